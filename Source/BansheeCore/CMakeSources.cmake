@@ -90,6 +90,7 @@ set(BS_BANSHEECORE_INC_PLATFORM
 	"Include/Win32/BsWin32Defs.h"
 	"Include/Win32/BSWin32PlatformData.h"
 	"Include/Win32/BsWin32Platform.h"
+	"Include/Linux/BsLinuxFolderMonitor.h"
 )
 
 set(BS_BANSHEECORE_INC_RENDERER
@@ -213,6 +214,8 @@ set(BS_BANSHEECORE_INC_RESOURCES
 set(BS_BANSHEECORE_SRC_UTILITY
 	"Source/BsUtility.cpp"
 	"Source/BsMeshUtility.cpp"
+	"Source/BsBVH.cpp"
+	"Source/BsMeshBVH.cpp"
 	"Source/BsDeferredCallManager.cpp"
 	"Source/BsDrawOps.cpp"
 	"Source/BsIconUtility.cpp"
@@ -226,6 +229,8 @@ set(BS_BANSHEECORE_INC_TEXT
 	"Include/BsFontImportOptions.h"
 	"Include/BsFontDesc.h"
 	"Include/BsFont.h"
+	"Include/BsFontRasterizer.h"
+	"Include/BsGlyphAtlas.h"
 )
 
 set(BS_BANSHEECORE_SRC_PROFILING
@@ -256,12 +261,17 @@ set(BS_BANSHEECORE_SRC_COMPONENTS
 )
 
 set(BS_BANSHEECORE_SRC_PLATFORM
-	"Source/Win32/BsWin32FolderMonitor.cpp"
 	"Source/BsPlatform.cpp"
 	"Source/Win32/BsWin32Platform.cpp"
 	"Source/Win32/BsWin32BrowseDialogs.cpp"
 )
 
+if(WIN32)
+	list(APPEND BS_BANSHEECORE_SRC_PLATFORM "Source/Win32/BsWin32FolderMonitor.cpp")
+elseif(UNIX AND NOT APPLE)
+	list(APPEND BS_BANSHEECORE_SRC_PLATFORM "Source/Linux/BsLinuxFolderMonitor.cpp")
+endif()
+
 set(BS_BANSHEECORE_SRC_IMPORTER
 	"Source/BsImporter.cpp"
 	"Source/BsImportOptions.cpp"
@@ -276,6 +286,8 @@ set(BS_BANSHEECORE_INC_UTILITY
 	"Include/BsCommonTypes.h"
 	"Include/BsUtility.h"
 	"Include/BsMeshUtility.h"
+	"Include/BsBVH.h"
+	"Include/BsMeshBVH.h"
 	"Include/BsDeferredCallManager.h"
 	"Include/BsIconUtility.h"
 	"Include/BsUUID.h"
@@ -409,6 +421,7 @@ set(BS_BANSHEECORE_SRC_TEXT
 	"Source/BsFont.cpp"
 	"Source/BsFontImportOptions.cpp"
 	"Source/BsFontManager.cpp"
+	"Source/BsGlyphAtlas.cpp"
 	"Source/BsTextData.cpp"
 )
 
@@ -511,6 +524,8 @@ set(BS_BANSHEECORE_SRC_AUDIO
 
 set(BS_BANSHEECORE_INC_ANIMATION
 	"Include/BsAnimationCurve.h"
+	"Include/BsAnimationCompression.h"
+	"Include/BsBakedAnimationCurves.h"
 	"Include/BsAnimationClip.h"
 	"Include/BsSkeleton.h"
 	"Include/BsAnimation.h"
@@ -523,6 +538,8 @@ set(BS_BANSHEECORE_INC_ANIMATION
 
 set(BS_BANSHEECORE_SRC_ANIMATION
 	"Source/BsAnimationCurve.cpp"
+	"Source/BsAnimationCompression.cpp"
+	"Source/BsBakedAnimationCurves.cpp"
 	"Source/BsAnimationClip.cpp"
 	"Source/BsSkeleton.cpp"
 	"Source/BsAnimation.cpp"
@@ -32,7 +32,8 @@ namespace BansheeEngine
 		Layout = 1 << 1,
 		All = 1 << 2,
 		Culling = 1 << 3,
-		MorphWeights = 1 << 4
+		MorphWeights = 1 << 4,
+		LOD = 1 << 5
 	};
 
 	typedef Flags<AnimDirtyStateFlag> AnimDirtyState;
@@ -119,6 +120,39 @@ namespace BansheeEngine
 		HAnimationClip botRightClip;
 	};
 
+	/** 
+	 * Level of detail used for evaluating skeletal animation. Level is chosen depending on how large the animation bounds
+	 * appear on screen, which allows distant or small animations to be evaluated less often and with fewer bones.
+	 */
+	struct AnimationLOD
+	{
+		AnimationLOD() { }
+		AnimationLOD(float screenSize, UINT32 updateInterval, UINT32 maxBones = 0)
+			:screenSize(screenSize), updateInterval(updateInterval), maxBones(maxBones)
+		{ }
+
+		/** 
+		 * Minimum size of the animation bounds on screen at which this level is used, as a fraction of the viewport 
+		 * height. Animations smaller than the smallest provided size use the level with the smallest size.
+		 */
+		float screenSize = 0.0f;
+
+		/** 
+		 * Number of animation updates between two evaluations of the skeleton pose. Updates in between interpolate
+		 * between the last two evaluated poses. Evaluation of different animations using the same interval is spread
+		 * across different updates. Value of 1 evaluates the pose on every update.
+		 */
+		UINT32 updateInterval = 1;
+
+		/** 
+		 * Maximum number of bones to evaluate, starting with bones closest to the root. Remaining bones keep their last
+		 * evaluated transform, relative to their parent. Value of 0 evaluates all bones.
+		 */
+		UINT32 maxBones = 0;
+	};
+
+	BS_ALLOW_MEMCPY_SERIALIZATION(AnimationLOD);
+
 	/** Contains a mapping between a scene object and an animation curve it is animated with. */
 	struct AnimatedSceneObject
 	{
@@ -239,6 +273,13 @@ namespace BansheeEngine
 		AABox mBounds;
 		bool mCullEnabled;
 
+		// Level of detail
+		Vector<AnimationLOD> lods; /**< Levels of detail, sorted from largest to smallest screen size. */
+		LocalSkeletonPose lodPoses[2]; /**< Last two evaluated poses, interpolated between when not evaluating every update. */
+		UINT32 lodLatestPoseIdx; /**< Index of the most recently evaluated pose in @p lodPoses. */
+		bool lodPosesValid; /**< True if both poses in @p lodPoses contain evaluated data. */
+		bool skeletonPoseValid; /**< True if all bones in @p skeletonPose have been evaluated at least once. */
+
 		// Evaluation results
 		LocalSkeletonPose skeletonPose;
 		LocalSkeletonPose sceneObjectPose;
@@ -303,6 +344,16 @@ namespace BansheeEngine
 		 */
 		void setCulling(bool cull);
 
+		/** 
+		 * Sets levels of detail that control how often, and for how many bones, is the skeletal animation evaluated, 
+		 * depending on how large the bounds provided in setBounds() appear on screen. Levels can be provided in any order.
+		 * Provide an empty list to evaluate all bones on every update.
+		 */
+		void setLODs(const Vector<AnimationLOD>& lods);
+
+		/** Returns levels of detail set by setLODs(). */
+		const Vector<AnimationLOD>& getLODs() const { return mLODs; }
+
 		/** 
 		 * Plays the specified animation clip. 
 		 *
@@ -497,6 +548,7 @@ namespace BansheeEngine
 		float mDefaultSpeed;
 		AABox mBounds;
 		bool mCull;
+		Vector<AnimationLOD> mLODs;
 		AnimDirtyState mDirty;
 
 		SPtr<Skeleton> mSkeleton;
@@ -7,6 +7,8 @@
 #include "BsVector3.h"
 #include "BsQuaternion.h"
 #include "BsAnimationCurve.h"
+#include "BsAnimationCompression.h"
+#include "BsBakedAnimationCurves.h"
 
 namespace BansheeEngine
 {
@@ -67,10 +69,66 @@ namespace BansheeEngine
 		/** Removes an existing curve from the clip. */
 		void removeGenericCurve(const String& name);
 
+		/** 
+		 * Evaluates the position curve at the specified index, using its baked or compressed version if one is 
+		 * available.
+		 *
+		 * @see TAnimationCurve::evaluate(float, const TCurveCache<T>&, bool) const
+		 */
+		Vector3 evaluatePosition(UINT32 idx, float time, const TCurveCache<Vector3>& cache, bool loop) const;
+
+		/** 
+		 * Evaluates the rotation curve at the specified index, using its baked or compressed version if one is 
+		 * available.
+		 *
+		 * @see TAnimationCurve::evaluate(float, const TCurveCache<T>&, bool) const
+		 */
+		Quaternion evaluateRotation(UINT32 idx, float time, const TCurveCache<Quaternion>& cache, bool loop) const;
+
+		/** 
+		 * Evaluates the scale curve at the specified index, using its baked or compressed version if one is 
+		 * available.
+		 *
+		 * @see TAnimationCurve::evaluate(float, const TCurveCache<T>&, bool) const
+		 */
+		Vector3 evaluateScale(UINT32 idx, float time, const TCurveCache<Vector3>& cache, bool loop) const;
+
+		/** 
+		 * Returns the position curve at the specified index. Compressed curves are decompressed, so the returned curve
+		 * contains keyframes even if the keyframes of the uncompressed version were released.
+		 */
+		TNamedAnimationCurve<Vector3> getPositionCurve(UINT32 idx) const;
+
+		/** @copydoc getPositionCurve */
+		TNamedAnimationCurve<Quaternion> getRotationCurve(UINT32 idx) const;
+
+		/** @copydoc getPositionCurve */
+		TNamedAnimationCurve<Vector3> getScaleCurve(UINT32 idx) const;
+
 		Vector<TNamedAnimationCurve<Vector3>> position;
 		Vector<TNamedAnimationCurve<Quaternion>> rotation;
 		Vector<TNamedAnimationCurve<Vector3>> scale;
 		Vector<TNamedAnimationCurve<float>> generic;
+
+		/** 
+		 * Compressed versions of the curves in @p position, @p rotation and @p scale. Either empty, or with an entry for
+		 * every curve in the respective uncompressed array. Curves with non-empty compressed versions are evaluated using
+		 * the compressed data, and the keyframes of their uncompressed versions are usually released.
+		 *
+		 * @see AnimationCompression
+		 */
+		Vector<TCompressedAnimationCurve<Vector3>> compressedPosition;
+		Vector<TCompressedAnimationCurve<Quaternion>> compressedRotation;
+		Vector<TCompressedAnimationCurve<Vector3>> compressedScale;
+
+		/** 
+		 * Optional pre-sampled version of the @p position, @p rotation and @p scale curves. When not empty it is used for
+		 * evaluating those curves, instead of both the compressed and uncompressed versions. Adding or removing any of
+		 * those curves clears the baked data.
+		 *
+		 * @see BakedAnimationCurves::bake
+		 */
+		BakedAnimationCurves baked;
 	};
 
 	/** Event that is triggered when animation reaches a certain point. */
@@ -63,6 +63,72 @@ namespace BansheeEngine
 		}
 	};
 
+	template<>
+	struct RTTIPlainType<BakedAnimationCurves>
+	{
+		enum { id = TID_BakedAnimationCurves }; enum { hasDynamicSize = 1 };
+
+		/** @copydoc RTTIPlainType::toMemory */
+		static void toMemory(const BakedAnimationCurves& data, char* memory)
+		{
+			UINT32 size = sizeof(UINT32);
+			char* memoryStart = memory;
+			memory += sizeof(UINT32);
+
+			UINT32 version = 0; // In case the data structure changes
+			memory = rttiWriteElem(version, memory, size);
+			memory = rttiWriteElem(data.mStart, memory, size);
+			memory = rttiWriteElem(data.mLength, memory, size);
+			memory = rttiWriteElem(data.mFrameRate, memory, size);
+			memory = rttiWriteElem(data.mNumFrames, memory, size);
+			memory = rttiWriteElem(data.mNumPositions, memory, size);
+			memory = rttiWriteElem(data.mNumRotations, memory, size);
+			memory = rttiWriteElem(data.mNumScales, memory, size);
+			memory = rttiWriteElem(data.mData, memory, size);
+
+			memcpy(memoryStart, &size, sizeof(UINT32));
+		}
+
+		/** @copydoc RTTIPlainType::fromMemory */
+		static UINT32 fromMemory(BakedAnimationCurves& data, char* memory)
+		{
+			UINT32 size = 0;
+			memory = rttiReadElem(size, memory);
+
+			UINT32 version;
+			memory = rttiReadElem(version, memory);
+
+			memory = rttiReadElem(data.mStart, memory);
+			memory = rttiReadElem(data.mLength, memory);
+			memory = rttiReadElem(data.mFrameRate, memory);
+			memory = rttiReadElem(data.mNumFrames, memory);
+			memory = rttiReadElem(data.mNumPositions, memory);
+			memory = rttiReadElem(data.mNumRotations, memory);
+			memory = rttiReadElem(data.mNumScales, memory);
+			memory = rttiReadElem(data.mData, memory);
+
+			return size;
+		}
+
+		/** @copydoc RTTIPlainType::getDynamicSize */
+		static UINT32 getDynamicSize(const BakedAnimationCurves& data)
+		{
+			UINT64 dataSize = sizeof(UINT32) + sizeof(UINT32);
+			dataSize += rttiGetElemSize(data.mStart);
+			dataSize += rttiGetElemSize(data.mLength);
+			dataSize += rttiGetElemSize(data.mFrameRate);
+			dataSize += rttiGetElemSize(data.mNumFrames);
+			dataSize += rttiGetElemSize(data.mNumPositions);
+			dataSize += rttiGetElemSize(data.mNumRotations);
+			dataSize += rttiGetElemSize(data.mNumScales);
+			dataSize += rttiGetElemSize(data.mData);
+
+			assert(dataSize <= std::numeric_limits<UINT32>::max());
+
+			return (UINT32)dataSize;
+		}
+	};
+
 	class BS_CORE_EXPORT AnimationClipRTTI : public RTTIType <AnimationClip, Resource, AnimationClipRTTI>
 	{
 	private:
@@ -75,6 +141,10 @@ namespace BansheeEngine
 			BS_RTTI_MEMBER_PLAIN(mLength, 5)
 			BS_RTTI_MEMBER_PLAIN(mEvents, 6)
 			BS_RTTI_MEMBER_PLAIN(mSampleRate, 7)
+			BS_RTTI_MEMBER_PLAIN_NAMED(compressedPositionCurves, mCurves->compressedPosition, 8)
+			BS_RTTI_MEMBER_PLAIN_NAMED(compressedRotationCurves, mCurves->compressedRotation, 9)
+			BS_RTTI_MEMBER_PLAIN_NAMED(compressedScaleCurves, mCurves->compressedScale, 10)
+			BS_RTTI_MEMBER_PLAIN_NAMED(bakedCurves, mCurves->baked, 11)
 		BS_END_RTTI_MEMBERS
 	public:
 		AnimationClipRTTI()
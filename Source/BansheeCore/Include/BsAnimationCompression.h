@@ -0,0 +1,136 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsAnimationCurve.h"
+#include "BsVector3.h"
+#include "BsQuaternion.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Animation-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Animation curve with keyframes stored in quantized form, requiring significantly less memory than TAnimationCurve.
+	 * Vector values and all tangents are quantized to 16 bits per component within the range of values in the curve,
+	 * while rotations are stored using the three smallest quaternion components. The curve can be evaluated directly,
+	 * without decompressing it first.
+	 *
+	 * Only Vector3 and Quaternion curves are supported.
+	 */
+	template <class T>
+	class BS_CORE_EXPORT TCompressedAnimationCurve // Note: Curves are expected to be immutable for threading purposes
+	{
+	public:
+		TCompressedAnimationCurve();
+
+		/** Creates a compressed version of the provided curve. */
+		TCompressedAnimationCurve(const TAnimationCurve<T>& curve);
+
+		/** @copydoc TAnimationCurve::evaluate(float, const TCurveCache<T>&, bool) const */
+		T evaluate(float time, const TCurveCache<T>& cache, bool loop = true) const;
+
+		/** Decompresses the curve back into a normal animation curve. */
+		TAnimationCurve<T> decompress() const;
+
+		/** Returns a decompressed keyframe at the specified index. */
+		TKeyframe<T> getKeyFrame(UINT32 idx) const;
+
+		/** Returns the total number of key-frames in the curve. */
+		UINT32 getNumKeyFrames() const { return (UINT32)mTimes.size(); }
+
+		/** Returns the length of the animation curve, from time zero to last keyframe. */
+		float getLength() const { return mEnd; }
+
+		/** @copydoc TAnimationCurve::getStart */
+		float getStart() const { return mStart; }
+
+		/** Checks does the curve contain any keyframes. */
+		bool isEmpty() const { return mTimes.empty(); }
+
+		/** Returns the number of bytes used for storing the keyframes. */
+		UINT32 getMemoryUsage() const;
+
+	private:
+		friend struct RTTIPlainType<TCompressedAnimationCurve<T>>;
+
+		/** Returns indices of the keys surrounding the provided time. Uses the cache to speed up the search if possible. */
+		void findKeys(float time, const TCurveCache<T>& cache, UINT32& leftKey, UINT32& rightKey) const;
+
+		/** Evaluates a value at the cached curve. Caller must ensure the time falls within the cached curve range. */
+		T evaluateCache(float time, const TCurveCache<T>& cache) const;
+
+		static const UINT32 CACHE_LOOKAHEAD;
+
+		Vector<float> mTimes;
+		Vector<UINT16> mValues;
+		Vector<UINT16> mTangents;
+
+		T mValueMin;
+		T mValueRange;
+		T mTangentMin;
+		T mTangentRange;
+
+		float mStart;
+		float mEnd;
+		float mLength;
+	};
+
+	/** Information about the results of compressing a set of animation curves. */
+	struct AnimationCompressionStats
+	{
+		UINT32 originalSize; /**< Size of the position, rotation and scale keyframes before compression, in bytes. */
+		UINT32 compressedSize; /**< Size of the position, rotation and scale keyframes after compression, in bytes. */
+		UINT32 originalNumKeys; /**< Number of keyframes before compression. */
+		UINT32 compressedNumKeys; /**< Number of keyframes after compression. */
+
+		float maxPositionError; /**< Maximum difference between original and compressed position curves, in units. */
+		float maxRotationError; /**< Maximum difference between original and compressed rotation curves, in radians. */
+		float maxScaleError; /**< Maximum difference between original and compressed scale curves. */
+
+		/** Time taken to sample all the original curves at the keyframes and between them, in microseconds. */
+		UINT64 originalEvaluationTime;
+		/** Time taken to sample all the compressed curves at the keyframes and between them, in microseconds. */
+		UINT64 compressedEvaluationTime;
+	};
+
+	/** Performs lossy compression of animation curves, to reduce their memory use and evaluation cost. */
+	class BS_CORE_EXPORT AnimationCompression
+	{
+	public:
+		/**
+		 * Removes keyframes from the curve that can be reconstructed by interpolating their neighbours, while keeping
+		 * the difference from the original curve within the provided error.
+		 *
+		 * @param[in]	curve		Curve to reduce.
+		 * @param[in]	maxError	Maximum allowed difference between the original and the reduced curve. For rotation
+		 *							curves this is the angle in radians, otherwise the distance between the values.
+		 * @return					Curve with redundant keyframes removed.
+		 */
+		template<class T>
+		static TAnimationCurve<T> reduceKeyframes(const TAnimationCurve<T>& curve, float maxError);
+
+		/**
+		 * Compresses all position, rotation and scale curves in the provided set of curves. Each curve first has its
+		 * redundant keyframes removed, after which it is quantized. The compressed curves replace the original ones,
+		 * whose keyframes are released.
+		 *
+		 * The allowed errors apply to the quantized curves. Curves whose quantized error exceeds them are reduced again
+		 * with a tighter tolerance. Errors reported in the returned statistics include both keyframe reduction and
+		 * quantization, and can exceed the allowed errors if quantization alone does.
+		 *
+		 * @param[in, out]	curves				Curves to compress.
+		 * @param[in]		maxPositionError	Maximum allowed error of compressed position curves, in units.
+		 * @param[in]		maxRotationError	Maximum allowed error of compressed rotation curves, in radians.
+		 * @param[in]		maxScaleError		Maximum allowed error of compressed scale curves.
+		 * @return								Statistics about the memory saved and the error introduced.
+		 */
+		static AnimationCompressionStats compress(AnimationCurves& curves, float maxPositionError = 0.0001f,
+			float maxRotationError = 0.0001f, float maxScaleError = 0.0001f);
+	};
+
+	/** @} */
+}
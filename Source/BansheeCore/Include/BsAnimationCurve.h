@@ -90,6 +90,9 @@ namespace BansheeEngine
 		/** Returns the length of the animation curve, from time zero to last keyframe. */
 		float getLength() const { return mEnd; }
 
+		/** Returns the time of the first keyframe in the curve. */
+		float getStart() const { return mStart; }
+
 		/** Returns the total number of key-frames in the curve. */
 		UINT32 getNumKeyFrames() const { return (UINT32)mKeyframes.size(); }
 
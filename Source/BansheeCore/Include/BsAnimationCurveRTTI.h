@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "BsRTTIType.h"
 #include "BsAnimationCurve.h"
+#include "BsAnimationCompression.h"
 
 namespace BansheeEngine
 {
@@ -98,6 +99,77 @@ namespace BansheeEngine
 		}
 	};
 
+	template<class T> struct RTTIPlainType<TCompressedAnimationCurve<T>>
+	{
+		enum { id = TID_CompressedAnimationCurve }; enum { hasDynamicSize = 1 };
+
+		/** @copydoc RTTIPlainType::toMemory */
+		static void toMemory(const TCompressedAnimationCurve<T>& data, char* memory)
+		{
+			UINT32 size = sizeof(UINT32);
+			char* memoryStart = memory;
+			memory += sizeof(UINT32);
+
+			UINT32 version = 0; // In case the data structure changes
+			memory = rttiWriteElem(version, memory, size);
+			memory = rttiWriteElem(data.mStart, memory, size);
+			memory = rttiWriteElem(data.mEnd, memory, size);
+			memory = rttiWriteElem(data.mLength, memory, size);
+			memory = rttiWriteElem(data.mValueMin, memory, size);
+			memory = rttiWriteElem(data.mValueRange, memory, size);
+			memory = rttiWriteElem(data.mTangentMin, memory, size);
+			memory = rttiWriteElem(data.mTangentRange, memory, size);
+			memory = rttiWriteElem(data.mTimes, memory, size);
+			memory = rttiWriteElem(data.mValues, memory, size);
+			memory = rttiWriteElem(data.mTangents, memory, size);
+
+			memcpy(memoryStart, &size, sizeof(UINT32));
+		}
+
+		/** @copydoc RTTIPlainType::fromMemory */
+		static UINT32 fromMemory(TCompressedAnimationCurve<T>& data, char* memory)
+		{
+			UINT32 size = 0;
+			memory = rttiReadElem(size, memory);
+
+			UINT32 version;
+			memory = rttiReadElem(version, memory);
+
+			memory = rttiReadElem(data.mStart, memory);
+			memory = rttiReadElem(data.mEnd, memory);
+			memory = rttiReadElem(data.mLength, memory);
+			memory = rttiReadElem(data.mValueMin, memory);
+			memory = rttiReadElem(data.mValueRange, memory);
+			memory = rttiReadElem(data.mTangentMin, memory);
+			memory = rttiReadElem(data.mTangentRange, memory);
+			memory = rttiReadElem(data.mTimes, memory);
+			memory = rttiReadElem(data.mValues, memory);
+			memory = rttiReadElem(data.mTangents, memory);
+
+			return size;
+		}
+
+		/** @copydoc RTTIPlainType::getDynamicSize */
+		static UINT32 getDynamicSize(const TCompressedAnimationCurve<T>& data)
+		{
+			UINT64 dataSize = sizeof(UINT32) + sizeof(UINT32);
+			dataSize += rttiGetElemSize(data.mStart);
+			dataSize += rttiGetElemSize(data.mEnd);
+			dataSize += rttiGetElemSize(data.mLength);
+			dataSize += rttiGetElemSize(data.mValueMin);
+			dataSize += rttiGetElemSize(data.mValueRange);
+			dataSize += rttiGetElemSize(data.mTangentMin);
+			dataSize += rttiGetElemSize(data.mTangentRange);
+			dataSize += rttiGetElemSize(data.mTimes);
+			dataSize += rttiGetElemSize(data.mValues);
+			dataSize += rttiGetElemSize(data.mTangents);
+
+			assert(dataSize <= std::numeric_limits<UINT32>::max());
+
+			return (UINT32)dataSize;
+		}
+	};
+
 	template<class T> struct RTTIPlainType<TNamedAnimationCurve<T>>
 	{
 		enum { id = TID_NamedAnimationCurve }; enum { hasDynamicSize = 1 };
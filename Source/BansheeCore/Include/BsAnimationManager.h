@@ -11,6 +11,7 @@
 namespace BansheeEngine
 {
 	struct AnimationProxy;
+	struct AnimationLOD;
 
 	/** @addtogroup Animation-Internal
 	 *  @{
@@ -70,6 +71,17 @@ namespace BansheeEngine
 		 */
 		void setUpdateRate(UINT32 fps);
 
+		/** 
+		 * Determines when can animations share an evaluated skeleton pose. Animations using the same skeleton, mask and
+		 * set of playing clips share the pose if the times of their clips fall within the same time step. Sharing 
+		 * animations are evaluated once per update, and reference the same bone transforms. Larger time steps allow more
+		 * animations to share a pose (e.g. a crowd playing the same cycle with small offsets), at the cost of accuracy.
+		 *
+		 * @param[in]	timeStep	Time step in seconds. Zero only shares poses of animations at exactly the same time, 
+		 *							while a negative value disables pose sharing. Default is zero.
+		 */
+		void setPoseSharingTimeStep(float timeStep);
+
 		/** 
 		 * Synchronizes animation data from the animation thread with the scene objects. Should be called before component
 		 * updates are sent. 
@@ -99,6 +111,22 @@ namespace BansheeEngine
 		 */
 		const RendererAnimationData& getRendererData();
 
+		/**
+		 * Evaluates skeleton poses of the provided animations immediately, the same way the animation thread would during
+		 * an update with the provided index. Culling is not performed, and scene object, generic curve and morph shape 
+		 * outputs are not evaluated.
+		 *
+		 * @param[in]	animations	Animations to evaluate. Must not be evaluated by the animation thread at the same time.
+		 * @param[in]	timeDelta	Time to advance the animations by before evaluating, in seconds.
+		 * @param[in]	updateIdx	Index of the animation update. Determines on which updates animations with a reduced
+		 *							update rate evaluate a new pose.
+		 * @param[out]	output		Output pose for each animation, and the bone transforms they reference.
+		 *
+		 * @note	Internal method. Sim thread only. Used for testing.
+		 */
+		void _evaluatePoses(const Vector<SPtr<Animation>>& animations, float timeDelta, UINT32 updateIdx, 
+			RendererAnimationData& output);
+
 	private:
 		friend class Animation;
 
@@ -113,6 +141,57 @@ namespace BansheeEngine
 		/** Worker method ran on the animation thread that evaluates all animation at the provided time. */
 		void evaluateAnimation();
 
+		/**
+		 * Evaluates skeleton poses of the provided animations, applying their level of detail and sharing poses between
+		 * animations that evaluate to the same pose.
+		 *
+		 * @param[in]	anims		Animations to evaluate.
+		 * @param[in]	updateIdx	Index of the animation update. Determines on which updates animations with a reduced
+		 *							update rate evaluate a new pose.
+		 * @param[out]	transforms	Bone transforms of all evaluated poses. Shared poses are only output once.
+		 * @param[out]	poseInfos	Information about the pose of each animation in @p anims, referencing @p transforms.
+		 */
+		void evaluatePoses(const Vector<AnimationProxy*>& anims, UINT32 updateIdx, Vector<Matrix4>& transforms,
+			Vector<RendererAnimationData::PoseInfo>& poseInfos) const;
+
+		/** 
+		 * Selects a level of detail for the animation depending on how large its bounds appear in any of the cameras.
+		 * Returns null if the animation has no levels of detail.
+		 */
+		const AnimationLOD* selectLOD(const AnimationProxy& anim) const;
+
+		/** 
+		 * Returns mesh data for storing evaluated morph shape vertices. Reuses pooled mesh data no longer referenced by
+		 * any renderer data, if available.
+		 */
+		SPtr<MeshData> getMorphShapeMesh(UINT32 numVertices);
+
+		/** Mesh data used for morph shape output, stored in a pool. */
+		struct MorphShapeMesh
+		{
+			SPtr<MeshData> meshData;
+			UINT32 lastUsedUpdate;
+		};
+
+		/** Information about a skeleton pose evaluated during the current update, that can be shared by animations. */
+		struct SharedPoseInfo
+		{
+			const AnimationProxy* anim;
+			UINT32 startIdx;
+		};
+
+		/** Information about a camera used for determining animation level of detail. */
+		struct LODCameraInfo
+		{
+			Vector3 position;
+			/** 
+			 * Factor that converts bounds radius into a fraction of the viewport height. For perspective cameras the
+			 * radius must also be divided by the distance from the camera.
+			 */
+			float screenScale; 
+			bool orthographic;
+		};
+
 		UINT64 mNextId;
 		UnorderedMap<UINT64, Animation*> mAnimations;
 		
@@ -120,6 +199,8 @@ namespace BansheeEngine
 		float mAnimationTime;
 		float mLastAnimationUpdateTime;
 		float mNextAnimationUpdateTime;
+		UINT32 mUpdateCount;
+		float mPoseSharingTimeStep;
 		bool mPaused;
 
 		bool mWorkerRunning;
@@ -128,7 +209,11 @@ namespace BansheeEngine
 
 		// Animation thread
 		Vector<SPtr<AnimationProxy>> mProxies;
+		Vector<AnimationProxy*> mVisibleProxies; // Transient
+		Vector<RendererAnimationData::PoseInfo> mPoseInfos; // Transient
 		Vector<ConvexVolume> mCullFrustums;
+		Vector<LODCameraInfo> mLODCameras;
+		Vector<MorphShapeMesh> mMorphShapeMeshes;
 		RendererAnimationData mAnimData[CoreThread::NUM_SYNC_BUFFERS];
 
 		UINT32 mPoseReadBufferIdx;
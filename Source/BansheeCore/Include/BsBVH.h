@@ -0,0 +1,174 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsAABox.h"
+#include "BsRay.h"
+#include "BsConvexVolume.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Utility-Core-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Bounding volume hierarchy built over a set of primitives represented by their axis aligned bounds. Allows ray and
+	 * volume queries to only visit the primitives whose bounds might be intersected, instead of all of them. The 
+	 * hierarchy doesn't know anything about the primitives themselves, and exact tests against them are left to the 
+	 * caller.
+	 */
+	class BS_CORE_EXPORT BVH
+	{
+		/** Single node in the hierarchy. Left child of an interior node always immediately follows its parent. */
+		struct Node
+		{
+			AABox bounds;
+			UINT32 start; /**< First primitive for leaf nodes, or index of the right child for interior nodes. */
+			UINT32 count; /**< Number of primitives in a leaf, or zero for interior nodes. */
+		};
+
+	public:
+		/**
+		 * Builds the hierarchy over the provided primitives, replacing any previous contents.
+		 *
+		 * @param[in]	bounds			Bounds of each primitive. Primitives are referenced by their index in this array.
+		 * @param[in]	maxLeafSize		Maximum number of primitives stored in a single leaf node.
+		 */
+		void build(const Vector<AABox>& bounds, UINT32 maxLeafSize = 4);
+
+		/** Removes all the nodes and primitives from the hierarchy. */
+		void clear();
+
+		/** Checks if the hierarchy contains any primitives. */
+		bool isEmpty() const { return mNodes.empty(); }
+
+		/** Returns the bounds encompassing all the primitives in the hierarchy. */
+		AABox getBounds() const { return mNodes.empty() ? AABox::BOX_EMPTY : mNodes[0].bounds; }
+
+		/** Returns the number of bytes used by the hierarchy. */
+		UINT32 getMemoryUsage() const;
+
+		/**
+		 * Finds primitives whose bounds are intersected by the ray. Nodes are visited front to back, and nodes further 
+		 * away than the closest hit found so far are skipped.
+		 *
+		 * @param[in]		ray			Ray to test. Doesn't need to be normalized, in which case all the distances are in
+		 *								units of the ray direction length.
+		 * @param[in, out]	distance	Maximum distance along the ray to search. Should be updated by @p visitor when a
+		 *								closer hit is found.
+		 * @param[in]		visitor		Callable with signature void(UINT32 primitiveIdx, float& distance), called for each
+		 *								primitive whose leaf is hit.
+		 */
+		template<class Visitor>
+		void intersects(const Ray& ray, float& distance, Visitor visitor) const
+		{
+			if (mNodes.empty())
+				return;
+
+			auto rootHit = mNodes[0].bounds.intersects(ray);
+			if (!rootHit.first || rootHit.second > distance)
+				return;
+
+			UINT32 stack[64];
+			UINT32 stackSize = 0;
+			stack[stackSize++] = 0;
+
+			while (stackSize > 0)
+			{
+				const Node& node = mNodes[stack[--stackSize]];
+
+				if (node.count > 0)
+				{
+					for (UINT32 i = 0; i < node.count; i++)
+						visitor(mPrimitives[node.start + i], distance);
+
+					continue;
+				}
+
+				UINT32 leftIdx = (UINT32)(&node - &mNodes[0]) + 1;
+				UINT32 rightIdx = node.start;
+
+				auto leftHit = mNodes[leftIdx].bounds.intersects(ray);
+				auto rightHit = mNodes[rightIdx].bounds.intersects(ray);
+
+				bool visitLeft = leftHit.first && leftHit.second <= distance;
+				bool visitRight = rightHit.first && rightHit.second <= distance;
+
+				// Push the further child first, so the nearer one is visited first and can shorten the search
+				if (visitLeft && visitRight)
+				{
+					if (leftHit.second < rightHit.second)
+					{
+						stack[stackSize++] = rightIdx;
+						stack[stackSize++] = leftIdx;
+					}
+					else
+					{
+						stack[stackSize++] = leftIdx;
+						stack[stackSize++] = rightIdx;
+					}
+				}
+				else if (visitLeft)
+					stack[stackSize++] = leftIdx;
+				else if (visitRight)
+					stack[stackSize++] = rightIdx;
+			}
+		}
+
+		/**
+		 * Finds primitives whose bounds intersect the provided volume.
+		 *
+		 * @param[in]	volume		Volume to test.
+		 * @param[in]	visitor		Callable with signature bool(UINT32 primitiveIdx), called for each primitive in the
+		 *							leaves intersecting the volume. Returning false stops the search.
+		 */
+		template<class Visitor>
+		void intersects(const ConvexVolume& volume, Visitor visitor) const
+		{
+			if (mNodes.empty())
+				return;
+
+			UINT32 stack[64];
+			UINT32 stackSize = 0;
+			stack[stackSize++] = 0;
+
+			while (stackSize > 0)
+			{
+				UINT32 nodeIdx = stack[--stackSize];
+				const Node& node = mNodes[nodeIdx];
+
+				if (!volume.intersects(node.bounds))
+					continue;
+
+				if (node.count > 0)
+				{
+					for (UINT32 i = 0; i < node.count; i++)
+					{
+						if (!visitor(mPrimitives[node.start + i]))
+							return;
+					}
+
+					continue;
+				}
+
+				stack[stackSize++] = node.start;
+				stack[stackSize++] = nodeIdx + 1;
+			}
+		}
+
+	private:
+		/** Recursively builds the node for the primitives in range [start, end) of mPrimitives. */
+		void buildNode(UINT32 start, UINT32 end, const Vector<AABox>& bounds, const Vector<Vector3>& centers, 
+			UINT32 maxLeafSize, UINT32 depth);
+
+		/** Maximum depth of the tree. Limited so traversal can use a fixed size stack. */
+		static const UINT32 MAX_DEPTH = 60;
+
+		Vector<Node> mNodes;
+		Vector<UINT32> mPrimitives;
+	};
+
+	/** @} */
+}
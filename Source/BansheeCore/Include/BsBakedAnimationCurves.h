@@ -0,0 +1,108 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsVector3.h"
+#include "BsQuaternion.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Animation-Internal
+	 *  @{
+	 */
+
+	/** Information about the results of baking a set of animation curves. */
+	struct AnimationBakingStats
+	{
+		UINT32 numFrames; /**< Number of frames the curves were sampled into. */
+		UINT32 bakedSize; /**< Size of the baked samples, in bytes. */
+
+		float maxPositionError; /**< Maximum difference between original and baked position curves, in units. */
+		float maxRotationError; /**< Maximum difference between original and baked rotation curves, in radians. */
+		float maxScaleError; /**< Maximum difference between original and baked scale curves. */
+
+		/** Time taken to evaluate all the original curves at the measurement points, in microseconds. */
+		UINT64 originalEvaluationTime;
+		/** Time taken to evaluate all the baked curves at the measurement points, in microseconds. */
+		UINT64 bakedEvaluationTime;
+	};
+
+	/**
+	 * Position, rotation and scale curves of an animation clip pre-sampled at evenly spaced intervals. Evaluation doesn't
+	 * require a keyframe search and is performed by interpolating between the two samples surrounding the requested time,
+	 * regardless of whether the animation is played forward, backwards or randomly seeked.
+	 *
+	 * All values of a single frame are stored sequentially, so evaluating all the curves at the same time reads from a
+	 * small contiguous block of memory. Since all curves share the same frames they are sampled and looped over a single
+	 * time range, and only sets of curves whose keyframes all span the same range can be baked.
+	 */
+	class BS_CORE_EXPORT BakedAnimationCurves // Note: Curves are expected to be immutable for threading purposes
+	{
+	public:
+		BakedAnimationCurves();
+
+		/**
+		 * Evaluates the baked position curve at the specified index.
+		 *
+		 * @param[in]	idx		Index of the curve, same as the index of its original in AnimationCurves::position.
+		 * @param[in]	time	Time to evaluate the curve at.
+		 * @param[in]	loop	If true the curve will loop when it goes past the end or beginning. Otherwise the curve
+		 *						value will be clamped.
+		 * @return				Interpolated value from the curve at provided time.
+		 */
+		Vector3 evaluatePosition(UINT32 idx, float time, bool loop) const;
+
+		/** @copydoc evaluatePosition */
+		Quaternion evaluateRotation(UINT32 idx, float time, bool loop) const;
+
+		/** @copydoc evaluatePosition */
+		Vector3 evaluateScale(UINT32 idx, float time, bool loop) const;
+
+		/** Returns the number of frames the curves were sampled into. */
+		UINT32 getNumFrames() const { return mNumFrames; }
+
+		/** Checks does the object contain any baked samples. */
+		bool isEmpty() const { return mNumFrames == 0; }
+
+		/** Returns the number of bytes used for storing the samples. */
+		UINT32 getMemoryUsage() const { return (UINT32)(mData.size() * sizeof(float)); }
+
+		/**
+		 * Samples all position, rotation and scale curves in the provided set of curves at evenly spaced intervals, and
+		 * stores the results in AnimationCurves::baked. Baked curves are used for evaluation from then on, while the
+		 * original curves are retained.
+		 *
+		 * Curves aren't baked if their first or last keyframes don't fall at the same times, as they would loop
+		 * differently than the original curves. A warning is logged and the returned statistics report zero frames.
+		 *
+		 * @param[in, out]	curves		Curves to bake.
+		 * @param[in]		sampleRate	Number of samples per second. Usually the sample rate of the animation clip.
+		 * @return						Statistics about the memory used, and the error and speedup compared to the
+		 *								original curves.
+		 */
+		static AnimationBakingStats bake(AnimationCurves& curves, UINT32 sampleRate);
+
+	private:
+		friend struct RTTIPlainType<BakedAnimationCurves>;
+
+		/**
+		 * Finds the samples surrounding the provided time. Returns the offsets at which the frames start in the sample
+		 * array, and the interpolation factor between them.
+		 */
+		void findFrames(float time, bool loop, UINT32& leftOffset, UINT32& rightOffset, float& t) const;
+
+		float mStart;
+		float mLength;
+		float mFrameRate;
+		UINT32 mNumFrames;
+
+		UINT32 mNumPositions;
+		UINT32 mNumRotations;
+		UINT32 mNumScales;
+
+		Vector<float> mData;
+	};
+
+	/** @} */
+}
@@ -282,6 +282,9 @@ namespace BansheeEngine
 	class GpuProgramImportOptions;
 	class MeshImportOptions;
 	struct FontBitmap;
+	class FontRasterizer;
+	class FontRasterizerFactory;
+	class GlyphAtlas;
 	class GameObject;
 	class GpuResourceData;
 	struct RenderOperation;
@@ -301,6 +304,8 @@ namespace BansheeEngine
 	class MeshCoreBase;
 	class MeshCore;
 	struct SubMesh;
+	struct MeshLOD;
+	struct MeshVertexCompression;
 	class TransientMeshCore;
 	class TextureCore;
 	class MeshHeapCore;
@@ -367,7 +372,9 @@ namespace BansheeEngine
 	class AnimationClip;
 	class CCamera;
 	template <class T> class TAnimationCurve;
+	template <class T> class TCompressedAnimationCurve;
 	struct AnimationCurves;
+	class BakedAnimationCurves;
 	class Skeleton;
 	class Animation;
 	class GpuParamsSet;
@@ -377,6 +384,7 @@ namespace BansheeEngine
 	class CameraCore;
 	class MorphShapes;
 	class MorphShape;
+	class MeshBVH;
 	// Asset import
 	class SpecificImporter;
 	class Importer;
@@ -387,6 +395,7 @@ namespace BansheeEngine
 	class Texture;
 	class Mesh;
 	class MeshBase;
+	class MeshProperties;
 	class TransientMesh;
 	class MeshHeap;
 	class Font;
@@ -543,6 +552,9 @@ namespace BansheeEngine
 		TID_PostProcessSettings = 1127,
 		TID_MorphShape = 1128,
 		TID_MorphShapes = 1129,
+		TID_CompressedAnimationCurve = 1130,
+		TID_BakedAnimationCurves = 1131,
+		TID_MeshLOD = 1132,
 
 		// Moved from Engine layer
 		TID_CCamera = 30000,
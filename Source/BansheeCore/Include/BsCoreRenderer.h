@@ -35,6 +35,10 @@ namespace BansheeEngine
 	static StringID RPS_WorldNoScaleTfrm = "WNoScale";
 	static StringID RPS_InvWorldNoScaleTfrm = "IWNoScale";
 	static StringID RPS_WorldDeterminantSign = "WorldDeterminantSign";
+	static StringID RPS_OctahedralNormals = "OctahedralNormals";
+	static StringID RPS_PositionScale = "PositionScale";
+	static StringID RPS_PositionOffset = "PositionOffset";
+	static StringID RPS_UVScaleOffset = "UVScaleOffset";
 	static StringID RPS_Diffuse = "Diffuse";
 	static StringID RPS_ViewDir = "ViewDir";
 
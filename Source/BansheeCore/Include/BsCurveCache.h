@@ -25,6 +25,7 @@ namespace BansheeEngine
 
 	private:
 		friend class TAnimationCurve<T>;
+		friend class TCompressedAnimationCurve<T>;
 
 		mutable UINT32 cachedKey; /**< Left-most key the curve was last evaluated at. -1 if no cached data. */
 		mutable float cachedCurveStart; /**< Time relative to the animation curve, at which the cached data starts. */
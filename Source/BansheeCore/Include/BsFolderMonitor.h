@@ -6,4 +6,6 @@
 
 #if BS_PLATFORM == BS_PLATFORM_WIN32
 #include "Win32/BsWin32FolderMonitor.h"
+#elif BS_PLATFORM == BS_PLATFORM_LINUX
+#include "Linux/BsLinuxFolderMonitor.h"
 #endif
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "BsResource.h"
 #include "BsFontDesc.h"
+#include "BsEvent.h"
 
 namespace BansheeEngine
 {
@@ -37,7 +38,13 @@ namespace BansheeEngine
 	// Also, changing the source texture will not automatically update the font because there is no direct link between them.
 	// -- This is probably not a large problem, but it is something to keep an eye out.
 
-	/**	Font resource containing data about textual characters and how to render text. */
+	/**
+	 * Font resource containing data about textual characters and how to render text.
+	 *
+	 * Fonts are either static, containing a fixed set of characters pre-rendered for specific sizes, or dynamic. Dynamic
+	 * fonts keep the source font data and render characters of any size on demand into a glyph atlas shared by all
+	 * dynamic fonts.
+	 */
 	class BS_CORE_EXPORT Font : public Resource
 	{
 	public:
@@ -50,12 +57,24 @@ namespace BansheeEngine
 		 */
 		SPtr<const FontBitmap> getBitmap(UINT32 size) const;
 
-		/**	Finds the available font bitmap size closest to the provided size. */
+		/**	Finds the available font bitmap size closest to the provided size. Dynamic fonts support all sizes. */
 		INT32 getClosestSize(UINT32 size) const;
 
+		/** Checks is this a dynamic font that renders characters on demand. */
+		bool isDynamic() const { return mIsDynamic; }
+
 		/**	Creates a new font from the provided per-size font data. */
 		static HFont create(const Vector<SPtr<FontBitmap>>& fontInitData);
 
+		/**
+		 * Creates a new dynamic font.
+		 *
+		 * @param[in]	sourceData	Contents of a font file in a format supported by the active font rasterizer.
+		 * @param[in]	dpi			Dots per inch resolution to use when rendering the characters.
+		 * @param[in]	renderMode	Determines how are the characters rendered.
+		 */
+		static HFont createDynamic(const Vector<UINT8>& sourceData, UINT32 dpi, FontRenderMode renderMode);
+
 	public: // ***** INTERNAL ******
 		using Resource::initialize;
 
@@ -70,9 +89,26 @@ namespace BansheeEngine
 		 */
 		void initialize(const Vector<SPtr<FontBitmap>>& fontData);
 
+		/**
+		 * Initializes the font as a dynamic font.
+		 *
+		 * @note	Internal method. Factory methods will call this automatically for you.
+		 */
+		void initializeDynamic(const Vector<UINT8>& sourceData, UINT32 dpi, FontRenderMode renderMode);
+
 		/** Creates a new font as a pointer instead of a resource handle. */
 		static SPtr<Font> _createPtr(const Vector<SPtr<FontBitmap>>& fontInitData);
 
+		/** Creates a new dynamic font as a pointer instead of a resource handle. */
+		static SPtr<Font> _createDynamicPtr(const Vector<UINT8>& sourceData, UINT32 dpi, FontRenderMode renderMode);
+
+		/**
+		 * Makes sure all the characters in the provided text are rendered for the provided size, so they can be retrieved
+		 * from the bitmap returned by getBitmap(). Marks the atlas pages containing the characters as in use for the
+		 * current frame. Does nothing for static fonts.
+		 */
+		void _prepareGlyphs(UINT32 size, const WString& text);
+
 		/** @} */
 
 	protected:
@@ -87,8 +123,43 @@ namespace BansheeEngine
 		void getCoreDependencies(Vector<CoreObject*>& dependencies) override;
 
 	private:
+		/** Additional per-size information about a dynamic font. */
+		struct DynamicSizeData
+		{
+			DynamicSizeData()
+				:hasMissingGlyph(false)
+			{ }
+
+			UnorderedSet<UINT32> missingChars; /**< Characters not present in the font. */
+			bool hasMissingGlyph; /**< True if the missing glyph has been rendered into the atlas. */
+
+			/** Kerning amounts of character pairs already queried from the rasterizer, keyed by both character IDs. */
+			UnorderedMap<UINT64, INT32> kerningCache;
+		};
+
+		/** Returns the kerning between two characters of a dynamic font. Results are cached per font size. */
+		INT32 getKerning(UINT32 size, UINT32 leftCharId, UINT32 rightCharId);
+
+		/** 
+		 * Renders a character into the glyph atlas and fills out its description. Returns false if the font doesn't 
+		 * contain the character, or there was no space for it in the atlas (in which case @p notInFont is false).
+		 */
+		bool rasterizeGlyph(UINT32 size, UINT32 charId, CHAR_DESC& desc, bool& notInFont);
+
+		/** Removes all characters stored on the provided glyph atlas page. */
+		void onGlyphPageEvicted(UINT32 page);
+
 		Map<UINT32, SPtr<FontBitmap>> mFontDataPerSize;
 
+		bool mIsDynamic;
+		Vector<UINT8> mSourceData;
+		UINT32 mDPI;
+		FontRenderMode mRenderMode;
+		SPtr<FontRasterizer> mRasterizer;
+		Map<UINT32, DynamicSizeData> mDynamicSizeData;
+		HEvent mPageEvictedConn;
+		Vector<UINT8> mGlyphPixels; // Transient
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -12,15 +12,6 @@ namespace BansheeEngine
 	 *  @{
 	 */
 
-	/**	Determines how is a font rendered into the bitmap texture. */
-	enum class FontRenderMode
-	{
-		Smooth, /*< Render antialiased fonts without hinting (slightly more blurry). */
-		Raster, /*< Render non-antialiased fonts without hinting (slightly more blurry). */
-		HintedSmooth, /*< Render antialiased fonts with hinting. */
-		HintedRaster /*< Render non-antialiased fonts with hinting. */
-	};
-
 	/**	Import options that allow you to control how is a font imported. */
 	class BS_CORE_EXPORT FontImportOptions : public ImportOptions
 	{
@@ -48,6 +39,13 @@ namespace BansheeEngine
 		/**	Sets whether the italic font style should be used when rendering. */
 		void setItalic(bool italic) { mItalic = italic; }
 
+		/**
+		 * Determines should the font be imported as a dynamic font. Dynamic fonts don't bake any characters during import,
+		 * and instead rasterize characters of any size on demand when they are first displayed. Font sizes and character
+		 * ranges are ignored for dynamic fonts.
+		 */
+		void setDynamic(bool dynamic) { mDynamic = dynamic; }
+
 		/**	Gets the sizes that are to be imported. Ranges are defined as unicode numbers. */
 		Vector<UINT32> getFontSizes() const { return mFontSizes; }
 
@@ -66,6 +64,9 @@ namespace BansheeEngine
 		/**	Sets whether the italic font style should be used when rendering. */
 		bool getItalic() const { return mItalic; }
 
+		/** Checks should the font be imported as a dynamic font. */
+		bool getDynamic() const { return mDynamic; }
+
 	private:
 		Vector<UINT32> mFontSizes;
 		Vector<std::pair<UINT32, UINT32>> mCharIndexRanges;
@@ -73,6 +74,7 @@ namespace BansheeEngine
 		FontRenderMode mRenderMode;
 		bool mBold;
 		bool mItalic;
+		bool mDynamic;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
@@ -4,6 +4,7 @@
 
 #include "BsCorePrerequisites.h"
 #include "BsModule.h"
+#include "BsFontDesc.h"
 
 namespace BansheeEngine
 {
@@ -11,19 +12,54 @@ namespace BansheeEngine
 	 *  @{
 	 */
 
-	/**	Handles creation of fonts. */
+	/**	Handles creation of fonts, and owns the glyph atlas used by dynamic fonts. */
 	class BS_CORE_EXPORT FontManager : public Module<FontManager>
 	{
 	public:
+		FontManager();
+		~FontManager();
+
 		/**	Creates a new font from the provided populated font data structure. */
 		SPtr<Font> create(const Vector<SPtr<FontBitmap>>& fontData) const;
 
+		/** 
+		 * Creates a new dynamic font from the provided font file contents.
+		 *
+		 * @see		Font::createDynamic
+		 */
+		SPtr<Font> createDynamic(const Vector<UINT8>& sourceData, UINT32 dpi, FontRenderMode renderMode) const;
+
+		/** 
+		 * Registers a factory used for creating rasterizers of dynamic fonts. Normally called by a plugin capable of
+		 * rendering font files.
+		 */
+		void setRasterizerFactory(const SPtr<FontRasterizerFactory>& factory) { mRasterizerFactory = factory; }
+
+		/** Returns the factory used for creating rasterizers of dynamic fonts. Null if no factory is registered. */
+		const SPtr<FontRasterizerFactory>& getRasterizerFactory() const { return mRasterizerFactory; }
+
+		/** Returns the atlas all dynamic fonts render their characters into. */
+		GlyphAtlas& getGlyphAtlas() const { return *mGlyphAtlas; }
+
 		/**
 		 * Creates an empty font.
 		 *
 		 * @note	Internal method. Used by factory methods.
 		 */
 		SPtr<Font> _createEmpty() const;
+
+		/** Uploads characters rendered during this frame to the GPU. Called once per frame. */
+		void _update();
+
+	private:
+		/** Width and height of a single glyph atlas page, in pixels. */
+		static const UINT32 GLYPH_ATLAS_PAGE_SIZE;
+
+		/** Maximum number of pages in the glyph atlas, before least recently used pages start getting evicted. */
+		static const UINT32 GLYPH_ATLAS_MAX_PAGES;
+
+		SPtr<FontRasterizerFactory> mRasterizerFactory;
+		GlyphAtlas* mGlyphAtlas;
 	};
 
 	/** @} */
@@ -7,6 +7,7 @@
 #include "BsFont.h"
 #include "BsFontManager.h"
 #include "BsTexture.h"
+#include "BsDataStream.h"
 
 namespace BansheeEngine
 {
@@ -60,6 +61,7 @@ namespace BansheeEngine
 		struct FontInitData
 		{
 			Vector<SPtr<FontBitmap>> fontDataPerSize;
+			Vector<UINT8> sourceData;
 		};
 
 	private:
@@ -85,6 +87,10 @@ namespace BansheeEngine
 
 		UINT32 getNumBitmaps(Font* obj)
 		{
+			// Bitmaps of dynamic fonts are generated at runtime
+			if (obj->mIsDynamic)
+				return 0;
+
 			return (UINT32)obj->mFontDataPerSize.size();
 		}
 
@@ -95,10 +101,40 @@ namespace BansheeEngine
 			initData->fontDataPerSize.resize(size);
 		}
 
+		bool& getIsDynamic(Font* obj) { return obj->mIsDynamic; }
+		void setIsDynamic(Font* obj, bool& value) { obj->mIsDynamic = value; }
+
+		UINT32& getDPI(Font* obj) { return obj->mDPI; }
+		void setDPI(Font* obj, UINT32& value) { obj->mDPI = value; }
+
+		FontRenderMode& getRenderMode(Font* obj) { return obj->mRenderMode; }
+		void setRenderMode(Font* obj, FontRenderMode& value) { obj->mRenderMode = value; }
+
+		SPtr<DataStream> getSourceData(Font* obj, UINT32& size)
+		{
+			size = (UINT32)obj->mSourceData.size();
+
+			UINT8* data = size > 0 ? &obj->mSourceData[0] : nullptr;
+			return bs_shared_ptr_new<MemoryDataStream>(data, size, false);
+		}
+
+		void setSourceData(Font* obj, const SPtr<DataStream>& value, UINT32 size)
+		{
+			FontInitData* initData = any_cast<FontInitData*>(obj->mRTTIData);
+
+			initData->sourceData.resize(size);
+			if (size > 0)
+				value->read(&initData->sourceData[0], size);
+		}
+
 	public:
 		FontRTTI()
 		{
 			addReflectableArrayField("mBitmaps", 0, &FontRTTI::getBitmap, &FontRTTI::getNumBitmaps, &FontRTTI::setBitmap, &FontRTTI::setNumBitmaps);
+			addPlainField("mIsDynamic", 1, &FontRTTI::getIsDynamic, &FontRTTI::setIsDynamic);
+			addPlainField("mDPI", 2, &FontRTTI::getDPI, &FontRTTI::setDPI);
+			addPlainField("mRenderMode", 3, &FontRTTI::getRenderMode, &FontRTTI::setRenderMode);
+			addDataBlockField("mSourceData", 4, &FontRTTI::getSourceData, &FontRTTI::setSourceData, 0);
 		}
 
 		const String& getRTTIName() override
@@ -131,7 +167,10 @@ namespace BansheeEngine
 			Font* font = static_cast<Font*>(obj);
 			FontInitData* initData = any_cast<FontInitData*>(font->mRTTIData);
 
-			font->initialize(initData->fontDataPerSize);
+			if (font->mIsDynamic)
+				font->initializeDynamic(initData->sourceData, font->mDPI, font->mRenderMode);
+			else
+				font->initialize(initData->fontDataPerSize);
 
 			bs_delete(initData);
 		}
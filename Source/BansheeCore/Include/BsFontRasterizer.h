@@ -0,0 +1,67 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsFontDesc.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/** Rasterizes glyphs of a single font face on demand. Used by dynamic fonts. */
+	class BS_CORE_EXPORT FontRasterizer
+	{
+	public:
+		virtual ~FontRasterizer() { }
+
+		/**
+		 * Retrieves information about the font that applies to all characters of the provided size (baseline offset, line
+		 * height and space width). Character information in @p output is left untouched.
+		 *
+		 * @return	True if successful, false if the font cannot be rendered at the provided size.
+		 */
+		virtual bool getMetrics(UINT32 size, FONT_DESC& output) = 0;
+
+		/**
+		 * Renders a single character into a bitmap.
+		 *
+		 * @param[in]	size		Size of the font in points.
+		 * @param[in]	charId		Unicode key of the character to render. Zero renders the missing glyph.
+		 * @param[out]	desc		Description of the character. Only character dimensions, offsets and advance are
+		 *							populated, while texture page and coordinates are left for the caller.
+		 * @param[out]	pixels		Coverage of the character with one byte per pixel, tightly packed, with
+		 *							@p desc.width * @p desc.height entries.
+		 * @return					False if the font doesn't contain the character or it failed to render.
+		 */
+		virtual bool rasterize(UINT32 size, UINT32 charId, CHAR_DESC& desc, Vector<UINT8>& pixels) = 0;
+
+		/** Checks does the font contain kerning information. */
+		virtual bool hasKerning() const = 0;
+
+		/** Returns the horizontal offset to apply between the provided pair of characters, in pixels. */
+		virtual INT32 getKerning(UINT32 size, UINT32 leftCharId, UINT32 rightCharId) = 0;
+	};
+
+	/** Creates font rasterizers. Implemented by plugins capable of rendering font files. */
+	class BS_CORE_EXPORT FontRasterizerFactory
+	{
+	public:
+		virtual ~FontRasterizerFactory() { }
+
+		/**
+		 * Creates a new rasterizer for the font face stored in the provided memory.
+		 *
+		 * @param[in]	data		Contents of the font file. Must remain valid for as long as the rasterizer exists.
+		 * @param[in]	size		Size of @p data, in bytes.
+		 * @param[in]	dpi			Dots per inch resolution to use when rendering the characters.
+		 * @param[in]	renderMode	Determines how are the characters rendered.
+		 * @return					New rasterizer, or null if the font data is not in a supported format.
+		 */
+		virtual SPtr<FontRasterizer> create(const UINT8* data, UINT32 size, UINT32 dpi, FontRenderMode renderMode) = 0;
+	};
+
+	/** @} */
+}
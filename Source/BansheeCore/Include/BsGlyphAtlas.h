@@ -0,0 +1,120 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsEvent.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/** Area of a glyph atlas page reserved for a single glyph. */
+	struct GlyphAtlasRegion
+	{
+		UINT32 page;
+		UINT32 x, y;
+		UINT32 width, height;
+	};
+
+	/**
+	 * Texture atlas that glyphs of dynamic fonts are rendered into as they are requested. Glyphs are packed into rows
+	 * (shelves) of similar height on fixed size pages. When all pages are full the least recently used page is cleared
+	 * and reused.
+	 *
+	 * Glyph pixels are written to a CPU copy of each page, and all modified pages are uploaded to the GPU once per
+	 * frame, from update().
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_CORE_EXPORT GlyphAtlas
+	{
+		/** Row of glyphs on an atlas page. */
+		struct Shelf
+		{
+			UINT32 y;
+			UINT32 height;
+			UINT32 nextX;
+		};
+
+		/** Single texture of the atlas. */
+		struct Page
+		{
+			HTexture texture;
+			SPtr<PixelData> pixels;
+			Vector<Shelf> shelves;
+			UINT32 nextShelfY;
+			UINT64 lastUsedFrame;
+			bool isDirty;
+		};
+
+	public:
+		/**
+		 * Creates a new empty atlas.
+		 *
+		 * @param[in]	pageSize	Width and height of a single atlas page, in pixels.
+		 * @param[in]	maxPages	Maximum number of pages the atlas can allocate before it starts evicting old pages.
+		 */
+		GlyphAtlas(UINT32 pageSize, UINT32 maxPages);
+
+		/**
+		 * Reserves space in the atlas for a glyph of the provided size. This might evict a page that wasn't used during
+		 * the current frame, in which case onPageEvicted is triggered before this method returns.
+		 *
+		 * @param[in]	width	Width of the glyph, in pixels.
+		 * @param[in]	height	Height of the glyph, in pixels.
+		 * @param[out]	region	Reserved area of the atlas.
+		 * @return				False if the glyph doesn't fit on a page, or if all pages were used during this frame and
+		 *						none can be evicted.
+		 */
+		bool allocate(UINT32 width, UINT32 height, GlyphAtlasRegion& region);
+
+		/**
+		 * Writes glyph coverage into a previously allocated region. Changes are uploaded to the GPU on the next call to
+		 * update().
+		 *
+		 * @param[in]	region	Region returned by allocate().
+		 * @param[in]	pixels	Coverage values with one byte per pixel, tightly packed.
+		 */
+		void write(const GlyphAtlasRegion& region, const UINT8* pixels);
+
+		/** Marks the page as used during the current frame, preventing it from being evicted during that frame. */
+		void notifyUsed(UINT32 page);
+
+		/** Uploads all modified pages to the GPU. Should be called once per frame. */
+		void update();
+
+		/** Returns the texture of the page with the provided index. */
+		const HTexture& getTexture(UINT32 page) const { return mPages[page].texture; }
+
+		/** Returns the number of currently allocated pages. */
+		UINT32 getNumPages() const { return (UINT32)mPages.size(); }
+
+		/** Returns the width and height of a single page, in pixels. */
+		UINT32 getPageSize() const { return mPageSize; }
+
+		/** Returns the number of bytes used by all the pages, including both the CPU and GPU copies. */
+		UINT32 getMemoryUsage() const;
+
+		/**
+		 * Triggered when a page is cleared in order to make space for new glyphs. Any glyphs previously allocated on the
+		 * page are no longer valid.
+		 */
+		Event<void(UINT32)> onPageEvicted;
+
+	private:
+		/** Attempts to find space for a glyph of the provided size on the provided page. Size must include padding. */
+		bool allocateOnPage(UINT32 pageIdx, UINT32 width, UINT32 height, GlyphAtlasRegion& region);
+
+		/** Number of empty pixels kept around each glyph, so neighboring glyphs don't bleed in when filtered. */
+		static const UINT32 PADDING;
+
+		UINT32 mPageSize;
+		UINT32 mMaxPages;
+		Vector<Page> mPages;
+	};
+
+	/** @} */
+}
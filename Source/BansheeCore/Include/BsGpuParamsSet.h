@@ -42,12 +42,17 @@ namespace BansheeEngine
 		/** Information about a parameter block buffer. */
 		struct BlockInfo
 		{
-			BlockInfo(const String& name, const ParamBlockPtrType& buffer, bool shareable)
-				:name(name), buffer(buffer), shareable(shareable), allowUpdate(true), isUsed(true)
+			BlockInfo(const String& name, const ParamBlockPtrType& buffer, UINT32 size, bool shareable)
+				: name(name), buffer(buffer), size(size), stagingOffset(0), firstDataParam(0), numDataParams(0)
+				, shareable(shareable), allowUpdate(true), isUsed(true)
 			{ }
 
 			String name;
 			ParamBlockPtrType buffer;
+			UINT32 size;
+			UINT32 stagingOffset;
+			UINT32 firstDataParam;
+			UINT32 numDataParams;
 			bool shareable;
 			bool allowUpdate;
 			bool isUsed;
@@ -88,7 +93,9 @@ namespace BansheeEngine
 		};
 
 	public:
-		TGpuParamsSet() {}
+		TGpuParamsSet() 
+			:mPassParamInfos(nullptr), mStagingData(nullptr), mParamsVersion(0)
+		{ }
 		TGpuParamsSet(const SPtr<TechniqueType>& technique, const ShaderType& shader,
 			const SPtr<MaterialParamsType>& params);
 		~TGpuParamsSet();
@@ -161,17 +168,16 @@ namespace BansheeEngine
 		UINT32 getNumPasses() const { return (UINT32)mPassParams.size(); }
 
 		/**
-		 * Updates internal GPU params for all passes and stages from the provided material parameters object.
+		 * Updates internal GPU params for all passes and stages from the provided material parameters object. Only
+		 * parameters modified since the last call are updated. Data parameters are first gathered in a CPU-side copy of
+		 * each parameter block, and then written to the block buffer using a single write per block.
 		 *
 		 * @param[in]	params			Object containing the parameter data to update from. Layout of the object must match the
 		 *								object used for creating this object (be created for the same shader).
-		 * @param[in]	dirtyBitIdx		Index to use when checking if parameters are dirty. Must be in range [0, 31]. Allows
-		 *								the same material params to record dirty state for multiple sets of GPU params
-		 *								(each with their own index).
-		 * @param[in]	updateAll		By default the system will only update parameters marked as dirty in @p params. If this
-		 *								is set to true, all parameters will be updated instead.
+		 * @param[in]	updateAll		By default the system will only update parameters modified in @p params since the
+		 *								last call. If this is set to true, all parameters will be updated instead.
 		 */
-		void update(const SPtr<MaterialParamsType>& params, UINT32 dirtyBitIdx, bool updateAll = false);
+		void update(const SPtr<MaterialParamsType>& params, bool updateAll = false);
 
 		static const UINT32 NUM_STAGES;
 	private:
@@ -181,6 +187,8 @@ namespace BansheeEngine
 		Vector<BlockInfo> mBlocks;
 		Vector<DataParamInfo> mDataParamInfos;
 		PassParamInfo* mPassParamInfos;
+		UINT8* mStagingData;
+		UINT64 mParamsVersion;
 	};
 
 	/** Sim thread version of TGpuParamsSet<Core>. */
@@ -130,9 +130,20 @@ namespace BansheeEngine
 		 */
 		void _registerAssetImporter(SpecificImporter* importer);
 
-		/** Alternative to importAll() which doesn't create resource handles, but instead returns raw resource pointers. */
+		/** 
+		 * Alternative to importAll() which doesn't create resource handles, but instead returns raw resource pointers.
+		 *
+		 * @note	Thread safe. Files handled by importers that don't support concurrent imports are imported one at a time.
+		 */
 		Vector<SubResourceRaw> _importAllRaw(const Path& inputFilePath, SPtr<const ImportOptions> importOptions = nullptr);
 
+		/** 
+		 * Returns the version of the importer that handles the provided file, or zero if the file type isn't supported.
+		 *
+		 * @see		SpecificImporter::getVersion
+		 */
+		UINT32 _getImporterVersion(const Path& inputFilePath) const;
+
 		/** @} */
 	private:
 		/** 
@@ -150,19 +150,16 @@ namespace BansheeEngine
 		SPtr<GpuParamsSetType> createParamsSet(UINT32 techniqueIdx = 0);
 
 		/**
-		 * Updates the provided parameter set by recording in it any changes that were made since the last call. It is
-		 * assumed only a single parameter set exists per-material per-technique. If there are multiple the material
-		 * will not be able to track which parameters were updated since the last call.
+		 * Updates the provided parameter set by recording in it any changes that were made since the last call. Each 
+		 * parameter set keeps track of the parameter version it was last updated with, so any number of parameter sets
+		 * can be updated from the same material. If nothing changed since the last update the call is a single version
+		 * comparison.
 		 *
 		 * @param[in]	paramsSet		Parameter set to update.
-		 * @param[in]	dirtyBitIdx		Index to use when checking if parameters are dirty. Must be in range [0, 30]. Allows
-		 *								the same material params to record dirty state for multiple sets of GPU params
-		 *								(each with their own index). Dirty state for the specified index will be cleared
-		 *								after the call.
 		 * @param[in]	forceRefresh	If true all material parameters will be assigned to the params set, regardless if
-		 *								they are marked dirty or not.
+		 *								they were modified or not.
 		 */
-		void updateParamsSet(const SPtr<GpuParamsSetType>& paramsSet, UINT32 dirtyBitIdx = 0, bool forceRefresh = false);
+		void updateParamsSet(const SPtr<GpuParamsSetType>& paramsSet, bool forceRefresh = false);
 
 		/**   
 		 * Assigns a float value to the shader parameter with the specified name. 
@@ -44,6 +44,7 @@ namespace BansheeEngine
 			UINT32 index;
 			UINT32 arraySize;
 			mutable UINT32 dirtyFlags;
+			mutable UINT64 version;
 		};
 
 		/** 
@@ -212,11 +213,22 @@ namespace BansheeEngine
 		}
 
 		/** 
-		 * Clears dirty flags for all parameters, for the specified index. 
-		 *
-		 * @param[in]	index	Index of the bit to clear. Must be in range [0-31]
+		 * Marks the provided parameter as modified. This flags it for core thread sync, and increments its version so GPU
+		 * parameter sets know to update it.
+		 */
+		void markParamDirty(const ParamData* param) const
+		{
+			param->dirtyFlags = 0xFFFFFFFF;
+			param->version = ++mParamsVersion;
+		}
+
+		/** 
+		 * Returns a version number that increments whenever any of the parameters is modified. Each parameter records the
+		 * version at which it was last modified (see ParamData::version), allowing external systems to detect if they
+		 * are out of date using a single comparison, and then update only the parameters modified since their last
+		 * update.
 		 */
-		void clearDirtyFlags(UINT32 index);
+		UINT64 getParamsVersion() const { return mParamsVersion; }
 
 	protected:
 		const static UINT32 STATIC_BUFFER_SIZE = 256;
@@ -225,6 +237,7 @@ namespace BansheeEngine
 		Vector<ParamData> mParams;
 
 		UINT8* mDataParamsBuffer = nullptr;
+		mutable UINT64 mParamsVersion = 1;
 
 		UINT32 mDataSize = 0;
 		UINT32 mNumStructParams = 0;
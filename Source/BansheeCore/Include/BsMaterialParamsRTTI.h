@@ -257,6 +257,7 @@ namespace BansheeEngine
 			memory = rttiReadElem(data.index, memory, size);
 			memory = rttiReadElem(data.arraySize, memory, size);
 			data.dirtyFlags = (UINT32)-1;
+			data.version = 1;
 
 			return size;
 		}
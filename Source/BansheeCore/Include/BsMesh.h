@@ -40,6 +40,19 @@ namespace BansheeEngine
 		 */
 		Vector<SubMesh> subMeshes;
 
+		/** 
+		 * Optional simplified versions of the mesh's geometry, ordered from highest to lowest detail. Each level must 
+		 * provide a sub-mesh for each entry in @p subMeshes, with index ranges pointing to indices stored in the same 
+		 * index buffer as the base mesh.
+		 */
+		Vector<MeshLOD> lods;
+
+		/** 
+		 * Parameters for decoding the vertices provided to the mesh, if they were compressed using 
+		 * MeshUtility::compressVertices(). 
+		 */
+		MeshVertexCompression vertexCompression;
+
 		/** Optimizes performance depending on planned usage of the mesh. */
 		INT32 usage = MU_STATIC; 
 
@@ -127,6 +140,9 @@ namespace BansheeEngine
 		 */
 		void readData(MeshData& dest);
 
+		/** Returns the usage flags the mesh was created with. Flags are a combination of MeshUsage values. */
+		int getUsage() const { return mUsage; }
+
 		/** Gets the skeleton required for animation of this mesh, if any is available. */
 		SPtr<Skeleton> getSkeleton() const { return mSkeleton; }
 
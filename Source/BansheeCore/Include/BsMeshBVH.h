@@ -0,0 +1,63 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsBVH.h"
+#include "BsVector3.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Utility-Core-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Keeps a CPU copy of mesh triangles, organized in a bounding volume hierarchy, allowing exact ray and volume queries
+	 * against the mesh geometry. All queries are performed in the local space of the mesh.
+	 */
+	class BS_CORE_EXPORT MeshBVH
+	{
+	public:
+		/**
+		 * Creates a hierarchy from the triangles in the provided mesh data. Only sub-meshes using triangle lists are
+		 * considered. Mesh data must contain three component floating point positions.
+		 *
+		 * @param[in]	meshData	Mesh data to read the vertices and indices from.
+		 * @param[in]	properties	Properties of the mesh the data belongs to, describing its sub-meshes.
+		 * @return					Created hierarchy, or null if the mesh data contains no usable triangles.
+		 */
+		static SPtr<MeshBVH> create(const MeshData& meshData, const MeshProperties& properties);
+
+		/**
+		 * Finds the closest triangle hit by the ray.
+		 *
+		 * @param[in]	ray			Ray in the local space of the mesh. Doesn't need to be normalized, in which case the
+		 *							distance is in units of the ray direction length.
+		 * @param[out]	distance	Distance along the ray to the intersection point.
+		 * @param[out]	normal		Normalized normal of the hit triangle facing the ray origin, in local space of the
+		 *							mesh.
+		 * @param[in]	cullMode	Determines which triangles are ignored, same as the hardware would when rendering the
+		 *							mesh, assuming the ray starts at the viewer. For example counter-clockwise culling
+		 *							ignores triangles whose vertices appear in counter-clockwise order from the ray origin.
+		 * @return					True if any triangle was hit.
+		 */
+		bool intersects(const Ray& ray, float& distance, Vector3& normal, CullingMode cullMode = CULL_NONE) const;
+
+		/** Checks if any of the triangles are potentially within the provided volume, in local space of the mesh. */
+		bool intersects(const ConvexVolume& volume) const;
+
+		/** Returns the bounds of all the triangles in the mesh. */
+		AABox getBounds() const { return mBVH.getBounds(); }
+
+		/** Returns the number of bytes used by the triangle data and the hierarchy. */
+		UINT32 getMemoryUsage() const;
+
+	private:
+		BVH mBVH;
+		Vector<Vector3> mVertices;
+		Vector<UINT32> mIndices;
+	};
+
+	/** @} */
+}
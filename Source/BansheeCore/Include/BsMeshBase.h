@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "BsResource.h"
 #include "BsBounds.h"
+#include "BsVector2.h"
 #include "BsDrawOps.h"
 #include "BsSubMesh.h"
 
@@ -25,6 +26,36 @@ namespace BansheeEngine
 		MU_CPUCACHED = 0x1000 /**< All mesh data will also be cached in CPU memory, making it readable with GPU reads. */
 	};
 
+	/** 
+	 * Parameters required for decoding mesh vertices that were quantized by MeshUtility::compressVertices(). Stored
+	 * positions and texture coordinates are in [-1, 1] range, and are decoded by multiplying them with the scale and
+	 * adding the offset. Default parameters leave the vertices unchanged.
+	 */
+	struct BS_CORE_EXPORT MeshVertexCompression
+	{
+		MeshVertexCompression()
+			: positionScale(Vector3::ONE), positionOffset(Vector3::ZERO), uvScale(Vector2::ONE), uvOffset(Vector2::ZERO)
+			, octahedralNormals(false)
+		{ }
+
+		/** Returns a transform that converts stored vertex positions into the mesh's local space. */
+		Matrix4 getPositionDecodeTransform() const;
+
+		/** Converts bounds calculated from the stored vertex positions into bounds in the mesh's local space. */
+		Bounds decodeBounds(const Bounds& bounds) const;
+
+		Vector3 positionScale;
+		Vector3 positionOffset;
+		Vector2 uvScale;
+		Vector2 uvOffset;
+
+		/** 
+		 * True if normals and tangents are stored as octahedral encoded 16-bit pairs, rather than as 8-bit packed
+		 * vectors.
+		 */
+		bool octahedralNormals;
+	};
+
 	/** Properties of a Mesh. Shared between sim and core thread versions of a Mesh. */
 	class BS_CORE_EXPORT MeshProperties
 	{
@@ -42,6 +73,29 @@ namespace BansheeEngine
 		/** Retrieves a total number of sub-meshes in this mesh. */
 		UINT32 getNumSubMeshes() const;
 
+		/** 
+		 * Returns the number of levels of detail in the mesh. Level zero always represents the full detail mesh, and is 
+		 * the only level available if the mesh wasn't simplified.
+		 */
+		UINT32 getNumLODs() const { return (UINT32)mLODs.size() + 1; }
+
+		/** 
+		 * Returns a sub-mesh containing the data used for rendering a certain portion of the mesh, at the specified level
+		 * of detail. Level zero returns the same sub-mesh as getSubMesh(). Levels out of range are clamped to the lowest
+		 * available detail.
+		 */
+		const SubMesh& getSubMesh(UINT32 subMeshIdx, UINT32 lod) const;
+
+		/** 
+		 * Returns the projected screen size of the mesh's bounds, relative to screen height, below which the specified
+		 * level of detail should be used. Level zero has no threshold and returns zero, as it is used at all sizes larger
+		 * than the threshold of level one.
+		 */
+		float getLODScreenSize(UINT32 lod) const;
+
+		/** Returns all the simplified levels of detail, starting with level one. */
+		const Vector<MeshLOD>& getLODs() const { return mLODs; }
+
 		/**	Returns maximum number of vertices the mesh may store. */
 		UINT32 getNumVertices() const { return mNumVertices; }
 
@@ -51,6 +105,9 @@ namespace BansheeEngine
 		/**	Returns bounds of the geometry contained in the vertex buffers for all sub-meshes. */
 		const Bounds& getBounds() const { return mBounds; }
 
+		/** Returns the parameters required for decoding the mesh's vertices, if they were compressed. */
+		const MeshVertexCompression& getVertexCompression() const { return mVertexCompression; }
+
 	protected:
 		friend class MeshBase;
 		friend class MeshCoreBase;
@@ -61,9 +118,11 @@ namespace BansheeEngine
 		friend class MeshBaseRTTI;
 
 		Vector<SubMesh> mSubMeshes;
+		Vector<MeshLOD> mLODs;
 		UINT32 mNumVertices;
 		UINT32 mNumIndices;
 		Bounds mBounds;
+		MeshVertexCompression mVertexCompression;
 	};
 
 	/** @} */
@@ -16,6 +16,55 @@ namespace BansheeEngine
 	 */
 
 	BS_ALLOW_MEMCPY_SERIALIZATION(SubMesh);
+	BS_ALLOW_MEMCPY_SERIALIZATION(MeshVertexCompression);
+
+	/** Serializable information about a single level of detail of a mesh. */
+	template<> struct RTTIPlainType<MeshLOD>
+	{
+		enum { id = TID_MeshLOD }; enum { hasDynamicSize = 1 };
+
+		/** @copydoc RTTIPlainType::toMemory */
+		static void toMemory(const MeshLOD& data, char* memory)
+		{
+			UINT32 size = sizeof(UINT32);
+			char* memoryStart = memory;
+			memory += sizeof(UINT32);
+
+			UINT32 version = 0; // In case the data structure changes
+			memory = rttiWriteElem(version, memory, size);
+			memory = rttiWriteElem(data.screenSize, memory, size);
+			memory = rttiWriteElem(data.subMeshes, memory, size);
+
+			memcpy(memoryStart, &size, sizeof(UINT32));
+		}
+
+		/** @copydoc RTTIPlainType::fromMemory */
+		static UINT32 fromMemory(MeshLOD& data, char* memory)
+		{
+			UINT32 size = 0;
+			memory = rttiReadElem(size, memory);
+
+			UINT32 version;
+			memory = rttiReadElem(version, memory);
+
+			memory = rttiReadElem(data.screenSize, memory);
+			memory = rttiReadElem(data.subMeshes, memory);
+
+			return size;
+		}
+
+		/** @copydoc RTTIPlainType::getDynamicSize */
+		static UINT32 getDynamicSize(const MeshLOD& data)
+		{
+			UINT64 dataSize = sizeof(UINT32) + sizeof(UINT32);
+			dataSize += rttiGetElemSize(data.screenSize);
+			dataSize += rttiGetElemSize(data.subMeshes);
+
+			assert(dataSize <= std::numeric_limits<UINT32>::max());
+
+			return (UINT32)dataSize;
+		}
+	};
 
 	class MeshBaseRTTI : public RTTIType<MeshBase, Resource, MeshBaseRTTI>
 	{
@@ -24,12 +73,20 @@ namespace BansheeEngine
 		UINT32 getNumSubmeshes(MeshBase* obj) { return (UINT32)obj->mProperties.mSubMeshes.size(); }
 		void setNumSubmeshes(MeshBase* obj, UINT32 numElements) { obj->mProperties.mSubMeshes.resize(numElements); }
 
+		MeshLOD& getLOD(MeshBase* obj, UINT32 arrayIdx) { return obj->mProperties.mLODs[arrayIdx]; }
+		void setLOD(MeshBase* obj, UINT32 arrayIdx, MeshLOD& value) { obj->mProperties.mLODs[arrayIdx] = value; }
+		UINT32 getNumLODs(MeshBase* obj) { return (UINT32)obj->mProperties.mLODs.size(); }
+		void setNumLODs(MeshBase* obj, UINT32 numElements) { obj->mProperties.mLODs.resize(numElements); }
+
 		UINT32& getNumVertices(MeshBase* obj) { return obj->mProperties.mNumVertices; }
 		void setNumVertices(MeshBase* obj, UINT32& value) { obj->mProperties.mNumVertices = value; }
 
 		UINT32& getNumIndices(MeshBase* obj) { return obj->mProperties.mNumIndices; }
 		void setNumIndices(MeshBase* obj, UINT32& value) { obj->mProperties.mNumIndices = value; }
 
+		MeshVertexCompression& getVertexCompression(MeshBase* obj) { return obj->mProperties.mVertexCompression; }
+		void setVertexCompression(MeshBase* obj, MeshVertexCompression& value) { obj->mProperties.mVertexCompression = value; }
+
 	public:
 		MeshBaseRTTI()
 		{
@@ -38,6 +95,12 @@ namespace BansheeEngine
 
 			addPlainArrayField("mSubMeshes", 2, &MeshBaseRTTI::getSubMesh, 
 				&MeshBaseRTTI::getNumSubmeshes, &MeshBaseRTTI::setSubMesh, &MeshBaseRTTI::setNumSubmeshes);
+
+			addPlainArrayField("mLODs", 3, &MeshBaseRTTI::getLOD, 
+				&MeshBaseRTTI::getNumLODs, &MeshBaseRTTI::setLOD, &MeshBaseRTTI::setNumLODs);
+
+			addPlainField("mVertexCompression", 4, &MeshBaseRTTI::getVertexCompression, 
+				&MeshBaseRTTI::setVertexCompression);
 		}
 
 		SPtr<IReflectable> newRTTIObject() override
@@ -212,7 +212,10 @@ namespace BansheeEngine
 		/**	Return the size (in bytes) of the entire buffer. */
 		UINT32 getSize() const { return getInternalBufferSize(); }
 
-		/**	Calculates the bounds of all vertices stored in the internal buffer. */
+		/**	
+		 * Calculates the bounds of all vertices stored in the internal buffer. Bounds of compressed positions are 
+		 * calculated in their stored range, and need to be decoded using MeshVertexCompression::decodeBounds().
+		 */
 		Bounds calculateBounds() const;
 
 		/**
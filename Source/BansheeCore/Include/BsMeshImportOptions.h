@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "BsImportOptions.h"
 #include "BsAnimationClip.h"
+#include "BsMeshUtility.h"
 
 namespace BansheeEngine
 {
@@ -147,6 +148,82 @@ namespace BansheeEngine
 		 */
 		bool getKeyFrameReduction() const { return mReduceKeyFrames; }
 
+		/**	
+		 * Enables or disables animation compression. Compressed animation clips have keyframes that don't noticeably
+		 * contribute to the animation removed, and the remaining keyframes stored in quantized form. This significantly 
+		 * reduces the memory used by the clip and speeds up its evaluation, at the cost of a small loss of precision.
+		 */
+		void setAnimationCompression(bool enabled) { mCompressAnimation = enabled; }
+
+		/**	
+		 * Checks is animation compression enabled.
+		 *
+		 * @see	setAnimationCompression
+		 */
+		bool getAnimationCompression() const { return mCompressAnimation; }
+
+		/**	
+		 * Enables or disables animation baking. Baked animation clips have their curves pre-sampled at the clip's sample
+		 * rate, so evaluating them takes constant time regardless of playback direction or seeking. This speeds up 
+		 * evaluation at the cost of additional memory, and a small loss of precision between the samples.
+		 */
+		void setAnimationBaking(bool enabled) { mBakeAnimation = enabled; }
+
+		/**	
+		 * Checks is animation baking enabled.
+		 *
+		 * @see	setAnimationBaking
+		 */
+		bool getAnimationBaking() const { return mBakeAnimation; }
+
+		/**	
+		 * Determines which optimizations are performed on the imported mesh. Optimized meshes have their triangles and
+		 * vertices reordered (and optionally duplicate vertices merged) so they are cheaper to render.
+		 */
+		void setMeshOptimization(MeshOptimizeFlags flags) { mMeshOptimization = flags; }
+
+		/**	
+		 * Returns which optimizations are performed on the imported mesh.
+		 *
+		 * @see	setMeshOptimization
+		 */
+		MeshOptimizeFlags getMeshOptimization() const { return mMeshOptimization; }
+
+		/**	
+		 * Sets the number of simplified levels of detail to generate for the mesh, not counting the original mesh. Lower
+		 * levels of detail are used for rendering the mesh when it takes up a small portion of the screen. Zero disables
+		 * level of detail generation.
+		 */
+		void setNumLODs(UINT32 numLODs) { mNumLODs = numLODs; }
+
+		/**	Returns the number of simplified levels of detail to generate for the mesh. */
+		UINT32 getNumLODs() const { return mNumLODs; }
+
+		/**	
+		 * Determines the ratio of the number of triangles in each level of detail compared to the previous level, in
+		 * range (0, 1).
+		 */
+		void setLODReduction(float reduction) { mLODReduction = reduction; }
+
+		/**	Returns the ratio of the number of triangles in each level of detail compared to the previous level. */
+		float getLODReduction() const { return mLODReduction; }
+
+		/**	
+		 * Determines which vertex attributes are quantized into smaller formats, reducing the memory used by the mesh and
+		 * the bandwidth required for rendering it, at the cost of some precision. If the mesh is CPU readable its cached
+		 * data is stored in the compressed formats as well.
+		 *
+		 * @see	MeshUtility::compressVertices
+		 */
+		void setVertexCompression(VertexCompressionFlags flags) { mVertexCompression = flags; }
+
+		/**	
+		 * Returns which vertex attributes are quantized into smaller formats.
+		 *
+		 * @see	setVertexCompression
+		 */
+		VertexCompressionFlags getVertexCompression() const { return mVertexCompression; }
+
 	private:
 		bool mCPUReadable;
 		bool mImportNormals;
@@ -155,6 +232,12 @@ namespace BansheeEngine
 		bool mImportSkin;
 		bool mImportAnimation;
 		bool mReduceKeyFrames;
+		bool mCompressAnimation;
+		bool mBakeAnimation;
+		MeshOptimizeFlags mMeshOptimization;
+		UINT32 mNumLODs;
+		float mLODReduction;
+		VertexCompressionFlags mVertexCompression;
 		float mImportScale;
 		CollisionMeshType mCollisionMeshType;
 		Vector<AnimationSplitInfo> mAnimationSplits;
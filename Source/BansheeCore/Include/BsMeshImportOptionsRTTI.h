@@ -29,6 +29,12 @@ namespace BansheeEngine
 			BS_RTTI_MEMBER_REFL_ARRAY(mAnimationSplits, 8)
 			BS_RTTI_MEMBER_PLAIN(mReduceKeyFrames, 9)
 			BS_RTTI_MEMBER_REFL_ARRAY(mAnimationEvents, 10)
+			BS_RTTI_MEMBER_PLAIN(mCompressAnimation, 11)
+			BS_RTTI_MEMBER_PLAIN(mBakeAnimation, 12)
+			BS_RTTI_MEMBER_PLAIN(mMeshOptimization, 13)
+			BS_RTTI_MEMBER_PLAIN(mNumLODs, 14)
+			BS_RTTI_MEMBER_PLAIN(mLODReduction, 15)
+			BS_RTTI_MEMBER_PLAIN(mVertexCompression, 16)
 		BS_END_RTTI_MEMBERS
 	public:
 		MeshImportOptionsRTTI()
@@ -24,12 +24,77 @@ namespace BansheeEngine
 		UINT32 packed;
 	};
 
+	/** Flags that control which optimizations are performed by MeshUtility::optimize(). */
+	enum class MeshOptimizeFlag
+	{
+		/** Merges vertices with identical data into a single vertex. */
+		WeldVertices = 1 << 0,
+		/** Reorders triangles so that vertices are more likely to be reused from the GPU post-transform cache. */
+		VertexCache = 1 << 1,
+		/** Reorders clusters of triangles so that triangles likely to occlude others are drawn first. */
+		Overdraw = 1 << 2,
+		/** Reorders vertices in the order they are referenced by the triangles, improving vertex fetch locality. */
+		VertexFetch = 1 << 3,
+		All = WeldVertices | VertexCache | Overdraw | VertexFetch
+	};
+
+	typedef Flags<MeshOptimizeFlag> MeshOptimizeFlags;
+	BS_FLAGS_OPERATORS(MeshOptimizeFlag);
+
+	/** Information about the results of MeshUtility::optimize(). */
+	struct MeshOptimizeStats
+	{
+		/** Average number of vertices transformed per triangle before optimization, assuming a FIFO vertex cache. */
+		float acmrBefore;
+		/** Average number of vertices transformed per triangle after optimization, assuming a FIFO vertex cache. */
+		float acmrAfter;
+
+		UINT32 numVerticesBefore; /**< Number of vertices before optimization. */
+		UINT32 numVerticesAfter; /**< Number of vertices after optimization. */
+	};
+
+	/** Flags that control which vertex attributes are quantized by MeshUtility::compressVertices(). */
+	enum class VertexCompressionFlag
+	{
+		/** Stores positions as 16-bit floats, normalized to the mesh bounds. */
+		Position = 1 << 0,
+		/** Stores normals and tangents as octahedral encoded pairs of 16-bit normalized integers. */
+		NormalTangent = 1 << 1,
+		/** Stores texture coordinates as pairs of 16-bit normalized integers, normalized to the range used by the mesh. */
+		UV = 1 << 2,
+		All = Position | NormalTangent | UV
+	};
+
+	typedef Flags<VertexCompressionFlag> VertexCompressionFlags;
+	BS_FLAGS_OPERATORS(VertexCompressionFlag);
+
+	/** Information about the results of MeshUtility::compressVertices(). */
+	struct VertexCompressionStats
+	{
+		UINT32 originalSize; /**< Size of the vertex data before compression, in bytes. */
+		UINT32 compressedSize; /**< Size of the vertex data after compression, in bytes. */
+
+		/** 
+		 * Maximum distance between an original and a decoded position, in units. Zero if positions were left
+		 * uncompressed.
+		 */
+		float maxPositionError;
+
+		/** True if positions were compressed. False if not requested, or if the mesh was too large to compress them. */
+		bool positionsCompressed;
+		float maxNormalError; /**< Maximum angle between an original and a decoded normal, in radians. */
+	};
+
 	/** Performs various operations on mesh geometry. */
 	class BS_CORE_EXPORT MeshUtility
 	{
 	public:
+		/** Minimum number of vertices processed by a single task, when splitting vertex processing across worker threads. */
+		static const UINT32 MIN_VERTICES_PER_TASK = 4096;
+
 		/**
-		 * Calculates per-vertex normals based on the provided vertices and indices.
+		 * Calculates per-vertex normals based on the provided vertices and indices. Large meshes are split into chunks 
+		 * that are processed in parallel.
 		 *
 		 * @param[in]	vertices	Set of vertices containing vertex positions.
 		 * @param[in]	indices		Set of indices containing indexes into vertex array for each triangle.
@@ -48,7 +113,8 @@ namespace BansheeEngine
 			UINT32 numIndices, Vector3* normals, UINT32 indexSize = 4);
 
 		/**
-		 * Calculates per-vertex tangents and bitangents based on the provided vertices, uv coordinates and indices.
+		 * Calculates per-vertex tangents and bitangents based on the provided vertices, uv coordinates and indices. Large
+		 * meshes are split into chunks that are processed in parallel.
 		 *
 		 * @param[in]	vertices	Set of vertices containing vertex positions.
 		 * @param[in]	normals		Set of normals to use when calculating tangents. Must the the same length as the number
@@ -173,6 +239,133 @@ namespace BansheeEngine
 		 * @param[in]	stride			Distance between two entries in the @p source buffer, in bytes.
 		 */
 		static void unpackNormals(UINT8* source, Vector4* destination, UINT32 count, UINT32 stride);
+
+		/**
+		 * Transforms vertex positions, and optionally normals, using linear blend skinning on the CPU. Useful when skinned
+		 * vertices are needed outside of rendering (e.g. for picking or physics). Large meshes are split into chunks that
+		 * are processed in parallel.
+		 *
+		 * @param[in]	meshData	Mesh data containing vertex positions as 3D or 4D floats, blend indices (4 bytes per
+		 *							vertex) and blend weights (4 floats per vertex), all in the first vertex stream. Must 
+		 *							also contain normals if @p normals is provided, either as 3D floats or packed. Vertices
+		 *							quantized by compressVertices() are not supported.
+		 * @param[in]	bones		Bone transforms to skin the vertices with, as output by Skeleton::getPose().
+		 * @param[in]	numBones	Number of entries in the @p bones array. Influences of bones outside of the array are
+		 *							ignored.
+		 * @param[out]	positions	Pre-allocated buffer to receive the skinned positions. Must have an entry for each
+		 *							vertex.
+		 * @param[out]	normals		Optional pre-allocated buffer to receive the skinned normals. Must have an entry for
+		 *							each vertex.
+		 */
+		static void skinVertices(const MeshData& meshData, const Matrix4* bones, UINT32 numBones, Vector3* positions,
+			Vector3* normals = nullptr);
+
+		/**
+		 * Reorders (and optionally welds) mesh vertices and triangles in order to reduce the cost of rendering the mesh.
+		 * Intended to be used offline, as the optimization is relatively expensive for large meshes.
+		 *
+		 * @param[in]	meshData	Mesh to optimize.
+		 * @param[in]	subMeshes	Sub-meshes the mesh is split into. Triangles are only reordered within a sub-mesh, and
+		 *							only triangle list sub-meshes are reordered. If empty the entire index buffer is
+		 *							treated as a single triangle list.
+		 * @param[in]	flags		Determines which optimizations to perform. Overdraw optimization requires the mesh to
+		 *							have 3D float positions, and is skipped otherwise.
+		 * @param[out]	vertexRemap	Array containing an entry for each vertex in the original mesh, with the index of that
+		 *							vertex in the optimized mesh. Useful for updating any external data referencing the
+		 *							original vertices.
+		 * @param[out]	stats		Information about the optimized mesh, including the vertex cache efficiency before
+		 *							and after.
+		 * @return					Optimized mesh using the same vertex description and index type as the original. The
+		 *							sub-mesh ranges of the original mesh remain valid for it.
+		 */
+		static SPtr<MeshData> optimize(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes, 
+			MeshOptimizeFlags flags, Vector<UINT32>& vertexRemap, MeshOptimizeStats& stats);
+
+		/**
+		 * Reduces the number of triangles in a triangle list by repeatedly collapsing the edges whose removal introduces
+		 * the least error, as measured by the quadric error metric. Collapses only move a vertex onto one of its
+		 * neighbours, so no new vertices are created. Vertices on open borders, and vertices that share their position 
+		 * with another vertex (e.g. on UV seams or hard edges) are never moved, so the mesh outline and its seams are
+		 * preserved.
+		 *
+		 * @param[in]	positions			Positions of all the vertices referenced by the indices.
+		 * @param[in]	numVertices			Number of entries in the @p positions array.
+		 * @param[in]	indices				Indices of the triangle list to simplify.
+		 * @param[in]	numIndices			Number of entries in the @p indices array. Must be a multiple of three.
+		 * @param[in]	targetNumIndices	Number of indices to reduce the triangle list to. The result might contain more
+		 *									indices if not enough edges can be collapsed without damaging the mesh.
+		 * @param[out]	output				Indices of the simplified triangle list, referencing the same vertices.
+		 *
+		 * @see	Garland, Heckbert - Surface Simplification Using Quadric Error Metrics
+		 */
+		static void simplify(const Vector3* positions, UINT32 numVertices, const UINT32* indices, UINT32 numIndices,
+			UINT32 targetNumIndices, Vector<UINT32>& output);
+
+		/**
+		 * Generates a chain of progressively simplified versions of the mesh, to be used for rendering the mesh when it
+		 * takes up a small portion of the screen. Each level is generated from the previous one using simplify(), and
+		 * its triangles are reordered for vertex cache efficiency in the same way as by optimize(). Intended to be used
+		 * offline, as simplification is relatively expensive for large meshes.
+		 *
+		 * @param[in]	meshData	Mesh to simplify. Must have 3D float positions, otherwise no levels are generated.
+		 * @param[in]	subMeshes	Sub-meshes the mesh is split into. Each sub-mesh is simplified separately and only
+		 *							triangle list sub-meshes are simplified. If empty the entire index buffer is treated as
+		 *							a single triangle list.
+		 * @param[in]	numLODs		Maximum number of levels of detail to generate, not counting the original mesh. Fewer
+		 *							levels are generated if the mesh cannot be simplified further.
+		 * @param[in]	reduction	Ratio of the number of triangles in a level compared to the previous level, in range 
+		 *							(0, 1).
+		 * @param[out]	lods		Generated levels of detail, with sub-mesh ranges referencing the returned mesh data,
+		 *							and the screen sizes at which to use them.
+		 * @return					Mesh data with the same vertices as the original, and the indices of all the
+		 *							generated levels appended after the original indices. The sub-mesh ranges of the
+		 *							original mesh remain valid for it.
+		 */
+		static SPtr<MeshData> generateLODs(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes, 
+			UINT32 numLODs, float reduction, Vector<MeshLOD>& lods);
+
+		/**
+		 * Quantizes vertex attributes into smaller formats, reducing the memory used by the mesh and the bandwidth 
+		 * required for rendering it. 
+		 *
+		 * - Positions are stored as 4D 16-bit floats, normalized to the [-1, 1] range of the mesh bounds. Half-floats
+		 *   have 11 bits of precision, so each component is within 1/8192th of the mesh extent along that axis. Positions
+		 *   are left uncompressed if the resulting error could exceed @p maxPositionError.
+		 * - Normals and tangents are stored using octahedral encoding as 2D 16-bit normalized values. The tangent's
+		 *   bitangent sign is stored in the sign of its second component.
+		 * - Texture coordinates are stored as 2D 16-bit normalized values, normalized to the range of coordinates used by
+		 *   the mesh. All texture coordinate sets share the same range.
+		 *
+		 * The builtin shaders decode the vertices using the per-object parameters provided by the renderer. Custom
+		 * shaders must do the same in order to render compressed meshes.
+		 *
+		 * @param[in]	meshData	Mesh to compress. Attributes in formats other than 3D and 4D float positions, 3D float
+		 *							or packed normals, 4D float or packed tangents and 2D float texture coordinates are
+		 *							left as is.
+		 * @param[in]	flags				Determines which attributes to compress.
+		 * @param[out]	compression			Parameters required for decoding the compressed vertices. Should be provided
+		 *									to the mesh through MESH_DESC::vertexCompression.
+		 * @param[out]	stats				Information about the memory saved and the error introduced.
+		 * @param[in]	maxPositionError	Maximum distance a compressed position is allowed to be from the original, in
+		 *									units. Positions of meshes too large to be compressed within this error are
+		 *									left as is.
+		 * @return							Mesh data with the same vertices and indices as the original, using the
+		 *									compressed vertex formats. Returns the original mesh data if no attributes
+		 *									were compressed.
+		 */
+		static SPtr<MeshData> compressVertices(const SPtr<MeshData>& meshData, VertexCompressionFlags flags,
+			MeshVertexCompression& compression, VertexCompressionStats& stats, float maxPositionError = 0.001f);
+
+		/**
+		 * Reads the vertex positions from the first position element of the provided mesh data. Positions compressed by
+		 * compressVertices() are decoded into the mesh's local space.
+		 *
+		 * @param[in]	meshData	Mesh to read the positions from. Must have 3D or 4D float, or 4D half-float positions.
+		 * @param[in]	compression	Parameters for decoding the positions, as returned by compressVertices().
+		 * @param[out]	output		Pre-allocated buffer to receive the positions. Must have an entry for each vertex.
+		 * @return					False if the mesh has no positions in a supported format, true otherwise.
+		 */
+		static bool readPositions(const MeshData& meshData, const MeshVertexCompression& compression, Vector3* output);
 	};
 
 	/** @} */
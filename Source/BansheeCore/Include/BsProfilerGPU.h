@@ -43,6 +43,11 @@ namespace BansheeEngine
 
 		UINT32 numObjectsCreated; /**< How many GPU objects were created. */
 		UINT32 numObjectsDestroyed; /**< How many GPU objects were destroyed. */
+
+		UINT32 numParamsWritten; /**< How many material parameters were written to GPU parameter objects. */
+		UINT32 numOcclusionCulled; /**< How many renderables were culled because they were hidden behind occluders. */
+
+		UINT64 peakRenderTargetMemory; /**< Highest amount of render target memory in use at the same time, in bytes. */
 	};
 
 	/** Profiler report containing information about GPU sampling data from a single frame. */
@@ -30,7 +30,8 @@ namespace BansheeEngine
 		: numDrawCalls(0), numComputeCalls(0), numRenderTargetChanges(0), numPresents(0), numClears(0),
 		  numVertices(0), numPrimitives(0), numBlendStateChanges(0), numRasterizerStateChanges(0), 
 		  numDepthStencilStateChanges(0), numTextureBinds(0), numSamplerBinds(0), numVertexBufferBinds(0), 
-		  numIndexBufferBinds(0), numGpuParamBufferBinds(0), numGpuProgramBinds(0)
+		  numIndexBufferBinds(0), numGpuParamBufferBinds(0), numGpuProgramBinds(0), numParamsWritten(0),
+		  numOcclusionCulled(0), peakRenderTargetMemory(0)
 		{ }
 
 		UINT64 numDrawCalls;
@@ -58,6 +59,11 @@ namespace BansheeEngine
 
 		UINT64 numObjectsCreated; 
 		UINT64 numObjectsDestroyed;
+
+		UINT64 numParamsWritten;
+		UINT64 numOcclusionCulled;
+
+		UINT64 peakRenderTargetMemory;
 	};
 
 	/**
@@ -167,6 +173,18 @@ namespace BansheeEngine
 		 */
 		void incResWrite(UINT32 category) { mData.numResourceWrites++; }
 
+		/** Increments the counter indicating how many material parameters were written to GPU parameter objects. */
+		void addNumParamsWritten(UINT32 count) { mData.numParamsWritten += count; }
+
+		/** Increments the counter indicating how many renderables were hidden behind occluders. */
+		void addNumOcclusionCulled(UINT32 count) { mData.numOcclusionCulled += count; }
+
+		/** 
+		 * Increments the counter of the highest amount of render target memory in use at the same time during a frame, 
+		 * in bytes.
+		 */
+		void addPeakRenderTargetMemory(UINT64 size) { mData.peakRenderTargetMemory += size; }
+
 		/**
 		 * Returns an object containing various rendering statistics.
 		 *			
@@ -28,6 +28,16 @@ namespace BansheeEngine
 		UINT32 scale;
 	};
 
+	/** 
+	 * Pairs a skeleton bone with the animation curve that animates it. Used for evaluating only the bones that are enabled
+	 * and animated by a clip, without having to check the mask and the curve mapping of each bone.
+	 */
+	struct AnimationCurveBinding
+	{
+		UINT32 bone; /**< Index of the bone in the skeleton. */
+		UINT32 curve; /**< Index of the curve in the relevant AnimationCurves array. */
+	};
+
 	/** Information about a single bone used for constructing a skeleton. */
 	struct BONE_DESC
 	{
@@ -44,6 +54,13 @@ namespace BansheeEngine
 		AnimationCurveMapping* boneToCurveMapping; /**< Mapping of bone indices to curve indices for quick lookup .*/
 		AnimationCurveMapping* soToCurveMapping; /**< Mapping of scene object indices to curve indices for quick lookup. */
 
+		AnimationCurveBinding* positionBindings; /**< Enabled bones animated by a position curve. */
+		AnimationCurveBinding* rotationBindings; /**< Enabled bones animated by a rotation curve. */
+		AnimationCurveBinding* scaleBindings; /**< Enabled bones animated by a scale curve. */
+		UINT32 numPositionBindings; /**< Number of entries in @p positionBindings. */
+		UINT32 numRotationBindings; /**< Number of entries in @p rotationBindings. */
+		UINT32 numScaleBindings; /**< Number of entries in @p scaleBindings. */
+
 		TCurveCache<Vector3>* positionCaches; /**< Cache used for evaluating position curves. */
 		TCurveCache<Quaternion>* rotationCaches; /**< Cache used for evaluating rotation curves. */
 		TCurveCache<Vector3>* scaleCaches; /**< Cache used for evaluating scale curves. */
@@ -136,14 +153,49 @@ namespace BansheeEngine
 		 *
 		 * @param[out]	pose		Output pose containing the requested transforms. Must be pre-allocated with enough space
 		 *							to hold all the bone matrices of this skeleton.
-		 * @param[in]	mask		Mask that filters which skeleton bones are enabled or disabled.
 		 * @param[out]	localPose	Output pose containing the local transforms. Must be pre-allocated with enough space
 		 *							to hold all the bone data of this skeleton.
-		 * @param[in]	layers		One or multiple layers, containing one or multiple animation states to evaluate.
+		 * @param[in]	layers		One or multiple layers, containing one or multiple animation states to evaluate. Curve
+		 *							bindings of each state must have been populated by buildCurveBindings().
 		 * @param[in]	numLayers	Number of layers in the @p layers array.
+		 * @param[in]	maxBones	Maximum number of bones to evaluate. Bones closest to the root are evaluated first, while
+		 *							the remaining bones keep the local transforms already present in @p localPose.
+		 */
+		void getPose(Matrix4* pose, LocalSkeletonPose& localPose, const AnimationStateLayer* layers, UINT32 numLayers,
+			UINT32 maxBones = (UINT32)-1);
+
+		/** 
+		 * Outputs a skeleton pose by interpolating between two previously evaluated local poses.
+		 *
+		 * @param[out]		pose		Output pose containing the requested transforms. Must be pre-allocated with enough
+		 *								space to hold all the bone matrices of this skeleton.
+		 * @param[in, out]	localPose	Output pose containing the interpolated local transforms. Its override flags must
+		 *								be populated for any bones whose transforms were overriden externally.
+		 * @param[in]		from		Local pose to interpolate from.
+		 * @param[in]		to			Local pose to interpolate to.
+		 * @param[in]		t			Interpolation parameter in range [0, 1]. t = 0 outputs @p from, t = 1 outputs @p to.
+		 */
+		void getPose(Matrix4* pose, LocalSkeletonPose& localPose, const LocalSkeletonPose& from, 
+			const LocalSkeletonPose& to, float t);
+
+		/** 
+		 * Evaluates the local transforms of the skeleton bones, without calculating the bone matrices. 
+		 *
+		 * @see getPose(Matrix4*, LocalSkeletonPose&, const AnimationStateLayer*, UINT32, UINT32)
+		 */
+		void getLocalPose(LocalSkeletonPose& localPose, const AnimationStateLayer* layers, UINT32 numLayers,
+			UINT32 maxBones = (UINT32)-1) const;
+
+		/**
+		 * Populates the position, rotation and scale curve bindings of the animation state, using its bone to curve 
+		 * mapping. Only bones that are enabled by the mask and have a curve mapped to them are included. 
+		 *
+		 * @param[in]		mask	Mask that filters which skeleton bones are enabled or disabled.
+		 * @param[in, out]	state	State whose bindings to populate. Its bone to curve mapping must be populated, and
+		 *							each of its binding arrays must be pre-allocated with enough space to hold an entry
+		 *							for every bone of this skeleton.
 		 */
-		void getPose(Matrix4* pose, LocalSkeletonPose& localPose, const SkeletonMask& mask, 
-			const AnimationStateLayer* layers, UINT32 numLayers);
+		void buildCurveBindings(const SkeletonMask& mask, AnimationState& state) const;
 
 		/** Returns the total number of bones in the skeleton. */
 		UINT32 getNumBones() const { return mNumBones; }
@@ -169,9 +221,24 @@ namespace BansheeEngine
 		Skeleton();
 		Skeleton(BONE_DESC* bones, UINT32 numBones);
 
+		/** Calculates the bone evaluation order so that parent bones always come before their children. */
+		void calculateBoneOrder();
+
+		/** Calculates bone matrices from the provided local pose. */
+		void calculateGlobalPose(Matrix4* pose, const LocalSkeletonPose& localPose) const;
+
+		/** 
+		 * Returns the number of curve bindings that reference bones among the first @p numActiveBones bones in the
+		 * evaluation order.
+		 */
+		UINT32 getNumActiveBindings(const AnimationCurveBinding* bindings, UINT32 numBindings, 
+			UINT32 numActiveBones) const;
+
 		UINT32 mNumBones;
 		Matrix4* mInvBindPoses;
 		SkeletonBoneInfo* mBoneInfo;
+		UINT32* mBoneOrder;
+		UINT32* mBoneOrderIdx;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
@@ -26,6 +26,9 @@ namespace BansheeEngine
 		 */
 		bool isEnabled(UINT32 boneIdx) const;
 
+		/** Checks if both masks enable and disable the same bones. */
+		bool operator==(const SkeletonMask& rhs) const { return mIsDisabled == rhs.mIsDisabled; }
+
 	private:
 		friend class SkeletonMaskBuilder;
 
@@ -70,6 +70,18 @@ namespace BansheeEngine
 		 */
 		virtual SPtr<ImportOptions> createImportOptions() const;
 
+		/**
+		 * Checks can the importer import multiple files at once, from different threads. Importers that can't are never
+		 * used by more than one thread at a time.
+		 */
+		virtual bool isThreadSafe() const { return false; }
+
+		/**
+		 * Returns the version of the data output by the importer. Should be increased whenever a change to the importer
+		 * changes the imported resources, so previously cached imports are invalidated.
+		 */
+		virtual UINT32 getVersion() const { return 0; }
+
 		/**
 		 * Gets the default import options.
 		 *
@@ -78,7 +90,11 @@ namespace BansheeEngine
 		SPtr<const ImportOptions> getDefaultImportOptions() const;
 
 	private:
+		friend class Importer;
+
 		mutable SPtr<const ImportOptions> mDefaultImportOptions;
+		mutable Mutex mDefaultImportOptionsMutex;
+		Mutex mImportMutex;
 	};
 
 	/** @} */
@@ -27,5 +27,26 @@ namespace BansheeEngine
 		DrawOperationType drawOp;
 	};
 
+	/** 
+	 * Simplified version of a mesh's geometry, used for rendering the mesh when it takes up a small portion of the
+	 * screen. A level of detail uses the same vertices as the base mesh, and contains its own set of indices for each
+	 * of the base mesh's sub-meshes.
+	 */
+	struct BS_CORE_EXPORT MeshLOD
+	{
+		MeshLOD()
+			: screenSize(0.0f)
+		{ }
+
+		/** 
+		 * Size of the mesh's bounding sphere, projected on screen and relative to screen height, below which this level 
+		 * of detail will be used.
+		 */
+		float screenSize;
+
+		/** Index ranges for each of the base mesh's sub-meshes, in the same order. */
+		Vector<SubMesh> subMeshes;
+	};
+
 	/** @} */
 }
\ No newline at end of file
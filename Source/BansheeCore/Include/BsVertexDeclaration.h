@@ -53,6 +53,11 @@ namespace BansheeEngine
 		VET_UINT2 = 22,  /**< 2D 32-bit signed integer value */
 		VET_UINT3 = 23,  /**< 3D 32-bit signed integer value */
 		VET_UBYTE4_NORM = 24, /**< 4D 8-bit unsigned integer interpreted as a normalized value in [0, 1] range. */
+		VET_HALF2 = 25, /**< 2D 16-bit floating point value */
+		VET_HALF4 = 26, /**< 4D 16-bit floating point value */
+		VET_SHORT2_NORM = 27, /**< 2D 16-bit signed integer interpreted as a normalized value in [-1, 1] range. */
+		VET_SHORT4_NORM = 28, /**< 4D 16-bit signed integer interpreted as a normalized value in [-1, 1] range. */
+		VET_UNKNOWN = 0xffff /**< Invalid type, used when no element of a requested semantic exists. */
     };
 
 	/**	Describes a single vertex element in a vertex declaration. */
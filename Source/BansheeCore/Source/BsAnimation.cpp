@@ -35,7 +35,8 @@ namespace BansheeEngine
 	AnimationProxy::AnimationProxy(UINT64 id)
 		: id(id), layers(nullptr), numLayers(0), numSceneObjects(0), sceneObjectInfos(nullptr)
 		, sceneObjectTransforms(nullptr), morphShapeInfos(nullptr), numMorphShapes(0), numMorphVertices(0)
-		, morphShapeWeightsDirty(false), mCullEnabled(true), numGenericCurves(0), genericCurveOutputs(nullptr)
+		, morphShapeWeightsDirty(false), mCullEnabled(true), lodLatestPoseIdx(0), lodPosesValid(false)
+		, skeletonPoseValid(false), numGenericCurves(0), genericCurveOutputs(nullptr)
 	{ }
 
 	AnimationProxy::~AnimationProxy()
@@ -129,6 +130,9 @@ namespace BansheeEngine
 		if (skeleton != nullptr)
 			skeletonPose = LocalSkeletonPose(skeleton->getNumBones());
 
+		skeletonPoseValid = false;
+		lodPosesValid = false;
+
 		numSceneObjects = (UINT32)sceneObjects.size();
 		if (numSceneObjects > 0)
 			sceneObjectPose = LocalSkeletonPose(numSceneObjects);
@@ -269,6 +273,7 @@ namespace BansheeEngine
 			UINT32 layersSize = sizeof(AnimationStateLayer) * numLayers;
 			UINT32 clipsSize = sizeof(AnimationState) * numClips;
 			UINT32 boneMappingSize = numBoneMappings * sizeof(AnimationCurveMapping);
+			UINT32 curveBindingSize = numBoneMappings * 3 * sizeof(AnimationCurveBinding);
 			UINT32 posCacheSize = numPosCurves * sizeof(TCurveCache<Vector3>);
 			UINT32 rotCacheSize = numRotCurves * sizeof(TCurveCache<Quaternion>);
 			UINT32 scaleCacheSize = numScaleCurves * sizeof(TCurveCache<Vector3>);
@@ -278,8 +283,8 @@ namespace BansheeEngine
 			UINT32 sceneObjectTransformsSize = numBoneMappedSOs * sizeof(Matrix4);
 			UINT32 morphShapeSize = numMorphShapes * sizeof(MorphShapeInfo);
 
-			UINT8* data = (UINT8*)bs_alloc(layersSize + clipsSize + boneMappingSize + posCacheSize + rotCacheSize + 
-				scaleCacheSize + genCacheSize + genericCurveOutputSize + sceneObjectIdsSize + sceneObjectTransformsSize +
+			UINT8* data = (UINT8*)bs_alloc(layersSize + clipsSize + boneMappingSize + curveBindingSize + posCacheSize + 
+				rotCacheSize + scaleCacheSize + genCacheSize + genericCurveOutputSize + sceneObjectIdsSize + sceneObjectTransformsSize +
 				morphShapeSize);
 
 			layers = (AnimationStateLayer*)data;
@@ -298,6 +303,9 @@ namespace BansheeEngine
 
 			data += boneMappingSize;
 
+			AnimationCurveBinding* curveBindings = (AnimationCurveBinding*)data;
+			data += curveBindingSize;
+
 			TCurveCache<Vector3>* posCache = (TCurveCache<Vector3>*)data;
 			for (UINT32 i = 0; i < numPosCurves; i++)
 				new (&posCache[i]) TCurveCache<Vector3>();
@@ -441,9 +449,24 @@ namespace BansheeEngine
 							for (UINT32 i = 0; i < numBones; i++)
 								state.boneToCurveMapping[i] = emptyMapping;
 						}
+
+						AnimationCurveBinding* stateBindings = &curveBindings[curStateIdx * numBones * 3];
+						state.positionBindings = stateBindings;
+						state.rotationBindings = stateBindings + numBones;
+						state.scaleBindings = stateBindings + numBones * 2;
+
+						skeleton->buildCurveBindings(skeletonMask, state);
 					}
 					else
+					{
 						state.boneToCurveMapping = nullptr;
+						state.positionBindings = nullptr;
+						state.rotationBindings = nullptr;
+						state.scaleBindings = nullptr;
+						state.numPositionBindings = 0;
+						state.numRotationBindings = 0;
+						state.numScaleBindings = 0;
+					}
 
 					layer.numStates++;
 					curStateIdx++;
@@ -687,6 +710,18 @@ namespace BansheeEngine
 		mDirty |= AnimDirtyStateFlag::Culling;
 	}
 
+	void Animation::setLODs(const Vector<AnimationLOD>& lods)
+	{
+		mLODs = lods;
+		std::sort(mLODs.begin(), mLODs.end(), 
+			[](const AnimationLOD& a, const AnimationLOD& b)
+		{
+			return a.screenSize > b.screenSize;
+		});
+
+		mDirty |= AnimDirtyStateFlag::LOD;
+	}
+
 	void Animation::play(const HAnimationClip& clip)
 	{
 		AnimationClipInfo* clipInfo = addClip(clip, (UINT32)-1);
@@ -1211,6 +1246,13 @@ namespace BansheeEngine
 			mDirty.unset(AnimDirtyStateFlag::Culling);
 		}
 
+		if (mDirty.isSet(AnimDirtyStateFlag::LOD))
+		{
+			mAnimProxy->lods = mLODs;
+
+			mDirty.unset(AnimDirtyStateFlag::LOD);
+		}
+
 		auto getAnimatedSOList = [&]()
 		{
 			Vector<AnimatedSceneObject> animatedSO(mSceneObjects.size());
@@ -7,35 +7,90 @@
 
 namespace BansheeEngine
 {
-
-	void AnimationCurves::addPositionCurve(const String& name, const TAnimationCurve<Vector3>& curve)
+	/** 
+	 * Adds or replaces a curve with the specified name, keeping the compressed curve array (if used) in sync. Compressed
+	 * version of a replaced curve is cleared, so the new uncompressed curve is used instead.
+	 */
+	template<class T>
+	void addCurve(Vector<TNamedAnimationCurve<T>>& curves, Vector<TCompressedAnimationCurve<T>>& compressedCurves,
+		const String& name, const TAnimationCurve<T>& curve)
 	{
-		auto iterFind = std::find_if(position.begin(), position.end(), [&](auto x) { return x.name == name; });
+		auto iterFind = std::find_if(curves.begin(), curves.end(), [&](auto& x) { return x.name == name; });
 
-		if (iterFind != position.end())
+		if (iterFind != curves.end())
+		{
 			iterFind->curve = curve;
+
+			if (!compressedCurves.empty())
+				compressedCurves[iterFind - curves.begin()] = TCompressedAnimationCurve<T>();
+		}
 		else
-			position.push_back({ name, AnimationCurveFlags(), curve });
+		{
+			curves.push_back({ name, AnimationCurveFlags(), curve });
+
+			if (!compressedCurves.empty())
+				compressedCurves.push_back(TCompressedAnimationCurve<T>());
+		}
 	}
 
-	void AnimationCurves::addRotationCurve(const String& name, const TAnimationCurve<Quaternion>& curve)
+	/** Removes a curve with the specified name, keeping the compressed curve array (if used) in sync. */
+	template<class T>
+	void removeCurve(Vector<TNamedAnimationCurve<T>>& curves, Vector<TCompressedAnimationCurve<T>>& compressedCurves,
+		const String& name)
 	{
-		auto iterFind = std::find_if(rotation.begin(), rotation.end(), [&](auto x) { return x.name == name; });
+		auto iterFind = std::find_if(curves.begin(), curves.end(), [&](auto& x) { return x.name == name; });
 
-		if (iterFind != rotation.end())
-			iterFind->curve = curve;
-		else
-			rotation.push_back({ name, AnimationCurveFlags(), curve });
+		if (iterFind != curves.end())
+		{
+			if (!compressedCurves.empty())
+				compressedCurves.erase(compressedCurves.begin() + (iterFind - curves.begin()));
+
+			curves.erase(iterFind);
+		}
 	}
 
-	void AnimationCurves::addScaleCurve(const String& name, const TAnimationCurve<Vector3>& curve)
+	/** Evaluates a curve at the specified index, preferring its compressed version if one exists. */
+	template<class T>
+	T evaluateCurve(const Vector<TNamedAnimationCurve<T>>& curves, 
+		const Vector<TCompressedAnimationCurve<T>>& compressedCurves, UINT32 idx, float time, 
+		const TCurveCache<T>& cache, bool loop)
 	{
-		auto iterFind = std::find_if(scale.begin(), scale.end(), [&](auto x) { return x.name == name; });
+		if (!compressedCurves.empty() && !compressedCurves[idx].isEmpty())
+			return compressedCurves[idx].evaluate(time, cache, loop);
 
-		if (iterFind != scale.end())
-			iterFind->curve = curve;
-		else
-			scale.push_back({ name, AnimationCurveFlags(), curve });
+		return curves[idx].curve.evaluate(time, cache, loop);
+	}
+
+	/** Returns a curve at the specified index, decompressing it if it has a compressed version. */
+	template<class T>
+	TNamedAnimationCurve<T> getCurve(const Vector<TNamedAnimationCurve<T>>& curves, 
+		const Vector<TCompressedAnimationCurve<T>>& compressedCurves, UINT32 idx)
+	{
+		if (compressedCurves.empty() || compressedCurves[idx].isEmpty())
+			return curves[idx];
+
+		TNamedAnimationCurve<T> output = curves[idx];
+		output.curve = compressedCurves[idx].decompress();
+
+		return output;
+	}
+
+	void AnimationCurves::addPositionCurve(const String& name, const TAnimationCurve<Vector3>& curve)
+	{
+		addCurve(position, compressedPosition, name, curve);
+		baked = BakedAnimationCurves();
+	}
+
+	void AnimationCurves::addRotationCurve(const String& name, const TAnimationCurve<Quaternion>& curve)
+	{
+		addCurve(rotation, compressedRotation, name, curve);
+		baked = BakedAnimationCurves();
+	}
+
+	void AnimationCurves::addScaleCurve(const String& name, const TAnimationCurve<Vector3>& curve)
+	{
+		addCurve(scale, compressedScale, name, curve);
+		baked = BakedAnimationCurves();
 	}
 
 	void AnimationCurves::addGenericCurve(const String& name, const TAnimationCurve<float>& curve)
@@ -50,26 +105,20 @@ namespace BansheeEngine
 
 	void AnimationCurves::removePositionCurve(const String& name)
 	{
-		auto iterFind = std::find_if(position.begin(), position.end(), [&](auto x) { return x.name == name; });
-
-		if (iterFind != position.end())
-			position.erase(iterFind);
+		removeCurve(position, compressedPosition, name);
+		baked = BakedAnimationCurves();
 	}
 
 	void AnimationCurves::removeRotationCurve(const String& name)
 	{
-		auto iterFind = std::find_if(rotation.begin(), rotation.end(), [&](auto x) { return x.name == name; });
-
-		if (iterFind != rotation.end())
-			rotation.erase(iterFind);
+		removeCurve(rotation, compressedRotation, name);
+		baked = BakedAnimationCurves();
 	}
 
 	void AnimationCurves::removeScaleCurve(const String& name)
 	{
-		auto iterFind = std::find_if(scale.begin(), scale.end(), [&](auto x) { return x.name == name; });
-
-		if (iterFind != scale.end())
-			scale.erase(iterFind);
+		removeCurve(scale, compressedScale, name);
+		baked = BakedAnimationCurves();
 	}
 
 	void AnimationCurves::removeGenericCurve(const String& name)
@@ -80,6 +129,46 @@ namespace BansheeEngine
 			generic.erase(iterFind);
 	}
 
+	Vector3 AnimationCurves::evaluatePosition(UINT32 idx, float time, const TCurveCache<Vector3>& cache, bool loop) const
+	{
+		if (!baked.isEmpty())
+			return baked.evaluatePosition(idx, time, loop);
+
+		return evaluateCurve(position, compressedPosition, idx, time, cache, loop);
+	}
+
+	Quaternion AnimationCurves::evaluateRotation(UINT32 idx, float time, const TCurveCache<Quaternion>& cache, 
+		bool loop) const
+	{
+		if (!baked.isEmpty())
+			return baked.evaluateRotation(idx, time, loop);
+
+		return evaluateCurve(rotation, compressedRotation, idx, time, cache, loop);
+	}
+
+	Vector3 AnimationCurves::evaluateScale(UINT32 idx, float time, const TCurveCache<Vector3>& cache, bool loop) const
+	{
+		if (!baked.isEmpty())
+			return baked.evaluateScale(idx, time, loop);
+
+		return evaluateCurve(scale, compressedScale, idx, time, cache, loop);
+	}
+
+	TNamedAnimationCurve<Vector3> AnimationCurves::getPositionCurve(UINT32 idx) const
+	{
+		return getCurve(position, compressedPosition, idx);
+	}
+
+	TNamedAnimationCurve<Quaternion> AnimationCurves::getRotationCurve(UINT32 idx) const
+	{
+		return getCurve(rotation, compressedRotation, idx);
+	}
+
+	TNamedAnimationCurve<Vector3> AnimationCurves::getScaleCurve(UINT32 idx) const
+	{
+		return getCurve(scale, compressedScale, idx);
+	}
+
 	AnimationClip::AnimationClip()
 		: Resource(false), mVersion(0), mCurves(bs_shared_ptr_new<AnimationCurves>()), mIsAdditive(false), mLength(0.0f)
 		, mSampleRate(1)
@@ -147,6 +236,15 @@ namespace BansheeEngine
 		for (auto& entry : mCurves->scale)
 			mLength = std::max(mLength, entry.curve.getLength());
 
+		for (auto& entry : mCurves->compressedPosition)
+			mLength = std::max(mLength, entry.getLength());
+
+		for (auto& entry : mCurves->compressedRotation)
+			mLength = std::max(mLength, entry.getLength());
+
+		for (auto& entry : mCurves->compressedScale)
+			mLength = std::max(mLength, entry.getLength());
+
 		for (auto& entry : mCurves->generic)
 			mLength = std::max(mLength, entry.curve.getLength());
 	}
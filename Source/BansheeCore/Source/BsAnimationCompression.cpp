@@ -0,0 +1,634 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsAnimationCompression.h"
+#include "BsAnimationClip.h"
+#include "BsMath.h"
+#include "BsTimer.h"
+
+namespace BansheeEngine
+{
+	/** Contains information about how are values of a specific type stored in a compressed curve. */
+	template <class T>
+	struct CompressedCurveInfo
+	{ };
+
+	template <>
+	struct CompressedCurveInfo<Vector3>
+	{
+		enum { NUM_COMPONENTS = 3, NUM_VALUE_WORDS = 3 };
+	};
+
+	template <>
+	struct CompressedCurveInfo<Quaternion>
+	{
+		enum { NUM_COMPONENTS = 4, NUM_VALUE_WORDS = 3 };
+	};
+
+	/** Quantized value reserved for infinite tangents, used by constant (step) keyframes. */
+	static const UINT16 QUANTIZED_INFINITY = 0xFFFF;
+
+	/** Maximum quantized value a finite component can be assigned. */
+	static const float QUANTIZED_MAX = 65534.0f;
+
+	/** Maximum value that can be stored in each of the three smallest quaternion components. */
+	static const UINT32 QUAT_COMPONENT_MAX = 0x7FFF;
+
+	/** Square root of two, used for mapping the smallest quaternion components to [0, 1] range. */
+	static const float SQRT_2 = 1.41421356f;
+
+	/** Quantizes a single component to 16 bits, within the provided range. */
+	UINT16 quantizeComponent(float value, float min, float range)
+	{
+		if (value == std::numeric_limits<float>::infinity())
+			return QUANTIZED_INFINITY;
+
+		if (range <= 0.0f)
+			return 0;
+
+		float normalized = Math::clamp01((value - min) / range);
+		return (UINT16)Math::roundToInt(normalized * QUANTIZED_MAX);
+	}
+
+	/** Restores a component quantized with quantizeComponent(). */
+	float dequantizeComponent(UINT16 value, float min, float range)
+	{
+		if (value == QUANTIZED_INFINITY)
+			return std::numeric_limits<float>::infinity();
+
+		return min + (value / QUANTIZED_MAX) * range;
+	}
+
+	/** Calculates the range of all finite components of the provided values. */
+	template <class T>
+	void calculateRange(const Vector<T>& values, T& min, T& range)
+	{
+		for (UINT32 i = 0; i < (UINT32)CompressedCurveInfo<T>::NUM_COMPONENTS; i++)
+		{
+			float minValue = std::numeric_limits<float>::max();
+			float maxValue = -std::numeric_limits<float>::max();
+
+			for (auto& value : values)
+			{
+				if (value[i] == std::numeric_limits<float>::infinity() || value[i] == -std::numeric_limits<float>::infinity())
+					continue;
+
+				minValue = std::min(minValue, value[i]);
+				maxValue = std::max(maxValue, value[i]);
+			}
+
+			if (minValue > maxValue)
+			{
+				min[i] = 0.0f;
+				range[i] = 0.0f;
+			}
+			else
+			{
+				min[i] = minValue;
+				range[i] = maxValue - minValue;
+			}
+		}
+	}
+
+	/** Encodes a keyframe value into its compressed form. */
+	void encodeValue(const Vector3& value, const Vector3& min, const Vector3& range, UINT16* output)
+	{
+		for (UINT32 i = 0; i < 3; i++)
+			output[i] = quantizeComponent(value[i], min[i], range[i]);
+	}
+
+	/**
+	 * Encodes a rotation by storing its three smallest components quantized to 15 bits. The remaining bit of each
+	 * component stores the index of the largest component and its sign, so the value can be exactly reconstructed (as
+	 * opposed to just its orientation, which matters when interpolating with tangents).
+	 */
+	void encodeValue(const Quaternion& value, const Quaternion& min, const Quaternion& range, UINT16* output)
+	{
+		Quaternion normalized = value;
+		normalized.normalize();
+
+		UINT32 largestIdx = 0;
+		for (UINT32 i = 1; i < 4; i++)
+		{
+			if (Math::abs(normalized[i]) > Math::abs(normalized[largestIdx]))
+				largestIdx = i;
+		}
+
+		bool negative = normalized[largestIdx] < 0.0f;
+		UINT16 flags[3] = { (UINT16)(largestIdx & 0x1), (UINT16)((largestIdx >> 1) & 0x1), (UINT16)(negative ? 1 : 0) };
+
+		UINT32 outputIdx = 0;
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			if (i == largestIdx)
+				continue;
+
+			// Smallest components are always in range [-1/sqrt(2), 1/sqrt(2)]
+			float normalizedComponent = Math::clamp01(normalized[i] * SQRT_2 * 0.5f + 0.5f);
+			UINT16 quantized = (UINT16)Math::roundToInt(normalizedComponent * QUAT_COMPONENT_MAX);
+
+			output[outputIdx] = quantized | (flags[outputIdx] << 15);
+			outputIdx++;
+		}
+	}
+
+	/** Decodes a keyframe value encoded with encodeValue(). */
+	Vector3 decodeValue(const UINT16* input, const Vector3& min, const Vector3& range)
+	{
+		Vector3 output;
+		for (UINT32 i = 0; i < 3; i++)
+			output[i] = dequantizeComponent(input[i], min[i], range[i]);
+
+		return output;
+	}
+
+	Quaternion decodeValue(const UINT16* input, const Quaternion& min, const Quaternion& range)
+	{
+		UINT32 largestIdx = ((input[0] >> 15) & 0x1) | (((input[1] >> 15) & 0x1) << 1);
+		bool negative = ((input[2] >> 15) & 0x1) != 0;
+
+		Quaternion output;
+		float sumSquared = 0.0f;
+
+		UINT32 inputIdx = 0;
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			if (i == largestIdx)
+				continue;
+
+			float normalizedComponent = (input[inputIdx] & QUAT_COMPONENT_MAX) / (float)QUAT_COMPONENT_MAX;
+			output[i] = (normalizedComponent - 0.5f) * 2.0f / SQRT_2;
+
+			sumSquared += output[i] * output[i];
+			inputIdx++;
+		}
+
+		float largest = std::sqrt(std::max(0.0f, 1.0f - sumSquared));
+		output[largestIdx] = negative ? -largest : largest;
+
+		return output;
+	}
+
+	/** Checks does the keyframe have any infinite tangents, signifying a constant (step) function. */
+	template <class T>
+	bool hasStepTangent(const TKeyframe<T>& key)
+	{
+		for (UINT32 i = 0; i < (UINT32)CompressedCurveInfo<T>::NUM_COMPONENTS; i++)
+		{
+			if (key.inTangent[i] == std::numeric_limits<float>::infinity() ||
+				key.outTangent[i] == std::numeric_limits<float>::infinity())
+				return true;
+		}
+
+		return false;
+	}
+
+	/** Updates hermite curve coefficients for any components of the keyframes that are constant (step) functions. */
+	template <class T>
+	void applyStepCoefficients(const TKeyframe<T>& lhs, const TKeyframe<T>& rhs, T (&coefficients)[4])
+	{
+		for (UINT32 i = 0; i < (UINT32)CompressedCurveInfo<T>::NUM_COMPONENTS; i++)
+		{
+			if (lhs.outTangent[i] != std::numeric_limits<float>::infinity() &&
+				rhs.inTangent[i] != std::numeric_limits<float>::infinity())
+				continue;
+
+			coefficients[0][i] = 0.0f;
+			coefficients[1][i] = 0.0f;
+			coefficients[2][i] = 0.0f;
+			coefficients[3][i] = lhs.value[i];
+		}
+	}
+
+	/** Returns the difference between two curve values, used for measuring compression error. */
+	float getError(const Vector3& lhs, const Vector3& rhs)
+	{
+		return lhs.distance(rhs);
+	}
+
+	float getError(const Quaternion& lhs, const Quaternion& rhs)
+	{
+		Quaternion normLhs = lhs;
+		normLhs.normalize();
+
+		Quaternion normRhs = rhs;
+		normRhs.normalize();
+
+		float cosHalfAngle = std::min(1.0f, Math::abs(normLhs.dot(normRhs)));
+		return 2.0f * std::acos(cosHalfAngle);
+	}
+
+	template <class T>
+	const UINT32 TCompressedAnimationCurve<T>::CACHE_LOOKAHEAD = 3;
+
+	template <class T>
+	TCompressedAnimationCurve<T>::TCompressedAnimationCurve()
+		: mValueMin(BsZero), mValueRange(BsZero), mTangentMin(BsZero), mTangentRange(BsZero), mStart(0.0f), mEnd(0.0f)
+		, mLength(0.0f)
+	{ }
+
+	template <class T>
+	TCompressedAnimationCurve<T>::TCompressedAnimationCurve(const TAnimationCurve<T>& curve)
+		: mValueMin(BsZero), mValueRange(BsZero), mTangentMin(BsZero), mTangentRange(BsZero), mStart(0.0f), mEnd(0.0f)
+		, mLength(0.0f)
+	{
+		const UINT32 numComponents = CompressedCurveInfo<T>::NUM_COMPONENTS;
+		const UINT32 numValueWords = CompressedCurveInfo<T>::NUM_VALUE_WORDS;
+
+		UINT32 numKeys = curve.getNumKeyFrames();
+		if (numKeys == 0)
+			return;
+
+		Vector<T> values(numKeys);
+		Vector<T> tangents(numKeys * 2);
+		for (UINT32 i = 0; i < numKeys; i++)
+		{
+			const TKeyframe<T>& key = curve.getKeyFrame(i);
+
+			values[i] = key.value;
+			tangents[i * 2 + 0] = key.inTangent;
+			tangents[i * 2 + 1] = key.outTangent;
+		}
+
+		calculateRange(values, mValueMin, mValueRange);
+		calculateRange(tangents, mTangentMin, mTangentRange);
+
+		mTimes.resize(numKeys);
+		mValues.resize(numKeys * numValueWords);
+		mTangents.resize(numKeys * numComponents * 2);
+
+		for (UINT32 i = 0; i < numKeys; i++)
+		{
+			const TKeyframe<T>& key = curve.getKeyFrame(i);
+
+			mTimes[i] = key.time;
+			encodeValue(key.value, mValueMin, mValueRange, &mValues[i * numValueWords]);
+
+			UINT16* tangentData = &mTangents[i * numComponents * 2];
+			for (UINT32 j = 0; j < numComponents; j++)
+			{
+				tangentData[j] = quantizeComponent(key.inTangent[j], mTangentMin[j], mTangentRange[j]);
+				tangentData[numComponents + j] = quantizeComponent(key.outTangent[j], mTangentMin[j], mTangentRange[j]);
+			}
+		}
+
+		mStart = mTimes[0];
+		mEnd = mTimes.back();
+		mLength = mEnd - mStart;
+	}
+
+	template <class T>
+	T TCompressedAnimationCurve<T>::evaluate(float time, const TCurveCache<T>& cache, bool loop) const
+	{
+		if (mTimes.size() == 0)
+			return T(BsZero);
+
+		if (Math::approxEquals(mLength, 0.0f))
+			time = 0.0f;
+
+		// Wrap time if looping
+		if (loop)
+		{
+			if (time < mStart)
+				time = time + (std::floor(mEnd - time) / mLength) * mLength;
+			else if (time > mEnd)
+				time = time - std::floor((time - mStart) / mLength) * mLength;
+		}
+
+		// If time is within cache, evaluate it directly
+		if (time >= cache.cachedCurveStart && time < cache.cachedCurveEnd)
+			return evaluateCache(time, cache);
+
+		// Clamp to start, cache constant of the first key and return
+		if (time < mStart)
+		{
+			T value = getKeyFrame(0).value;
+
+			cache.cachedCurveStart = -std::numeric_limits<float>::infinity();
+			cache.cachedCurveEnd = mStart;
+			cache.cachedKey = 0;
+			cache.cachedCubicCoefficients[0] = T(BsZero);
+			cache.cachedCubicCoefficients[1] = T(BsZero);
+			cache.cachedCubicCoefficients[2] = T(BsZero);
+			cache.cachedCubicCoefficients[3] = value;
+
+			return value;
+		}
+
+		if (time >= mEnd) // Clamp to end, cache constant of the final key and return
+		{
+			UINT32 lastKey = (UINT32)mTimes.size() - 1;
+			T value = getKeyFrame(lastKey).value;
+
+			cache.cachedCurveStart = mEnd;
+			cache.cachedCurveEnd = std::numeric_limits<float>::infinity();
+			cache.cachedKey = lastKey;
+			cache.cachedCubicCoefficients[0] = T(BsZero);
+			cache.cachedCubicCoefficients[1] = T(BsZero);
+			cache.cachedCubicCoefficients[2] = T(BsZero);
+			cache.cachedCubicCoefficients[3] = value;
+
+			return value;
+		}
+
+		UINT32 leftKeyIdx;
+		UINT32 rightKeyIdx;
+
+		findKeys(time, cache, leftKeyIdx, rightKeyIdx);
+
+		// Keys only need to be decoded when moving to a new pair, after which the curve is evaluated from the cache
+		TKeyframe<T> leftKey = getKeyFrame(leftKeyIdx);
+		TKeyframe<T> rightKey = getKeyFrame(rightKeyIdx);
+
+		cache.cachedCurveStart = leftKey.time;
+		cache.cachedCurveEnd = rightKey.time;
+
+		float length = rightKey.time - leftKey.time;
+		assert(length > 0.0f);
+
+		Math::cubicHermiteCoefficients(leftKey.value, rightKey.value, leftKey.outTangent, rightKey.inTangent, length,
+			cache.cachedCubicCoefficients);
+
+		applyStepCoefficients(leftKey, rightKey, cache.cachedCubicCoefficients);
+
+		return evaluateCache(time, cache);
+	}
+
+	template <class T>
+	TAnimationCurve<T> TCompressedAnimationCurve<T>::decompress() const
+	{
+		UINT32 numKeys = (UINT32)mTimes.size();
+
+		Vector<TKeyframe<T>> keyframes(numKeys);
+		for (UINT32 i = 0; i < numKeys; i++)
+			keyframes[i] = getKeyFrame(i);
+
+		return TAnimationCurve<T>(keyframes);
+	}
+
+	template <class T>
+	TKeyframe<T> TCompressedAnimationCurve<T>::getKeyFrame(UINT32 idx) const
+	{
+		const UINT32 numComponents = CompressedCurveInfo<T>::NUM_COMPONENTS;
+		const UINT32 numValueWords = CompressedCurveInfo<T>::NUM_VALUE_WORDS;
+
+		TKeyframe<T> output;
+		output.time = mTimes[idx];
+		output.value = decodeValue(&mValues[idx * numValueWords], mValueMin, mValueRange);
+
+		const UINT16* tangentData = &mTangents[idx * numComponents * 2];
+		for (UINT32 i = 0; i < numComponents; i++)
+		{
+			output.inTangent[i] = dequantizeComponent(tangentData[i], mTangentMin[i], mTangentRange[i]);
+			output.outTangent[i] = dequantizeComponent(tangentData[numComponents + i], mTangentMin[i], mTangentRange[i]);
+		}
+
+		return output;
+	}
+
+	template <class T>
+	UINT32 TCompressedAnimationCurve<T>::getMemoryUsage() const
+	{
+		return (UINT32)(mTimes.size() * sizeof(float) + mValues.size() * sizeof(UINT16) +
+			mTangents.size() * sizeof(UINT16));
+	}
+
+	template <class T>
+	T TCompressedAnimationCurve<T>::evaluateCache(float time, const TCurveCache<T>& cache) const
+	{
+		float t = time - cache.cachedCurveStart;
+
+		const T* coeffs = cache.cachedCubicCoefficients;
+		return t * (t * (t * coeffs[0] + coeffs[1]) + coeffs[2]) + coeffs[3];
+	}
+
+	template <class T>
+	void TCompressedAnimationCurve<T>::findKeys(float time, const TCurveCache<T>& cache, UINT32& leftKey,
+		UINT32& rightKey) const
+	{
+		UINT32 numKeys = (UINT32)mTimes.size();
+
+		// Check nearby keys first if there is cached data
+		if (cache.cachedKey != (UINT32)-1)
+		{
+			if (time >= mTimes[cache.cachedKey])
+			{
+				UINT32 end = std::min(numKeys, cache.cachedKey + CACHE_LOOKAHEAD + 1);
+				for (UINT32 i = cache.cachedKey + 1; i < end; i++)
+				{
+					if (time < mTimes[i])
+					{
+						leftKey = i - 1;
+						rightKey = i;
+
+						cache.cachedKey = leftKey;
+						return;
+					}
+				}
+			}
+			else
+			{
+				UINT32 start = (UINT32)std::max(0, (INT32)cache.cachedKey - (INT32)CACHE_LOOKAHEAD);
+				for (UINT32 i = start; i < cache.cachedKey; i++)
+				{
+					if (time >= mTimes[i])
+					{
+						leftKey = i;
+						rightKey = i + 1;
+
+						cache.cachedKey = leftKey;
+						return;
+					}
+				}
+			}
+		}
+
+		// Cannot find nearby ones, search all keys
+		INT32 start = (INT32)(std::upper_bound(mTimes.begin(), mTimes.end(), time) - mTimes.begin());
+
+		leftKey = (UINT32)std::max(0, start - 1);
+		rightKey = (UINT32)std::min(start, (INT32)numKeys - 1);
+		cache.cachedKey = leftKey;
+	}
+
+	template class TCompressedAnimationCurve<Vector3>;
+	template class TCompressedAnimationCurve<Quaternion>;
+
+	/**
+	 * Maximum number of original keyframes a single segment of a reduced curve can span. Limits the cost of validating
+	 * each segment extension, which otherwise grows quadratically with the number of removed keys.
+	 */
+	static const UINT32 MAX_REDUCED_SEGMENT_KEYS = 32;
+
+	/** Maximum number of times a curve is reduced with a tighter error, if quantization pushed it over the limit. */
+	static const UINT32 MAX_REDUCTION_ATTEMPTS = 4;
+
+	template <class T>
+	TAnimationCurve<T> AnimationCompression::reduceKeyframes(const TAnimationCurve<T>& curve, float maxError)
+	{
+		UINT32 numKeys = curve.getNumKeyFrames();
+		if (numKeys <= 2)
+			return curve;
+
+		// Sample the original curve half-way between each pair of keys once, so validating a segment doesn't need to
+		// re-evaluate the curve
+		Vector<T> midValues(numKeys - 1);
+
+		TCurveCache<T> cache;
+		for (UINT32 i = 0; i < numKeys - 1; i++)
+		{
+			float midTime = (curve.getKeyFrame(i).time + curve.getKeyFrame(i + 1).time) * 0.5f;
+			midValues[i] = curve.evaluate(midTime, cache, false);
+		}
+
+		Vector<TKeyframe<T>> keyframes;
+		keyframes.push_back(curve.getKeyFrame(0));
+
+		// Greedily extend the segment starting at the last kept key, for as long as the segment stays within the error
+		// of the original curve, both at the removed keys and in-between them
+		UINT32 leftIdx = 0;
+		for (UINT32 i = 1; i < numKeys - 1; i++)
+		{
+			const TKeyframe<T>& leftKey = curve.getKeyFrame(leftIdx);
+			const TKeyframe<T>& rightKey = curve.getKeyFrame(i + 1);
+
+			bool canRemove = (i - leftIdx) < MAX_REDUCED_SEGMENT_KEYS && !hasStepTangent(leftKey) &&
+				!hasStepTangent(curve.getKeyFrame(i)) && !hasStepTangent(rightKey);
+
+			float length = rightKey.time - leftKey.time;
+			if (length <= 0.0f)
+				canRemove = false;
+
+			for (UINT32 j = leftIdx; j <= i && canRemove; j++)
+			{
+				const TKeyframe<T>& segmentKey = curve.getKeyFrame(j + 1);
+				float midTime = (curve.getKeyFrame(j).time + segmentKey.time) * 0.5f;
+
+				float sampleTimes[2] = { midTime, segmentKey.time };
+				const T* originalValues[2] = { &midValues[j], &segmentKey.value };
+				UINT32 numSamples = j < i ? 2 : 1;
+
+				for (UINT32 k = 0; k < numSamples; k++)
+				{
+					float t = (sampleTimes[k] - leftKey.time) / length;
+
+					T reducedValue = Math::cubicHermite(t, leftKey.value, rightKey.value, leftKey.outTangent * length,
+						rightKey.inTangent * length);
+
+					if (getError(*originalValues[k], reducedValue) > maxError)
+					{
+						canRemove = false;
+						break;
+					}
+				}
+			}
+
+			if (!canRemove)
+			{
+				keyframes.push_back(curve.getKeyFrame(i));
+				leftIdx = i;
+			}
+		}
+
+		keyframes.push_back(curve.getKeyFrame(numKeys - 1));
+		return TAnimationCurve<T>(keyframes);
+	}
+
+	template TAnimationCurve<Vector3> AnimationCompression::reduceKeyframes(const TAnimationCurve<Vector3>&, float);
+	template TAnimationCurve<Quaternion> AnimationCompression::reduceKeyframes(const TAnimationCurve<Quaternion>&, float);
+
+	/**
+	 * Reduces and quantizes all curves in the provided array, measuring the introduced error and the evaluation time
+	 * before and after compression. Error is measured on the quantized curve, and if quantization pushes it over
+	 * @p maxError the curve is reduced again with a tighter tolerance. If all keys are kept and quantization alone
+	 * exceeds the error, the measured error is reported as is.
+	 */
+	template <class T>
+	void compressCurves(Vector<TNamedAnimationCurve<T>>& curves, Vector<TCompressedAnimationCurve<T>>& output,
+		float maxError, float& measuredError, AnimationCompressionStats& stats)
+	{
+		output.resize(curves.size());
+
+		Timer timer;
+		for (UINT32 i = 0; i < (UINT32)curves.size(); i++)
+		{
+			TAnimationCurve<T>& curve = curves[i].curve;
+			UINT32 numKeys = curve.getNumKeyFrames();
+
+			// Sample at the original keys and half-way between them
+			UINT32 numSamples = numKeys > 0 ? numKeys * 2 - 1 : 0;
+			Vector<float> sampleTimes(numSamples);
+			for (UINT32 j = 0; j < numKeys; j++)
+			{
+				sampleTimes[j * 2] = curve.getKeyFrame(j).time;
+
+				if (j + 1 < numKeys)
+					sampleTimes[j * 2 + 1] = (curve.getKeyFrame(j).time + curve.getKeyFrame(j + 1).time) * 0.5f;
+			}
+
+			Vector<T> originalValues(numSamples);
+			Vector<T> compressedValues(numSamples);
+
+			TCurveCache<T> originalCache;
+			timer.reset();
+			for (UINT32 j = 0; j < numSamples; j++)
+				originalValues[j] = curve.evaluate(sampleTimes[j], originalCache, false);
+
+			stats.originalEvaluationTime += timer.getMicroseconds();
+
+			float curveError = 0.0f;
+			float reductionError = maxError;
+			for (UINT32 j = 0; j < MAX_REDUCTION_ATTEMPTS; j++)
+			{
+				TAnimationCurve<T> reducedCurve = AnimationCompression::reduceKeyframes(curve, reductionError);
+				output[i] = TCompressedAnimationCurve<T>(reducedCurve);
+
+				TCurveCache<T> compressedCache;
+				curveError = 0.0f;
+				for (UINT32 k = 0; k < numSamples; k++)
+				{
+					T compressedValue = output[i].evaluate(sampleTimes[k], compressedCache, false);
+					curveError = std::max(curveError, getError(originalValues[k], compressedValue));
+				}
+
+				if (curveError <= maxError)
+					break;
+
+				// Keep all keys on the final attempt, any remaining error is then purely due to quantization
+				if (j + 2 == MAX_REDUCTION_ATTEMPTS)
+					reductionError = 0.0f;
+				else
+					reductionError *= 0.5f;
+			}
+
+			measuredError = std::max(measuredError, curveError);
+
+			stats.originalNumKeys += numKeys;
+			stats.compressedNumKeys += output[i].getNumKeyFrames();
+			stats.originalSize += numKeys * sizeof(TKeyframe<T>);
+			stats.compressedSize += output[i].getMemoryUsage();
+
+			TCurveCache<T> compressedCache;
+			timer.reset();
+			for (UINT32 j = 0; j < numSamples; j++)
+				compressedValues[j] = output[i].evaluate(sampleTimes[j], compressedCache, false);
+
+			stats.compressedEvaluationTime += timer.getMicroseconds();
+
+			// Release the uncompressed keyframes, the compressed curve is used from now on
+			curve = TAnimationCurve<T>();
+		}
+	}
+
+	AnimationCompressionStats AnimationCompression::compress(AnimationCurves& curves, float maxPositionError,
+		float maxRotationError, float maxScaleError)
+	{
+		AnimationCompressionStats stats;
+		memset(&stats, 0, sizeof(stats));
+
+		compressCurves(curves.position, curves.compressedPosition, maxPositionError, stats.maxPositionError, stats);
+		compressCurves(curves.rotation, curves.compressedRotation, maxRotationError, stats.maxRotationError, stats);
+		compressCurves(curves.scale, curves.compressedScale, maxScaleError, stats.maxScaleError, stats);
+
+		return stats;
+	}
+}
@@ -15,7 +15,7 @@ namespace BansheeEngine
 {
 	AnimationManager::AnimationManager()
 		: mNextId(1), mUpdateRate(1.0f / 60.0f), mAnimationTime(0.0f), mLastAnimationUpdateTime(0.0f)
-		, mNextAnimationUpdateTime(0.0f), mPaused(false), mWorkerRunning(false), mPoseReadBufferIdx(1)
+		, mNextAnimationUpdateTime(0.0f), mUpdateCount(0), mPoseSharingTimeStep(0.0f), mPaused(false), mWorkerRunning(false), mPoseReadBufferIdx(1)
 		, mPoseWriteBufferIdx(0), mDataReadyCount(0), mDataReady(false)
 	{
 		mAnimationWorker = Task::create("Animation", std::bind(&AnimationManager::evaluateAnimation, this));
@@ -38,6 +38,11 @@ namespace BansheeEngine
 		mUpdateRate = 1.0f / fps;
 	}
 
+	void AnimationManager::setPoseSharingTimeStep(float timeStep)
+	{
+		mPoseSharingTimeStep = timeStep;
+	}
+
 	void AnimationManager::preUpdate()
 	{
 		if (mPaused || !mWorkerRunning)
@@ -71,6 +76,7 @@ namespace BansheeEngine
 
 		float timeDelta = mAnimationTime - mLastAnimationUpdateTime;
 		mLastAnimationUpdateTime = mAnimationTime;
+		mUpdateCount++;
 
 		// Update poses in the currently active buffer. Multi-buffering allows the core thread to safely read the
 		// poses without worrying about them being overwritten by another call to postUpdate, as long as the simulation
@@ -83,6 +89,7 @@ namespace BansheeEngine
 		}
 
 		mCullFrustums.clear();
+		mLODCameras.clear();
 
 		auto& allCameras = gCoreSceneManager().getAllCameras();
 		for(auto& entry : allCameras)
@@ -94,6 +101,17 @@ namespace BansheeEngine
 			// TODO: Not checking if camera and animation renderable's layers match. If we checked more animations could
 			// be culled.
 			mCullFrustums.push_back(entry.second.camera->getWorldFrustum());
+
+			LODCameraInfo lodCamera;
+			lodCamera.position = entry.second.camera->getPosition();
+			lodCamera.orthographic = entry.second.camera->getProjectionType() == PT_ORTHOGRAPHIC;
+
+			if (lodCamera.orthographic)
+				lodCamera.screenScale = 2.0f / std::max(entry.second.camera->getOrthoWindowHeight(), 0.0001f);
+			else
+				lodCamera.screenScale = entry.second.camera->getProjectionMatrix()[1][1];
+
+			mLODCameras.push_back(lodCamera);
 		}
 
 		// Make sure thread finishes writing all changes to the anim proxies as they will be read by the animation thread
@@ -107,6 +125,191 @@ namespace BansheeEngine
 		mWorkerRunning = true;
 	}
 
+	/** Copies local transforms and override flags of all bones from one pose to another with the same number of bones. */
+	void copyPose(const LocalSkeletonPose& src, LocalSkeletonPose& dst)
+	{
+		assert(src.numBones == dst.numBones);
+
+		memcpy(dst.positions, src.positions, sizeof(Vector3) * src.numBones);
+		memcpy(dst.rotations, src.rotations, sizeof(Quaternion) * src.numBones);
+		memcpy(dst.scales, src.scales, sizeof(Vector3) * src.numBones);
+		memcpy(dst.hasOverride, src.hasOverride, sizeof(bool) * src.numBones);
+	}
+
+	/** Returns the time of an animation state, quantized to multiples of the provided time step (if non-zero). */
+	float quantizeTime(float time, float timeStep)
+	{
+		if (timeStep > 0.0f)
+			return Math::floor(time / timeStep);
+
+		return time;
+	}
+
+	/** 
+	 * Generates a hash from all the animation proxy data that determines its skeleton pose. Animation state times are
+	 * quantized using the provided time step.
+	 */
+	size_t getPoseHash(const AnimationProxy& anim, float timeStep)
+	{
+		size_t hash = 0;
+		hash_combine(hash, anim.skeleton.get());
+		hash_combine(hash, anim.numLayers);
+
+		for(UINT32 i = 0; i < anim.numLayers; i++)
+		{
+			const AnimationStateLayer& layer = anim.layers[i];
+			hash_combine(hash, layer.additive);
+			hash_combine(hash, layer.numStates);
+
+			for(UINT32 j = 0; j < layer.numStates; j++)
+			{
+				const AnimationState& state = layer.states[j];
+				hash_combine(hash, state.curves.get());
+				hash_combine(hash, quantizeTime(state.time, timeStep));
+				hash_combine(hash, state.weight);
+				hash_combine(hash, state.loop);
+				hash_combine(hash, state.disabled);
+			}
+		}
+
+		for(UINT32 i = 0; i < anim.numSceneObjects; i++)
+			hash_combine(hash, anim.sceneObjectInfos[i].boneIdx);
+
+		return hash;
+	}
+
+	/** Checks if the two matrices are equal, allowing for a small error. */
+	bool approxEquals(const Matrix4& a, const Matrix4& b)
+	{
+		for (UINT32 row = 0; row < 4; row++)
+		{
+			for (UINT32 col = 0; col < 4; col++)
+			{
+				if (!Math::approxEquals(a[row][col], b[row][col], 0.0001f))
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	/** 
+	 * Checks if the two animation proxies evaluate to the same skeleton pose. Animation state times are quantized using
+	 * the provided time step before being compared.
+	 */
+	bool isPoseEqual(const AnimationProxy& a, const AnimationProxy& b, float timeStep)
+	{
+		if (a.skeleton != b.skeleton || !(a.skeletonMask == b.skeletonMask) || a.numLayers != b.numLayers)
+			return false;
+
+		for(UINT32 i = 0; i < a.numLayers; i++)
+		{
+			const AnimationStateLayer& layerA = a.layers[i];
+			const AnimationStateLayer& layerB = b.layers[i];
+
+			if (layerA.additive != layerB.additive || layerA.numStates != layerB.numStates)
+				return false;
+
+			for(UINT32 j = 0; j < layerA.numStates; j++)
+			{
+				const AnimationState& stateA = layerA.states[j];
+				const AnimationState& stateB = layerB.states[j];
+
+				if (stateA.curves != stateB.curves || stateA.weight != stateB.weight || stateA.loop != stateB.loop ||
+					stateA.disabled != stateB.disabled)
+					return false;
+
+				if (quantizeTime(stateA.time, timeStep) != quantizeTime(stateB.time, timeStep))
+					return false;
+			}
+		}
+
+		// Bones mapped to scene objects use the scene object transform unless animated, so they must match as well
+		if (a.numSceneObjects != b.numSceneObjects)
+			return false;
+
+		UINT32 boneTfrmIdx = 0;
+		for(UINT32 i = 0; i < a.numSceneObjects; i++)
+		{
+			if (a.sceneObjectInfos[i].boneIdx != b.sceneObjectInfos[i].boneIdx)
+				return false;
+
+			if (a.sceneObjectInfos[i].boneIdx == -1)
+				continue;
+
+			if (!approxEquals(a.sceneObjectTransforms[boneTfrmIdx], b.sceneObjectTransforms[boneTfrmIdx]))
+				return false;
+
+			boneTfrmIdx++;
+		}
+
+		return true;
+	}
+
+	/** Morph shape vertex data accumulated from all active morph shapes, and the vertex buffer to write it to. */
+	struct MorphVertexData
+	{
+		Vector3* positions;
+		Vector3* normals;
+		float* weights;
+
+		UINT8* positionDst;
+		UINT8* normalDst;
+		UINT32 stride;
+	};
+
+	/** 
+	 * Writes accumulated morph shape positions and normals for vertices in range [@p start, @p end) into the vertex
+	 * buffer. Normals are normalized by their accumulated weight and packed. 
+	 */
+	void writeMorphVertexRange(const MorphVertexData& data, UINT32 start, UINT32 end)
+	{
+		for(UINT32 i = start; i < end; i++)
+		{
+			memcpy(data.positionDst + i * data.stride, &data.positions[i], sizeof(Vector3));
+
+			// Accumulated normal is in range [-2, 2] but our normal packing method assumes [-1, 1] range. Zero normal
+			// packs into the neutral value for vertices not affected by any shape.
+			if (data.weights[i] > 0.0001f)
+				data.normals[i] = data.normals[i] / (data.weights[i] * 2.0f);
+			else
+				data.normals[i] = Vector3::ZERO;
+		}
+
+		MeshUtility::packNormals(data.normals + start, data.normalDst + start * data.stride, end - start, data.stride);
+
+		for(UINT32 i = start; i < end; i++)
+		{
+			PackedNormal* destNrm = (PackedNormal*)(data.normalDst + i * data.stride);
+
+			if (data.weights[i] > 0.0001f)
+				destNrm->w = (UINT8)(std::min(1.0f, data.weights[i]) * 255.999f);
+			else
+				destNrm->w = 0;
+		}
+	}
+
+	SPtr<MeshData> AnimationManager::getMorphShapeMesh(UINT32 numVertices)
+	{
+		// Mesh data is only referenced by the pool once no renderer data buffer references it anymore, at which point
+		// it's safe to overwrite it
+		for(auto& entry : mMorphShapeMeshes)
+		{
+			if (entry.meshData.unique() && entry.meshData->getNumVertices() == numVertices)
+			{
+				entry.lastUsedUpdate = mUpdateCount;
+				return entry.meshData;
+			}
+		}
+
+		MorphShapeMesh entry;
+		entry.meshData = bs_shared_ptr_new<MeshData>(numVertices, 0, mBlendShapeVertexDesc);
+		entry.lastUsedUpdate = mUpdateCount;
+
+		mMorphShapeMeshes.push_back(entry);
+		return entry.meshData;
+	}
+
 	void AnimationManager::evaluateAnimation()
 	{
 		// Make sure we don't load obsolete anim proxy data written by the simulation thread
@@ -115,21 +318,10 @@ namespace BansheeEngine
 		// No need for locking, as we are sure that only postUpdate() writes to the proxy buffer, and increments the write
 		// buffer index. And it's called sequentially ensuring previous call to evaluate finishes.
 
-		UINT32 totalNumBones = 0;
-		for (auto& anim : mProxies)
-		{
-			if (anim->skeleton != nullptr)
-				totalNumBones += anim->skeleton->getNumBones();
-		}
-
 		RendererAnimationData& renderData = mAnimData[mPoseWriteBufferIdx];
 		mPoseWriteBufferIdx = (mPoseWriteBufferIdx + 1) % CoreThread::NUM_SYNC_BUFFERS;
 
-		renderData.transforms.resize(totalNumBones);
-
-		UnorderedMap<UINT64, RendererAnimationData::AnimInfo> newAnimInfos;
-
-		UINT32 curBoneIdx = 0;
+		mVisibleProxies.clear();
 		for(auto& anim : mProxies)
 		{
 			if(anim->mCullEnabled)
@@ -145,52 +337,29 @@ namespace BansheeEngine
 				}
 
 				if (!isVisible)
+				{
+					// Poses used for interpolation are out of date once the animation becomes visible again
+					anim->lodPosesValid = false;
 					continue;
+				}
 			}
 
-			RendererAnimationData::AnimInfo animInfo;
-			bool hasAnimInfo = false;
-
-			// Evaluate skeletal animation
-			if (anim->skeleton != nullptr)
-			{
-				UINT32 numBones = anim->skeleton->getNumBones();
-
-				RendererAnimationData::PoseInfo& poseInfo = animInfo.poseInfo;
-				poseInfo.animId = anim->id;
-				poseInfo.startIdx = curBoneIdx;
-				poseInfo.numBones = numBones;
-
-				memset(anim->skeletonPose.hasOverride, 0, sizeof(bool) * anim->skeletonPose.numBones);
-				Matrix4* boneDst = renderData.transforms.data() + curBoneIdx;
+			mVisibleProxies.push_back(anim.get());
+		}
 
-				// Copy transforms from mapped scene objects
-				UINT32 boneTfrmIdx = 0;
-				for(UINT32 i = 0; i < anim->numSceneObjects; i++)
-				{
-					const AnimatedSceneObjectInfo& soInfo = anim->sceneObjectInfos[i];
+		// Evaluate skeletal animation
+		evaluatePoses(mVisibleProxies, mUpdateCount, renderData.transforms, mPoseInfos);
 
-					if (soInfo.boneIdx == -1)
-						continue;
-
-					boneDst[soInfo.boneIdx] = anim->sceneObjectTransforms[boneTfrmIdx];
-					anim->skeletonPose.hasOverride[soInfo.boneIdx] = true;
-					boneTfrmIdx++;
-				}
+		UnorderedMap<UINT64, RendererAnimationData::AnimInfo> newAnimInfos;
 
-				// Animate bones
-				anim->skeleton->getPose(boneDst, anim->skeletonPose, anim->skeletonMask, anim->layers, anim->numLayers);
+		UINT32 numVisibleProxies = (UINT32)mVisibleProxies.size();
+		for(UINT32 animIdx = 0; animIdx < numVisibleProxies; animIdx++)
+		{
+			AnimationProxy* anim = mVisibleProxies[animIdx];
 
-				curBoneIdx += numBones;
-				hasAnimInfo = true;
-			}
-			else
-			{
-				RendererAnimationData::PoseInfo& poseInfo = animInfo.poseInfo;
-				poseInfo.animId = anim->id;
-				poseInfo.startIdx = 0;
-				poseInfo.numBones = 0;
-			}
+			RendererAnimationData::AnimInfo animInfo;
+			animInfo.poseInfo = mPoseInfos[animIdx];
+			bool hasAnimInfo = anim->skeleton != nullptr;
 
 			// Reset mapped SO transform
 			for (UINT32 i = 0; i < anim->sceneObjectPose.numBones; i++)
@@ -223,8 +392,8 @@ namespace BansheeEngine
 					UINT32 curveIdx = soInfo.curveIndices.position;
 					if (curveIdx != (UINT32)-1)
 					{
-						const TAnimationCurve<Vector3>& curve = state.curves->position[curveIdx].curve;
-						anim->sceneObjectPose.positions[curveIdx] = curve.evaluate(state.time, state.positionCaches[curveIdx], state.loop);
+						anim->sceneObjectPose.positions[curveIdx] = state.curves->evaluatePosition(curveIdx, state.time, 
+							state.positionCaches[curveIdx], state.loop);
 						anim->sceneObjectPose.hasOverride[curveIdx] = false;
 					}
 				}
@@ -233,8 +402,8 @@ namespace BansheeEngine
 					UINT32 curveIdx = soInfo.curveIndices.rotation;
 					if (curveIdx != (UINT32)-1)
 					{
-						const TAnimationCurve<Quaternion>& curve = state.curves->rotation[curveIdx].curve;
-						anim->sceneObjectPose.rotations[curveIdx] = curve.evaluate(state.time, state.rotationCaches[curveIdx], state.loop);
+						anim->sceneObjectPose.rotations[curveIdx] = state.curves->evaluateRotation(curveIdx, state.time, 
+							state.rotationCaches[curveIdx], state.loop);
 						anim->sceneObjectPose.rotations[curveIdx].normalize();
 						anim->sceneObjectPose.hasOverride[curveIdx] = false;
 					}
@@ -244,8 +413,8 @@ namespace BansheeEngine
 					UINT32 curveIdx = soInfo.curveIndices.scale;
 					if (curveIdx != (UINT32)-1)
 					{
-						const TAnimationCurve<Vector3>& curve = state.curves->scale[curveIdx].curve;
-						anim->sceneObjectPose.scales[curveIdx] = curve.evaluate(state.time, state.scaleCaches[curveIdx], state.loop);
+						anim->sceneObjectPose.scales[curveIdx] = state.curves->evaluateScale(curveIdx, state.time, 
+							state.scaleCaches[curveIdx], state.loop);
 						anim->sceneObjectPose.hasOverride[curveIdx] = false;
 					}
 				}
@@ -280,22 +449,24 @@ namespace BansheeEngine
 
 				if(anim->morphShapeWeightsDirty)
 				{
-					SPtr<MeshData> meshData = bs_shared_ptr_new<MeshData>(anim->numMorphVertices, 0, mBlendShapeVertexDesc);
+					SPtr<MeshData> meshData = getMorphShapeMesh(anim->numMorphVertices);
 
-					UINT8* bufferData = meshData->getData();
-					memset(bufferData, 0, meshData->getSize());
-
-					UINT32 tempDataSize = (sizeof(Vector3) + sizeof(float)) * anim->numMorphVertices;
+					// Accumulate into contiguous buffers, and only write the interleaved vertex data once at the end
+					UINT32 tempDataSize = (sizeof(Vector3) * 2 + sizeof(float)) * anim->numMorphVertices;
 					UINT8* tempData = (UINT8*)bs_stack_alloc(tempDataSize);
 					memset(tempData, 0, tempDataSize);
 
-					Vector3* tempNormals = (Vector3*)tempData;
-					float* accumulatedWeight = (float*)(tempData + sizeof(Vector3) * anim->numMorphVertices);
-
-					UINT8* positions = meshData->getElementData(VES_POSITION, 1, 1);
-					UINT8* normals = meshData->getElementData(VES_NORMAL, 1, 1);
+					MorphVertexData vertexData;
+					vertexData.positions = (Vector3*)tempData;
+					vertexData.normals = (Vector3*)(tempData + sizeof(Vector3) * anim->numMorphVertices);
+					vertexData.weights = (float*)(tempData + sizeof(Vector3) * 2 * anim->numMorphVertices);
+					vertexData.positionDst = meshData->getElementData(VES_POSITION, 1, 1);
+					vertexData.normalDst = meshData->getElementData(VES_NORMAL, 1, 1);
+					vertexData.stride = mBlendShapeVertexDesc->getVertexStride(1);
 
-					UINT32 stride = mBlendShapeVertexDesc->getVertexStride(1);
+					Vector3* tempPositions = vertexData.positions;
+					Vector3* tempNormals = vertexData.normals;
+					float* accumulatedWeight = vertexData.weights;
 
 					for(UINT32 i = 0; i < anim->numMorphShapes; i++)
 					{
@@ -311,32 +482,16 @@ namespace BansheeEngine
 						{
 							const MorphVertex& vertex = morphVertices[j];
 
-							Vector3* destPos = (Vector3*)(positions + vertex.sourceIdx * stride);
-							*destPos += vertex.deltaPosition * info.weight;
-
+							tempPositions[vertex.sourceIdx] += vertex.deltaPosition * info.weight;
 							tempNormals[vertex.sourceIdx] += vertex.deltaNormal * info.weight;
 							accumulatedWeight[vertex.sourceIdx] += absWeight;
 						}
 					}
 
-					for(UINT32 i = 0; i < anim->numMorphVertices; i++)
-					{
-						PackedNormal* destNrm = (PackedNormal*)(normals + i * stride);
-
-						if (accumulatedWeight[i] > 0.0001f)
-						{
-							Vector3 normal = tempNormals[i] / accumulatedWeight[i];
-							normal /= 2.0f; // Accumulated normal is in range [-2, 2] but our normal packing method assumes [-1, 1] range
-
-							MeshUtility::packNormals(&normal, (UINT8*)destNrm, 1, stride);
-							destNrm->w = (UINT8)(std::min(1.0f, accumulatedWeight[i]) * 255.999f);
-						}
-						else
-						{
-							*destNrm = { 127, 127, 127, 0 };
-						}
-					}
-
+					// Each task writes to its own range of vertices so no synchronization is needed
+					TaskScheduler::processRangeInParallel("MorphVertices", anim->numMorphVertices, 
+						MeshUtility::MIN_VERTICES_PER_TASK, 
+						[&vertexData](UINT32 start, UINT32 end) { writeMorphVertexRange(vertexData, start, end); });
 					bs_stack_free(tempData);
 
 					animInfo.morphShapeInfo.meshData = meshData;
@@ -354,6 +509,17 @@ namespace BansheeEngine
 				newAnimInfos[anim->id] = animInfo;
 		}
 
+		// Release pooled morph shape meshes that haven't been needed for a while
+		static const UINT32 MORPH_SHAPE_MESH_EXPIRY = 60;
+
+		auto iterRemove = std::remove_if(mMorphShapeMeshes.begin(), mMorphShapeMeshes.end(), 
+			[&](const MorphShapeMesh& x)
+		{
+			return x.meshData.unique() && (mUpdateCount - x.lastUsedUpdate) > MORPH_SHAPE_MESH_EXPIRY;
+		});
+
+		mMorphShapeMeshes.erase(iterRemove, mMorphShapeMeshes.end());
+
 		renderData.infos = newAnimInfos;
 
 		mDataReadyCount.fetch_add(1, std::memory_order_relaxed);
@@ -363,6 +529,211 @@ namespace BansheeEngine
 		std::atomic_thread_fence(std::memory_order_release);
 	}
 
+	void AnimationManager::evaluatePoses(const Vector<AnimationProxy*>& anims, UINT32 updateIdx, 
+		Vector<Matrix4>& transforms, Vector<RendererAnimationData::PoseInfo>& poseInfos) const
+	{
+		UINT32 totalNumBones = 0;
+		for (auto& anim : anims)
+		{
+			if (anim->skeleton != nullptr)
+				totalNumBones += anim->skeleton->getNumBones();
+		}
+
+		transforms.resize(totalNumBones);
+		poseInfos.resize(anims.size());
+
+		UnorderedMap<size_t, SharedPoseInfo> sharedPoses;
+
+		UINT32 curBoneIdx = 0;
+		UINT32 numAnims = (UINT32)anims.size();
+		for(UINT32 animIdx = 0; animIdx < numAnims; animIdx++)
+		{
+			AnimationProxy* anim = anims[animIdx];
+
+			RendererAnimationData::PoseInfo& poseInfo = poseInfos[animIdx];
+			poseInfo.animId = anim->id;
+			poseInfo.startIdx = 0;
+			poseInfo.numBones = 0;
+
+			if (anim->skeleton == nullptr)
+				continue;
+
+			UINT32 numBones = anim->skeleton->getNumBones();
+			poseInfo.startIdx = curBoneIdx;
+			poseInfo.numBones = numBones;
+
+			const AnimationLOD* lod = selectLOD(*anim);
+
+			UINT32 updateInterval = 1;
+			UINT32 maxBones = numBones;
+			if(lod != nullptr)
+			{
+				updateInterval = std::max(lod->updateInterval, 1U);
+
+				if (lod->maxBones > 0)
+					maxBones = std::min(lod->maxBones, numBones);
+			}
+
+			// All bones must be evaluated at least once, as bones skipped due to LOD keep their last transform
+			if (!anim->skeletonPoseValid)
+				maxBones = numBones;
+
+			// Only fully evaluated poses can be shared, as reduced LOD poses also depend on previous evaluations
+			bool canSharePose = mPoseSharingTimeStep >= 0.0f && updateInterval == 1 && maxBones == numBones;
+
+			const SharedPoseInfo* sharedPose = nullptr;
+			size_t poseHash = 0;
+			if(canSharePose)
+			{
+				poseHash = getPoseHash(*anim, mPoseSharingTimeStep);
+
+				auto iterFind = sharedPoses.find(poseHash);
+				if (iterFind != sharedPoses.end() && isPoseEqual(*iterFind->second.anim, *anim, mPoseSharingTimeStep))
+					sharedPose = &iterFind->second;
+			}
+
+			if(sharedPose != nullptr)
+			{
+				// Reference the bones of an identical animation evaluated earlier during this update
+				poseInfo.startIdx = sharedPose->startIdx;
+
+				copyPose(sharedPose->anim->skeletonPose, anim->skeletonPose);
+				anim->lodPosesValid = false;
+			}
+			else
+			{
+				memset(anim->skeletonPose.hasOverride, 0, sizeof(bool) * anim->skeletonPose.numBones);
+				Matrix4* boneDst = transforms.data() + curBoneIdx;
+
+				// Copy transforms from mapped scene objects
+				UINT32 boneTfrmIdx = 0;
+				for(UINT32 i = 0; i < anim->numSceneObjects; i++)
+				{
+					const AnimatedSceneObjectInfo& soInfo = anim->sceneObjectInfos[i];
+
+					if (soInfo.boneIdx == -1)
+						continue;
+
+					boneDst[soInfo.boneIdx] = anim->sceneObjectTransforms[boneTfrmIdx];
+					anim->skeletonPose.hasOverride[soInfo.boneIdx] = true;
+					boneTfrmIdx++;
+				}
+
+				// Animate bones
+				if (updateInterval == 1)
+				{
+					anim->skeleton->getPose(boneDst, anim->skeletonPose, anim->layers, anim->numLayers, maxBones);
+					anim->lodPosesValid = false;
+				}
+				else if(!anim->lodPosesValid)
+				{
+					anim->skeleton->getPose(boneDst, anim->skeletonPose, anim->layers, anim->numLayers, maxBones);
+
+					for(UINT32 i = 0; i < 2; i++)
+					{
+						LocalSkeletonPose& lodPose = anim->lodPoses[i];
+						if (lodPose.numBones != numBones)
+							lodPose = LocalSkeletonPose(numBones);
+
+						copyPose(anim->skeletonPose, lodPose);
+					}
+
+					anim->lodPosesValid = true;
+				}
+				else
+				{
+					// Offset by animation ID so evaluation of animations with the same interval is spread across 
+					// updates
+					UINT32 phase = (UINT32)((updateIdx + anim->id) % updateInterval);
+					if(phase == 0)
+					{
+						// Evaluate into the older pose, starting from the latest pose so bones outside of the LOD keep
+						// their transforms
+						const LocalSkeletonPose& latestPose = anim->lodPoses[anim->lodLatestPoseIdx];
+
+						anim->lodLatestPoseIdx = (anim->lodLatestPoseIdx + 1) % 2;
+						LocalSkeletonPose& newPose = anim->lodPoses[anim->lodLatestPoseIdx];
+
+						copyPose(latestPose, newPose);
+						memcpy(newPose.hasOverride, anim->skeletonPose.hasOverride, sizeof(bool) * numBones);
+
+						anim->skeleton->getLocalPose(newPose, anim->layers, anim->numLayers, maxBones);
+					}
+
+					// Displayed pose lags one interval behind the evaluated pose, so it can be interpolated between
+					// the two most recent evaluations
+					const LocalSkeletonPose& fromPose = anim->lodPoses[(anim->lodLatestPoseIdx + 1) % 2];
+					const LocalSkeletonPose& toPose = anim->lodPoses[anim->lodLatestPoseIdx];
+					float t = phase / (float)updateInterval;
+
+					anim->skeleton->getPose(boneDst, anim->skeletonPose, fromPose, toPose, t);
+				}
+
+				// In case of a hash collision with a different pose, the first pose keeps the entry
+				if (canSharePose && sharedPoses.find(poseHash) == sharedPoses.end())
+					sharedPoses[poseHash] = { anim, curBoneIdx };
+
+				curBoneIdx += numBones;
+			}
+
+			anim->skeletonPoseValid = true;
+		}
+
+		// Shared poses don't use their reserved portion of the buffer
+		transforms.resize(curBoneIdx);
+	}
+
+	void AnimationManager::_evaluatePoses(const Vector<SPtr<Animation>>& animations, float timeDelta, UINT32 updateIdx,
+		RendererAnimationData& output)
+	{
+		Vector<AnimationProxy*> proxies;
+		for (auto& anim : animations)
+		{
+			anim->updateAnimProxy(timeDelta);
+			proxies.push_back(anim->mAnimProxy.get());
+		}
+
+		Vector<RendererAnimationData::PoseInfo> poseInfos;
+		evaluatePoses(proxies, updateIdx, output.transforms, poseInfos);
+
+		output.infos.clear();
+		for (auto& poseInfo : poseInfos)
+			output.infos[poseInfo.animId].poseInfo = poseInfo;
+	}
+
+	const AnimationLOD* AnimationManager::selectLOD(const AnimationProxy& anim) const
+	{
+		if (anim.lods.empty())
+			return nullptr;
+
+		Vector3 center = anim.mBounds.getCenter();
+		float radius = anim.mBounds.getRadius();
+
+		float screenSize = 0.0f;
+		for(auto& camera : mLODCameras)
+		{
+			float cameraScreenSize;
+			if (camera.orthographic)
+				cameraScreenSize = radius * camera.screenScale;
+			else
+			{
+				float distance = camera.position.distance(center);
+				cameraScreenSize = radius * camera.screenScale / std::max(distance, 0.0001f);
+			}
+
+			screenSize = std::max(screenSize, cameraScreenSize);
+		}
+
+		// Levels are sorted from largest to smallest screen size
+		for(auto& lod : anim.lods)
+		{
+			if (screenSize >= lod.screenSize)
+				return &lod;
+		}
+
+		return &anim.lods.back();
+	}
+
 	void AnimationManager::waitUntilComplete()
 	{
 		mAnimationWorker->wait();
@@ -0,0 +1,87 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsBVH.h"
+
+namespace BansheeEngine
+{
+	void BVH::build(const Vector<AABox>& bounds, UINT32 maxLeafSize)
+	{
+		clear();
+
+		UINT32 numPrimitives = (UINT32)bounds.size();
+		if (numPrimitives == 0)
+			return;
+
+		maxLeafSize = std::max(maxLeafSize, 1U);
+
+		Vector<Vector3> centers(numPrimitives);
+		mPrimitives.resize(numPrimitives);
+		for (UINT32 i = 0; i < numPrimitives; i++)
+		{
+			centers[i] = bounds[i].getCenter();
+			mPrimitives[i] = i;
+		}
+
+		mNodes.reserve((numPrimitives / maxLeafSize + 1) * 2);
+		buildNode(0, numPrimitives, bounds, centers, maxLeafSize, 0);
+	}
+
+	void BVH::clear()
+	{
+		mNodes.clear();
+		mPrimitives.clear();
+	}
+
+	UINT32 BVH::getMemoryUsage() const
+	{
+		return (UINT32)(mNodes.capacity() * sizeof(Node) + mPrimitives.capacity() * sizeof(UINT32));
+	}
+
+	void BVH::buildNode(UINT32 start, UINT32 end, const Vector<AABox>& bounds, const Vector<Vector3>& centers,
+		UINT32 maxLeafSize, UINT32 depth)
+	{
+		UINT32 nodeIdx = (UINT32)mNodes.size();
+		mNodes.push_back(Node());
+
+		AABox nodeBounds = bounds[mPrimitives[start]];
+		AABox centerBounds(centers[mPrimitives[start]], centers[mPrimitives[start]]);
+		for (UINT32 i = start + 1; i < end; i++)
+		{
+			nodeBounds.merge(bounds[mPrimitives[i]]);
+			centerBounds.merge(centers[mPrimitives[i]]);
+		}
+
+		mNodes[nodeIdx].bounds = nodeBounds;
+
+		UINT32 count = end - start;
+		Vector3 extents = centerBounds.getMax() - centerBounds.getMin();
+
+		// Make a leaf if the primitives fit, or if they cannot be separated any further
+		float maxExtent = std::max(extents.x, std::max(extents.y, extents.z));
+		if (count <= maxLeafSize || depth >= MAX_DEPTH || maxExtent <= 0.0f)
+		{
+			mNodes[nodeIdx].start = start;
+			mNodes[nodeIdx].count = count;
+			return;
+		}
+
+		UINT32 axis = 0;
+		if (extents.y > extents[axis])
+			axis = 1;
+
+		if (extents.z > extents[axis])
+			axis = 2;
+
+		// Split at the median along the longest axis, which keeps the tree balanced
+		UINT32 mid = start + count / 2;
+		std::nth_element(mPrimitives.begin() + start, mPrimitives.begin() + mid, mPrimitives.begin() + end,
+			[&](UINT32 a, UINT32 b) { return centers[a][axis] < centers[b][axis]; });
+
+		buildNode(start, mid, bounds, centers, maxLeafSize, depth + 1);
+
+		mNodes[nodeIdx].start = (UINT32)mNodes.size();
+		mNodes[nodeIdx].count = 0;
+
+		buildNode(mid, end, bounds, centers, maxLeafSize, depth + 1);
+	}
+}
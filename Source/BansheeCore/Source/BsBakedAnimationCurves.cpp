@@ -0,0 +1,283 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsBakedAnimationCurves.h"
+#include "BsAnimationClip.h"
+#include "BsAnimationUtility.h"
+#include "BsMath.h"
+#include "BsTimer.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/** Returns the angle between two rotations in radians, used for measuring baking error. */
+	float getRotationDifference(const Quaternion& lhs, const Quaternion& rhs)
+	{
+		Quaternion normLhs = lhs;
+		normLhs.normalize();
+
+		Quaternion normRhs = rhs;
+		normRhs.normalize();
+
+		float cosHalfAngle = std::min(1.0f, Math::abs(normLhs.dot(normRhs)));
+		return 2.0f * std::acos(cosHalfAngle);
+	}
+
+	/** 
+	 * Expands the provided range so it includes the ranges of all non-empty curves in the array, using the compressed
+	 * version of a curve if one exists. Returns false if any of the curves spans a different range than the others.
+	 */
+	template<class T>
+	bool findSharedRange(const Vector<TNamedAnimationCurve<T>>& curves, 
+		const Vector<TCompressedAnimationCurve<T>>& compressedCurves, bool& hasRange, float& start, float& end)
+	{
+		for (UINT32 i = 0; i < (UINT32)curves.size(); i++)
+		{
+			float curveStart, curveEnd;
+			if (!compressedCurves.empty() && !compressedCurves[i].isEmpty())
+			{
+				curveStart = compressedCurves[i].getStart();
+				curveEnd = compressedCurves[i].getLength();
+			}
+			else
+			{
+				if (curves[i].curve.getNumKeyFrames() == 0)
+					continue;
+
+				curveStart = curves[i].curve.getStart();
+				curveEnd = curves[i].curve.getLength();
+			}
+
+			if (!hasRange)
+			{
+				start = curveStart;
+				end = curveEnd;
+				hasRange = true;
+			}
+			else if (!Math::approxEquals(start, curveStart) || !Math::approxEquals(end, curveEnd))
+				return false;
+		}
+
+		return true;
+	}
+
+	BakedAnimationCurves::BakedAnimationCurves()
+		: mStart(0.0f), mLength(0.0f), mFrameRate(0.0f), mNumFrames(0), mNumPositions(0), mNumRotations(0), mNumScales(0)
+	{ }
+
+	Vector3 BakedAnimationCurves::evaluatePosition(UINT32 idx, float time, bool loop) const
+	{
+		UINT32 leftOffset, rightOffset;
+		float t;
+		findFrames(time, loop, leftOffset, rightOffset, t);
+
+		UINT32 valueOffset = idx * 3;
+		const float* left = &mData[leftOffset + valueOffset];
+		const float* right = &mData[rightOffset + valueOffset];
+
+		return Vector3(left[0], left[1], left[2]) * (1.0f - t) + Vector3(right[0], right[1], right[2]) * t;
+	}
+
+	Quaternion BakedAnimationCurves::evaluateRotation(UINT32 idx, float time, bool loop) const
+	{
+		UINT32 leftOffset, rightOffset;
+		float t;
+		findFrames(time, loop, leftOffset, rightOffset, t);
+
+		UINT32 valueOffset = mNumPositions * 3 + idx * 4;
+		const float* left = &mData[leftOffset + valueOffset];
+		const float* right = &mData[rightOffset + valueOffset];
+
+		// Samples are close enough for normalized lerp to be indistinguishable from slerp
+		return Quaternion::lerp(t, Quaternion(left[0], left[1], left[2], left[3]),
+			Quaternion(right[0], right[1], right[2], right[3]));
+	}
+
+	Vector3 BakedAnimationCurves::evaluateScale(UINT32 idx, float time, bool loop) const
+	{
+		UINT32 leftOffset, rightOffset;
+		float t;
+		findFrames(time, loop, leftOffset, rightOffset, t);
+
+		UINT32 valueOffset = mNumPositions * 3 + mNumRotations * 4 + idx * 3;
+		const float* left = &mData[leftOffset + valueOffset];
+		const float* right = &mData[rightOffset + valueOffset];
+
+		return Vector3(left[0], left[1], left[2]) * (1.0f - t) + Vector3(right[0], right[1], right[2]) * t;
+	}
+
+	void BakedAnimationCurves::findFrames(float time, bool loop, UINT32& leftOffset, UINT32& rightOffset, float& t) const
+	{
+		// Wrap the same way as the original curves, except for single-frame curves which wrapTime() maps to zero
+		if (mLength > 0.0f)
+			AnimationUtility::wrapTime(time, mStart, mStart + mLength, loop);
+		else
+			time = mStart;
+
+		float frame = std::max(0.0f, (time - mStart) * mFrameRate);
+		UINT32 leftFrame = std::min((UINT32)frame, mNumFrames - 1);
+		UINT32 rightFrame = std::min(leftFrame + 1, mNumFrames - 1);
+
+		t = Math::clamp01(frame - (float)leftFrame);
+
+		UINT32 frameStride = mNumPositions * 3 + mNumRotations * 4 + mNumScales * 3;
+		leftOffset = leftFrame * frameStride;
+		rightOffset = rightFrame * frameStride;
+	}
+
+	AnimationBakingStats BakedAnimationCurves::bake(AnimationCurves& curves, UINT32 sampleRate)
+	{
+		AnimationBakingStats stats;
+		memset(&stats, 0, sizeof(stats));
+
+		// Make sure the original curves are evaluated when sampling
+		curves.baked = BakedAnimationCurves();
+
+		BakedAnimationCurves output;
+		output.mNumPositions = (UINT32)curves.position.size();
+		output.mNumRotations = (UINT32)curves.rotation.size();
+		output.mNumScales = (UINT32)curves.scale.size();
+
+		UINT32 frameStride = output.mNumPositions * 3 + output.mNumRotations * 4 + output.mNumScales * 3;
+		if (frameStride == 0)
+			return stats;
+
+		// All values of a frame are sampled at the same time, so the curves must share their range in order to loop the
+		// same way as the originals
+		bool hasRange = false;
+		float start = 0.0f;
+		float end = 0.0f;
+		if (!findSharedRange(curves.position, curves.compressedPosition, hasRange, start, end) ||
+			!findSharedRange(curves.rotation, curves.compressedRotation, hasRange, start, end) ||
+			!findSharedRange(curves.scale, curves.compressedScale, hasRange, start, end))
+		{
+			LOGWRN("Cannot bake animation curves. Position, rotation and scale curves don't all start and end at the "
+				"same time.");
+			return stats;
+		}
+
+		// Round the number of frames up so the samples are evenly spaced and the last one falls at the end of the clip
+		float length = end - start;
+		UINT32 numIntervals = std::max(1U, (UINT32)std::ceil(length * std::max(sampleRate, 1U) - 0.001f));
+
+		output.mStart = start;
+		output.mLength = length;
+		output.mFrameRate = length > 0.0f ? numIntervals / length : 0.0f;
+		output.mNumFrames = numIntervals + 1;
+		output.mData.resize(output.mNumFrames * frameStride);
+
+		Vector<TCurveCache<Vector3>> positionCaches(output.mNumPositions);
+		Vector<TCurveCache<Quaternion>> rotationCaches(output.mNumRotations);
+		Vector<TCurveCache<Vector3>> scaleCaches(output.mNumScales);
+
+		for (UINT32 i = 0; i < output.mNumFrames; i++)
+		{
+			float time = start + (length > 0.0f ? std::min(i / output.mFrameRate, length) : 0.0f);
+			float* dst = &output.mData[i * frameStride];
+
+			for (UINT32 j = 0; j < output.mNumPositions; j++)
+			{
+				Vector3 value = curves.evaluatePosition(j, time, positionCaches[j], false);
+				memcpy(dst, &value, sizeof(Vector3));
+
+				dst += 3;
+			}
+
+			for (UINT32 j = 0; j < output.mNumRotations; j++)
+			{
+				Quaternion value = curves.evaluateRotation(j, time, rotationCaches[j], false);
+				value.normalize();
+
+				// Keep neighbouring samples in the same hemisphere
+				if (i > 0)
+				{
+					const float* prev = dst - frameStride;
+					if (value.dot(Quaternion(prev[0], prev[1], prev[2], prev[3])) < 0.0f)
+						value = -value;
+				}
+
+				dst[0] = value.x;
+				dst[1] = value.y;
+				dst[2] = value.z;
+				dst[3] = value.w;
+
+				dst += 4;
+			}
+
+			for (UINT32 j = 0; j < output.mNumScales; j++)
+			{
+				Vector3 value = curves.evaluateScale(j, time, scaleCaches[j], false);
+				memcpy(dst, &value, sizeof(Vector3));
+
+				dst += 3;
+			}
+		}
+
+		stats.numFrames = output.mNumFrames;
+		stats.bakedSize = output.getMemoryUsage();
+
+		// Measure at the samples and half-way between them, where the interpolation error is largest
+		UINT32 numMeasurements = numIntervals * 2 + 1;
+		float measureStep = length / (numIntervals * 2);
+
+		Vector<Vector3> originalPositions(numMeasurements * output.mNumPositions);
+		Vector<Quaternion> originalRotations(numMeasurements * output.mNumRotations);
+		Vector<Vector3> originalScales(numMeasurements * output.mNumScales);
+
+		Vector<Vector3> bakedPositions(originalPositions.size());
+		Vector<Quaternion> bakedRotations(originalRotations.size());
+		Vector<Vector3> bakedScales(originalScales.size());
+
+		positionCaches = Vector<TCurveCache<Vector3>>(output.mNumPositions);
+		rotationCaches = Vector<TCurveCache<Quaternion>>(output.mNumRotations);
+		scaleCaches = Vector<TCurveCache<Vector3>>(output.mNumScales);
+
+		Timer timer;
+		for (UINT32 i = 0; i < numMeasurements; i++)
+		{
+			float time = start + i * measureStep;
+
+			for (UINT32 j = 0; j < output.mNumPositions; j++)
+				originalPositions[i * output.mNumPositions + j] = curves.evaluatePosition(j, time, positionCaches[j], false);
+
+			for (UINT32 j = 0; j < output.mNumRotations; j++)
+				originalRotations[i * output.mNumRotations + j] = curves.evaluateRotation(j, time, rotationCaches[j], false);
+
+			for (UINT32 j = 0; j < output.mNumScales; j++)
+				originalScales[i * output.mNumScales + j] = curves.evaluateScale(j, time, scaleCaches[j], false);
+		}
+
+		stats.originalEvaluationTime = timer.getMicroseconds();
+
+		timer.reset();
+		for (UINT32 i = 0; i < numMeasurements; i++)
+		{
+			float time = start + i * measureStep;
+
+			for (UINT32 j = 0; j < output.mNumPositions; j++)
+				bakedPositions[i * output.mNumPositions + j] = output.evaluatePosition(j, time, false);
+
+			for (UINT32 j = 0; j < output.mNumRotations; j++)
+				bakedRotations[i * output.mNumRotations + j] = output.evaluateRotation(j, time, false);
+
+			for (UINT32 j = 0; j < output.mNumScales; j++)
+				bakedScales[i * output.mNumScales + j] = output.evaluateScale(j, time, false);
+		}
+
+		stats.bakedEvaluationTime = timer.getMicroseconds();
+
+		for (UINT32 i = 0; i < (UINT32)originalPositions.size(); i++)
+			stats.maxPositionError = std::max(stats.maxPositionError, originalPositions[i].distance(bakedPositions[i]));
+
+		for (UINT32 i = 0; i < (UINT32)originalRotations.size(); i++)
+		{
+			stats.maxRotationError = std::max(stats.maxRotationError,
+				getRotationDifference(originalRotations[i], bakedRotations[i]));
+		}
+
+		for (UINT32 i = 0; i < (UINT32)originalScales.size(); i++)
+			stats.maxScaleError = std::max(stats.maxScaleError, originalScales[i].distance(bakedScales[i]));
+
+		curves.baked = std::move(output);
+		return stats;
+	}
+}
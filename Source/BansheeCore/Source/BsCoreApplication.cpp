@@ -235,6 +235,9 @@ namespace BansheeEngine
 			// Send out resource events in case any were loaded/destroyed/modified
 			ResourceListenerManager::instance().update();
 
+			// Upload any characters dynamic fonts rendered during this frame
+			FontManager::instance()._update();
+
 			gCoreSceneManager()._updateCoreObjectTransforms();
 			PROFILE_CALL(RendererManager::instance().getActive()->renderAll(), "Render");
 
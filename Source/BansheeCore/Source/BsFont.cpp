@@ -4,6 +4,8 @@
 #include "BsFontRTTI.h"
 #include "BsFontManager.h"
 #include "BsResources.h"
+#include "BsFontRasterizer.h"
+#include "BsGlyphAtlas.h"
 
 namespace BansheeEngine
 {
@@ -29,11 +31,13 @@ namespace BansheeEngine
 	}
 
 	Font::Font()
-		:Resource(false)
+		:Resource(false), mIsDynamic(false), mDPI(96), mRenderMode(FontRenderMode::HintedSmooth)
 	{ }
 
 	Font::~Font()
-	{ }
+	{
+		mPageEvictedConn.disconnect();
+	}
 
 	void Font::initialize(const Vector<SPtr<FontBitmap>>& fontData)
 	{
@@ -43,6 +47,206 @@ namespace BansheeEngine
 		Resource::initialize();
 	}
 
+	void Font::initializeDynamic(const Vector<UINT8>& sourceData, UINT32 dpi, FontRenderMode renderMode)
+	{
+		mIsDynamic = true;
+		mSourceData = sourceData;
+		mDPI = dpi;
+		mRenderMode = renderMode;
+
+		const SPtr<FontRasterizerFactory>& factory = FontManager::instance().getRasterizerFactory();
+		if (factory != nullptr && !mSourceData.empty())
+			mRasterizer = factory->create(&mSourceData[0], (UINT32)mSourceData.size(), mDPI, mRenderMode);
+
+		if (mRasterizer == nullptr)
+			LOGWRN("Unable to create a rasterizer for a dynamic font. Font will not be rendered.");
+
+		mPageEvictedConn = FontManager::instance().getGlyphAtlas().onPageEvicted.connect(
+			std::bind(&Font::onGlyphPageEvicted, this, std::placeholders::_1));
+
+		Resource::initialize();
+	}
+
+	void Font::_prepareGlyphs(UINT32 size, const WString& text)
+	{
+		if (!mIsDynamic || mRasterizer == nullptr)
+			return;
+
+		GlyphAtlas& atlas = FontManager::instance().getGlyphAtlas();
+
+		SPtr<FontBitmap>& bitmap = mFontDataPerSize[size];
+		DynamicSizeData& sizeData = mDynamicSizeData[size];
+
+		if (bitmap == nullptr)
+		{
+			bitmap = bs_shared_ptr_new<FontBitmap>();
+			bitmap->size = size;
+
+			if (!mRasterizer->getMetrics(size, bitmap->fontDesc))
+			{
+				bitmap->fontDesc.baselineOffset = 0;
+				bitmap->fontDesc.lineHeight = size;
+				bitmap->fontDesc.spaceWidth = size / 2;
+			}
+
+			bitmap->fontDesc.missingGlyph = CHAR_DESC();
+		}
+
+		FONT_DESC& fontDesc = bitmap->fontDesc;
+		if (!sizeData.hasMissingGlyph)
+		{
+			bool notInFont;
+			sizeData.hasMissingGlyph = rasterizeGlyph(size, 0, fontDesc.missingGlyph, notInFont);
+		}
+
+		if (sizeData.hasMissingGlyph)
+			atlas.notifyUsed(fontDesc.missingGlyph.page);
+
+		auto isWhitespace = [](UINT32 charId)
+		{
+			return charId == '\n' || charId == '\r' || charId == ' ' || charId == '\t';
+		};
+
+		for (auto& character : text)
+		{
+			UINT32 charId = (UINT32)character;
+			if (isWhitespace(charId))
+				continue;
+
+			auto iterFind = fontDesc.characters.find(charId);
+			if (iterFind != fontDesc.characters.end())
+			{
+				atlas.notifyUsed(iterFind->second.page);
+				continue;
+			}
+
+			if (sizeData.missingChars.find(charId) != sizeData.missingChars.end())
+				continue;
+
+			CHAR_DESC charDesc;
+			bool notInFont;
+			if (!rasterizeGlyph(size, charId, charDesc, notInFont))
+			{
+				// If there was no room in the atlas, try again next time the character is needed
+				if (notInFont)
+					sizeData.missingChars.insert(charId);
+
+				continue;
+			}
+
+			fontDesc.characters[charId] = charDesc;
+		}
+
+		// Kerning is only looked up for the character pairs present in the text, so rendering a new glyph doesn't 
+		// require querying it against every other rendered glyph
+		if (mRasterizer->hasKerning())
+		{
+			for (UINT32 i = 1; i < (UINT32)text.size(); i++)
+			{
+				UINT32 leftCharId = (UINT32)text[i - 1];
+				UINT32 rightCharId = (UINT32)text[i];
+
+				if (isWhitespace(leftCharId) || isWhitespace(rightCharId))
+					continue;
+
+				auto iterLeft = fontDesc.characters.find(leftCharId);
+				if (iterLeft == fontDesc.characters.end() || 
+					fontDesc.characters.find(rightCharId) == fontDesc.characters.end())
+					continue;
+
+				INT32 kerning = getKerning(size, leftCharId, rightCharId);
+				if (kerning == 0)
+					continue;
+
+				Vector<KerningPair>& kerningPairs = iterLeft->second.kerningPairs;
+				auto iterFind = std::find_if(kerningPairs.begin(), kerningPairs.end(), 
+					[&](const KerningPair& pair) { return pair.otherCharId == rightCharId; });
+
+				if (iterFind == kerningPairs.end())
+					kerningPairs.push_back({ rightCharId, kerning });
+			}
+		}
+
+		// Characters reference atlas pages directly, so expose all of them
+		UINT32 numPages = atlas.getNumPages();
+		if (bitmap->texturePages.size() != numPages)
+		{
+			bitmap->texturePages.resize(numPages);
+			for (UINT32 i = 0; i < numPages; i++)
+				bitmap->texturePages[i] = atlas.getTexture(i);
+		}
+	}
+
+	INT32 Font::getKerning(UINT32 size, UINT32 leftCharId, UINT32 rightCharId)
+	{
+		static const UINT32 MAX_CACHED_KERNING_PAIRS = 4096;
+
+		DynamicSizeData& sizeData = mDynamicSizeData[size];
+
+		UINT64 key = ((UINT64)leftCharId << 32) | rightCharId;
+		auto iterFind = sizeData.kerningCache.find(key);
+		if (iterFind != sizeData.kerningCache.end())
+			return iterFind->second;
+
+		if (sizeData.kerningCache.size() >= MAX_CACHED_KERNING_PAIRS)
+			sizeData.kerningCache.clear();
+
+		INT32 kerning = mRasterizer->getKerning(size, leftCharId, rightCharId);
+		sizeData.kerningCache[key] = kerning;
+
+		return kerning;
+	}
+
+	bool Font::rasterizeGlyph(UINT32 size, UINT32 charId, CHAR_DESC& desc, bool& notInFont)
+	{
+		notInFont = false;
+
+		if (!mRasterizer->rasterize(size, charId, desc, mGlyphPixels))
+		{
+			notInFont = true;
+			return false;
+		}
+
+		GlyphAtlas& atlas = FontManager::instance().getGlyphAtlas();
+
+		GlyphAtlasRegion region;
+		if (!atlas.allocate(desc.width, desc.height, region))
+			return false;
+
+		if (desc.width > 0 && desc.height > 0)
+			atlas.write(region, &mGlyphPixels[0]);
+
+		float invPageSize = 1.0f / atlas.getPageSize();
+
+		desc.charId = charId;
+		desc.page = region.page;
+		desc.uvX = region.x * invPageSize;
+		desc.uvY = region.y * invPageSize;
+		desc.uvWidth = region.width * invPageSize;
+		desc.uvHeight = region.height * invPageSize;
+
+		return true;
+	}
+
+	void Font::onGlyphPageEvicted(UINT32 page)
+	{
+		for (auto& entry : mFontDataPerSize)
+		{
+			FONT_DESC& fontDesc = entry.second->fontDesc;
+			for (auto iter = fontDesc.characters.begin(); iter != fontDesc.characters.end();)
+			{
+				if (iter->second.page == page)
+					iter = fontDesc.characters.erase(iter);
+				else
+					++iter;
+			}
+
+			DynamicSizeData& sizeData = mDynamicSizeData[entry.first];
+			if (sizeData.hasMissingGlyph && fontDesc.missingGlyph.page == page)
+				sizeData.hasMissingGlyph = false;
+		}
+	}
+
 	SPtr<const FontBitmap> Font::getBitmap(UINT32 size) const
 	{
 		auto iterFind = mFontDataPerSize.find(size);
@@ -55,6 +259,9 @@ namespace BansheeEngine
 
 	INT32 Font::getClosestSize(UINT32 size) const
 	{
+		if (mIsDynamic)
+			return size;
+
 		UINT32 minDiff = std::numeric_limits<UINT32>::max();
 		UINT32 bestSize = size;
 
@@ -87,6 +294,10 @@ namespace BansheeEngine
 
 	void Font::getResourceDependencies(FrameVector<HResource>& dependencies) const
 	{
+		// Pages of dynamic fonts belong to the glyph atlas
+		if (mIsDynamic)
+			return;
+
 		for (auto& fontDataEntry : mFontDataPerSize)
 		{
 			for (auto& texture : fontDataEntry.second->texturePages)
@@ -99,6 +310,9 @@ namespace BansheeEngine
 
 	void Font::getCoreDependencies(Vector<CoreObject*>& dependencies)
 	{
+		if (mIsDynamic)
+			return;
+
 		for (auto& fontDataEntry : mFontDataPerSize)
 		{
 			for (auto& texture : fontDataEntry.second->texturePages)
@@ -116,11 +330,23 @@ namespace BansheeEngine
 		return static_resource_cast<Font>(gResources()._createResourceHandle(newFont));
 	}
 
+	HFont Font::createDynamic(const Vector<UINT8>& sourceData, UINT32 dpi, FontRenderMode renderMode)
+	{
+		SPtr<Font> newFont = _createDynamicPtr(sourceData, dpi, renderMode);
+
+		return static_resource_cast<Font>(gResources()._createResourceHandle(newFont));
+	}
+
 	SPtr<Font> Font::_createPtr(const Vector<SPtr<FontBitmap>>& fontData)
 	{
 		return FontManager::instance().create(fontData);
 	}
 
+	SPtr<Font> Font::_createDynamicPtr(const Vector<UINT8>& sourceData, UINT32 dpi, FontRenderMode renderMode)
+	{
+		return FontManager::instance().createDynamic(sourceData, dpi, renderMode);
+	}
+
 	RTTITypeBase* Font::getRTTIStatic()
 	{
 		return FontRTTI::instance();
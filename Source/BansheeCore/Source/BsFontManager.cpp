@@ -2,9 +2,24 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsFontManager.h"
 #include "BsFont.h"
+#include "BsFontRasterizer.h"
+#include "BsGlyphAtlas.h"
 
 namespace BansheeEngine
 {
+	const UINT32 FontManager::GLYPH_ATLAS_PAGE_SIZE = 1024;
+	const UINT32 FontManager::GLYPH_ATLAS_MAX_PAGES = 8;
+
+	FontManager::FontManager()
+	{
+		mGlyphAtlas = bs_new<GlyphAtlas>(GLYPH_ATLAS_PAGE_SIZE, GLYPH_ATLAS_MAX_PAGES);
+	}
+
+	FontManager::~FontManager()
+	{
+		bs_delete(mGlyphAtlas);
+	}
+
 	SPtr<Font> FontManager::create(const Vector<SPtr<FontBitmap>>& fontData) const
 	{
 		SPtr<Font> newFont = bs_core_ptr<Font>(new (bs_alloc<Font>()) Font());
@@ -14,6 +29,15 @@ namespace BansheeEngine
 		return newFont;
 	}
 
+	SPtr<Font> FontManager::createDynamic(const Vector<UINT8>& sourceData, UINT32 dpi, FontRenderMode renderMode) const
+	{
+		SPtr<Font> newFont = bs_core_ptr<Font>(new (bs_alloc<Font>()) Font());
+		newFont->_setThisPtr(newFont);
+		newFont->initializeDynamic(sourceData, dpi, renderMode);
+
+		return newFont;
+	}
+
 	SPtr<Font> FontManager::_createEmpty() const
 	{
 		SPtr<Font> newFont = bs_core_ptr<Font>(new (bs_alloc<Font>()) Font());
@@ -21,4 +45,9 @@ namespace BansheeEngine
 
 		return newFont;
 	}
+
+	void FontManager::_update()
+	{
+		mGlyphAtlas->update();
+	}
 }
\ No newline at end of file
@@ -0,0 +1,171 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsGlyphAtlas.h"
+#include "BsTexture.h"
+#include "BsPixelData.h"
+#include "BsPixelUtil.h"
+#include "BsCoreThread.h"
+#include "BsTime.h"
+
+namespace BansheeEngine
+{
+	const UINT32 GlyphAtlas::PADDING = 1;
+
+	GlyphAtlas::GlyphAtlas(UINT32 pageSize, UINT32 maxPages)
+		:mPageSize(pageSize), mMaxPages(std::max(maxPages, 1U))
+	{ }
+
+	bool GlyphAtlas::allocate(UINT32 width, UINT32 height, GlyphAtlasRegion& region)
+	{
+		UINT32 paddedWidth = width + PADDING;
+		UINT32 paddedHeight = height + PADDING;
+
+		if (paddedWidth > mPageSize || paddedHeight > mPageSize)
+			return false;
+
+		UINT32 numPages = (UINT32)mPages.size();
+		for (UINT32 i = 0; i < numPages; i++)
+		{
+			if (allocateOnPage(i, paddedWidth, paddedHeight, region))
+				return true;
+		}
+
+		UINT32 pageIdx;
+		if (numPages < mMaxPages)
+		{
+			mPages.push_back(Page());
+			pageIdx = numPages;
+
+			Page& page = mPages[pageIdx];
+			page.texture = Texture::create(TEX_TYPE_2D, mPageSize, mPageSize, 0, PF_R8G8, TU_DYNAMIC);
+			page.texture->setName(L"GlyphAtlasPage" + toWString(pageIdx));
+			page.pixels = bs_shared_ptr_new<PixelData>(mPageSize, mPageSize, 1, PF_R8G8);
+			page.pixels->allocateInternalBuffer();
+		}
+		else
+		{
+			// Evict the least recently used page, unless all pages are in use during this frame
+			UINT64 frameIdx = gTime().getFrameIdx();
+
+			pageIdx = 0;
+			for (UINT32 i = 1; i < numPages; i++)
+			{
+				if (mPages[i].lastUsedFrame < mPages[pageIdx].lastUsedFrame)
+					pageIdx = i;
+			}
+
+			if (mPages[pageIdx].lastUsedFrame >= frameIdx)
+				return false;
+		}
+
+		Page& page = mPages[pageIdx];
+		memset(page.pixels->getData(), 0, page.pixels->getSize());
+		page.shelves.clear();
+		page.nextShelfY = 0;
+		page.isDirty = true;
+
+		if (pageIdx < numPages)
+			onPageEvicted(pageIdx);
+
+		return allocateOnPage(pageIdx, paddedWidth, paddedHeight, region);
+	}
+
+	bool GlyphAtlas::allocateOnPage(UINT32 pageIdx, UINT32 width, UINT32 height, GlyphAtlasRegion& region)
+	{
+		Page& page = mPages[pageIdx];
+
+		// Find the shortest shelf that can fit the glyph, to minimize wasted space
+		Shelf* foundShelf = nullptr;
+		for (auto& shelf : page.shelves)
+		{
+			if (shelf.height < height || (shelf.nextX + width) > mPageSize)
+				continue;
+
+			if (foundShelf == nullptr || shelf.height < foundShelf->height)
+				foundShelf = &shelf;
+		}
+
+		if (foundShelf == nullptr)
+		{
+			if ((page.nextShelfY + height) > mPageSize)
+				return false;
+
+			Shelf newShelf;
+			newShelf.y = page.nextShelfY;
+			newShelf.height = height;
+			newShelf.nextX = 0;
+
+			page.shelves.push_back(newShelf);
+			page.nextShelfY += height;
+
+			foundShelf = &page.shelves.back();
+		}
+
+		region.page = pageIdx;
+		region.x = foundShelf->nextX;
+		region.y = foundShelf->y;
+		region.width = width - PADDING;
+		region.height = height - PADDING;
+
+		foundShelf->nextX += width;
+		page.lastUsedFrame = gTime().getFrameIdx();
+
+		return true;
+	}
+
+	void GlyphAtlas::write(const GlyphAtlasRegion& region, const UINT8* pixels)
+	{
+		Page& page = mPages[region.page];
+
+		UINT8* dst = page.pixels->getData() + (region.y * mPageSize + region.x) * 2;
+		for (UINT32 y = 0; y < region.height; y++)
+		{
+			for (UINT32 x = 0; x < region.width; x++)
+			{
+				dst[x * 2 + 0] = pixels[x];
+				dst[x * 2 + 1] = pixels[x];
+			}
+
+			dst += mPageSize * 2;
+			pixels += region.width;
+		}
+
+		page.isDirty = true;
+	}
+
+	void GlyphAtlas::notifyUsed(UINT32 page)
+	{
+		if (page < (UINT32)mPages.size())
+			mPages[page].lastUsedFrame = gTime().getFrameIdx();
+	}
+
+	void GlyphAtlas::update()
+	{
+		for (auto& page : mPages)
+		{
+			if (!page.isDirty)
+				continue;
+
+			const TextureProperties& props = page.texture->getProperties();
+			UINT32 subresourceIdx = props.mapToSubresourceIdx(0, 0);
+
+			// Core thread reads the data asynchronously, so it gets its own copy while the atlas keeps modifying the
+			// original
+			SPtr<PixelData> uploadData = props.allocateSubresourceBuffer(subresourceIdx);
+			if (props.getFormat() != page.pixels->getFormat())
+				PixelUtil::bulkPixelConversion(*page.pixels, *uploadData);
+			else
+				memcpy(uploadData->getData(), page.pixels->getData(), page.pixels->getSize());
+
+			page.texture->writeSubresource(gCoreAccessor(), subresourceIdx, uploadData, true);
+			page.isDirty = false;
+		}
+	}
+
+	UINT32 GlyphAtlas::getMemoryUsage() const
+	{
+		UINT32 pageSize = PixelUtil::getMemorySize(mPageSize, mPageSize, 1, PF_R8G8);
+
+		return (UINT32)mPages.size() * pageSize * 2;
+	}
+}
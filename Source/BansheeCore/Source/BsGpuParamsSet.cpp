@@ -9,6 +9,7 @@
 #include "BsGpuParamDesc.h"
 #include "BsRenderAPI.h"
 #include "BsGpuParamBlockBuffer.h"
+#include "BsRenderStats.h"
 
 namespace BansheeEngine
 {
@@ -417,7 +418,7 @@ namespace BansheeEngine
 	template<bool Core>
 	TGpuParamsSet<Core>::TGpuParamsSet(const SPtr<TechniqueType>& technique, const ShaderType& shader,
 		const SPtr<MaterialParamsType>& params)
-		:mPassParams(technique->getNumPasses())
+		:mPassParams(technique->getNumPasses()), mPassParamInfos(nullptr), mStagingData(nullptr), mParamsVersion(0)
 	{
 		UINT32 numPasses = technique->getNumPasses();
 
@@ -475,7 +476,7 @@ namespace BansheeEngine
 			paramBlock.sequentialIdx = (UINT32)mBlocks.size();
 
 			paramBlockBuffers[paramBlock.name] = newParamBlockBuffer;
-			mBlocks.push_back(BlockInfo(paramBlock.name, newParamBlockBuffer, true));
+			mBlocks.push_back(BlockInfo(paramBlock.name, newParamBlockBuffer, (UINT32)paramBlock.size, true));
 		}
 
 		//// Assign param block buffers and generate information about data parameters
@@ -510,12 +511,13 @@ namespace BansheeEngine
 						UINT32 globalBlockIdx = (UINT32)-1;
 						if (!blockDesc.isShareable)
 						{
-							ParamBlockPtrType newParamBlockBuffer = ParamBlockType::create(blockDesc.blockSize * sizeof(UINT32));
+							UINT32 blockSize = blockDesc.blockSize * sizeof(UINT32);
+							ParamBlockPtrType newParamBlockBuffer = ParamBlockType::create(blockSize);
 
 							globalBlockIdx = (UINT32)mBlocks.size();
 
 							paramPtr->setParamBlockBuffer(iterBlockDesc->first, newParamBlockBuffer);
-							mBlocks.push_back(BlockInfo(iterBlockDesc->first, newParamBlockBuffer, false));
+							mBlocks.push_back(BlockInfo(iterBlockDesc->first, newParamBlockBuffer, blockSize, false));
 						}
 						else
 						{
@@ -569,11 +571,53 @@ namespace BansheeEngine
 
 			if(iterFind == mBlocks.end())
 			{
-				mBlocks.push_back(BlockInfo(entry.first, nullptr, true));
+				mBlocks.push_back(BlockInfo(entry.first, nullptr, 0, true));
 				mBlocks.back().isUsed = false;
 			}
 		}
 
+		// Group data parameters per block so they can be updated one block at a time. Shareable blocks used by multiple
+		// stages will have generated the same mappings multiple times, so remove the duplicates.
+		std::sort(mDataParamInfos.begin(), mDataParamInfos.end(), 
+			[](const DataParamInfo& a, const DataParamInfo& b)
+		{
+			if (a.blockIdx != b.blockIdx)
+				return a.blockIdx < b.blockIdx;
+
+			return a.offset < b.offset;
+		});
+
+		auto iterLast = std::unique(mDataParamInfos.begin(), mDataParamInfos.end(), 
+			[](const DataParamInfo& a, const DataParamInfo& b)
+		{
+			return a.blockIdx == b.blockIdx && a.paramIdx == b.paramIdx;
+		});
+
+		mDataParamInfos.erase(iterLast, mDataParamInfos.end());
+
+		for (UINT32 i = 0; i < (UINT32)mDataParamInfos.size(); i++)
+		{
+			BlockInfo& block = mBlocks[mDataParamInfos[i].blockIdx];
+			if (block.numDataParams == 0)
+				block.firstDataParam = i;
+
+			block.numDataParams++;
+		}
+
+		// Allocate CPU-side copies of all the blocks, used for batching parameter writes
+		UINT32 stagingSize = 0;
+		for (auto& block : mBlocks)
+		{
+			block.stagingOffset = stagingSize;
+			stagingSize += block.size;
+		}
+
+		if (stagingSize > 0)
+		{
+			mStagingData = (UINT8*)bs_alloc(stagingSize);
+			memset(mStagingData, 0, stagingSize);
+		}
+
 		// Generate information about object parameters
 		bs_frame_mark();
 		{
@@ -704,6 +748,9 @@ namespace BansheeEngine
 	{
 		// All allocations share the same memory, so we just clear it all at once
 		bs_free(mPassParamInfos);
+
+		if (mStagingData != nullptr)
+			bs_free(mStagingData);
 	}
 
 	template<bool Core>
@@ -760,8 +807,17 @@ namespace BansheeEngine
 		if (!mBlocks[foundIdx].isUsed)
 			return;
 
-		mBlocks[foundIdx].buffer = paramBlock;
-		mBlocks[foundIdx].allowUpdate = !ignoreInUpdate;
+		BlockInfo& block = mBlocks[foundIdx];
+		block.buffer = paramBlock;
+		block.allowUpdate = !ignoreInUpdate;
+
+		// Parameters are written to the buffer from the CPU-side copy of the block, so make sure it contains the current
+		// contents of the buffer, in order not to overwrite any externally written data
+		if (paramBlock != nullptr && block.allowUpdate)
+		{
+			UINT32 readSize = std::min(block.size, paramBlock->getSize());
+			paramBlock->read(0, mStagingData + block.stagingOffset, readSize);
+		}
 
 		UINT32 numPasses = (UINT32)mPassParams.size();
 		for (UINT32 j = 0; j < numPasses; j++)
@@ -779,113 +835,130 @@ namespace BansheeEngine
 	}
 
 	template<bool Core>
-	void TGpuParamsSet<Core>::update(const SPtr<MaterialParamsType>& params, UINT32 dirtyBitIdx, bool updateAll)
+	void TGpuParamsSet<Core>::update(const SPtr<MaterialParamsType>& params, bool updateAll)
 	{
-		// Note: Instead of iterating over every single parameter, it might be more efficient for @p params to keep
-		// a ring buffer and a version number. Then we could just iterate over the ring buffer and only access dirty
-		// parameters. If the version number is too high (larger than ring buffer can store), then we force update for all.
+		// Nothing was modified since the last update
+		UINT64 paramsVersion = params->getParamsVersion();
+		if (paramsVersion == mParamsVersion && !updateAll)
+			return;
 
-		// Maximum of 31 techniques are supported. Bit 32 is reserved.
-		assert(dirtyBitIdx < 31);
-		UINT32 dirtyFlagMask = 1 << dirtyBitIdx;
+		UINT32 numParamsWritten = 0;
+		bool transposeMatrices = RenderAPICore::instance().getAPIInfo().getGpuProgramHasColumnMajorMatrices();
 
-		// Update data params
-		for(auto& paramInfo : mDataParamInfos)
+		// Update data params, gathering modified parameters in the CPU-side block copy and then writing the modified
+		// range of each block with a single write
+		for(auto& block : mBlocks)
 		{
-			ParamBlockPtrType paramBlock = mBlocks[paramInfo.blockIdx].buffer;
-			if (paramBlock == nullptr || !mBlocks[paramInfo.blockIdx].allowUpdate)
+			if (block.buffer == nullptr || !block.allowUpdate || block.numDataParams == 0)
 				continue;
 
-			const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-			if ((materialParamInfo->dirtyFlags & dirtyFlagMask) == 0 && !updateAll)
-				continue;
+			UINT8* blockData = mStagingData + block.stagingOffset;
+			UINT32 dirtyStart = block.size;
+			UINT32 dirtyEnd = 0;
+
+			for(UINT32 i = 0; i < block.numDataParams; i++)
+			{
+				const DataParamInfo& paramInfo = mDataParamInfos[block.firstDataParam + i];
 
-			UINT32 arraySize = materialParamInfo->arraySize == 0 ? 1 : materialParamInfo->arraySize;
-			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)materialParamInfo->dataType];
-			UINT32 paramSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
+				const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
+				if (materialParamInfo->version <= mParamsVersion && !updateAll)
+					continue;
 
-			UINT8* data = params->getData(materialParamInfo->index);
+				UINT32 arraySize = materialParamInfo->arraySize == 0 ? 1 : materialParamInfo->arraySize;
+				const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)materialParamInfo->dataType];
+				UINT32 paramSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
 
-			bool transposeMatrices = RenderAPICore::instance().getAPIInfo().getGpuProgramHasColumnMajorMatrices();
-			if (transposeMatrices)
-			{
-				auto writeTransposed = [&](auto& temp)
+				UINT32 dstOffset = paramInfo.offset * sizeof(UINT32);
+				UINT32 dataSize = paramSize * arraySize;
+
+				UINT8* src = params->getData(materialParamInfo->index);
+				UINT8* dst = blockData + dstOffset;
+
+				if (transposeMatrices)
 				{
-					for (UINT32 i = 0; i < arraySize; i++)
+					auto writeTransposed = [&](auto& temp)
 					{
-						UINT32 arrayOffset = i * paramSize;
-						memcpy(&temp, data + arrayOffset, paramSize);
-						temp.transpose();
+						for (UINT32 j = 0; j < arraySize; j++)
+						{
+							UINT32 arrayOffset = j * paramSize;
+							memcpy(&temp, src + arrayOffset, paramSize);
+							temp.transpose();
 
-						paramBlock->write((paramInfo.offset + arrayOffset) * sizeof(UINT32), &temp, paramSize);
-					}
-				};
+							memcpy(dst + arrayOffset, &temp, paramSize);
+						}
+					};
 
-				switch (materialParamInfo->dataType)
-				{
-				case GPDT_MATRIX_2X2:
-				{
-					MatrixNxM<2, 2> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_2X3:
-				{
-					MatrixNxM<2, 3> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_2X4:
-				{
-					MatrixNxM<2, 4> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_3X2:
-				{
-					MatrixNxM<3, 2> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_3X3:
-				{
-					Matrix3 matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_3X4:
-				{
-					MatrixNxM<3, 4> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_4X2:
-				{
-					MatrixNxM<4, 2> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_4X3:
-				{
-					MatrixNxM<4, 3> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_4X4:
-				{
-					Matrix4 matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				default:
-				{
-					paramBlock->write(paramInfo.offset * sizeof(UINT32), data, paramSize * arraySize);
-					break;
-				}
+					switch (materialParamInfo->dataType)
+					{
+					case GPDT_MATRIX_2X2:
+					{
+						MatrixNxM<2, 2> matrix;
+						writeTransposed(matrix);
+					}
+						break;
+					case GPDT_MATRIX_2X3:
+					{
+						MatrixNxM<2, 3> matrix;
+						writeTransposed(matrix);
+					}
+						break;
+					case GPDT_MATRIX_2X4:
+					{
+						MatrixNxM<2, 4> matrix;
+						writeTransposed(matrix);
+					}
+						break;
+					case GPDT_MATRIX_3X2:
+					{
+						MatrixNxM<3, 2> matrix;
+						writeTransposed(matrix);
+					}
+						break;
+					case GPDT_MATRIX_3X3:
+					{
+						Matrix3 matrix;
+						writeTransposed(matrix);
+					}
+						break;
+					case GPDT_MATRIX_3X4:
+					{
+						MatrixNxM<3, 4> matrix;
+						writeTransposed(matrix);
+					}
+						break;
+					case GPDT_MATRIX_4X2:
+					{
+						MatrixNxM<4, 2> matrix;
+						writeTransposed(matrix);
+					}
+						break;
+					case GPDT_MATRIX_4X3:
+					{
+						MatrixNxM<4, 3> matrix;
+						writeTransposed(matrix);
+					}
+						break;
+					case GPDT_MATRIX_4X4:
+					{
+						Matrix4 matrix;
+						writeTransposed(matrix);
+					}
+						break;
+					default:
+						memcpy(dst, src, dataSize);
+						break;
+					}
 				}
+				else
+					memcpy(dst, src, dataSize);
+
+				dirtyStart = std::min(dirtyStart, dstOffset);
+				dirtyEnd = std::max(dirtyEnd, dstOffset + dataSize);
+				numParamsWritten++;
 			}
-			else
-				paramBlock->write(paramInfo.offset * sizeof(UINT32), data, paramSize * arraySize);
+
+			if (dirtyStart < dirtyEnd)
+				block.buffer->write(dirtyStart, blockData + dirtyStart, dirtyEnd - dirtyStart);
 		}
 
 		// Update object params
@@ -899,19 +972,21 @@ namespace BansheeEngine
 				if(paramsPtr != nullptr)
 				{
 					const StageParamInfo& stageInfo = mPassParamInfos[i].stages[j];
+					UINT32 numStageParamsWritten = 0;
 
 					for(UINT32 k = 0; k < stageInfo.numTextures; k++)
 					{
 						const ObjectParamInfo& paramInfo = stageInfo.textures[k];
 
 						const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-						if ((materialParamInfo->dirtyFlags & dirtyFlagMask) == 0 && !updateAll)
+						if (materialParamInfo->version <= mParamsVersion && !updateAll)
 							continue;
 
 						TextureType texture;
 						params->getTexture(materialParamInfo->index, texture);
 
 						paramsPtr->setTexture(paramInfo.slotIdx, texture);
+						numStageParamsWritten++;
 					}
 
 					for (UINT32 k = 0; k < stageInfo.numLoadStoreTextures; k++)
@@ -919,7 +994,7 @@ namespace BansheeEngine
 						const ObjectParamInfo& paramInfo = stageInfo.loadStoreTextures[k];
 
 						const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-						if ((materialParamInfo->dirtyFlags & dirtyFlagMask) == 0 && !updateAll)
+						if (materialParamInfo->version <= mParamsVersion && !updateAll)
 							continue;
 
 						TextureSurface surface;
@@ -927,6 +1002,7 @@ namespace BansheeEngine
 						params->getLoadStoreTexture(materialParamInfo->index, texture, surface);
 
 						paramsPtr->setLoadStoreTexture(paramInfo.slotIdx, texture, surface);
+						numStageParamsWritten++;
 					}
 
 					for (UINT32 k = 0; k < stageInfo.numBuffers; k++)
@@ -934,13 +1010,14 @@ namespace BansheeEngine
 						const ObjectParamInfo& paramInfo = stageInfo.buffers[k];
 
 						const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-						if ((materialParamInfo->dirtyFlags & dirtyFlagMask) == 0 && !updateAll)
+						if (materialParamInfo->version <= mParamsVersion && !updateAll)
 							continue;
 
 						BufferType buffer;
 						params->getBuffer(materialParamInfo->index, buffer);
 
 						paramsPtr->setBuffer(paramInfo.slotIdx, buffer);
+						numStageParamsWritten++;
 					}
 
 					for (UINT32 k = 0; k < stageInfo.numSamplerStates; k++)
@@ -948,19 +1025,31 @@ namespace BansheeEngine
 						const ObjectParamInfo& paramInfo = stageInfo.samplerStates[k];
 
 						const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-						if ((materialParamInfo->dirtyFlags & dirtyFlagMask) == 0 && !updateAll)
+						if (materialParamInfo->version <= mParamsVersion && !updateAll)
 							continue;
 
 						SamplerStateType samplerState;
 						params->getSamplerState(materialParamInfo->index, samplerState);
 
 						paramsPtr->setSamplerState(paramInfo.slotIdx, samplerState);
+						numStageParamsWritten++;
 					}
 
-					paramsPtr->_markCoreDirty();
+					if (numStageParamsWritten > 0)
+						paramsPtr->_markCoreDirty();
+
+					numParamsWritten += numStageParamsWritten;
 				}
 			}
 		}
+
+		mParamsVersion = paramsVersion;
+
+		// Render stats are only tracked on the core thread
+		if (Core)
+		{
+			BS_ADD_RENDER_STAT(NumParamsWritten, numParamsWritten);
+		}
 	}
 
 	template class TGpuParamsSet <false>;
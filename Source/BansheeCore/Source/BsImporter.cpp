@@ -78,7 +78,15 @@ namespace BansheeEngine
 			}
 		}
 
+		// Importers that don't support concurrent imports are only ever used by one thread at a time
+		Lock lock(importer->mImportMutex, std::defer_lock);
+		if (!importer->isThreadSafe())
+			lock.lock();
+
 		SPtr<Resource> importedResource = importer->import(inputFilePath, importOptions);
+		if (lock.owns_lock())
+			lock.unlock();
+
 		return gResources()._createResourceHandle(importedResource);
 	}
 
@@ -121,9 +129,23 @@ namespace BansheeEngine
 			}
 		}
 
+		// Importers that don't support concurrent imports are only ever used by one thread at a time
+		Lock lock(importer->mImportMutex, std::defer_lock);
+		if (!importer->isThreadSafe())
+			lock.lock();
+
 		return importer->importAll(inputFilePath, importOptions);
 	}
 
+	UINT32 Importer::_getImporterVersion(const Path& inputFilePath) const
+	{
+		SpecificImporter* importer = getImporterForFile(inputFilePath);
+		if (importer == nullptr)
+			return 0;
+
+		return importer->getVersion();
+	}
+
 	void Importer::reimport(HResource& existingResource, const Path& inputFilePath, SPtr<const ImportOptions> importOptions)
 	{
 		if(!FileSystem::isFile(inputFilePath))
@@ -148,7 +170,15 @@ namespace BansheeEngine
 			}
 		}
 
+		// Importers that don't support concurrent imports are only ever used by one thread at a time
+		Lock lock(importer->mImportMutex, std::defer_lock);
+		if (!importer->isThreadSafe())
+			lock.lock();
+
 		SPtr<Resource> importedResource = importer->import(inputFilePath, importOptions);
+		if (lock.owns_lock())
+			lock.unlock();
+
 		gResources().update(existingResource, importedResource);
 	}
 
@@ -54,11 +54,9 @@ namespace BansheeEngine
 	}
 
 	template<bool Core>
-	void TMaterial<Core>::updateParamsSet(const SPtr<GpuParamsSetType>& paramsSet, UINT32 dirtyBitIdx, bool forceRefresh)
+	void TMaterial<Core>::updateParamsSet(const SPtr<GpuParamsSetType>& paramsSet, bool forceRefresh)
 	{
-		paramsSet->update(mParams, dirtyBitIdx, forceRefresh);
-
-		mParams->clearDirtyFlags(dirtyBitIdx);
+		paramsSet->update(mParams, forceRefresh);
 	}
 
 	template<bool Core>
@@ -51,6 +51,7 @@ namespace BansheeEngine
 			dataParam.type = ParamType::Data;
 			dataParam.dataType = entry.second.type;
 			dataParam.dirtyFlags = 0xFFFFFFFF;
+			dataParam.version = 1;
 
 			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)dataParam.dataType];
 			UINT32 paramSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
@@ -72,6 +73,7 @@ namespace BansheeEngine
 			dataParam.dataType = GPDT_UNKNOWN;
 			dataParam.index = textureIdx;
 			dataParam.dirtyFlags = 0xFFFFFFFF;
+			dataParam.version = 1;
 
 			textureIdx++;
 		}
@@ -89,6 +91,7 @@ namespace BansheeEngine
 			dataParam.dataType = GPDT_UNKNOWN;
 			dataParam.index = bufferIdx;
 			dataParam.dirtyFlags = 0xFFFFFFFF;
+			dataParam.version = 1;
 
 			bufferIdx++;
 		}
@@ -106,6 +109,7 @@ namespace BansheeEngine
 			dataParam.dataType = GPDT_UNKNOWN;
 			dataParam.index = samplerIdx;
 			dataParam.dirtyFlags = 0xFFFFFFFF;
+			dataParam.version = 1;
 
 			samplerIdx++;
 		}
@@ -185,14 +189,6 @@ namespace BansheeEngine
 		}
 	}
 
-	void MaterialParamsBase::clearDirtyFlags(UINT32 techniqueIdx)
-	{
-		UINT32 mask = ~(1 << techniqueIdx);
-
-		for (auto& entry : mParams)
-			entry.dirtyFlags &= mask;
-	}
-
 	RTTITypeBase* MaterialParamStructData::getRTTIStatic()
 	{
 		return MaterialParamStructDataRTTI::instance();
@@ -619,7 +615,7 @@ namespace BansheeEngine
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
 			ParamData& param = mParams[paramIdx];
-			param.dirtyFlags = 0xFFFFFFFF;
+			markParamDirty(&param);
 
 			UINT32 arraySize = param.arraySize > 1 ? param.arraySize : 1;
 			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)param.type];
@@ -636,7 +632,7 @@ namespace BansheeEngine
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
 			ParamData& param = mParams[paramIdx];
-			param.dirtyFlags = 0xFFFFFFFF;
+			markParamDirty(&param);
 
 			MaterialParamTextureDataCore* sourceTexData = (MaterialParamTextureDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamTextureDataCore);
@@ -651,7 +647,7 @@ namespace BansheeEngine
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
 			ParamData& param = mParams[paramIdx];
-			param.dirtyFlags = 0xFFFFFFFF;
+			markParamDirty(&param);
 
 			MaterialParamBufferDataCore* sourceBufferData = (MaterialParamBufferDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamBufferDataCore);
@@ -666,7 +662,7 @@ namespace BansheeEngine
 			sourceData = rttiReadElem(paramIdx, sourceData);
 
 			ParamData& param = mParams[paramIdx];
-			param.dirtyFlags = 0xFFFFFFFF;
+			markParamDirty(&param);
 
 			MaterialParamSamplerStateDataCore* sourceSamplerStateData = (MaterialParamSamplerStateDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamSamplerStateDataCore);
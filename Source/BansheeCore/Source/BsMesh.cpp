@@ -21,7 +21,10 @@ namespace BansheeEngine
 		, mVertexDesc(desc.vertexDesc), mUsage(desc.usage), mIndexType(desc.indexType)
 		, mTempInitialMeshData(initialMeshData), mSkeleton(desc.skeleton), mMorphShapes(desc.morphShapes)
 		
-	{ }
+	{
+		mProperties.mLODs = desc.lods;
+		mProperties.mVertexCompression = desc.vertexCompression;
+	}
 
 	MeshCore::~MeshCore()
 	{
@@ -292,7 +295,7 @@ namespace BansheeEngine
 
 	void MeshCore::updateBounds(const MeshData& meshData)
 	{
-		mProperties.mBounds = meshData.calculateBounds();
+		mProperties.mBounds = mProperties.mVertexCompression.decodeBounds(meshData.calculateBounds());
 		
 		// TODO - Sync this to sim-thread possibly?
 	}
@@ -363,7 +366,8 @@ namespace BansheeEngine
 		:MeshBase(desc.numVertices, desc.numIndices, desc.subMeshes), mVertexDesc(desc.vertexDesc), mUsage(desc.usage),
 		mIndexType(desc.indexType), mSkeleton(desc.skeleton), mMorphShapes(desc.morphShapes)
 	{
-
+		mProperties.mLODs = desc.lods;
+		mProperties.mVertexCompression = desc.vertexCompression;
 	}
 
 	Mesh::Mesh(const SPtr<MeshData>& initialMeshData, const MESH_DESC& desc)
@@ -372,7 +376,8 @@ namespace BansheeEngine
 		mUsage(desc.usage), mIndexType(initialMeshData->getIndexType()), mSkeleton(desc.skeleton), 
 		mMorphShapes(desc.morphShapes)
 	{
-
+		mProperties.mLODs = desc.lods;
+		mProperties.mVertexCompression = desc.vertexCompression;
 	}
 
 	Mesh::Mesh()
@@ -443,7 +448,7 @@ namespace BansheeEngine
 
 	void Mesh::updateBounds(const MeshData& meshData)
 	{
-		mProperties.mBounds = meshData.calculateBounds();
+		mProperties.mBounds = mProperties.mVertexCompression.decodeBounds(meshData.calculateBounds());
 		markCoreDirty();
 	}
 
@@ -459,6 +464,8 @@ namespace BansheeEngine
 		desc.numIndices = mProperties.mNumIndices;
 		desc.vertexDesc = mVertexDesc;
 		desc.subMeshes = mProperties.mSubMeshes;
+		desc.lods = mProperties.mLODs;
+		desc.vertexCompression = mProperties.mVertexCompression;
 		desc.usage = mUsage;
 		desc.indexType = mIndexType;
 		desc.skeleton = mSkeleton;
@@ -0,0 +1,141 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsMeshBVH.h"
+#include "BsMeshData.h"
+#include "BsMeshBase.h"
+#include "BsVertexDataDesc.h"
+#include "BsPlane.h"
+#include "BsMeshUtility.h"
+
+namespace BansheeEngine
+{
+	SPtr<MeshBVH> MeshBVH::create(const MeshData& meshData, const MeshProperties& properties)
+	{
+		SPtr<VertexDataDesc> vertexDesc = meshData.getVertexDesc();
+		if (!vertexDesc->hasElement(VES_POSITION))
+			return nullptr;
+
+		UINT32 numVertices = meshData.getNumVertices();
+		UINT32 numIndices = meshData.getNumIndices();
+
+		SPtr<MeshBVH> output = bs_shared_ptr_new<MeshBVH>();
+
+		output->mVertices.resize(numVertices);
+		if (!MeshUtility::readPositions(meshData, properties.getVertexCompression(), output->mVertices.data()))
+			return nullptr;
+
+		UINT16* indices16 = nullptr;
+		UINT32* indices32 = nullptr;
+		if (meshData.getIndexType() == IT_16BIT)
+			indices16 = meshData.getIndices16();
+		else
+			indices32 = meshData.getIndices32();
+
+		UINT32 numSubMeshes = properties.getNumSubMeshes();
+		for (UINT32 i = 0; i < numSubMeshes; i++)
+		{
+			const SubMesh& subMesh = properties.getSubMesh(i);
+			if (subMesh.drawOp != DOT_TRIANGLE_LIST)
+				continue;
+
+			UINT32 end = std::min(subMesh.indexOffset + subMesh.indexCount, numIndices);
+			for (UINT32 j = subMesh.indexOffset; j + 2 < end; j += 3)
+			{
+				UINT32 idx[3];
+				for (UINT32 k = 0; k < 3; k++)
+					idx[k] = indices16 != nullptr ? indices16[j + k] : indices32[j + k];
+
+				if (idx[0] >= numVertices || idx[1] >= numVertices || idx[2] >= numVertices)
+					continue;
+
+				output->mIndices.insert(output->mIndices.end(), idx, idx + 3);
+			}
+		}
+
+		UINT32 numTriangles = (UINT32)output->mIndices.size() / 3;
+		if (numTriangles == 0)
+			return nullptr;
+
+		Vector<AABox> triangleBounds(numTriangles);
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			const Vector3& a = output->mVertices[output->mIndices[i * 3 + 0]];
+			const Vector3& b = output->mVertices[output->mIndices[i * 3 + 1]];
+			const Vector3& c = output->mVertices[output->mIndices[i * 3 + 2]];
+
+			AABox bounds(a, a);
+			bounds.merge(b);
+			bounds.merge(c);
+
+			triangleBounds[i] = bounds;
+		}
+
+		output->mBVH.build(triangleBounds);
+		return output;
+	}
+
+	bool MeshBVH::intersects(const Ray& ray, float& distance, Vector3& normal, CullingMode cullMode) const
+	{
+		// Vertices of a triangle appear counter-clockwise when viewed from the side the cross product of its edges points
+		// towards, which is the positive side of the triangle
+		bool positiveSide = cullMode != CULL_COUNTERCLOCKWISE;
+		bool negativeSide = cullMode != CULL_CLOCKWISE;
+
+		bool hit = false;
+		distance = std::numeric_limits<float>::max();
+
+		mBVH.intersects(ray, distance, 
+			[&](UINT32 triangleIdx, float& maxDistance)
+		{
+			const Vector3& a = mVertices[mIndices[triangleIdx * 3 + 0]];
+			const Vector3& b = mVertices[mIndices[triangleIdx * 3 + 1]];
+			const Vector3& c = mVertices[mIndices[triangleIdx * 3 + 2]];
+
+			Vector3 triNormal = Vector3::cross(b - a, c - a);
+			auto result = ray.intersects(a, b, c, triNormal, positiveSide, negativeSide);
+			if (result.first && result.second < maxDistance)
+			{
+				maxDistance = result.second;
+				normal = Vector3::normalize(triNormal);
+				hit = true;
+			}
+		});
+
+		if (hit && normal.dot(ray.getDirection()) > 0.0f)
+			normal = -normal;
+
+		return hit;
+	}
+
+	bool MeshBVH::intersects(const ConvexVolume& volume) const
+	{
+		Vector<Plane> planes = volume.getPlanes();
+
+		bool found = false;
+		mBVH.intersects(volume, 
+			[&](UINT32 triangleIdx)
+		{
+			const Vector3& a = mVertices[mIndices[triangleIdx * 3 + 0]];
+			const Vector3& b = mVertices[mIndices[triangleIdx * 3 + 1]];
+			const Vector3& c = mVertices[mIndices[triangleIdx * 3 + 2]];
+
+			// Conservative test, the triangle is only rejected if all of its vertices are outside of the same plane
+			for (auto& plane : planes)
+			{
+				if (plane.getDistance(a) < 0.0f && plane.getDistance(b) < 0.0f && plane.getDistance(c) < 0.0f)
+					return true;
+			}
+
+			found = true;
+			return false;
+		});
+
+		return found;
+	}
+
+	UINT32 MeshBVH::getMemoryUsage() const
+	{
+		return (UINT32)(mVertices.capacity() * sizeof(Vector3) + mIndices.capacity() * sizeof(UINT32)) + 
+			mBVH.getMemoryUsage();
+	}
+}
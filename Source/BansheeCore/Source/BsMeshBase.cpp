@@ -5,9 +5,28 @@
 #include "BsCoreThread.h"
 #include "BsFrameAlloc.h"
 #include "BsDebug.h"
+#include "BsQuaternion.h"
 
 namespace BansheeEngine
 {
+	Matrix4 MeshVertexCompression::getPositionDecodeTransform() const
+	{
+		return Matrix4::TRS(positionOffset, Quaternion::IDENTITY, positionScale);
+	}
+
+	Bounds MeshVertexCompression::decodeBounds(const Bounds& bounds) const
+	{
+		const AABox& box = bounds.getBox();
+		const Sphere& sphere = bounds.getSphere();
+
+		AABox decodedBox(box.getMin() * positionScale + positionOffset, box.getMax() * positionScale + positionOffset);
+
+		float maxScale = std::max(std::max(positionScale.x, positionScale.y), positionScale.z);
+		Sphere decodedSphere(sphere.getCenter() * positionScale + positionOffset, sphere.getRadius() * maxScale);
+
+		return Bounds(decodedBox, decodedSphere);
+	}
+
 	MeshProperties::MeshProperties()
 		:mNumVertices(0), mNumIndices(0)
 	{
@@ -42,6 +61,26 @@ namespace BansheeEngine
 		return (UINT32)mSubMeshes.size();
 	}
 
+	const SubMesh& MeshProperties::getSubMesh(UINT32 subMeshIdx, UINT32 lod) const
+	{
+		if (lod == 0 || mLODs.empty())
+			return getSubMesh(subMeshIdx);
+
+		const MeshLOD& meshLOD = mLODs[std::min(lod, (UINT32)mLODs.size()) - 1];
+		if (subMeshIdx >= meshLOD.subMeshes.size())
+			return getSubMesh(subMeshIdx);
+
+		return meshLOD.subMeshes[subMeshIdx];
+	}
+
+	float MeshProperties::getLODScreenSize(UINT32 lod) const
+	{
+		if (lod == 0 || lod > mLODs.size())
+			return 0.0f;
+
+		return mLODs[lod - 1].screenSize;
+	}
+
 	MeshCoreBase::MeshCoreBase(UINT32 numVertices, UINT32 numIndices, const Vector<SubMesh>& subMeshes)
 		:mProperties(numVertices, numIndices, subMeshes)
 	{ }
@@ -11,6 +11,7 @@
 #include "BsVertexDataDesc.h"
 #include "BsException.h"
 #include "BsDebug.h"
+#include "BsBitwise.h"
 
 namespace BansheeEngine
 {
@@ -359,22 +360,34 @@ namespace BansheeEngine
 		{
 			const VertexElement& curElement = vertexDesc->getElement(i);
 
-			if (curElement.getSemantic() != VES_POSITION || (curElement.getType() != VET_FLOAT3 && curElement.getType() != VET_FLOAT4))
+			VertexElementType type = curElement.getType();
+			if (curElement.getSemantic() != VES_POSITION || (type != VET_FLOAT3 && type != VET_FLOAT4 && type != VET_HALF4))
 				continue;
 
 			UINT8* data = getElementData(curElement.getSemantic(), curElement.getSemanticIdx(), curElement.getStreamIdx());
 			UINT32 stride = vertexDesc->getVertexStride(curElement.getStreamIdx());
 
+			// Half precision positions are returned as stored, and must be decoded by the caller if they were compressed
+			auto readPosition = [&](UINT32 idx)
+			{
+				if (type != VET_HALF4)
+					return *(Vector3*)(data + stride * idx);
+
+				UINT16* halfs = (UINT16*)(data + stride * idx);
+				return Vector3(Bitwise::halfToFloat(halfs[0]), Bitwise::halfToFloat(halfs[1]), 
+					Bitwise::halfToFloat(halfs[2]));
+			};
+
 			if (getNumVertices() > 0)
 			{
-				Vector3 curPosition = *(Vector3*)data;
+				Vector3 curPosition = readPosition(0);
 				Vector3 accum = curPosition;
 				Vector3 min = curPosition;
 				Vector3 max = curPosition;
 
 				for (UINT32 i = 1; i < getNumVertices(); i++)
 				{
-					curPosition = *(Vector3*)(data + stride * i);
+					curPosition = readPosition(i);
 					accum += curPosition;
 					min = Vector3::min(min, curPosition);
 					max = Vector3::max(max, curPosition);
@@ -385,7 +398,7 @@ namespace BansheeEngine
 
 				for (UINT32 i = 0; i < getNumVertices(); i++)
 				{
-					curPosition = *(Vector3*)(data + stride * i);
+					curPosition = readPosition(i);
 					float dist = center.squaredDistance(curPosition);
 
 					if (dist > radiusSqrd)
@@ -27,7 +27,9 @@ namespace BansheeEngine
 
 	MeshImportOptions::MeshImportOptions()
 		: mCPUReadable(false), mImportNormals(true), mImportTangents(true), mImportBlendShapes(false), mImportSkin(false)
-		, mImportAnimation(false), mReduceKeyFrames(true), mImportScale(1.0f), mCollisionMeshType(CollisionMeshType::None)
+		, mImportAnimation(false), mReduceKeyFrames(true), mCompressAnimation(false), mBakeAnimation(false)
+		, mMeshOptimization(MeshOptimizeFlag::All), mNumLODs(0), mLODReduction(0.5f), mVertexCompression()
+		, mImportScale(1.0f), mCollisionMeshType(CollisionMeshType::None)
 	{ }
 
 	RTTITypeBase* MeshImportOptions::getRTTIStatic()
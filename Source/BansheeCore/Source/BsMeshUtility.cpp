@@ -5,78 +5,80 @@
 #include "BsVector3.h"
 #include "BsVector2.h"
 #include "BsPlane.h"
+#include "BsMatrix4.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsTaskScheduler.h"
+#include "BsSubMesh.h"
+#include "BsMeshBase.h"
+#include "BsBitwise.h"
+
+#if (BS_ARCH_TYPE == BS_ARCHITECTURE_x86_64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define BS_MESH_UTILITY_SSE 1
+#	include <emmintrin.h>
+#else
+#	define BS_MESH_UTILITY_SSE 0
+#endif
 
 namespace BansheeEngine
 {
-	struct VertexFaces
-	{
-		UINT32* faces;
-		UINT32 numFaces = 0;
-	};
+	/** Minimum number of triangles processed by a single task, when splitting triangle processing across worker threads. */
+	static const UINT32 MIN_FACES_PER_TASK = 4096;
 
+	/** Lists the faces referencing each vertex, in the order the faces appear in the index buffer. */
 	struct VertexConnectivity
 	{
-		VertexConnectivity(UINT8* indices, UINT32 numVertices, UINT32 numFaces, UINT32 indexSize)
-			:vertexFaces(nullptr), mMaxFacesPerVertex(0), mNumVertices(numVertices), mFaces(nullptr)
+		VertexConnectivity(const UINT32* indices, UINT32 numVertices, UINT32 numFaces)
+			:faceOffsets(numVertices + 1, 0), faces(numFaces * 3)
 		{
-			vertexFaces = bs_newN<VertexFaces>(numVertices);
+			for (UINT32 i = 0; i < numFaces * 3; i++)
+			{
+				assert(indices[i] < numVertices);
+				faceOffsets[indices[i] + 1]++;
+			}
 
-			resizeFaceArray(10);
+			for (UINT32 i = 0; i < numVertices; i++)
+				faceOffsets[i + 1] += faceOffsets[i];
 
+			Vector<UINT32> numVertexFaces(numVertices, 0);
 			for (UINT32 i = 0; i < numFaces; i++)
 			{
 				for (UINT32 j = 0; j < 3; j++)
 				{
-					UINT32 idx = i * 3 + j;
-					UINT32 vertexIdx = 0;
-					memcpy(&vertexIdx, indices + idx * indexSize, indexSize);
-
-					assert(vertexIdx < mNumVertices);
-					VertexFaces& faces = vertexFaces[vertexIdx];
-					if (faces.numFaces >= mMaxFacesPerVertex)
-						resizeFaceArray(mMaxFacesPerVertex * 2);
-
-					faces.faces[faces.numFaces] = i;
-					faces.numFaces++;
+					UINT32 vertexIdx = indices[i * 3 + j];
+					faces[faceOffsets[vertexIdx] + numVertexFaces[vertexIdx]++] = i;
 				}
 			}
 		}
 
-		~VertexConnectivity()
-		{
-			if (vertexFaces != nullptr)
-				bs_deleteN(vertexFaces, mNumVertices);
+		/** 
+		 * Offsets into the @p faces array at which the faces of each vertex start. Contains an extra entry at the end,
+		 * so the faces of vertex i are in range [faceOffsets[i], faceOffsets[i + 1]).
+		 */
+		Vector<UINT32> faceOffsets;
 
-			if (mFaces != nullptr)
-				bs_free(mFaces);
-		}
+		/** Indices of the faces referencing each vertex, grouped by vertex. */
+		Vector<UINT32> faces;
+	};
 
-		VertexFaces* vertexFaces;
+	/** Converts indices of the provided size into 32-bit indices. */
+	void readIndices(const UINT8* indices, UINT32 numIndices, UINT32 indexSize, Vector<UINT32>& output)
+	{
+		output.resize(numIndices);
 
-	private:
-		void resizeFaceArray(UINT32 numFaces)
+		if (indexSize == sizeof(UINT32))
+			memcpy(output.data(), indices, numIndices * sizeof(UINT32));
+		else
 		{
-			UINT32* newFaces = (UINT32*)bs_alloc(numFaces * mNumVertices * sizeof(UINT32));
-
-			if (mFaces != nullptr)
+			for (UINT32 i = 0; i < numIndices; i++)
 			{
-				for (UINT32 i = 0; i < mNumVertices; i++)
-					memcpy(newFaces + (i * numFaces), mFaces + (i * mMaxFacesPerVertex), mMaxFacesPerVertex * sizeof(UINT32));
+				UINT32 index = 0;
+				memcpy(&index, indices + i * indexSize, indexSize);
 
-				bs_free(mFaces);
+				output[i] = index;
 			}
-
-			for (UINT32 i = 0; i < mNumVertices; i++)
-				vertexFaces[i].faces = newFaces + (i * numFaces);
-
-			mFaces = newFaces;
-			mMaxFacesPerVertex = numFaces;
 		}
-
-		UINT32 mMaxFacesPerVertex;
-		UINT32 mNumVertices;
-		UINT32* mFaces;
-	};
+	}
 
 	/** Provides base methods required for clipping of arbitrary triangles. */
 	class TriangleClipperBase // Implementation from: http://www.geometrictools.com/Documentation/ClipMesh.pdf
@@ -724,18 +726,94 @@ namespace BansheeEngine
 		bs_frame_clear();
 	}
 
-	void MeshUtility::calculateNormals(Vector3* vertices, UINT8* indices, UINT32 numVertices,
-		UINT32 numIndices, Vector3* normals, UINT32 indexSize)
+#if BS_MESH_UTILITY_SSE
+	/** Four three-component vectors, stored in structure of arrays form. */
+	struct Vector3x4
 	{
-		UINT32 numFaces = numIndices / 3;
+		__m128 x, y, z;
+	};
+
+	/** Loads the vectors at the four provided indices. */
+	Vector3x4 loadVector3x4(const Vector3* vectors, const UINT32* indices, UINT32 stride)
+	{
+		const Vector3& a = vectors[indices[0]];
+		const Vector3& b = vectors[indices[stride]];
+		const Vector3& c = vectors[indices[stride * 2]];
+		const Vector3& d = vectors[indices[stride * 3]];
+
+		Vector3x4 output;
+		output.x = _mm_setr_ps(a.x, b.x, c.x, d.x);
+		output.y = _mm_setr_ps(a.y, b.y, c.y, d.y);
+		output.z = _mm_setr_ps(a.z, b.z, c.z, d.z);
+
+		return output;
+	}
+
+	/** Stores the four vectors sequentially in the output array. */
+	void storeVector3x4(const Vector3x4& vectors, Vector3* output)
+	{
+		float x[4], y[4], z[4];
+		_mm_storeu_ps(x, vectors.x);
+		_mm_storeu_ps(y, vectors.y);
+		_mm_storeu_ps(z, vectors.z);
 
-		Vector3* faceNormals = bs_newN<Vector3>(numFaces);
-		for (UINT32 i = 0; i < numFaces; i++)
+		for (UINT32 i = 0; i < 4; i++)
+			output[i] = Vector3(x[i], y[i], z[i]);
+	}
+
+	Vector3x4 subVector3x4(const Vector3x4& a, const Vector3x4& b)
+	{
+		return { _mm_sub_ps(a.x, b.x), _mm_sub_ps(a.y, b.y), _mm_sub_ps(a.z, b.z) };
+	}
+
+	Vector3x4 crossVector3x4(const Vector3x4& a, const Vector3x4& b)
+	{
+		return {
+			_mm_sub_ps(_mm_mul_ps(a.y, b.z), _mm_mul_ps(a.z, b.y)),
+			_mm_sub_ps(_mm_mul_ps(a.z, b.x), _mm_mul_ps(a.x, b.z)),
+			_mm_sub_ps(_mm_mul_ps(a.x, b.y), _mm_mul_ps(a.y, b.x))
+		};
+	}
+
+	/** Normalizes the vectors, leaving the vectors that are too short unchanged. Same as Vector3::normalize(). */
+	Vector3x4 normalizeVector3x4(const Vector3x4& v)
+	{
+		__m128 sqrdLength = _mm_add_ps(_mm_add_ps(_mm_mul_ps(v.x, v.x), _mm_mul_ps(v.y, v.y)), _mm_mul_ps(v.z, v.z));
+		__m128 length = _mm_sqrt_ps(sqrdLength);
+		__m128 invLength = _mm_div_ps(_mm_set1_ps(1.0f), length);
+
+		__m128 mask = _mm_cmpgt_ps(length, _mm_set1_ps(1e-08f));
+		invLength = _mm_or_ps(_mm_and_ps(mask, invLength), _mm_andnot_ps(mask, _mm_set1_ps(1.0f)));
+
+		return { _mm_mul_ps(v.x, invLength), _mm_mul_ps(v.y, invLength), _mm_mul_ps(v.z, invLength) };
+	}
+#endif
+
+	/** Calculates normals of the faces in range [@p start, @p end). */
+	void calculateFaceNormalRange(const Vector3* vertices, const UINT32* indices, Vector3* faceNormals, UINT32 start,
+		UINT32 end)
+	{
+		UINT32 i = start;
+
+#if BS_MESH_UTILITY_SSE
+		for (; i + 4 <= end; i += 4)
 		{
-			UINT32 triangle[3];
-			memcpy(&triangle[0], indices + (i * 3 + 0) * indexSize, indexSize);
-			memcpy(&triangle[1], indices + (i * 3 + 1) * indexSize, indexSize);
-			memcpy(&triangle[2], indices + (i * 3 + 2) * indexSize, indexSize);
+			const UINT32* triangles = &indices[i * 3];
+
+			Vector3x4 p0 = loadVector3x4(vertices, triangles + 0, 3);
+			Vector3x4 p1 = loadVector3x4(vertices, triangles + 1, 3);
+			Vector3x4 p2 = loadVector3x4(vertices, triangles + 2, 3);
+
+			Vector3x4 edgeA = subVector3x4(p1, p0);
+			Vector3x4 edgeB = subVector3x4(p2, p0);
+
+			storeVector3x4(normalizeVector3x4(crossVector3x4(edgeA, edgeB)), &faceNormals[i]);
+		}
+#endif
+
+		for (; i < end; i++)
+		{
+			const UINT32* triangle = &indices[i * 3];
 
 			Vector3 edgeA = vertices[triangle[1]] - vertices[triangle[0]];
 			Vector3 edgeB = vertices[triangle[2]] - vertices[triangle[0]];
@@ -744,37 +822,85 @@ namespace BansheeEngine
 			// Note: Potentially don't normalize here in order to weigh the normals
 			// by triangle size
 		}
+	}
 
-		VertexConnectivity connectivity(indices, numVertices, numFaces, indexSize);
-		for (UINT32 i = 0; i < numVertices; i++)
+	/** 
+	 * Calculates tangents and bitangents of the faces in range [@p start, @p end). Faces with degenerate UV coordinates
+	 * are assigned zero vectors, so they don't contribute to vertex tangents.
+	 */
+	void calculateFaceTangentRange(const Vector3* vertices, const Vector2* uv, const UINT32* indices, 
+		Vector3* faceTangents, Vector3* faceBitangents, UINT32 start, UINT32 end)
+	{
+		static const float MIN_UV_AREA = 1e-8f;
+		UINT32 i = start;
+
+#if BS_MESH_UTILITY_SSE
+		for (; i + 4 <= end; i += 4)
 		{
-			VertexFaces& faces = connectivity.vertexFaces[i];
+			const UINT32* triangles = &indices[i * 3];
 
-			for (UINT32 j = 0; j < faces.numFaces; j++)
+			Vector3x4 p0 = loadVector3x4(vertices, triangles + 0, 3);
+			Vector3x4 q0 = subVector3x4(loadVector3x4(vertices, triangles + 1, 3), p0);
+			Vector3x4 q1 = subVector3x4(loadVector3x4(vertices, triangles + 2, 3), p0);
+
+			float uvs[3][2][4];
+			for (UINT32 j = 0; j < 4; j++)
 			{
-				UINT32 faceIdx = faces.faces[j];
-				normals[i] += faceNormals[faceIdx];
+				for (UINT32 k = 0; k < 3; k++)
+				{
+					const Vector2& value = uv[triangles[j * 3 + k]];
+					uvs[k][0][j] = value.x;
+					uvs[k][1][j] = value.y;
+				}
 			}
 
-			normals[i].normalize();
-		}
+			__m128 u0 = _mm_loadu_ps(uvs[0][0]);
+			__m128 v0 = _mm_loadu_ps(uvs[0][1]);
 
-		bs_deleteN(faceNormals, numFaces);
-	}
+			__m128 sx = _mm_sub_ps(_mm_loadu_ps(uvs[1][0]), u0);
+			__m128 sy = _mm_sub_ps(_mm_loadu_ps(uvs[2][0]), u0);
+			__m128 tx = _mm_sub_ps(_mm_loadu_ps(uvs[1][1]), v0);
+			__m128 ty = _mm_sub_ps(_mm_loadu_ps(uvs[2][1]), v0);
 
-	void MeshUtility::calculateTangents(Vector3* vertices, Vector3* normals, Vector2* uv, UINT8* indices, UINT32 numVertices,
-		UINT32 numIndices, Vector3* tangents, Vector3* bitangents, UINT32 indexSize)
-	{
-		UINT32 numFaces = numIndices / 3;
+			__m128 denom = _mm_sub_ps(_mm_mul_ps(sx, ty), _mm_mul_ps(sy, tx));
+			__m128 absDenom = _mm_andnot_ps(_mm_set1_ps(-0.0f), denom);
+			__m128 mask = _mm_cmpge_ps(absDenom, _mm_set1_ps(MIN_UV_AREA));
+
+			// Degenerate faces divide by one instead, and have their results masked out below
+			__m128 r = _mm_div_ps(_mm_set1_ps(1.0f), _mm_or_ps(_mm_and_ps(mask, denom), 
+				_mm_andnot_ps(mask, _mm_set1_ps(1.0f))));
+
+			sx = _mm_mul_ps(sx, r);
+			sy = _mm_mul_ps(sy, r);
+			tx = _mm_mul_ps(tx, r);
+			ty = _mm_mul_ps(ty, r);
+
+			Vector3x4 tangent = {
+				_mm_sub_ps(_mm_mul_ps(ty, q0.x), _mm_mul_ps(tx, q1.x)),
+				_mm_sub_ps(_mm_mul_ps(ty, q0.y), _mm_mul_ps(tx, q1.y)),
+				_mm_sub_ps(_mm_mul_ps(ty, q0.z), _mm_mul_ps(tx, q1.z))
+			};
+
+			Vector3x4 bitangent = {
+				_mm_sub_ps(_mm_mul_ps(sx, q0.x), _mm_mul_ps(sy, q1.x)),
+				_mm_sub_ps(_mm_mul_ps(sx, q0.y), _mm_mul_ps(sy, q1.y)),
+				_mm_sub_ps(_mm_mul_ps(sx, q0.z), _mm_mul_ps(sy, q1.z))
+			};
+
+			tangent = normalizeVector3x4(tangent);
+			bitangent = normalizeVector3x4(bitangent);
 
-		Vector3* faceTangents = bs_newN<Vector3>(numFaces);
-		Vector3* faceBitangents = bs_newN<Vector3>(numFaces);
-		for (UINT32 i = 0; i < numFaces; i++)
+			tangent = { _mm_and_ps(mask, tangent.x), _mm_and_ps(mask, tangent.y), _mm_and_ps(mask, tangent.z) };
+			bitangent = { _mm_and_ps(mask, bitangent.x), _mm_and_ps(mask, bitangent.y), _mm_and_ps(mask, bitangent.z) };
+
+			storeVector3x4(tangent, &faceTangents[i]);
+			storeVector3x4(bitangent, &faceBitangents[i]);
+		}
+#endif
+
+		for (; i < end; i++)
 		{
-			UINT32 triangle[3];
-			memcpy(&triangle[0], indices + (i * 3 + 0) * indexSize, indexSize);
-			memcpy(&triangle[1], indices + (i * 3 + 1) * indexSize, indexSize);
-			memcpy(&triangle[2], indices + (i * 3 + 2) * indexSize, indexSize);
+			const UINT32* triangle = &indices[i * 3];
 
 			Vector3 p0 = vertices[triangle[0]];
 			Vector3 p1 = vertices[triangle[1]];
@@ -796,7 +922,7 @@ namespace BansheeEngine
 			t.y = uv2.y - uv0.y;
 
 			float denom = s.x*t.y - s.y * t.x;
-			if (fabs(denom) >= 0e-8f)
+			if (fabs(denom) >= MIN_UV_AREA)
 			{
 				float r = 1.0f / denom;
 				s *= r;
@@ -808,39 +934,100 @@ namespace BansheeEngine
 				faceTangents[i].normalize();
 				faceBitangents[i].normalize();
 			}
+			else
+			{
+				faceTangents[i] = Vector3::ZERO;
+				faceBitangents[i] = Vector3::ZERO;
+			}
 
 			// Note: Potentially don't normalize here in order to weigh the normals
 			// by triangle size
 		}
+	}
 
-		VertexConnectivity connectivity(indices, numVertices, numFaces, indexSize);
-		for (UINT32 i = 0; i < numVertices; i++)
+	void MeshUtility::calculateNormals(Vector3* vertices, UINT8* indices, UINT32 numVertices,
+		UINT32 numIndices, Vector3* normals, UINT32 indexSize)
+	{
+		UINT32 numFaces = numIndices / 3;
+
+		Vector<UINT32> indices32;
+		readIndices(indices, numFaces * 3, indexSize, indices32);
+
+		// Faces and vertices are both processed in parallel chunks. Each task only writes to its own range of the output,
+		// and vertices gather the normals of their faces instead of faces scattering them, so no synchronization is
+		// needed and the results don't depend on the number of tasks.
+		Vector<Vector3> faceNormals(numFaces);
+		TaskScheduler::processRangeInParallel("CalculateFaceNormals", numFaces, MIN_FACES_PER_TASK, 
+			[&](UINT32 start, UINT32 end)
 		{
-			VertexFaces& faces = connectivity.vertexFaces[i];
+			calculateFaceNormalRange(vertices, indices32.data(), faceNormals.data(), start, end);
+		});
 
-			for (UINT32 j = 0; j < faces.numFaces; j++)
+		VertexConnectivity connectivity(indices32.data(), numVertices, numFaces);
+		TaskScheduler::processRangeInParallel("CalculateVertexNormals", numVertices, MIN_VERTICES_PER_TASK, 
+			[&](UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
 			{
-				UINT32 faceIdx = faces.faces[j];
-				tangents[i] += faceTangents[faceIdx];
-				bitangents[i] += faceBitangents[faceIdx];
+				Vector3 normal = Vector3::ZERO;
+				for (UINT32 j = connectivity.faceOffsets[i]; j < connectivity.faceOffsets[i + 1]; j++)
+					normal += faceNormals[connectivity.faces[j]];
+
+				normal.normalize();
+				normals[i] = normal;
 			}
+		});
+	}
+
+	void MeshUtility::calculateTangents(Vector3* vertices, Vector3* normals, Vector2* uv, UINT8* indices, UINT32 numVertices,
+		UINT32 numIndices, Vector3* tangents, Vector3* bitangents, UINT32 indexSize)
+	{
+		UINT32 numFaces = numIndices / 3;
 
-			tangents[i].normalize();
-			bitangents[i].normalize();
+		Vector<UINT32> indices32;
+		readIndices(indices, numFaces * 3, indexSize, indices32);
 
-			// Orthonormalize
-			float dot0 = normals[i].dot(tangents[i]);
-			tangents[i] -= dot0*normals[i];
-			tangents[i].normalize();
+		Vector<Vector3> faceTangents(numFaces);
+		Vector<Vector3> faceBitangents(numFaces);
+		TaskScheduler::processRangeInParallel("CalculateFaceTangents", numFaces, MIN_FACES_PER_TASK, 
+			[&](UINT32 start, UINT32 end)
+		{
+			calculateFaceTangentRange(vertices, uv, indices32.data(), faceTangents.data(), faceBitangents.data(), 
+				start, end);
+		});
 
-			float dot1 = tangents[i].dot(bitangents[i]);
-			dot0 = normals[i].dot(bitangents[i]);
-			bitangents[i] -= dot0*normals[i] + dot1*tangents[i];
-			bitangents[i].normalize();
-		}
+		VertexConnectivity connectivity(indices32.data(), numVertices, numFaces);
+		TaskScheduler::processRangeInParallel("CalculateVertexTangents", numVertices, MIN_VERTICES_PER_TASK, 
+			[&](UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
+			{
+				Vector3 tangent = Vector3::ZERO;
+				Vector3 bitangent = Vector3::ZERO;
+				for (UINT32 j = connectivity.faceOffsets[i]; j < connectivity.faceOffsets[i + 1]; j++)
+				{
+					UINT32 faceIdx = connectivity.faces[j];
+					tangent += faceTangents[faceIdx];
+					bitangent += faceBitangents[faceIdx];
+				}
 
-		bs_deleteN(faceTangents, numFaces);
-		bs_deleteN(faceBitangents, numFaces);
+				tangent.normalize();
+				bitangent.normalize();
+
+				// Orthonormalize
+				float dot0 = normals[i].dot(tangent);
+				tangent -= dot0*normals[i];
+				tangent.normalize();
+
+				float dot1 = tangent.dot(bitangent);
+				dot0 = normals[i].dot(bitangent);
+				bitangent -= dot0*normals[i] + dot1*tangent;
+				bitangent.normalize();
+
+				tangents[i] = tangent;
+				bitangents[i] = bitangent;
+			}
+		});
 
 		// TODO - Consider weighing tangents by triangle size and/or edge angles
 	}
@@ -866,10 +1053,46 @@ namespace BansheeEngine
 		clipper.clip(vertices, uvs, numTris, vertexStride, clipPlanes, writeCallback);
 	}
 
+#if BS_MESH_UTILITY_SSE
+	/** 
+	 * Converts the normal into integer values in range [0, 255] (in the first three lanes), using the same rounding as
+	 * the scalar packing code.
+	 */
+	__m128i packNormalSSE(const Vector3& normal)
+	{
+		const __m128 scale = _mm_set1_ps(127.5f);
+
+		__m128 value = _mm_setr_ps(normal.x, normal.y, normal.z, 0.0f);
+		return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value, scale), scale));
+	}
+#endif
+
 	void MeshUtility::packNormals(Vector3* source, UINT8* destination, UINT32 count, UINT32 stride)
 	{
 		UINT8* ptr = destination;
-		for (UINT32 i = 0; i < count; i++)
+		UINT32 i = 0;
+
+#if BS_MESH_UTILITY_SSE
+		// Pack four normals at once, saturating packs perform the clamp to [0, 255]
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i low = _mm_packs_epi32(packNormalSSE(source[i + 0]), packNormalSSE(source[i + 1]));
+			__m128i high = _mm_packs_epi32(packNormalSSE(source[i + 2]), packNormalSSE(source[i + 3]));
+
+			UINT32 packed[4];
+			_mm_storeu_si128((__m128i*)packed, _mm_packus_epi16(low, high));
+
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				memcpy(ptr, &packed[j], sizeof(UINT32));
+				((PackedNormal*)ptr)->w = 128;
+
+				ptr += stride;
+			}
+		}
+#endif
+
+		for (; i < count; i++)
 		{
 			PackedNormal& packed = *(PackedNormal*)ptr;
 			packed.x = Math::clamp((int)(source[i].x * 127.5f + 127.5f), 0, 255);
@@ -926,4 +1149,1527 @@ namespace BansheeEngine
 			ptr += stride;
 		}
 	}
+
+	/** 
+	 * Returns the type of the vertex element with the provided semantic, in the first stream. Returns VET_UNKNOWN if there
+	 * is no such element.
+	 */
+	VertexElementType getElementType(const VertexDataDesc& vertexDesc, VertexElementSemantic semantic)
+	{
+		for (UINT32 i = 0; i < vertexDesc.getNumElements(); i++)
+		{
+			const VertexElement& element = vertexDesc.getElement(i);
+			if (element.getSemantic() == semantic && element.getSemanticIdx() == 0 && element.getStreamIdx() == 0)
+				return element.getType();
+		}
+
+		return VET_UNKNOWN;
+	}
+
+	/** Vertex data used for skinning a range of vertices. */
+	struct SkinningData
+	{
+		UINT8* positions;
+		UINT8* normals;
+		UINT8* blendIndices;
+		UINT8* blendWeights;
+		UINT32 stride;
+		bool packedNormals;
+
+		const Matrix4* bones;
+		UINT32 numBones;
+
+		Vector3* outPositions;
+		Vector3* outNormals;
+	};
+
+	/** Skins vertices in range [@p start, @p end). */
+	void skinVertexRange(const SkinningData& data, UINT32 start, UINT32 end)
+	{
+		for (UINT32 i = start; i < end; i++)
+		{
+			UINT32 offset = i * data.stride;
+			const UINT8* indices = data.blendIndices + offset;
+			const float* weights = (const float*)(data.blendWeights + offset);
+
+			// Blend the top three rows of the bone transforms, as they are expected to be affine
+			float blended[12];
+			float totalWeight = 0.0f;
+
+#if BS_MESH_UTILITY_SSE
+			__m128 row0 = _mm_setzero_ps();
+			__m128 row1 = _mm_setzero_ps();
+			__m128 row2 = _mm_setzero_ps();
+
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				if (weights[j] == 0.0f || indices[j] >= data.numBones)
+					continue;
+
+				const float* bone = data.bones[indices[j]][0];
+				__m128 weight = _mm_set1_ps(weights[j]);
+
+				row0 = _mm_add_ps(row0, _mm_mul_ps(weight, _mm_loadu_ps(bone + 0)));
+				row1 = _mm_add_ps(row1, _mm_mul_ps(weight, _mm_loadu_ps(bone + 4)));
+				row2 = _mm_add_ps(row2, _mm_mul_ps(weight, _mm_loadu_ps(bone + 8)));
+
+				totalWeight += weights[j];
+			}
+
+			_mm_storeu_ps(blended + 0, row0);
+			_mm_storeu_ps(blended + 4, row1);
+			_mm_storeu_ps(blended + 8, row2);
+#else
+			memset(blended, 0, sizeof(blended));
+
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				if (weights[j] == 0.0f || indices[j] >= data.numBones)
+					continue;
+
+				const float* bone = data.bones[indices[j]][0];
+				for (UINT32 k = 0; k < 12; k++)
+					blended[k] += weights[j] * bone[k];
+
+				totalWeight += weights[j];
+			}
+#endif
+
+			Vector3 position = *(const Vector3*)(data.positions + offset);
+
+			// Vertices not influenced by any bone are left as is
+			if (totalWeight == 0.0f)
+			{
+				data.outPositions[i] = position;
+
+				if (data.outNormals == nullptr)
+					continue;
+			}
+			else
+			{
+				data.outPositions[i] = Vector3(
+					blended[0] * position.x + blended[1] * position.y + blended[2] * position.z + blended[3],
+					blended[4] * position.x + blended[5] * position.y + blended[6] * position.z + blended[7],
+					blended[8] * position.x + blended[9] * position.y + blended[10] * position.z + blended[11]);
+			}
+
+			if (data.outNormals != nullptr)
+			{
+				Vector3 normal;
+				if (data.packedNormals)
+					MeshUtility::unpackNormals(data.normals + offset, &normal, 1, data.stride);
+				else
+					normal = *(const Vector3*)(data.normals + offset);
+
+				if (totalWeight != 0.0f)
+				{
+					normal = Vector3(
+						blended[0] * normal.x + blended[1] * normal.y + blended[2] * normal.z,
+						blended[4] * normal.x + blended[5] * normal.y + blended[6] * normal.z,
+						blended[8] * normal.x + blended[9] * normal.y + blended[10] * normal.z);
+				}
+
+				data.outNormals[i] = Vector3::normalize(normal);
+			}
+		}
+	}
+
+	void MeshUtility::skinVertices(const MeshData& meshData, const Matrix4* bones, UINT32 numBones, 
+		Vector3* positions, Vector3* normals)
+	{
+		SPtr<VertexDataDesc> vertexDesc = meshData.getVertexDesc();
+
+		if (!vertexDesc->hasElement(VES_POSITION) || !vertexDesc->hasElement(VES_BLEND_INDICES) || 
+			!vertexDesc->hasElement(VES_BLEND_WEIGHTS))
+		{
+			LOGWRN("Cannot skin vertices. Mesh data is missing positions, blend indices or blend weights.");
+			return;
+		}
+
+		// Positions compressed by compressVertices() would need to be decoded first, see readPositions()
+		VertexElementType positionType = getElementType(*vertexDesc, VES_POSITION);
+		if (positionType != VET_FLOAT3 && positionType != VET_FLOAT4)
+		{
+			LOGWRN("Cannot skin vertices. Positions must be stored as 3D or 4D floats.");
+			return;
+		}
+
+		SkinningData data;
+		data.positions = meshData.getElementData(VES_POSITION);
+		data.blendIndices = meshData.getElementData(VES_BLEND_INDICES);
+		data.blendWeights = meshData.getElementData(VES_BLEND_WEIGHTS);
+		data.stride = vertexDesc->getVertexStride(0);
+		data.bones = bones;
+		data.numBones = numBones;
+		data.outPositions = positions;
+		data.outNormals = nullptr;
+		data.normals = nullptr;
+		data.packedNormals = false;
+
+		if (normals != nullptr)
+		{
+			VertexElementType normalType = getElementType(*vertexDesc, VES_NORMAL);
+
+			// Octahedral encoded normals have the same size as packed ones, so check the type rather than the size
+			if (normalType == VET_FLOAT3 || normalType == VET_UBYTE4_NORM)
+			{
+				data.normals = meshData.getElementData(VES_NORMAL);
+				data.packedNormals = normalType == VET_UBYTE4_NORM;
+				data.outNormals = normals;
+			}
+			else
+				LOGWRN("Cannot skin normals. Mesh data has no normals, or they are in an unsupported format.");
+		}
+
+		// Each task writes to its own range of output vertices so no synchronization is needed
+		TaskScheduler::processRangeInParallel("SkinVertices", meshData.getNumVertices(), MIN_VERTICES_PER_TASK,
+			[&data](UINT32 start, UINT32 end) { skinVertexRange(data, start, end); });
+	}
+
+	/** Size of the FIFO post-transform vertex cache simulated when measuring cache efficiency and forming clusters. */
+	static const UINT32 FIFO_CACHE_SIZE = 16;
+
+	/** Size of the LRU vertex cache assumed by the vertex cache optimization scoring function. */
+	static const UINT32 LRU_CACHE_SIZE = 32;
+
+	/** 
+	 * Simulates a FIFO post-transform vertex cache and returns the number of cache misses (transformed vertices) for
+	 * the provided triangle list.
+	 */
+	UINT32 countCacheMisses(const UINT32* indices, UINT32 numIndices, UINT32 numVertices)
+	{
+		// Stores the time at which each vertex entered the cache, a vertex is in cache if less than cache size vertices
+		// entered the cache after it
+		Vector<UINT32> timestamps(numVertices, 0);
+		UINT32 time = FIFO_CACHE_SIZE + 1;
+
+		UINT32 numMisses = 0;
+		for (UINT32 i = 0; i < numIndices; i++)
+		{
+			UINT32 vertexIdx = indices[i];
+			if ((time - timestamps[vertexIdx]) > FIFO_CACHE_SIZE)
+			{
+				timestamps[vertexIdx] = time++;
+				numMisses++;
+			}
+		}
+
+		return numMisses;
+	}
+
+	/**
+	 * Calculates a score of a vertex for the purposes of vertex cache optimization. Vertices recently used are favored,
+	 * as well as vertices with only a few remaining triangles, so they get removed from the working set quickly.
+	 *
+	 * @see	Tom Forsyth - Linear-Speed Vertex Cache Optimisation
+	 */
+	float getVertexCacheScore(INT32 cachePosition, UINT32 numActiveTriangles)
+	{
+		if (numActiveTriangles == 0)
+			return -1.0f;
+
+		float score = 0.0f;
+		if (cachePosition >= 0)
+		{
+			// Vertices of the last emitted triangle get a fixed score, so the next triangle isn't chosen purely based on
+			// sharing an edge with it
+			if (cachePosition < 3)
+				score = 0.75f;
+			else
+			{
+				const float scale = 1.0f / (LRU_CACHE_SIZE - 3);
+				score = std::pow(1.0f - (cachePosition - 3) * scale, 1.5f);
+			}
+		}
+
+		score += 2.0f * std::pow((float)numActiveTriangles, -0.5f);
+		return score;
+	}
+
+	/** Reorders triangles in the provided triangle list so that recently transformed vertices get reused. */
+	void optimizeVertexCache(UINT32* indices, UINT32 numIndices, UINT32 numVertices)
+	{
+		UINT32 numTriangles = numIndices / 3;
+		if (numTriangles == 0)
+			return;
+
+		// Build a list of triangles using each vertex
+		Vector<UINT32> adjacencyOffsets(numVertices + 1, 0);
+		for (UINT32 i = 0; i < numTriangles * 3; i++)
+			adjacencyOffsets[indices[i] + 1]++;
+
+		for (UINT32 i = 0; i < numVertices; i++)
+			adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+
+		Vector<UINT32> numActiveTriangles(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+			numActiveTriangles[i] = adjacencyOffsets[i + 1] - adjacencyOffsets[i];
+
+		Vector<UINT32> adjacency(numTriangles * 3);
+		Vector<UINT32> writeOffsets(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+		for (UINT32 i = 0; i < numTriangles * 3; i++)
+			adjacency[writeOffsets[indices[i]]++] = i / 3;
+
+		// Calculate initial scores
+		Vector<INT32> cachePositions(numVertices, -1);
+		Vector<float> vertexScores(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+			vertexScores[i] = getVertexCacheScore(-1, numActiveTriangles[i]);
+
+		Vector<float> triangleScores(numTriangles);
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			triangleScores[i] = vertexScores[indices[i * 3 + 0]] + vertexScores[indices[i * 3 + 1]] + 
+				vertexScores[indices[i * 3 + 2]];
+		}
+
+		Vector<bool> isEmitted(numTriangles, false);
+		Vector<UINT32> output;
+		output.reserve(numTriangles * 3);
+
+		UINT32 cache[LRU_CACHE_SIZE + 3];
+		UINT32 cacheSize = 0;
+
+		UINT32 nextCandidate = 0;
+		INT32 bestTriangle = -1;
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			// No triangles connected to the cache remain, continue with the next unprocessed one
+			if (bestTriangle < 0)
+			{
+				while (isEmitted[nextCandidate])
+					nextCandidate++;
+
+				bestTriangle = (INT32)nextCandidate;
+			}
+
+			isEmitted[bestTriangle] = true;
+
+			UINT32 newCache[LRU_CACHE_SIZE + 3];
+			UINT32 newCacheSize = 0;
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				UINT32 vertexIdx = indices[bestTriangle * 3 + j];
+				output.push_back(vertexIdx);
+
+				// Remove the triangle from the vertex's list of active triangles
+				UINT32* triangles = &adjacency[adjacencyOffsets[vertexIdx]];
+				UINT32 numVertexTriangles = numActiveTriangles[vertexIdx];
+				for (UINT32 k = 0; k < numVertexTriangles; k++)
+				{
+					if (triangles[k] == (UINT32)bestTriangle)
+					{
+						std::swap(triangles[k], triangles[numVertexTriangles - 1]);
+						break;
+					}
+				}
+
+				numActiveTriangles[vertexIdx]--;
+
+				bool isInCache = false;
+				for (UINT32 k = 0; k < newCacheSize; k++)
+					isInCache |= newCache[k] == vertexIdx;
+
+				if (!isInCache)
+					newCache[newCacheSize++] = vertexIdx;
+			}
+
+			// Vertices of the emitted triangle move to the front of the cache, followed by the previous cache contents
+			for (UINT32 j = 0; j < cacheSize; j++)
+			{
+				UINT32 vertexIdx = cache[j];
+
+				bool isInCache = false;
+				for (UINT32 k = 0; k < 3; k++)
+					isInCache |= indices[bestTriangle * 3 + k] == vertexIdx;
+
+				if (!isInCache)
+					newCache[newCacheSize++] = vertexIdx;
+			}
+
+			cacheSize = std::min(newCacheSize, LRU_CACHE_SIZE);
+			memcpy(cache, newCache, cacheSize * sizeof(UINT32));
+
+			// Update scores of all vertices whose cache position changed, including those pushed out of the cache
+			for (UINT32 j = 0; j < newCacheSize; j++)
+			{
+				UINT32 vertexIdx = newCache[j];
+				cachePositions[vertexIdx] = j < cacheSize ? (INT32)j : -1;
+
+				float score = getVertexCacheScore(cachePositions[vertexIdx], numActiveTriangles[vertexIdx]);
+				float scoreDelta = score - vertexScores[vertexIdx];
+				vertexScores[vertexIdx] = score;
+
+				UINT32* triangles = &adjacency[adjacencyOffsets[vertexIdx]];
+				for (UINT32 k = 0; k < numActiveTriangles[vertexIdx]; k++)
+					triangleScores[triangles[k]] += scoreDelta;
+			}
+
+			// Pick the next triangle from the ones connected to vertices in the cache
+			bestTriangle = -1;
+			float bestScore = -1.0f;
+			for (UINT32 j = 0; j < cacheSize; j++)
+			{
+				UINT32 vertexIdx = cache[j];
+
+				UINT32* triangles = &adjacency[adjacencyOffsets[vertexIdx]];
+				for (UINT32 k = 0; k < numActiveTriangles[vertexIdx]; k++)
+				{
+					UINT32 triangleIdx = triangles[k];
+					if (triangleScores[triangleIdx] > bestScore)
+					{
+						bestScore = triangleScores[triangleIdx];
+						bestTriangle = (INT32)triangleIdx;
+					}
+				}
+			}
+		}
+
+		memcpy(indices, output.data(), output.size() * sizeof(UINT32));
+	}
+
+	/**
+	 * Splits the triangle list into clusters and reorders them so that clusters facing away from the mesh center are
+	 * drawn first, as they are more likely to occlude the rest of the mesh. Clusters are split only at triangles that
+	 * don't share any vertices with the simulated vertex cache, so the vertex cache efficiency of an already cache
+	 * optimized list remains mostly unchanged.
+	 *
+	 * @see	Sander, Nehab, Barczak - Fast Triangle Reordering for Vertex Locality and Reduced Overdraw
+	 */
+	void optimizeOverdraw(UINT32* indices, UINT32 numIndices, const UINT8* positions, UINT32 stride, 
+		const Vector<UINT32>& sourceVertices)
+	{
+		UINT32 numTriangles = numIndices / 3;
+		UINT32 numVertices = (UINT32)sourceVertices.size();
+
+		Vector<UINT32> clusterStarts;
+		Vector<UINT32> timestamps(numVertices, 0);
+		UINT32 time = FIFO_CACHE_SIZE + 1;
+
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			UINT32 numMisses = 0;
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				UINT32 vertexIdx = indices[i * 3 + j];
+				if ((time - timestamps[vertexIdx]) > FIFO_CACHE_SIZE)
+				{
+					timestamps[vertexIdx] = time++;
+					numMisses++;
+				}
+			}
+
+			if (i == 0 || numMisses == 3)
+				clusterStarts.push_back(i);
+		}
+
+		UINT32 numClusters = (UINT32)clusterStarts.size();
+		if (numClusters <= 1)
+			return;
+
+		clusterStarts.push_back(numTriangles);
+
+		auto getPosition = [&](UINT32 vertexIdx)
+		{
+			Vector3 output;
+			memcpy(&output, positions + sourceVertices[vertexIdx] * stride, sizeof(Vector3));
+
+			return output;
+		};
+
+		// Calculate area weighted centroids and normals of the clusters and the entire mesh
+		Vector<Vector3> clusterCentroids(numClusters, Vector3::ZERO);
+		Vector<Vector3> clusterNormals(numClusters, Vector3::ZERO);
+		Vector3 meshCentroid = Vector3::ZERO;
+		float meshArea = 0.0f;
+
+		for (UINT32 i = 0; i < numClusters; i++)
+		{
+			float clusterArea = 0.0f;
+			for (UINT32 j = clusterStarts[i]; j < clusterStarts[i + 1]; j++)
+			{
+				Vector3 a = getPosition(indices[j * 3 + 0]);
+				Vector3 b = getPosition(indices[j * 3 + 1]);
+				Vector3 c = getPosition(indices[j * 3 + 2]);
+
+				Vector3 normal = Vector3::cross(b - a, c - a);
+				float area = normal.length();
+
+				clusterCentroids[i] += (a + b + c) * (area / 3.0f);
+				clusterNormals[i] += normal;
+				clusterArea += area;
+			}
+
+			meshCentroid += clusterCentroids[i];
+			meshArea += clusterArea;
+
+			if (clusterArea > 0.0f)
+				clusterCentroids[i] /= clusterArea;
+		}
+
+		if (meshArea > 0.0f)
+			meshCentroid /= meshArea;
+
+		Vector<float> sortKeys(numClusters);
+		for (UINT32 i = 0; i < numClusters; i++)
+		{
+			Vector3 normal = Vector3::normalize(clusterNormals[i]);
+			sortKeys[i] = normal.dot(clusterCentroids[i] - meshCentroid);
+		}
+
+		Vector<UINT32> clusterOrder(numClusters);
+		for (UINT32 i = 0; i < numClusters; i++)
+			clusterOrder[i] = i;
+
+		std::stable_sort(clusterOrder.begin(), clusterOrder.end(), 
+			[&](UINT32 lhs, UINT32 rhs) { return sortKeys[lhs] > sortKeys[rhs]; });
+
+		Vector<UINT32> output;
+		output.reserve(numTriangles * 3);
+
+		for (auto& clusterIdx : clusterOrder)
+		{
+			UINT32 start = clusterStarts[clusterIdx] * 3;
+			UINT32 end = clusterStarts[clusterIdx + 1] * 3;
+
+			output.insert(output.end(), indices + start, indices + end);
+		}
+
+		memcpy(indices, output.data(), output.size() * sizeof(UINT32));
+	}
+
+	SPtr<MeshData> MeshUtility::optimize(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes, 
+		MeshOptimizeFlags flags, Vector<UINT32>& vertexRemap, MeshOptimizeStats& stats)
+	{
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numIndices = meshData->getNumIndices();
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+
+		Vector<UINT32> indices(numIndices);
+		if (meshData->getIndexType() == IT_16BIT)
+		{
+			UINT16* srcIndices = meshData->getIndices16();
+			for (UINT32 i = 0; i < numIndices; i++)
+				indices[i] = srcIndices[i];
+		}
+		else
+			memcpy(indices.data(), meshData->getIndices32(), numIndices * sizeof(UINT32));
+
+		// Only triangle lists are reordered
+		Vector<SubMesh> triangleLists;
+		if (subMeshes.empty())
+			triangleLists.push_back(SubMesh(0, numIndices, DOT_TRIANGLE_LIST));
+		else
+		{
+			for (auto& subMesh : subMeshes)
+			{
+				if (subMesh.drawOp == DOT_TRIANGLE_LIST && (subMesh.indexOffset + subMesh.indexCount) <= numIndices)
+					triangleLists.push_back(subMesh);
+			}
+		}
+
+		auto calculateACMR = [&](UINT32 numUsedVertices)
+		{
+			UINT32 numMisses = 0;
+			UINT32 numTriangles = 0;
+			for (auto& subMesh : triangleLists)
+			{
+				numMisses += countCacheMisses(indices.data() + subMesh.indexOffset, subMesh.indexCount, numUsedVertices);
+				numTriangles += subMesh.indexCount / 3;
+			}
+
+			return numTriangles > 0 ? numMisses / (float)numTriangles : 0.0f;
+		};
+
+		stats.numVerticesBefore = numVertices;
+		stats.acmrBefore = calculateACMR(numVertices);
+
+		// Maps each vertex in the working set to the original vertex whose data it uses
+		Vector<UINT32> sourceVertices(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+			sourceVertices[i] = i;
+
+		vertexRemap.resize(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+			vertexRemap[i] = i;
+
+		UINT32 numElements = vertexDesc->getNumElements();
+		auto getElementStride = [&](const VertexElement& element)
+		{
+			return vertexDesc->getVertexStride(element.getStreamIdx());
+		};
+
+		auto getElementData = [&](const VertexElement& element)
+		{
+			return meshData->getElementData(element.getSemantic(), element.getSemanticIdx(), element.getStreamIdx());
+		};
+
+		if (flags.isSet(MeshOptimizeFlag::WeldVertices))
+		{
+			// Compare all vertex elements, using a hash table to find candidate duplicates
+			auto hashVertex = [&](UINT32 vertexIdx)
+			{
+				size_t hash = 0;
+				for (UINT32 i = 0; i < numElements; i++)
+				{
+					const VertexElement& element = vertexDesc->getElement(i);
+					const UINT8* data = getElementData(element) + vertexIdx * getElementStride(element);
+
+					for (UINT32 j = 0; j < element.getSize(); j++)
+						hash_combine(hash, data[j]);
+				}
+
+				return hash;
+			};
+
+			auto isVertexEqual = [&](UINT32 lhs, UINT32 rhs)
+			{
+				for (UINT32 i = 0; i < numElements; i++)
+				{
+					const VertexElement& element = vertexDesc->getElement(i);
+					const UINT8* data = getElementData(element);
+					UINT32 stride = getElementStride(element);
+
+					if (memcmp(data + lhs * stride, data + rhs * stride, element.getSize()) != 0)
+						return false;
+				}
+
+				return true;
+			};
+
+			UINT32 tableSize = Bitwise::firstPO2From(std::max(numVertices * 2, 1U));
+			Vector<UINT32> table(tableSize, (UINT32)-1);
+
+			UINT32 numUniqueVertices = 0;
+			for (UINT32 i = 0; i < numVertices; i++)
+			{
+				UINT32 slot = (UINT32)hashVertex(i) & (tableSize - 1);
+				while (table[slot] != (UINT32)-1 && !isVertexEqual(table[slot], i))
+					slot = (slot + 1) & (tableSize - 1);
+
+				if (table[slot] == (UINT32)-1)
+				{
+					table[slot] = i;
+					sourceVertices[numUniqueVertices] = i;
+					vertexRemap[i] = numUniqueVertices++;
+				}
+				else
+					vertexRemap[i] = vertexRemap[table[slot]];
+			}
+
+			sourceVertices.resize(numUniqueVertices);
+			for (auto& index : indices)
+				index = vertexRemap[index];
+		}
+
+		UINT32 numOutputVertices = (UINT32)sourceVertices.size();
+
+		if (flags.isSet(MeshOptimizeFlag::VertexCache))
+		{
+			for (auto& subMesh : triangleLists)
+				optimizeVertexCache(indices.data() + subMesh.indexOffset, subMesh.indexCount, numOutputVertices);
+		}
+
+		if (flags.isSet(MeshOptimizeFlag::Overdraw))
+		{
+			if (vertexDesc->hasElement(VES_POSITION) && vertexDesc->getElementSize(VES_POSITION) == sizeof(Vector3))
+			{
+				UINT8* positions = meshData->getElementData(VES_POSITION);
+				UINT32 stride = vertexDesc->getVertexStride(0);
+
+				for (auto& subMesh : triangleLists)
+				{
+					optimizeOverdraw(indices.data() + subMesh.indexOffset, subMesh.indexCount, positions, stride, 
+						sourceVertices);
+				}
+			}
+		}
+
+		if (flags.isSet(MeshOptimizeFlag::VertexFetch))
+		{
+			// Assign new vertex indices in the order the vertices are first referenced, unreferenced vertices go last
+			Vector<UINT32> fetchRemap(numOutputVertices, (UINT32)-1);
+			UINT32 nextVertexIdx = 0;
+			for (auto& index : indices)
+			{
+				if (fetchRemap[index] == (UINT32)-1)
+					fetchRemap[index] = nextVertexIdx++;
+
+				index = fetchRemap[index];
+			}
+
+			for (UINT32 i = 0; i < numOutputVertices; i++)
+			{
+				if (fetchRemap[i] == (UINT32)-1)
+					fetchRemap[i] = nextVertexIdx++;
+			}
+
+			Vector<UINT32> remappedSourceVertices(numOutputVertices);
+			for (UINT32 i = 0; i < numOutputVertices; i++)
+				remappedSourceVertices[fetchRemap[i]] = sourceVertices[i];
+
+			sourceVertices = remappedSourceVertices;
+			for (auto& entry : vertexRemap)
+				entry = fetchRemap[entry];
+		}
+
+		// Generate the output mesh
+		SPtr<MeshData> output = bs_shared_ptr_new<MeshData>(numOutputVertices, numIndices, vertexDesc, 
+			meshData->getIndexType());
+
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			const UINT8* srcData = getElementData(element);
+			UINT8* dstData = output->getElementData(element.getSemantic(), element.getSemanticIdx(), element.getStreamIdx());
+			UINT32 stride = getElementStride(element);
+			UINT32 size = element.getSize();
+
+			for (UINT32 j = 0; j < numOutputVertices; j++)
+				memcpy(dstData + j * stride, srcData + sourceVertices[j] * stride, size);
+		}
+
+		if (meshData->getIndexType() == IT_16BIT)
+		{
+			UINT16* dstIndices = output->getIndices16();
+			for (UINT32 i = 0; i < numIndices; i++)
+				dstIndices[i] = (UINT16)indices[i];
+		}
+		else
+			memcpy(output->getIndices32(), indices.data(), numIndices * sizeof(UINT32));
+
+		stats.numVerticesAfter = numOutputVertices;
+		stats.acmrAfter = calculateACMR(numOutputVertices);
+
+		return output;
+	}
+
+	/** Symmetric 4x4 matrix accumulating the squared distances to a set of planes. */
+	struct Quadric
+	{
+		Quadric()
+			: a2(0.0), ab(0.0), ac(0.0), ad(0.0), b2(0.0), bc(0.0), bd(0.0), c2(0.0), cd(0.0), d2(0.0)
+		{ }
+
+		/** Creates a quadric measuring the squared distance to the plane with the provided normal and distance. */
+		Quadric(const Vector3& normal, float d, float weight)
+		{
+			double a = normal.x;
+			double b = normal.y;
+			double c = normal.z;
+
+			a2 = a * a * weight; ab = a * b * weight; ac = a * c * weight; ad = a * d * weight;
+			b2 = b * b * weight; bc = b * c * weight; bd = b * d * weight;
+			c2 = c * c * weight; cd = c * d * weight;
+			d2 = (double)d * d * weight;
+		}
+
+		Quadric& operator+= (const Quadric& rhs)
+		{
+			a2 += rhs.a2; ab += rhs.ab; ac += rhs.ac; ad += rhs.ad;
+			b2 += rhs.b2; bc += rhs.bc; bd += rhs.bd;
+			c2 += rhs.c2; cd += rhs.cd;
+			d2 += rhs.d2;
+
+			return *this;
+		}
+
+		/** Returns the sum of weighted squared distances from the point to all the planes in the quadric. */
+		double evaluate(const Vector3& point) const
+		{
+			double x = point.x;
+			double y = point.y;
+			double z = point.z;
+
+			return a2 * x * x + 2.0 * ab * x * y + 2.0 * ac * x * z + 2.0 * ad * x
+				+ b2 * y * y + 2.0 * bc * y * z + 2.0 * bd * y
+				+ c2 * z * z + 2.0 * cd * z
+				+ d2;
+		}
+
+		double a2, ab, ac, ad, b2, bc, bd, c2, cd, d2;
+	};
+
+	/** Potential collapse of an edge, moving the source vertex onto the destination vertex. */
+	struct EdgeCollapse
+	{
+		double cost;
+		UINT32 from;
+		UINT32 to;
+	};
+
+	/** Minimum cosine of the angle between a triangle's normal before and after a collapse, for the collapse to be valid. */
+	static const float MIN_COLLAPSE_NORMAL_DOT = 0.2f;
+
+	/** Returns a key uniquely identifying an undirected edge between two vertices. */
+	UINT64 getEdgeKey(UINT32 a, UINT32 b)
+	{
+		return a < b ? ((UINT64)a << 32) | b : ((UINT64)b << 32) | a;
+	}
+
+	void MeshUtility::simplify(const Vector3* positions, UINT32 numVertices, const UINT32* indices, UINT32 numIndices,
+		UINT32 targetNumIndices, Vector<UINT32>& output)
+	{
+		numIndices -= numIndices % 3;
+		output.assign(indices, indices + numIndices);
+
+		if (numIndices <= targetNumIndices)
+			return;
+
+		// Lock vertices that share their position with another vertex, as moving them would tear the mesh apart
+		Vector<bool> locked(numVertices, false);
+		{
+			Vector<UINT32> sortedVertices(numVertices);
+			for (UINT32 i = 0; i < numVertices; i++)
+				sortedVertices[i] = i;
+
+			auto isPositionLess = [&](UINT32 lhs, UINT32 rhs)
+			{
+				const Vector3& a = positions[lhs];
+				const Vector3& b = positions[rhs];
+
+				if (a.x != b.x) return a.x < b.x;
+				if (a.y != b.y) return a.y < b.y;
+				return a.z < b.z;
+			};
+
+			std::sort(sortedVertices.begin(), sortedVertices.end(), isPositionLess);
+
+			for (UINT32 i = 1; i < numVertices; i++)
+			{
+				UINT32 prev = sortedVertices[i - 1];
+				UINT32 cur = sortedVertices[i];
+
+				if (positions[prev] == positions[cur])
+				{
+					locked[prev] = true;
+					locked[cur] = true;
+				}
+			}
+		}
+
+		// Lock vertices on open borders and non-manifold edges, so the outline of the mesh is preserved
+		{
+			UnorderedMap<UINT64, UINT32> edgeUseCounts;
+			for (UINT32 i = 0; i < numIndices; i += 3)
+			{
+				for (UINT32 j = 0; j < 3; j++)
+					edgeUseCounts[getEdgeKey(output[i + j], output[i + (j + 1) % 3])]++;
+			}
+
+			for (auto& entry : edgeUseCounts)
+			{
+				if (entry.second != 2)
+				{
+					locked[(UINT32)(entry.first >> 32)] = true;
+					locked[(UINT32)(entry.first & 0xFFFFFFFF)] = true;
+				}
+			}
+		}
+
+		// Accumulate area weighted quadrics of all the triangles around each vertex
+		Vector<Quadric> quadrics(numVertices);
+		for (UINT32 i = 0; i < numIndices; i += 3)
+		{
+			const Vector3& a = positions[output[i + 0]];
+			const Vector3& b = positions[output[i + 1]];
+			const Vector3& c = positions[output[i + 2]];
+
+			Vector3 normal = Vector3::cross(b - a, c - a);
+			float area = normal.length();
+			if (area <= 0.0f)
+				continue;
+
+			normal /= area;
+			Quadric quadric(normal, -normal.dot(a), area * 0.5f);
+
+			for (UINT32 j = 0; j < 3; j++)
+				quadrics[output[i + j]] += quadric;
+		}
+
+		Vector<UINT32> adjacencyOffsets(numVertices + 1);
+		Vector<UINT32> adjacency;
+		Vector<UINT32> remap(numVertices);
+		Vector<bool> touched(numVertices);
+		Vector<UINT32> neighbourMarks(numVertices, 0);
+		UINT32 neighbourMark = 0;
+		Vector<EdgeCollapse> collapses;
+
+		// Collapse the cheapest edges in passes, where each vertex can only be affected by a single collapse per pass
+		while (output.size() > targetNumIndices)
+		{
+			UINT32 numTriangles = (UINT32)output.size() / 3;
+
+			// Build vertex to triangle adjacency for the current triangles
+			memset(adjacencyOffsets.data(), 0, adjacencyOffsets.size() * sizeof(UINT32));
+			for (auto& index : output)
+				adjacencyOffsets[index + 1]++;
+
+			for (UINT32 i = 0; i < numVertices; i++)
+				adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+
+			adjacency.resize(output.size());
+			Vector<UINT32> adjacencyCounts(numVertices, 0);
+			for (UINT32 i = 0; i < numTriangles; i++)
+			{
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					UINT32 vertexIdx = output[i * 3 + j];
+					adjacency[adjacencyOffsets[vertexIdx] + adjacencyCounts[vertexIdx]++] = i;
+				}
+			}
+
+			// Find the cost of all valid collapses and sort them from cheapest to most expensive
+			collapses.clear();
+			for (UINT32 i = 0; i < numTriangles; i++)
+			{
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					UINT32 a = output[i * 3 + j];
+					UINT32 b = output[i * 3 + (j + 1) % 3];
+
+					Quadric quadric = quadrics[a];
+					quadric += quadrics[b];
+
+					if (!locked[a])
+						collapses.push_back({ quadric.evaluate(positions[b]), a, b });
+
+					if (!locked[b])
+						collapses.push_back({ quadric.evaluate(positions[a]), b, a });
+				}
+			}
+
+			if (collapses.empty())
+				break;
+
+			std::sort(collapses.begin(), collapses.end(), 
+				[](const EdgeCollapse& lhs, const EdgeCollapse& rhs) { return lhs.cost < rhs.cost; });
+
+			for (UINT32 i = 0; i < numVertices; i++)
+			{
+				remap[i] = i;
+				touched[i] = false;
+			}
+
+			UINT32 numTrianglesToRemove = (UINT32)(output.size() - targetNumIndices + 2) / 3;
+			UINT32 numRemovedTriangles = 0;
+			UINT32 numCollapses = 0;
+
+			for (auto& collapse : collapses)
+			{
+				if (numRemovedTriangles >= numTrianglesToRemove)
+					break;
+
+				UINT32 from = collapse.from;
+				UINT32 to = collapse.to;
+
+				if (touched[from] || touched[to])
+					continue;
+
+				const UINT32* fromTriangles = &adjacency[adjacencyOffsets[from]];
+				UINT32 numFromTriangles = adjacencyOffsets[from + 1] - adjacencyOffsets[from];
+
+				const UINT32* toTriangles = &adjacency[adjacencyOffsets[to]];
+				UINT32 numToTriangles = adjacencyOffsets[to + 1] - adjacencyOffsets[to];
+
+				// Only edges whose vertices share exactly two neighbours can be collapsed without creating non-manifold 
+				// geometry
+				neighbourMark++;
+				for (UINT32 j = 0; j < numFromTriangles; j++)
+				{
+					for (UINT32 k = 0; k < 3; k++)
+						neighbourMarks[output[fromTriangles[j] * 3 + k]] = neighbourMark;
+				}
+
+				UINT32 numSharedNeighbours = 0;
+				for (UINT32 j = 0; j < numToTriangles; j++)
+				{
+					for (UINT32 k = 0; k < 3; k++)
+					{
+						UINT32 vertexIdx = output[toTriangles[j] * 3 + k];
+						if (vertexIdx != from && vertexIdx != to && neighbourMarks[vertexIdx] == neighbourMark)
+						{
+							neighbourMarks[vertexIdx] = 0;
+							numSharedNeighbours++;
+						}
+					}
+				}
+
+				if (numSharedNeighbours != 2)
+					continue;
+
+				// Reject collapses that would flip or degenerate any of the remaining triangles
+				bool isValid = true;
+				UINT32 numCollapsedTriangles = 0;
+				for (UINT32 j = 0; j < numFromTriangles && isValid; j++)
+				{
+					const UINT32* triangle = &output[fromTriangles[j] * 3];
+					if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+					{
+						numCollapsedTriangles++;
+						continue;
+					}
+
+					Vector3 oldPositions[3];
+					Vector3 newPositions[3];
+					for (UINT32 k = 0; k < 3; k++)
+					{
+						oldPositions[k] = positions[triangle[k]];
+						newPositions[k] = triangle[k] == from ? positions[to] : oldPositions[k];
+					}
+
+					Vector3 oldNormal = Vector3::cross(oldPositions[1] - oldPositions[0], oldPositions[2] - oldPositions[0]);
+					Vector3 newNormal = Vector3::cross(newPositions[1] - newPositions[0], newPositions[2] - newPositions[0]);
+
+					float oldLength = oldNormal.length();
+					float newLength = newNormal.length();
+
+					if (newLength <= 0.0f || oldNormal.dot(newNormal) < MIN_COLLAPSE_NORMAL_DOT * oldLength * newLength)
+						isValid = false;
+				}
+
+				if (!isValid)
+					continue;
+
+				remap[from] = to;
+				quadrics[to] += quadrics[from];
+				numRemovedTriangles += numCollapsedTriangles;
+				numCollapses++;
+
+				// Triangles around both vertices have changed, so their vertices cannot participate in other collapses
+				// during this pass
+				for (UINT32 j = 0; j < numFromTriangles; j++)
+				{
+					for (UINT32 k = 0; k < 3; k++)
+						touched[output[fromTriangles[j] * 3 + k]] = true;
+				}
+
+				for (UINT32 j = 0; j < numToTriangles; j++)
+				{
+					for (UINT32 k = 0; k < 3; k++)
+						touched[output[toTriangles[j] * 3 + k]] = true;
+				}
+			}
+
+			if (numCollapses == 0)
+				break;
+
+			// Apply the collapses and remove the triangles that became degenerate
+			UINT32 numOutputIndices = 0;
+			for (UINT32 i = 0; i < numTriangles; i++)
+			{
+				UINT32 a = remap[output[i * 3 + 0]];
+				UINT32 b = remap[output[i * 3 + 1]];
+				UINT32 c = remap[output[i * 3 + 2]];
+
+				if (a == b || b == c || a == c)
+					continue;
+
+				output[numOutputIndices++] = a;
+				output[numOutputIndices++] = b;
+				output[numOutputIndices++] = c;
+			}
+
+			output.resize(numOutputIndices);
+		}
+	}
+
+	SPtr<MeshData> MeshUtility::generateLODs(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes, 
+		UINT32 numLODs, float reduction, Vector<MeshLOD>& lods)
+	{
+		lods.clear();
+
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		if (numLODs == 0 || !vertexDesc->hasElement(VES_POSITION) || 
+			vertexDesc->getElementSize(VES_POSITION) != sizeof(Vector3))
+		{
+			return meshData;
+		}
+
+		reduction = Math::clamp(reduction, 0.01f, 0.99f);
+
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numIndices = meshData->getNumIndices();
+
+		Vector<Vector3> positions(numVertices);
+		{
+			UINT8* srcPositions = meshData->getElementData(VES_POSITION);
+			UINT32 stride = vertexDesc->getVertexStride(0);
+
+			for (UINT32 i = 0; i < numVertices; i++)
+				memcpy(&positions[i], srcPositions + i * stride, sizeof(Vector3));
+		}
+
+		Vector<UINT32> indices(numIndices);
+		if (meshData->getIndexType() == IT_16BIT)
+		{
+			UINT16* srcIndices = meshData->getIndices16();
+			for (UINT32 i = 0; i < numIndices; i++)
+				indices[i] = srcIndices[i];
+		}
+		else
+			memcpy(indices.data(), meshData->getIndices32(), numIndices * sizeof(UINT32));
+
+		Vector<SubMesh> prevSubMeshes = subMeshes;
+		if (prevSubMeshes.empty())
+			prevSubMeshes.push_back(SubMesh(0, numIndices, DOT_TRIANGLE_LIST));
+
+		// Each level is generated from the previous one, so errors don't accumulate while simplifying from scratch
+		Vector<UINT32> lodIndices;
+		for (UINT32 i = 0; i < numLODs; i++)
+		{
+			MeshLOD lod;
+			lod.screenSize = 0.5f * std::pow(std::sqrt(reduction), (float)i);
+
+			UINT32 numPrevIndices = 0;
+			UINT32 numLODIndices = 0;
+			for (auto& prevSubMesh : prevSubMeshes)
+			{
+				UINT32 offset = (UINT32)indices.size();
+				bool isValidRange = (prevSubMesh.indexOffset + prevSubMesh.indexCount) <= (UINT32)indices.size();
+
+				if (prevSubMesh.drawOp == DOT_TRIANGLE_LIST && isValidRange)
+				{
+					UINT32 targetNumIndices = (UINT32)(prevSubMesh.indexCount / 3 * reduction) * 3;
+					simplify(positions.data(), numVertices, indices.data() + prevSubMesh.indexOffset, 
+						prevSubMesh.indexCount, targetNumIndices, lodIndices);
+
+					// Collapses leave the remaining triangles in their original order, which no longer makes good use
+					// of the vertex cache, and the levels are appended after optimize() has already run
+					optimizeVertexCache(lodIndices.data(), (UINT32)lodIndices.size(), numVertices);
+
+					indices.insert(indices.end(), lodIndices.begin(), lodIndices.end());
+					lod.subMeshes.push_back(SubMesh(offset, (UINT32)lodIndices.size(), prevSubMesh.drawOp));
+
+					numPrevIndices += prevSubMesh.indexCount;
+					numLODIndices += (UINT32)lodIndices.size();
+				}
+				else // Other primitive types aren't simplified and just reuse the previous level's indices
+					lod.subMeshes.push_back(prevSubMesh);
+			}
+
+			// Stop if the mesh couldn't be simplified any further
+			if (numLODIndices >= numPrevIndices)
+			{
+				indices.resize(indices.size() - numLODIndices);
+				break;
+			}
+
+			prevSubMeshes = lod.subMeshes;
+			lods.push_back(lod);
+		}
+
+		if (lods.empty())
+			return meshData;
+
+		// Generate the output mesh, with the original vertices and all the indices
+		UINT32 numOutputIndices = (UINT32)indices.size();
+		SPtr<MeshData> output = bs_shared_ptr_new<MeshData>(numVertices, numOutputIndices, vertexDesc, 
+			meshData->getIndexType());
+
+		for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			VertexElementSemantic semantic = element.getSemantic();
+			UINT32 semanticIdx = element.getSemanticIdx();
+			UINT32 streamIdx = element.getStreamIdx();
+
+			const UINT8* srcData = meshData->getElementData(semantic, semanticIdx, streamIdx);
+			UINT8* dstData = output->getElementData(semantic, semanticIdx, streamIdx);
+			UINT32 stride = vertexDesc->getVertexStride(streamIdx);
+			UINT32 size = element.getSize();
+
+			for (UINT32 j = 0; j < numVertices; j++)
+				memcpy(dstData + j * stride, srcData + j * stride, size);
+		}
+
+		if (meshData->getIndexType() == IT_16BIT)
+		{
+			UINT16* dstIndices = output->getIndices16();
+			for (UINT32 i = 0; i < numOutputIndices; i++)
+				dstIndices[i] = (UINT16)indices[i];
+		}
+		else
+			memcpy(output->getIndices32(), indices.data(), numOutputIndices * sizeof(UINT32));
+
+		return output;
+	}
+
+	/** Converts a float to a half-float, rounding to nearest rather than truncating as Bitwise::floatToHalf() does. */
+	UINT16 floatToHalfRounded(float value)
+	{
+		UINT32 bits;
+		memcpy(&bits, &value, sizeof(bits));
+
+		// Adding half of the lowest half-float mantissa bit makes the truncation round to nearest
+		return Bitwise::floatToHalfI(bits + 0x00001000);
+	}
+
+	/** Smallest non-zero magnitude representable by a 16-bit normalized integer. */
+	static const float SNORM16_EPSILON = 1.0f / 32767.0f;
+
+	/** Converts a value in [-1, 1] range into a 16-bit normalized integer. */
+	INT16 toSNorm16(float value)
+	{
+		return (INT16)Math::clamp(Math::roundToInt(value * 32767.0f), -32767, 32767);
+	}
+
+	/** Converts a 16-bit normalized integer into a value in [-1, 1] range, as performed by the GPU. */
+	float fromSNorm16(INT16 value)
+	{
+		return std::max(value / 32767.0f, -1.0f);
+	}
+
+	/** 
+	 * Maps a direction onto an octahedron and unfolds it onto a square, returning coordinates in [-1, 1] range. Must be
+	 * kept in sync with the decoding in the builtin shaders.
+	 */
+	Vector2 encodeOctahedral(const Vector3& direction)
+	{
+		float l1Norm = Math::abs(direction.x) + Math::abs(direction.y) + Math::abs(direction.z);
+		if (l1Norm == 0.0f)
+			return Vector2(0.0f, 0.0f);
+
+		Vector2 output(direction.x / l1Norm, direction.y / l1Norm);
+
+		// Fold the lower hemisphere over the diagonals
+		if (direction.z < 0.0f)
+		{
+			float x = output.x;
+			output.x = (1.0f - Math::abs(output.y)) * (x >= 0.0f ? 1.0f : -1.0f);
+			output.y = (1.0f - Math::abs(x)) * (output.y >= 0.0f ? 1.0f : -1.0f);
+		}
+
+		return output;
+	}
+
+	/** Decodes a direction encoded with encodeOctahedral(). */
+	Vector3 decodeOctahedral(const Vector2& value)
+	{
+		Vector3 output(value.x, value.y, 1.0f - Math::abs(value.x) - Math::abs(value.y));
+
+		float t = std::max(-output.z, 0.0f);
+		output.x += output.x >= 0.0f ? -t : t;
+		output.y += output.y >= 0.0f ? -t : t;
+
+		return Vector3::normalize(output);
+	}
+
+	/** Reads a normal or a tangent stored as a float vector or in the 8-bit packed format. */
+	Vector4 readDirection(const UINT8* data, VertexElementType type)
+	{
+		if (type == VET_UBYTE4_NORM)
+		{
+			const PackedNormal& packed = *(const PackedNormal*)data;
+			return Vector4(packed.x / 127.5f - 1.0f, packed.y / 127.5f - 1.0f, packed.z / 127.5f - 1.0f, 
+				packed.w / 127.5f - 1.0f);
+		}
+
+		Vector4 output(0.0f, 0.0f, 0.0f, 1.0f);
+		memcpy(&output, data, VertexElement::getTypeSize(type));
+
+		return output;
+	}
+
+	SPtr<MeshData> MeshUtility::compressVertices(const SPtr<MeshData>& meshData, VertexCompressionFlags flags,
+		MeshVertexCompression& compression, VertexCompressionStats& stats, float maxPositionError)
+	{
+		compression = MeshVertexCompression();
+		memset(&stats, 0, sizeof(stats));
+
+		const SPtr<VertexDataDesc>& vertexDesc = meshData->getVertexDesc();
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numIndices = meshData->getNumIndices();
+		UINT32 numElements = vertexDesc->getNumElements();
+
+		stats.originalSize = vertexDesc->getVertexStride() * numVertices;
+		stats.compressedSize = stats.originalSize;
+
+		// Normals and tangents are decoded together in the shader, so only compress them if all are in a supported format
+		bool compressNormals = flags.isSet(VertexCompressionFlag::NormalTangent);
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			VertexElementType type = element.getType();
+
+			if (element.getSemantic() == VES_NORMAL)
+				compressNormals &= type == VET_FLOAT3 || type == VET_FLOAT4 || type == VET_UBYTE4_NORM;
+			else if (element.getSemantic() == VES_TANGENT)
+				compressNormals &= type == VET_FLOAT4 || type == VET_UBYTE4_NORM;
+		}
+
+		Vector<VertexElementType> outputTypes(numElements);
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			VertexElementType type = element.getType();
+			outputTypes[i] = type;
+
+			switch (element.getSemantic())
+			{
+			case VES_POSITION:
+				// Only the primary position is decoded by the shaders
+				if (flags.isSet(VertexCompressionFlag::Position) && element.getSemanticIdx() == 0 && 
+					element.getStreamIdx() == 0 && (type == VET_FLOAT3 || type == VET_FLOAT4))
+				{
+					outputTypes[i] = VET_HALF4;
+				}
+				break;
+			case VES_NORMAL:
+			case VES_TANGENT:
+				if (compressNormals)
+					outputTypes[i] = VET_SHORT2_NORM;
+				break;
+			case VES_TEXCOORD:
+				if (flags.isSet(VertexCompressionFlag::UV) && type == VET_FLOAT2)
+					outputTypes[i] = VET_SHORT2_NORM;
+				break;
+			default:
+				break;
+			}
+		}
+
+		if (numVertices == 0)
+			return meshData;
+
+		// Find the ranges to normalize the positions and texture coordinates to
+		float maxFloat = std::numeric_limits<float>::max();
+		Vector3 positionMin(maxFloat, maxFloat, maxFloat);
+		Vector3 positionMax(-maxFloat, -maxFloat, -maxFloat);
+		Vector2 uvMin(maxFloat, maxFloat);
+		Vector2 uvMax(-maxFloat, -maxFloat);
+
+		bool hasPositions = false;
+		bool hasUVs = false;
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			if (outputTypes[i] == element.getType())
+				continue;
+
+			const UINT8* data = meshData->getElementData(element.getSemantic(), element.getSemanticIdx(), 
+				element.getStreamIdx());
+			UINT32 stride = vertexDesc->getVertexStride(element.getStreamIdx());
+
+			if (element.getSemantic() == VES_POSITION)
+			{
+				for (UINT32 j = 0; j < numVertices; j++)
+				{
+					Vector3 position;
+					memcpy(&position, data + j * stride, sizeof(position));
+
+					positionMin = Vector3::min(positionMin, position);
+					positionMax = Vector3::max(positionMax, position);
+				}
+
+				hasPositions = true;
+			}
+			else if (element.getSemantic() == VES_TEXCOORD)
+			{
+				for (UINT32 j = 0; j < numVertices; j++)
+				{
+					Vector2 uv;
+					memcpy(&uv, data + j * stride, sizeof(uv));
+
+					uvMin = Vector2::min(uvMin, uv);
+					uvMax = Vector2::max(uvMax, uv);
+				}
+
+				hasUVs = true;
+			}
+		}
+
+		// Map the ranges to [-1, 1], as half-floats have more precision there than in the positive range alone
+		if (hasPositions)
+		{
+			compression.positionOffset = (positionMin + positionMax) * 0.5f;
+			compression.positionScale = (positionMax - positionMin) * 0.5f;
+
+			for (UINT32 i = 0; i < 3; i++)
+			{
+				if (compression.positionScale[i] <= 0.0f)
+					compression.positionScale[i] = 1.0f;
+			}
+
+			// Half-floats have 11 bits of precision, so normalized components in [-1, 1] are rounded by at most 2^-12
+			float worstCaseError = compression.positionScale.length() / 4096.0f;
+			if (worstCaseError > maxPositionError)
+			{
+				for (UINT32 i = 0; i < numElements; i++)
+				{
+					const VertexElement& element = vertexDesc->getElement(i);
+					if (element.getSemantic() == VES_POSITION)
+						outputTypes[i] = element.getType();
+				}
+
+				compression.positionOffset = Vector3::ZERO;
+				compression.positionScale = Vector3::ONE;
+				hasPositions = false;
+			}
+		}
+
+		stats.positionsCompressed = hasPositions;
+
+		bool anyCompressed = false;
+		for (UINT32 i = 0; i < numElements; i++)
+			anyCompressed |= outputTypes[i] != vertexDesc->getElement(i).getType();
+
+		if (!anyCompressed)
+			return meshData;
+
+		if (hasUVs)
+		{
+			compression.uvOffset = (uvMin + uvMax) * 0.5f;
+			compression.uvScale = (uvMax - uvMin) * 0.5f;
+
+			for (UINT32 i = 0; i < 2; i++)
+			{
+				if (compression.uvScale[i] <= 0.0f)
+					compression.uvScale[i] = 1.0f;
+			}
+		}
+
+		compression.octahedralNormals = compressNormals && (vertexDesc->hasElement(VES_NORMAL) || 
+			vertexDesc->hasElement(VES_TANGENT));
+
+		SPtr<VertexDataDesc> outputDesc = VertexDataDesc::create();
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			outputDesc->addVertElem(outputTypes[i], element.getSemantic(), element.getSemanticIdx(), 
+				element.getStreamIdx(), element.getInstanceStepRate());
+		}
+
+		SPtr<MeshData> output = bs_shared_ptr_new<MeshData>(numVertices, numIndices, outputDesc, 
+			meshData->getIndexType());
+
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			VertexElementSemantic semantic = element.getSemantic();
+			VertexElementType type = element.getType();
+			UINT32 semanticIdx = element.getSemanticIdx();
+			UINT32 streamIdx = element.getStreamIdx();
+
+			const UINT8* srcData = meshData->getElementData(semantic, semanticIdx, streamIdx);
+			UINT8* dstData = output->getElementData(semantic, semanticIdx, streamIdx);
+			UINT32 srcStride = vertexDesc->getVertexStride(streamIdx);
+			UINT32 dstStride = outputDesc->getVertexStride(streamIdx);
+
+			if (outputTypes[i] == type)
+			{
+				UINT32 size = element.getSize();
+				for (UINT32 j = 0; j < numVertices; j++)
+					memcpy(dstData + j * dstStride, srcData + j * srcStride, size);
+
+				continue;
+			}
+
+			for (UINT32 j = 0; j < numVertices; j++)
+			{
+				const UINT8* src = srcData + j * srcStride;
+				UINT8* dst = dstData + j * dstStride;
+
+				if (semantic == VES_POSITION)
+				{
+					Vector3 position;
+					memcpy(&position, src, sizeof(position));
+
+					Vector3 normalized = (position - compression.positionOffset) / compression.positionScale;
+					UINT16 encoded[4] = { floatToHalfRounded(normalized.x), floatToHalfRounded(normalized.y),
+						floatToHalfRounded(normalized.z), floatToHalfRounded(1.0f) };
+
+					memcpy(dst, encoded, sizeof(encoded));
+
+					Vector3 decoded(Bitwise::halfToFloat(encoded[0]), Bitwise::halfToFloat(encoded[1]), 
+						Bitwise::halfToFloat(encoded[2]));
+					decoded = decoded * compression.positionScale + compression.positionOffset;
+
+					stats.maxPositionError = std::max(stats.maxPositionError, position.distance(decoded));
+				}
+				else if (semantic == VES_NORMAL)
+				{
+					Vector3 normal = Vector3::normalize(Vector3(readDirection(src, type)));
+					Vector2 octahedral = encodeOctahedral(normal);
+
+					INT16 encoded[2] = { toSNorm16(octahedral.x), toSNorm16(octahedral.y) };
+					memcpy(dst, encoded, sizeof(encoded));
+
+					Vector3 decoded = decodeOctahedral(Vector2(fromSNorm16(encoded[0]), fromSNorm16(encoded[1])));
+					float cosAngle = Math::clamp(normal.dot(decoded), -1.0f, 1.0f);
+
+					stats.maxNormalError = std::max(stats.maxNormalError, std::acos(cosAngle));
+				}
+				else if (semantic == VES_TANGENT)
+				{
+					Vector4 tangent = readDirection(src, type);
+					Vector2 octahedral = encodeOctahedral(Vector3::normalize(Vector3(tangent)));
+
+					// Remap the second component to [epsilon, 1] so its sign can store the bitangent sign even when zero
+					float y = (octahedral.y * 0.5f + 0.5f) * (1.0f - SNORM16_EPSILON) + SNORM16_EPSILON;
+
+					INT16 encoded[2] = { toSNorm16(octahedral.x), toSNorm16(tangent.w < 0.0f ? -y : y) };
+					memcpy(dst, encoded, sizeof(encoded));
+				}
+				else if (semantic == VES_TEXCOORD)
+				{
+					Vector2 uv;
+					memcpy(&uv, src, sizeof(uv));
+
+					Vector2 normalized = (uv - compression.uvOffset) / compression.uvScale;
+
+					INT16 encoded[2] = { toSNorm16(normalized.x), toSNorm16(normalized.y) };
+					memcpy(dst, encoded, sizeof(encoded));
+				}
+			}
+		}
+
+		if (meshData->getIndexType() == IT_16BIT)
+			memcpy(output->getIndices16(), meshData->getIndices16(), numIndices * sizeof(UINT16));
+		else
+			memcpy(output->getIndices32(), meshData->getIndices32(), numIndices * sizeof(UINT32));
+
+		stats.compressedSize = outputDesc->getVertexStride() * numVertices;
+		return output;
+	}
+
+	bool MeshUtility::readPositions(const MeshData& meshData, const MeshVertexCompression& compression, Vector3* output)
+	{
+		const SPtr<VertexDataDesc>& vertexDesc = meshData.getVertexDesc();
+		for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+		{
+			const VertexElement& element = vertexDesc->getElement(i);
+			if (element.getSemantic() != VES_POSITION)
+				continue;
+
+			VertexElementType type = element.getType();
+			if (type != VET_FLOAT3 && type != VET_FLOAT4 && type != VET_HALF4)
+				return false;
+
+			const UINT8* data = meshData.getElementData(VES_POSITION, element.getSemanticIdx(), element.getStreamIdx());
+			UINT32 stride = vertexDesc->getVertexStride(element.getStreamIdx());
+			UINT32 numVertices = meshData.getNumVertices();
+
+			if (type == VET_HALF4)
+			{
+				for (UINT32 j = 0; j < numVertices; j++)
+				{
+					const UINT16* encoded = (const UINT16*)(data + j * stride);
+					Vector3 position(Bitwise::halfToFloat(encoded[0]), Bitwise::halfToFloat(encoded[1]), 
+						Bitwise::halfToFloat(encoded[2]));
+
+					output[j] = position * compression.positionScale + compression.positionOffset;
+				}
+			}
+			else
+			{
+				for (UINT32 j = 0; j < numVertices; j++)
+					memcpy(&output[j], data + j * stride, sizeof(Vector3));
+			}
+
+			return true;
+		}
+
+		return false;
+	}
 }
\ No newline at end of file
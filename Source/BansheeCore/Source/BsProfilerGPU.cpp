@@ -163,6 +163,11 @@ namespace BansheeEngine
 		reportSample.numObjectsCreated = (UINT32)(sample.endStats.numObjectsCreated - sample.startStats.numObjectsCreated);
 		reportSample.numObjectsDestroyed = (UINT32)(sample.endStats.numObjectsDestroyed - sample.startStats.numObjectsDestroyed);
 
+		reportSample.numParamsWritten = (UINT32)(sample.endStats.numParamsWritten - sample.startStats.numParamsWritten);
+		reportSample.numOcclusionCulled = (UINT32)(sample.endStats.numOcclusionCulled - sample.startStats.numOcclusionCulled);
+
+		reportSample.peakRenderTargetMemory = sample.endStats.peakRenderTargetMemory - sample.startStats.peakRenderTargetMemory;
+
 		mFreeTimerQueries.push(sample.activeTimeQuery);
 		mFreeOcclusionQueries.push(sample.activeOcclusionQuery);
 	}
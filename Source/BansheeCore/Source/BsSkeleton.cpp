@@ -5,8 +5,121 @@
 #include "BsSkeletonMask.h"
 #include "BsSkeletonRTTI.h"
 
+#if (BS_ARCH_TYPE == BS_ARCHITECTURE_x86_64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define BS_SKELETON_SSE 1
+#	include <emmintrin.h>
+#else
+#	define BS_SKELETON_SSE 0
+#endif
+
 namespace BansheeEngine
 {
+#if BS_SKELETON_SSE
+	/** Returns the dot product of two four component vectors, in all four components of the output. */
+	__m128 dot4(__m128 a, __m128 b)
+	{
+		__m128 mul = _mm_mul_ps(a, b);
+		__m128 sum = _mm_add_ps(mul, _mm_shuffle_ps(mul, mul, _MM_SHUFFLE(2, 3, 0, 1)));
+
+		return _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+
+	/** Returns a mask with only the sign bits set, in components where @p value is negative. */
+	__m128 negativeSignMask(__m128 value)
+	{
+		return _mm_and_ps(_mm_cmplt_ps(value, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+	}
+
+	/** 
+	 * Adds a weighted rotation to an accumulated rotation. The rotation is negated first if needed, so both are in the 
+	 * same hemisphere. 
+	 */
+	void accumulateRotation(Quaternion& accum, const Quaternion& value, float weight)
+	{
+		__m128 accumVec = _mm_loadu_ps(&accum.x);
+		__m128 valueVec = _mm_mul_ps(_mm_loadu_ps(&value.x), _mm_set1_ps(weight));
+
+		valueVec = _mm_xor_ps(valueVec, negativeSignMask(dot4(valueVec, accumVec)));
+		_mm_storeu_ps(&accum.x, _mm_add_ps(accumVec, valueVec));
+	}
+
+	/** Interpolates between two rotations along the shortest arc and normalizes the result. Same as Quaternion::lerp. */
+	Quaternion blendRotations(const Quaternion& from, const Quaternion& to, float t)
+	{
+		__m128 fromVec = _mm_loadu_ps(&from.x);
+		__m128 toVec = _mm_loadu_ps(&to.x);
+
+		__m128 fromWeight = _mm_xor_ps(_mm_set1_ps(1.0f - t), negativeSignMask(dot4(fromVec, toVec)));
+		__m128 blended = _mm_add_ps(_mm_mul_ps(fromVec, fromWeight), _mm_mul_ps(toVec, _mm_set1_ps(t)));
+		blended = _mm_div_ps(blended, _mm_sqrt_ps(dot4(blended, blended)));
+
+		Quaternion output;
+		_mm_storeu_ps(&output.x, blended);
+
+		return output;
+	}
+
+	/** Normalizes a rotation with a non-zero length. */
+	void normalizeRotation(Quaternion& rotation)
+	{
+		__m128 rotationVec = _mm_loadu_ps(&rotation.x);
+		_mm_storeu_ps(&rotation.x, _mm_div_ps(rotationVec, _mm_sqrt_ps(dot4(rotationVec, rotationVec))));
+	}
+
+	/** Concatenates two affine matrices. Same as Matrix4::concatenateAffine, except @p output may alias the inputs. */
+	void concatenateAffine(const Matrix4& lhs, const Matrix4& rhs, Matrix4& output)
+	{
+		__m128 row0 = _mm_loadu_ps(rhs[0]);
+		__m128 row1 = _mm_loadu_ps(rhs[1]);
+		__m128 row2 = _mm_loadu_ps(rhs[2]);
+		__m128 row3 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+
+		__m128 result[3];
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			result[i] = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(_mm_set1_ps(lhs[i][0]), row0), _mm_mul_ps(_mm_set1_ps(lhs[i][1]), row1)),
+				_mm_add_ps(_mm_mul_ps(_mm_set1_ps(lhs[i][2]), row2), _mm_mul_ps(_mm_set1_ps(lhs[i][3]), row3)));
+		}
+
+		for (UINT32 i = 0; i < 3; i++)
+			_mm_storeu_ps(output[i], result[i]);
+
+		_mm_storeu_ps(output[3], row3);
+	}
+#else
+	/** 
+	 * Adds a weighted rotation to an accumulated rotation. The rotation is negated first if needed, so both are in the 
+	 * same hemisphere. 
+	 */
+	void accumulateRotation(Quaternion& accum, const Quaternion& value, float weight)
+	{
+		Quaternion weighted = value * weight;
+		if (weighted.dot(accum) < 0.0f)
+			weighted = -weighted;
+
+		accum += weighted;
+	}
+
+	/** Interpolates between two rotations along the shortest arc and normalizes the result. Same as Quaternion::lerp. */
+	Quaternion blendRotations(const Quaternion& from, const Quaternion& to, float t)
+	{
+		return Quaternion::lerp(t, from, to);
+	}
+
+	/** Normalizes a rotation with a non-zero length. */
+	void normalizeRotation(Quaternion& rotation)
+	{
+		rotation.normalize();
+	}
+
+	/** Concatenates two affine matrices. Same as Matrix4::concatenateAffine, except @p output may alias the inputs. */
+	void concatenateAffine(const Matrix4& lhs, const Matrix4& rhs, Matrix4& output)
+	{
+		output = lhs.concatenateAffine(rhs);
+	}
+#endif
+
 	LocalSkeletonPose::LocalSkeletonPose()
 		: positions(nullptr), rotations(nullptr), scales(nullptr), hasOverride(nullptr), numBones(0)
 	{ }
@@ -85,11 +198,12 @@ namespace BansheeEngine
 	}
 
 	Skeleton::Skeleton()
-		:mInvBindPoses(nullptr), mBoneInfo(nullptr), mNumBones(0)
+		:mInvBindPoses(nullptr), mBoneInfo(nullptr), mBoneOrder(nullptr), mBoneOrderIdx(nullptr), mNumBones(0)
 	{ }
 
 	Skeleton::Skeleton(BONE_DESC* bones, UINT32 numBones)
-		:mInvBindPoses(bs_newN<Matrix4>(numBones)), mBoneInfo(bs_newN<SkeletonBoneInfo>(numBones)), mNumBones(numBones)
+		: mInvBindPoses(bs_newN<Matrix4>(numBones)), mBoneInfo(bs_newN<SkeletonBoneInfo>(numBones)), mBoneOrder(nullptr)
+		, mBoneOrderIdx(nullptr), mNumBones(numBones)
 	{
 		for(UINT32 i = 0; i < numBones; i++)
 		{
@@ -97,6 +211,8 @@ namespace BansheeEngine
 			mBoneInfo[i].name = bones[i].name;
 			mBoneInfo[i].parent = bones[i].parent;
 		}
+
+		calculateBoneOrder();
 	}
 
 	Skeleton::~Skeleton()
@@ -106,6 +222,47 @@ namespace BansheeEngine
 
 		if (mBoneInfo != nullptr)
 			bs_deleteN(mBoneInfo, mNumBones);
+
+		if (mBoneOrder != nullptr)
+			bs_free(mBoneOrder);
+	}
+
+	void Skeleton::calculateBoneOrder()
+	{
+		if (mBoneOrder != nullptr)
+			bs_free(mBoneOrder);
+
+		// The order, and the position of each bone in the order, share the same allocation
+		mBoneOrder = (UINT32*)bs_alloc(sizeof(UINT32) * mNumBones * 2);
+		mBoneOrderIdx = mBoneOrder + mNumBones;
+
+		// Sort bones by their depth in the hierarchy. This ensures parents always come before their children, and that
+		// bones closest to the root come first so the pose can be evaluated for only a subset of the bones.
+		UINT32* depths = (UINT32*)bs_stack_alloc(sizeof(UINT32) * mNumBones);
+		for (UINT32 i = 0; i < mNumBones; i++)
+		{
+			UINT32 depth = 0;
+			UINT32 parentBoneIdx = mBoneInfo[i].parent;
+			while (parentBoneIdx != (UINT32)-1 && depth < mNumBones) // Limit guards against invalid (cyclic) hierarchies
+			{
+				parentBoneIdx = mBoneInfo[parentBoneIdx].parent;
+				depth++;
+			}
+
+			depths[i] = depth;
+			mBoneOrder[i] = i;
+		}
+
+		std::stable_sort(mBoneOrder, mBoneOrder + mNumBones, 
+			[&](UINT32 a, UINT32 b)
+		{
+			return depths[a] < depths[b];
+		});
+
+		for (UINT32 i = 0; i < mNumBones; i++)
+			mBoneOrderIdx[mBoneOrder[i]] = i;
+
+		bs_stack_free(depths);
 	}
 
 	SPtr<Skeleton> Skeleton::create(BONE_DESC* bones, UINT32 numBones)
@@ -122,9 +279,16 @@ namespace BansheeEngine
 		{
 			FrameVector<AnimationCurveMapping> boneToCurveMapping(mNumBones);
 
+			FrameVector<AnimationCurveBinding> positionBindings(mNumBones);
+			FrameVector<AnimationCurveBinding> rotationBindings(mNumBones);
+			FrameVector<AnimationCurveBinding> scaleBindings(mNumBones);
+
 			AnimationState state;
 			state.curves = clip.getCurves();
 			state.boneToCurveMapping = boneToCurveMapping.data();
+			state.positionBindings = positionBindings.data();
+			state.rotationBindings = rotationBindings.data();
+			state.scaleBindings = scaleBindings.data();
 			state.loop = loop;
 			state.weight = 1.0f;
 			state.time = time;
@@ -146,29 +310,82 @@ namespace BansheeEngine
 			layer.numStates = 1;
 
 			clip.getBoneMapping(*this, state.boneToCurveMapping);
+			buildCurveBindings(mask, state);
 
-			getPose(pose, localPose, mask, &layer, 1);
+			getPose(pose, localPose, &layer, 1);
 		}
 		bs_frame_clear();
 	}
 
-	void Skeleton::getPose(Matrix4* pose, LocalSkeletonPose& localPose, const SkeletonMask& mask, 
-		const AnimationStateLayer* layers, UINT32 numLayers)
+	void Skeleton::buildCurveBindings(const SkeletonMask& mask, AnimationState& state) const
+	{
+		state.numPositionBindings = 0;
+		state.numRotationBindings = 0;
+		state.numScaleBindings = 0;
+
+		// Bindings are added in bone evaluation order, so bones closest to the root come first
+		for (UINT32 i = 0; i < mNumBones; i++)
+		{
+			UINT32 boneIdx = mBoneOrder[i];
+			if (!mask.isEnabled(boneIdx))
+				continue;
+
+			const AnimationCurveMapping& mapping = state.boneToCurveMapping[boneIdx];
+			if (mapping.position != (UINT32)-1)
+				state.positionBindings[state.numPositionBindings++] = { boneIdx, mapping.position };
+
+			if (mapping.rotation != (UINT32)-1)
+				state.rotationBindings[state.numRotationBindings++] = { boneIdx, mapping.rotation };
+
+			if (mapping.scale != (UINT32)-1)
+				state.scaleBindings[state.numScaleBindings++] = { boneIdx, mapping.scale };
+		}
+	}
+
+	void Skeleton::getPose(Matrix4* pose, LocalSkeletonPose& localPose, const AnimationStateLayer* layers, 
+		UINT32 numLayers, UINT32 maxBones)
+	{
+		getLocalPose(localPose, layers, numLayers, maxBones);
+		calculateGlobalPose(pose, localPose);
+	}
+
+	void Skeleton::getPose(Matrix4* pose, LocalSkeletonPose& localPose, const LocalSkeletonPose& from, 
+		const LocalSkeletonPose& to, float t)
 	{
-		// Note: If more performance is required this method could be optimized with vector instructions
+		assert(localPose.numBones == mNumBones && from.numBones == mNumBones && to.numBones == mNumBones);
 
+		for (UINT32 i = 0; i < mNumBones; i++)
+		{
+			// Bones that were animated when the poses were evaluated ignore any external overrides
+			localPose.hasOverride[i] = localPose.hasOverride[i] && to.hasOverride[i];
+			if (localPose.hasOverride[i])
+				continue;
+
+			localPose.positions[i] = Vector3::lerp(t, from.positions[i], to.positions[i]);
+			localPose.rotations[i] = blendRotations(from.rotations[i], to.rotations[i], t);
+			localPose.scales[i] = Vector3::lerp(t, from.scales[i], to.scales[i]);
+		}
+
+		calculateGlobalPose(pose, localPose);
+	}
+
+	void Skeleton::getLocalPose(LocalSkeletonPose& localPose, const AnimationStateLayer* layers, UINT32 numLayers, 
+		UINT32 maxBones) const
+	{
 		assert(localPose.numBones == mNumBones);
 
-		for(UINT32 i = 0; i < mNumBones; i++)
+		UINT32 numActiveBones = std::min(maxBones, mNumBones);
+		for(UINT32 i = 0; i < numActiveBones; i++)
 		{
-			localPose.positions[i] = Vector3::ZERO;
-			localPose.rotations[i] = Quaternion::ZERO;
-			localPose.scales[i] = Vector3::ONE;
+			UINT32 boneIdx = mBoneOrder[i];
+
+			localPose.positions[boneIdx] = Vector3::ZERO;
+			localPose.rotations[boneIdx] = Quaternion::ZERO;
+			localPose.scales[boneIdx] = Vector3::ONE;
 		}
 
-		// Note: For a possible performance improvement consider keeping an array of only active (non-disabled) bones and
-		// just iterate over them without mask checks. Possibly also a list of active curve mappings to avoid those checks
-		// as well.
+		// Note: Only bones that are enabled by the mask and animated by a curve are present in the state bindings, so the
+		// loops below require no per-bone checks
 		for(UINT32 i = 0; i < numLayers; i++)
 		{
 			const AnimationStateLayer& layer = layers[i];
@@ -197,135 +414,124 @@ namespace BansheeEngine
 				if (Math::approxEquals(normWeight, 0.0f))
 					continue;
 
-				for (UINT32 k = 0; k < mNumBones; k++)
+				UINT32 numPositionBindings = getNumActiveBindings(state.positionBindings, state.numPositionBindings, 
+					numActiveBones);
+				for (UINT32 k = 0; k < numPositionBindings; k++)
 				{
-					if (!mask.isEnabled(k))
-						continue;
+					const AnimationCurveBinding& binding = state.positionBindings[k];
 
-					const AnimationCurveMapping& mapping = state.boneToCurveMapping[k];
-					if (mapping.position != (UINT32)-1)
-					{
-						const TAnimationCurve<Vector3>& curve = state.curves->position[mapping.position].curve;
-						localPose.positions[k] += curve.evaluate(state.time, state.positionCaches[k], state.loop) * normWeight;
+					Vector3 value = state.curves->evaluatePosition(binding.curve, state.time, 
+						state.positionCaches[binding.curve], state.loop);
+					localPose.positions[binding.bone] += value * normWeight;
 
-						localPose.hasOverride[k] = false;
-					}
+					localPose.hasOverride[binding.bone] = false;
 				}
 
-				for (UINT32 k = 0; k < mNumBones; k++)
+				UINT32 numScaleBindings = getNumActiveBindings(state.scaleBindings, state.numScaleBindings, 
+					numActiveBones);
+				for (UINT32 k = 0; k < numScaleBindings; k++)
 				{
-					if (!mask.isEnabled(k))
-						continue;
+					const AnimationCurveBinding& binding = state.scaleBindings[k];
 
-					const AnimationCurveMapping& mapping = state.boneToCurveMapping[k];
-					if (mapping.scale != (UINT32)-1)
-					{
-						const TAnimationCurve<Vector3>& curve = state.curves->scale[mapping.scale].curve;
-						localPose.scales[k] *= curve.evaluate(state.time, state.scaleCaches[k], state.loop) * normWeight;
+					Vector3 value = state.curves->evaluateScale(binding.curve, state.time, 
+						state.scaleCaches[binding.curve], state.loop);
+					localPose.scales[binding.bone] *= value * normWeight;
 
-						localPose.hasOverride[k] = false;
-					}
+					localPose.hasOverride[binding.bone] = false;
 				}
 
+				UINT32 numRotationBindings = getNumActiveBindings(state.rotationBindings, state.numRotationBindings, 
+					numActiveBones);
 				if(layer.additive)
 				{
-					for (UINT32 k = 0; k < mNumBones; k++)
+					for (UINT32 k = 0; k < numRotationBindings; k++)
 					{
-						if (!mask.isEnabled(k))
-							continue;
-
-						const AnimationCurveMapping& mapping = state.boneToCurveMapping[k];
-						if (mapping.rotation != (UINT32)-1)
-						{
-							bool isAssigned = localPose.rotations[k].w != 0.0f;
-							if (!isAssigned)
-								localPose.rotations[k] = Quaternion::IDENTITY;
+						const AnimationCurveBinding& binding = state.rotationBindings[k];
+						Quaternion& rotation = localPose.rotations[binding.bone];
 
-							const TAnimationCurve<Quaternion>& curve = state.curves->rotation[mapping.rotation].curve;
+						bool isAssigned = rotation.w != 0.0f;
+						if (!isAssigned)
+							rotation = Quaternion::IDENTITY;
 
-							Quaternion value = curve.evaluate(state.time, state.rotationCaches[k], state.loop);
-							value = Quaternion::lerp(normWeight, Quaternion::IDENTITY, value);
+						Quaternion value = state.curves->evaluateRotation(binding.curve, state.time, 
+							state.rotationCaches[binding.curve], state.loop);
+						value = Quaternion::lerp(normWeight, Quaternion::IDENTITY, value);
 
-							localPose.rotations[k] *= value;
-							localPose.hasOverride[k] = false;
-						}
+						rotation *= value;
+						localPose.hasOverride[binding.bone] = false;
 					}
 				}
 				else
 				{
-					for (UINT32 k = 0; k < mNumBones; k++)
+					for (UINT32 k = 0; k < numRotationBindings; k++)
 					{
-						if (!mask.isEnabled(k))
-							continue;
-
-						const AnimationCurveMapping& mapping = state.boneToCurveMapping[k];
-						if (mapping.rotation != (UINT32)-1)
-						{
-							const TAnimationCurve<Quaternion>& curve = state.curves->rotation[mapping.rotation].curve;
-							Quaternion value = curve.evaluate(state.time, state.rotationCaches[k], state.loop) * normWeight;
-
-							if (value.dot(localPose.rotations[k]) < 0.0f)
-								value = -value;
-							
-							localPose.rotations[k] += value;
-							localPose.hasOverride[k] = false;
-						}
+						const AnimationCurveBinding& binding = state.rotationBindings[k];
+
+						Quaternion value = state.curves->evaluateRotation(binding.curve, state.time, 
+							state.rotationCaches[binding.curve], state.loop);
+
+						accumulateRotation(localPose.rotations[binding.bone], value, normWeight);
+						localPose.hasOverride[binding.bone] = false;
 					}
 				}
 			}
 		}
 
-		// Calculate local pose matrices
-		UINT32 isGlobalBytes = sizeof(bool) * mNumBones;
-		bool* isGlobal = (bool*)bs_stack_alloc(isGlobalBytes);
-		memset(isGlobal, 0, isGlobalBytes);
-
-		for(UINT32 i = 0; i < mNumBones; i++)
+		for(UINT32 i = 0; i < numActiveBones; i++)
 		{
-			bool isAssigned = localPose.rotations[i].w != 0.0f;
+			UINT32 boneIdx = mBoneOrder[i];
+
+			bool isAssigned = localPose.rotations[boneIdx].w != 0.0f;
 			if (!isAssigned)
-				localPose.rotations[i] = Quaternion::IDENTITY;
+				localPose.rotations[boneIdx] = Quaternion::IDENTITY;
 			else
-				localPose.rotations[i].normalize();
+				normalizeRotation(localPose.rotations[boneIdx]);
+		}
+	}
 
+	void Skeleton::calculateGlobalPose(Matrix4* pose, const LocalSkeletonPose& localPose) const
+	{
+		// Calculate local pose matrices
+		for(UINT32 i = 0; i < mNumBones; i++)
+		{
+			// Overriden bones already contain their global transform
 			if (localPose.hasOverride[i])
-			{
-				isGlobal[i] = true;
 				continue;
-			}
 
 			pose[i] = Matrix4::TRS(localPose.positions[i], localPose.rotations[i], localPose.scales[i]);
 		}
 
-		// Calculate global poses
-		// Note: For a possible performance improvement consider sorting bones in such order so that parents (and overrides)
-		// always come before children, we no isGlobal check is needed.
-		std::function<void(UINT32)> calcGlobal = [&](UINT32 boneIdx)
+		// Calculate global poses. Parents always come before their children in the bone order, so their global pose is 
+		// always available by the time a child is processed.
+		for (UINT32 i = 0; i < mNumBones; i++)
 		{
+			UINT32 boneIdx = mBoneOrder[i];
+			if (localPose.hasOverride[boneIdx])
+				continue;
+
 			UINT32 parentBoneIdx = mBoneInfo[boneIdx].parent;
-			if (parentBoneIdx == (UINT32)-1)
-			{
-				isGlobal[boneIdx] = true;
-				return;
-			}
+			if (parentBoneIdx != (UINT32)-1)
+				concatenateAffine(pose[parentBoneIdx], pose[boneIdx], pose[boneIdx]);
+		}
 
-			if (!isGlobal[parentBoneIdx])
-				calcGlobal(parentBoneIdx);
+		for (UINT32 i = 0; i < mNumBones; i++)
+			concatenateAffine(pose[i], mInvBindPoses[i], pose[i]);
+	}
 
-			pose[boneIdx] = pose[parentBoneIdx] * pose[boneIdx];
-			isGlobal[boneIdx] = true;
-		};
+	UINT32 Skeleton::getNumActiveBindings(const AnimationCurveBinding* bindings, UINT32 numBindings, 
+		UINT32 numActiveBones) const
+	{
+		if (numActiveBones >= mNumBones)
+			return numBindings;
 
-		for (UINT32 i = 0; i < mNumBones; i++)
+		// Bindings are sorted in bone evaluation order, so all active bindings are at the start of the array
+		const AnimationCurveBinding* end = std::lower_bound(bindings, bindings + numBindings, numActiveBones,
+			[&](const AnimationCurveBinding& binding, UINT32 orderIdx)
 		{
-			if (!isGlobal[i])
-				calcGlobal(i);
-		}
-
-		for (UINT32 i = 0; i < mNumBones; i++)
-			pose[i] = pose[i] * mInvBindPoses[i];
+			return mBoneOrderIdx[binding.bone] < orderIdx;
+		});
 
-		bs_stack_free(isGlobal);
+		return (UINT32)(end - bindings);
 	}
 
 	UINT32 Skeleton::getRootBoneIndex() const
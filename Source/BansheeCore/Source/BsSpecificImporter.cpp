@@ -22,6 +22,8 @@ namespace BansheeEngine
 
 	SPtr<const ImportOptions> SpecificImporter::getDefaultImportOptions() const
 	{
+		Lock lock(mDefaultImportOptionsMutex);
+
 		if(mDefaultImportOptions == nullptr)
 			mDefaultImportOptions = createImportOptions();
 
@@ -359,6 +359,9 @@ namespace BansheeEngine
 
 		if(font != nullptr)
 		{
+			// Dynamic fonts render any missing characters now
+			font->_prepareGlyphs(fontSize, text);
+
 			UINT32 nearestSize = font->getClosestSize(fontSize);
 			mFontData = font->getBitmap(nearestSize);
 		}
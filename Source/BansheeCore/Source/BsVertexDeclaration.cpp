@@ -67,6 +67,12 @@ namespace BansheeEngine
 			return sizeof(INT32) * 3;
 		case VET_UBYTE4:
 			return sizeof(UINT8) * 4;
+		case VET_HALF2:
+		case VET_SHORT2_NORM:
+			return sizeof(UINT16) * 2;
+		case VET_HALF4:
+		case VET_SHORT4_NORM:
+			return sizeof(UINT16) * 4;
 		}
 
 		return 0;
@@ -91,6 +97,8 @@ namespace BansheeEngine
 		case VET_USHORT2:
 		case VET_INT2:
 		case VET_UINT2:
+		case VET_HALF2:
+		case VET_SHORT2_NORM:
 			return 2;
 		case VET_FLOAT3:
 		case VET_INT3:
@@ -103,6 +111,8 @@ namespace BansheeEngine
 		case VET_UINT4:
 		case VET_UBYTE4:
 		case VET_UBYTE4_NORM:
+		case VET_HALF4:
+		case VET_SHORT4_NORM:
 			return 4;
 		}
 
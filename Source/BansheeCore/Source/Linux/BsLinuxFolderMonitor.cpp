@@ -0,0 +1,548 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "Linux/BsLinuxFolderMonitor.h"
+#include "BsFileSystem.h"
+#include "BsException.h"
+
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <chrono>
+
+namespace BansheeEngine
+{
+	enum class FileActionType
+	{
+		Added,
+		Removed,
+		Modified,
+		Renamed
+	};
+
+	struct FileAction
+	{
+		FileActionType type;
+		String oldName;
+		String newName;
+	};
+
+	struct FolderMonitor::FolderWatchInfo
+	{
+		String mFolderToMonitor;
+		bool mMonitorSubdirectories;
+		UINT32 mMonitorFlags;
+	};
+
+	/** 
+	 * Time to wait for the IN_MOVED_TO half of a move after its IN_MOVED_FROM half was read, before reporting the entry 
+	 * as moved outside of the monitored folders. 
+	 */
+	static const UINT32 MOVE_TIMEOUT_MS = 100;
+
+	struct FolderMonitor::Pimpl
+	{
+		/** Single inotify watch. Each monitored directory and subdirectory requires a separate watch. */
+		struct WatchedDirectory
+		{
+			String path;
+			FolderWatchInfo* owner;
+		};
+
+		/** IN_MOVED_FROM event still waiting for the IN_MOVED_TO event with the same cookie. */
+		struct PendingMove
+		{
+			UINT32 cookie;
+			String path;
+			bool isDirectory;
+			std::chrono::steady_clock::time_point timestamp;
+		};
+
+		Vector<FolderWatchInfo*> mFoldersToWatch;
+		UnorderedMap<int, WatchedDirectory> mWatches;
+		UnorderedMap<String, int> mWatchesByPath;
+		Vector<PendingMove> mPendingMoves;
+		int mInotifyHandle;
+		int mShutdownPipe[2];
+
+		Queue<FileAction> mFileActions;
+
+		Mutex mMainMutex;
+		Mutex mWatchMutex;
+		Thread* mWorkerThread;
+	};
+
+	/** Returns true if the path is equal to, or a child of, the provided directory. */
+	static bool isPathInDirectory(const String& path, const String& directory)
+	{
+		if (path.size() < directory.size() || path.compare(0, directory.size(), directory) != 0)
+			return false;
+
+		return path.size() == directory.size() || path[directory.size()] == '/';
+	}
+
+	FolderMonitor::FolderMonitor()
+	{
+		mPimpl = bs_new<Pimpl>();
+		mPimpl->mWorkerThread = nullptr;
+		mPimpl->mInotifyHandle = -1;
+		mPimpl->mShutdownPipe[0] = -1;
+		mPimpl->mShutdownPipe[1] = -1;
+	}
+
+	FolderMonitor::~FolderMonitor()
+	{
+		stopMonitorAll();
+		bs_delete(mPimpl);
+	}
+
+	void FolderMonitor::startMonitor(const Path& folderPath, bool subdirectories, FolderChange changeFilter)
+	{
+		if(!FileSystem::isDirectory(folderPath))
+		{
+			LOGERR("Provided path \"" + folderPath.toString() + "\" is not a directory");
+			return;
+		}
+
+		if(mPimpl->mInotifyHandle == -1)
+		{
+			mPimpl->mInotifyHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+			if(mPimpl->mInotifyHandle == -1)
+			{
+				BS_EXCEPT(InternalErrorException, "Failed to create an inotify instance for folder monitoring. Error code: " + 
+					toString(errno));
+			}
+
+			if(pipe2(mPimpl->mShutdownPipe, O_CLOEXEC) == -1)
+			{
+				close(mPimpl->mInotifyHandle);
+				mPimpl->mInotifyHandle = -1;
+
+				BS_EXCEPT(InternalErrorException, "Failed to create a pipe for folder monitoring. Error code: " + 
+					toString(errno));
+			}
+		}
+
+		String folder = folderPath.toString();
+		while(folder.size() > 1 && folder.back() == '/')
+			folder.pop_back();
+
+		FolderWatchInfo* watchInfo = bs_new<FolderWatchInfo>();
+		watchInfo->mFolderToMonitor = folder;
+		watchInfo->mMonitorSubdirectories = subdirectories;
+		watchInfo->mMonitorFlags = (UINT32)changeFilter;
+
+		{
+			Lock lock(mPimpl->mWatchMutex);
+
+			mPimpl->mFoldersToWatch.push_back(watchInfo);
+			addWatches(*watchInfo, folder);
+		}
+
+		if(mPimpl->mWorkerThread == nullptr)
+			mPimpl->mWorkerThread = bs_new<Thread>(std::bind(&FolderMonitor::workerThreadMain, this));
+	}
+
+	void FolderMonitor::stopMonitor(const Path& folderPath)
+	{
+		String folder = folderPath.toString();
+		while(folder.size() > 1 && folder.back() == '/')
+			folder.pop_back();
+
+		bool isEmpty;
+		{
+			Lock lock(mPimpl->mWatchMutex);
+
+			auto findIter = std::find_if(mPimpl->mFoldersToWatch.begin(), mPimpl->mFoldersToWatch.end(), 
+				[&](const FolderWatchInfo* x) { return x->mFolderToMonitor == folder; });
+
+			if(findIter != mPimpl->mFoldersToWatch.end())
+			{
+				FolderWatchInfo* watchInfo = *findIter;
+
+				for(auto iter = mPimpl->mWatches.begin(); iter != mPimpl->mWatches.end();)
+				{
+					if(iter->second.owner == watchInfo)
+					{
+						inotify_rm_watch(mPimpl->mInotifyHandle, iter->first);
+						mPimpl->mWatchesByPath.erase(iter->second.path);
+
+						iter = mPimpl->mWatches.erase(iter);
+					}
+					else
+						++iter;
+				}
+
+				auto& pendingMoves = mPimpl->mPendingMoves;
+				pendingMoves.erase(std::remove_if(pendingMoves.begin(), pendingMoves.end(), 
+					[&](const Pimpl::PendingMove& x) { return isPathInDirectory(x.path, folder); }), pendingMoves.end());
+
+				bs_delete(watchInfo);
+				mPimpl->mFoldersToWatch.erase(findIter);
+			}
+
+			isEmpty = mPimpl->mFoldersToWatch.empty();
+		}
+
+		// Shutting down joins the worker thread, which needs the watch mutex, so it must happen outside the lock
+		if(isEmpty)
+			stopMonitorAll();
+	}
+
+	void FolderMonitor::stopMonitorAll()
+	{
+		if(mPimpl->mWorkerThread != nullptr)
+		{
+			// Wake up the worker thread, so it notices the shutdown request
+			char signal = 0;
+			while(write(mPimpl->mShutdownPipe[1], &signal, 1) == -1 && errno == EINTR)
+			{ }
+
+			mPimpl->mWorkerThread->join();
+			bs_delete(mPimpl->mWorkerThread);
+			mPimpl->mWorkerThread = nullptr;
+		}
+
+		// No need for mutex since we know worker thread is shut down by now
+		for(auto& watchInfo : mPimpl->mFoldersToWatch)
+			bs_delete(watchInfo);
+
+		mPimpl->mFoldersToWatch.clear();
+		mPimpl->mWatches.clear();
+		mPimpl->mWatchesByPath.clear();
+		mPimpl->mPendingMoves.clear();
+
+		// Closing the inotify instance releases all of its watches
+		if(mPimpl->mInotifyHandle != -1)
+		{
+			close(mPimpl->mInotifyHandle);
+			mPimpl->mInotifyHandle = -1;
+		}
+
+		for(auto& handle : mPimpl->mShutdownPipe)
+		{
+			if(handle != -1)
+			{
+				close(handle);
+				handle = -1;
+			}
+		}
+	}
+
+	void FolderMonitor::addWatches(FolderWatchInfo& watchInfo, const String& path, Vector<String>* addedEntries)
+	{
+		UINT32 mask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_CLOSE_WRITE | IN_ONLYDIR;
+
+		if((watchInfo.mMonitorFlags & ((UINT32)FolderChange::Attributes | (UINT32)FolderChange::Security)) != 0)
+			mask |= IN_ATTRIB;
+
+		if((watchInfo.mMonitorFlags & (UINT32)FolderChange::LastAccess) != 0)
+			mask |= IN_ACCESS;
+
+		int watchHandle = inotify_add_watch(mPimpl->mInotifyHandle, path.c_str(), mask);
+		if(watchHandle == -1)
+		{
+			// Most likely the per-user watch limit was reached (see /proc/sys/fs/inotify/max_user_watches)
+			LOGWRN("Failed to monitor folder \"" + path + "\". Error code: " + toString(errno));
+			return;
+		}
+
+		mPimpl->mWatches[watchHandle] = { path, &watchInfo };
+		mPimpl->mWatchesByPath[path] = watchHandle;
+
+		if(!watchInfo.mMonitorSubdirectories)
+			return;
+
+		DIR* dirHandle = opendir(path.c_str());
+		if(dirHandle == nullptr)
+			return;
+
+		while(dirent* entry = readdir(dirHandle))
+		{
+			// Skip the special entries, and hidden files the same as the notifications do
+			if(entry->d_name[0] == '.')
+				continue;
+
+			String childPath = path + "/" + entry->d_name;
+
+			bool isDirectory = entry->d_type == DT_DIR;
+			if(entry->d_type == DT_UNKNOWN)
+			{
+				struct stat st;
+				isDirectory = stat(childPath.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+			}
+
+			if(addedEntries != nullptr)
+			{
+				UINT32 addFlags = isDirectory ? (UINT32)FolderChange::DirName : 
+					((UINT32)FolderChange::FileName | (UINT32)FolderChange::Creation);
+
+				if((watchInfo.mMonitorFlags & addFlags) != 0)
+					addedEntries->push_back(childPath);
+			}
+
+			if(isDirectory)
+				addWatches(watchInfo, childPath, addedEntries);
+		}
+
+		closedir(dirHandle);
+	}
+
+	void FolderMonitor::removeWatches(const String& path)
+	{
+		for(auto iter = mPimpl->mWatches.begin(); iter != mPimpl->mWatches.end();)
+		{
+			if(isPathInDirectory(iter->second.path, path))
+			{
+				inotify_rm_watch(mPimpl->mInotifyHandle, iter->first);
+				mPimpl->mWatchesByPath.erase(iter->second.path);
+
+				iter = mPimpl->mWatches.erase(iter);
+			}
+			else
+				++iter;
+		}
+	}
+
+	void FolderMonitor::workerThreadMain()
+	{
+		static const UINT32 READ_BUFFER_SIZE = 65536;
+		alignas(inotify_event) UINT8 buffer[READ_BUFFER_SIZE];
+
+		pollfd handles[2];
+		handles[0].fd = mPimpl->mInotifyHandle;
+		handles[0].events = POLLIN;
+		handles[1].fd = mPimpl->mShutdownPipe[0];
+		handles[1].events = POLLIN;
+
+		while(true)
+		{
+			handles[0].revents = 0;
+			handles[1].revents = 0;
+
+			// Only wake up periodically while there are moves waiting for their second half
+			int timeout = -1;
+			{
+				Lock lock(mPimpl->mWatchMutex);
+
+				if(!mPimpl->mPendingMoves.empty())
+					timeout = (int)MOVE_TIMEOUT_MS;
+			}
+
+			int numReady = poll(handles, 2, timeout);
+			if(numReady == -1)
+			{
+				if(errno == EINTR)
+					continue;
+
+				LOGERR("Folder monitoring stopped due to an error. Error code: " + toString(errno));
+				break;
+			}
+
+			if((handles[1].revents & POLLIN) != 0)
+				break;
+
+			if((handles[0].revents & POLLIN) != 0)
+			{
+				ssize_t numBytes = read(mPimpl->mInotifyHandle, buffer, READ_BUFFER_SIZE);
+				if(numBytes > 0)
+					handleNotifications(buffer, (UINT32)numBytes);
+			}
+			else if(numReady == 0)
+				handleNotifications(buffer, 0);
+		}
+	}
+
+	void FolderMonitor::handleNotifications(UINT8* buffer, UINT32 size)
+	{
+		Vector<FileAction> actions;
+		auto now = std::chrono::steady_clock::now();
+
+		Lock lock(mPimpl->mWatchMutex);
+		auto& pendingMoves = mPimpl->mPendingMoves;
+
+		UINT8* bufferEnd = buffer + size;
+		while(buffer < bufferEnd)
+		{
+			inotify_event* event = (inotify_event*)buffer;
+			buffer += sizeof(inotify_event) + event->len;
+
+			// Some events were lost, so report the monitored folders as modified, in which case listeners should check
+			// them in full
+			if((event->mask & IN_Q_OVERFLOW) != 0)
+			{
+				for(auto& watchInfo : mPimpl->mFoldersToWatch)
+					actions.push_back({ FileActionType::Modified, String(), watchInfo->mFolderToMonitor });
+
+				continue;
+			}
+
+			auto iterFind = mPimpl->mWatches.find(event->wd);
+			if(iterFind == mPimpl->mWatches.end())
+				continue;
+
+			// Watched directory was deleted or moved out of the monitored folder
+			if((event->mask & IN_IGNORED) != 0)
+			{
+				mPimpl->mWatchesByPath.erase(iterFind->second.path);
+				mPimpl->mWatches.erase(iterFind);
+				continue;
+			}
+
+			// Ignore events about the watched directory itself, as they're also reported by its parent, as well as
+			// notifications about hidden files
+			if(event->len == 0 || event->name[0] == '.')
+				continue;
+
+			FolderWatchInfo& watchInfo = *iterFind->second.owner;
+			String fullPath = iterFind->second.path + "/" + event->name;
+
+			bool isDirectory = (event->mask & IN_ISDIR) != 0;
+			UINT32 nameFlags = isDirectory ? (UINT32)FolderChange::DirName : (UINT32)FolderChange::FileName;
+			bool reportNames = (watchInfo.mMonitorFlags & nameFlags) != 0;
+
+			if((event->mask & IN_CREATE) != 0)
+			{
+				Vector<String> existingEntries;
+				if(isDirectory && watchInfo.mMonitorSubdirectories)
+					addWatches(watchInfo, fullPath, &existingEntries);
+
+				if(reportNames || (!isDirectory && (watchInfo.mMonitorFlags & (UINT32)FolderChange::Creation) != 0))
+					actions.push_back({ FileActionType::Added, String(), fullPath });
+
+				// Entries created in the new directory before its watch was added never generate events of their own. 
+				// Entries created after may get reported twice, which listeners must already handle for new folders.
+				for(auto& entry : existingEntries)
+					actions.push_back({ FileActionType::Added, String(), entry });
+			}
+			else if((event->mask & IN_DELETE) != 0)
+			{
+				if(reportNames)
+					actions.push_back({ FileActionType::Removed, String(), fullPath });
+			}
+			else if((event->mask & IN_MOVED_FROM) != 0)
+			{
+				pendingMoves.push_back({ event->cookie, fullPath, isDirectory, now });
+			}
+			else if((event->mask & IN_MOVED_TO) != 0)
+			{
+				auto iterMove = std::find_if(pendingMoves.begin(), pendingMoves.end(), 
+					[&](const Pimpl::PendingMove& x) { return x.cookie == event->cookie; });
+
+				if(iterMove != pendingMoves.end())
+				{
+					// Watches follow the directory inode, so only their paths need updating
+					if(isDirectory)
+					{
+						String oldPath = iterMove->path;
+						for(auto& entry : mPimpl->mWatches)
+						{
+							if(!isPathInDirectory(entry.second.path, oldPath))
+								continue;
+
+							mPimpl->mWatchesByPath.erase(entry.second.path);
+							entry.second.path = fullPath + entry.second.path.substr(oldPath.size());
+							mPimpl->mWatchesByPath[entry.second.path] = entry.first;
+						}
+					}
+
+					if(reportNames)
+						actions.push_back({ FileActionType::Renamed, iterMove->path, fullPath });
+
+					pendingMoves.erase(iterMove);
+				}
+				else
+				{
+					// Moved in from outside of the monitored folders
+					if(isDirectory && watchInfo.mMonitorSubdirectories)
+						addWatches(watchInfo, fullPath);
+
+					if(reportNames)
+						actions.push_back({ FileActionType::Added, String(), fullPath });
+				}
+			}
+			else if(!isDirectory)
+			{
+				UINT32 modifyFlags = 0;
+				if((event->mask & IN_CLOSE_WRITE) != 0)
+					modifyFlags = (UINT32)FolderChange::LastWrite | (UINT32)FolderChange::Size;
+				else if((event->mask & IN_ATTRIB) != 0)
+					modifyFlags = (UINT32)FolderChange::Attributes | (UINT32)FolderChange::Security;
+				else if((event->mask & IN_ACCESS) != 0)
+					modifyFlags = (UINT32)FolderChange::LastAccess;
+
+				if((watchInfo.mMonitorFlags & modifyFlags) != 0)
+					actions.push_back({ FileActionType::Modified, String(), fullPath });
+			}
+		}
+
+		// Both halves of a move are usually reported in the same read, but the IN_MOVED_TO half can end up in the next 
+		// one. Moves left unmatched after the timeout were moved outside of the monitored folders.
+		for(auto iter = pendingMoves.begin(); iter != pendingMoves.end();)
+		{
+			if((now - iter->timestamp) < std::chrono::milliseconds(MOVE_TIMEOUT_MS))
+			{
+				++iter;
+				continue;
+			}
+
+			if(iter->isDirectory)
+				removeWatches(iter->path);
+
+			actions.push_back({ FileActionType::Removed, String(), iter->path });
+			iter = pendingMoves.erase(iter);
+		}
+
+		lock.unlock();
+
+		{
+			Lock actionLock(mPimpl->mMainMutex);
+
+			for(auto& action : actions)
+				mPimpl->mFileActions.push(action);
+		}
+	}
+
+	void FolderMonitor::_update()
+	{
+		Vector<FileAction> actions;
+
+		{
+			Lock lock(mPimpl->mMainMutex);
+
+			while (!mPimpl->mFileActions.empty())
+			{
+				actions.push_back(mPimpl->mFileActions.front());
+				mPimpl->mFileActions.pop();
+			}
+		}
+
+		// Unlike on Windows there is no need to wait for writes to finish, as modifications are only reported once the
+		// file is closed
+		for (auto& action : actions)
+		{
+			switch (action.type)
+			{
+			case FileActionType::Added:
+				if (!onAdded.empty())
+					onAdded(Path(action.newName));
+				break;
+			case FileActionType::Removed:
+				if (!onRemoved.empty())
+					onRemoved(Path(action.newName));
+				break;
+			case FileActionType::Modified:
+				if (!onModified.empty())
+					onModified(Path(action.newName));
+				break;
+			case FileActionType::Renamed:
+				if (!onRenamed.empty())
+					onRenamed(Path(action.oldName), Path(action.newName));
+				break;
+			}
+		}
+	}
+}
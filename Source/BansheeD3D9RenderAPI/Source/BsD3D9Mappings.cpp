@@ -352,6 +352,14 @@ namespace BansheeEngine
 			return D3DDECLTYPE_SHORT4;
         case VET_UBYTE4:
             return D3DDECLTYPE_UBYTE4;
+		case VET_HALF2:
+			return D3DDECLTYPE_FLOAT16_2;
+		case VET_HALF4:
+			return D3DDECLTYPE_FLOAT16_4;
+		case VET_SHORT2_NORM:
+			return D3DDECLTYPE_SHORT2N;
+		case VET_SHORT4_NORM:
+			return D3DDECLTYPE_SHORT4N;
 		default:
 			LOGWRN("Invalid vertex element type for DX9.");
 			break;
@@ -9,6 +9,7 @@ set(BS_BANSHEEEDITOR_SRC_LIBRARY
 	"Source/BsProjectLibraryEntries.cpp"
 	"Source/BsProjectResourceMeta.cpp"
 	"Source/BsEditorShaderIncludeHandler.cpp"
+	"Source/BsImportCache.cpp"
 )
 
 set(BS_BANSHEEEDITOR_INC_EDITORWINDOW
@@ -73,6 +74,7 @@ set(BS_BANSHEEEDITOR_INC_LIBRARY
 	"Include/BsProjectLibraryEntries.h"
 	"Include/BsProjectResourceMeta.h"
 	"Include/BsEditorShaderIncludeHandler.h"
+	"Include/BsImportCache.h"
 )
 
 set(BS_BANSHEEEDITOR_INC_GUI
@@ -183,6 +185,7 @@ set(BS_BANSHEEEDITOR_INC_UTILITY
 
 set(BS_BANSHEEEDITOR_SRC_TESTING
 	"Source/BsEditorTestSuite.cpp"
+	"Source/BsEditorBenchmarkSuite.cpp"
 )
 
 set(BS_BANSHEEEDITOR_SRC_SETTINGS
@@ -231,6 +234,7 @@ set(BS_BANSHEEEDITOR_SRC_HANDLES
 
 set(BS_BANSHEEEDITOR_INC_TESTING
 	"Include/BsEditorTestSuite.h"
+	"Include/BsEditorBenchmarkSuite.h"
 )
 
 source_group("Header Files\\Settings" FILES ${BS_BANSHEEEDITOR_INC_SETTINGS})
@@ -34,6 +34,9 @@ namespace BansheeEngine
 		/** @copydoc EditorCommand::revert */
 		void revert() override;
 
+		/** @copydoc EditorCommand::getMemoryUsage */
+		UINT32 getMemoryUsage() const override { return mSerializedObjectSize; }
+
 	private:
 		friend class UndoRedo;
 
@@ -6,6 +6,8 @@
 #include "BsEditorCommand.h"
 #include "BsUndoRedo.h"
 #include "BsEditorUtility.h"
+#include "BsVector3.h"
+#include "BsQuaternion.h"
 
 namespace BansheeEngine
 {
@@ -16,9 +18,57 @@ namespace BansheeEngine
 	/**
 	 * A command used for undo/redo purposes. It records a state of the entire scene object at a specific point and allows
 	 * you to restore it to its original values as needed.
+	 *
+	 * Once the change to the object is done (a newer command is registered, or the command is reverted) the recorded
+	 * state is replaced with a set of differences between the states before and after the change, which are then applied
+	 * in-place on undo and redo. If components or children were added or removed in the meantime the full state is kept
+	 * and the object is restored by re-creating it.
 	 */
 	class BS_ED_EXPORT CmdRecordSO : public EditorCommand
 	{
+		/** Recorded state of a single component. */
+		struct ComponentState
+		{
+			UINT64 id;
+			SPtr<SerializedObject> data;
+		};
+
+		/** Recorded state of a single scene object. */
+		struct ObjectState
+		{
+			UINT64 id;
+			String name;
+			Vector3 position;
+			Quaternion rotation;
+			Vector3 scale;
+			bool active;
+
+			Vector<ComponentState> components;
+			Vector<UINT64> children;
+		};
+
+		/** Differences in a single component between two states, encoded using MemorySerializer. */
+		struct ComponentDiff
+		{
+			UINT64 id;
+			UINT8* data;
+			UINT32 size;
+		};
+
+		/** Differences in a single scene object between two states. Only fields marked in @p flags are stored. */
+		struct ObjectDiff
+		{
+			UINT64 id;
+			UINT32 flags;
+			String name;
+			Vector3 position;
+			Quaternion rotation;
+			Vector3 scale;
+			bool active;
+
+			Vector<ComponentDiff> components;
+		};
+
 	public:
 		~CmdRecordSO();
 
@@ -39,6 +89,12 @@ namespace BansheeEngine
 		/** @copydoc EditorCommand::revert */
 		void revert() override;
 
+		/** @copydoc EditorCommand::compact */
+		void compact() override;
+
+		/** @copydoc EditorCommand::getMemoryUsage */
+		UINT32 getMemoryUsage() const override;
+
 	private:
 		friend class UndoRedo;
 
@@ -50,6 +106,34 @@ namespace BansheeEngine
 		 */
 		void recordSO(const HSceneObject& sceneObject);
 
+		/**
+		 * Outputs the current state of the recorded scene object, as well as its children if the hierarchy is being
+		 * recorded. Objects are output in depth-first order.
+		 *
+		 * @param[out]	output				State of all the recorded objects.
+		 * @param[in]	recordComponentData	If true, serialized data of all the components is output as well. Otherwise
+		 *									only the component IDs are output.
+		 */
+		void recordState(Vector<ObjectState>& output, bool recordComponentData) const;
+
+		/**
+		 * Assigns component data to the recorded state, extracted from the serialized object recorded when the command
+		 * was executed. Returns false if the serialized object doesn't match the recorded state.
+		 */
+		bool readRecordedComponents();
+
+		/**
+		 * Generates a set of differences that transform objects from the @p from state to the @p to state. Both states
+		 * must have the same structure.
+		 */
+		static void generateDiff(const Vector<ObjectState>& from, const Vector<ObjectState>& to, Vector<ObjectDiff>& output);
+
+		/** Applies a set of differences generated by generateDiff() to the live objects. */
+		static void applyDiff(const Vector<ObjectDiff>& diff);
+
+		/** Frees all memory used by the provided set of differences and clears it. */
+		static void clearDiff(Vector<ObjectDiff>& diff);
+
 		/**	Clears all the stored data and frees memory. */
 		void clear();
 
@@ -59,6 +143,11 @@ namespace BansheeEngine
 
 		UINT8* mSerializedObject;
 		UINT32 mSerializedObjectSize;
+		Vector<ObjectState> mRecordedState;
+
+		bool mHasDiff;
+		Vector<ObjectDiff> mUndoDiff;
+		Vector<ObjectDiff> mRedoDiff;
 	};
 
 	/** @} */
@@ -0,0 +1,42 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "BsTestSuite.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Testing-Editor
+	 *  @{
+	 */
+
+	/** 
+	 * Contains a set of performance benchmarks for the editor. Each benchmark logs its timings and only asserts on the
+	 * validity of the benchmarked work. Benchmarks are only ran on start-up if the editor was built with 
+	 * BS_EDITOR_BENCHMARKS defined.
+	 */
+	class EditorBenchmarkSuite : public TestSuite
+	{
+	public:
+		EditorBenchmarkSuite();
+
+	private:
+		/** Compares the time of laying out text against retrieving it from the text layout cache. */
+		void BenchmarkTextLayoutCache();
+
+		/** Compares the time of evaluating original and compressed animation curves. */
+		void BenchmarkAnimationCompression();
+
+		/** Measures skeleton clip evaluation and pose blending, for various rig sizes. */
+		void BenchmarkSkeletonPose();
+
+		/** Measures CPU skinning of positions and normals. */
+		void BenchmarkSkinVertices();
+
+		/** Measures normal and tangent calculation. */
+		void BenchmarkTangentSpace();
+	};
+
+	/** @} */
+}
\ No newline at end of file
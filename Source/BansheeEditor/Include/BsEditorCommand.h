@@ -26,6 +26,16 @@ namespace BansheeEngine
 		/** Reverts the command, reverting the change previously done with commit(). */
 		virtual void revert() { }
 
+		/**
+		 * Called by the undo/redo system when a newer command is registered on top of this one. At that point the
+		 * affected objects are in the state right after this command was applied, which commands can use to replace the
+		 * data they recorded with a more compact representation.
+		 */
+		virtual void compact() { }
+
+		/** Returns the approximate number of bytes of memory used by the data stored by the command. */
+		virtual UINT32 getMemoryUsage() const { return 0; }
+
 		/**	Deletes the command. */
 		static void destroy(EditorCommand* command);
 
@@ -70,6 +70,12 @@ namespace BansheeEngine
 		 */
 		float getMouseSensitivity() const { return mMouseSensitivity; }
 
+		/** 
+		 * Retrieves the folder in which imported resources are cached, so they can be reused by any project instead of
+		 * being imported again. Empty path means each project uses its own cache within its internal folder.
+		 */
+		Path getImportCacheFolder() const { return mImportCacheFolder; }
+
 		/**	Enables/disables snapping for move handles in scene view. */
 		void setMoveHandleSnapActive(bool snapActive) { mMoveSnapActive = snapActive; markAsDirty(); }
 
@@ -118,6 +124,13 @@ namespace BansheeEngine
 		 */
 		void setMouseSensitivity(float value) { mMouseSensitivity = value; markAsDirty(); }
 
+		/** 
+		 * Sets the folder in which imported resources are cached, so they can be reused by any project instead of being
+		 * imported again. The folder can be shared between machines. Empty path means each project uses its own cache
+		 * within its internal folder.
+		 */
+		void setImportCacheFolder(const Path& value) { mImportCacheFolder = value; markAsDirty(); }
+
 	private:
 		bool mMoveSnapActive;
 		bool mRotateSnapActive;
@@ -139,6 +152,7 @@ namespace BansheeEngine
 		Path mLastOpenProject;
 		bool mAutoLoadLastProject;
 		Vector<RecentProject> mRecentProjects;
+		Path mImportCacheFolder;
 
 		/************************************************************************/
 		/* 								RTTI		                     		*/
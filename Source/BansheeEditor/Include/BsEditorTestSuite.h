@@ -5,6 +5,7 @@
 #include "BsEditorPrerequisites.h"
 #include "BsTestSuite.h"
 #include "BsComponent.h"
+#include "BsSkeleton.h"
 
 namespace BansheeEngine
 {
@@ -67,6 +68,25 @@ namespace BansheeEngine
 		TestComponentB() {} // Serialization only
 	};
 
+	/** Creates a bitmap font containing lowercase letters of fixed width, without any texture data. */
+	HFont createTestFont(UINT32 size);
+
+	/** Generates a grid of @p size x @p size quads in the XZ plane with gentle hills, with two triangles per quad. */
+	void createTestGrid(UINT32 size, Vector<Vector3>& positions, Vector<UINT32>& indices);
+
+	/** 
+	 * Adds smooth position and rotation curves to @p curves, sampled densely similar to what is imported from baked FBX
+	 * animation. 
+	 */
+	void createTestAnimationCurves(UINT32 numCurves, UINT32 numKeys, float keyInterval, AnimationCurves& curves);
+
+	/** 
+	 * Creates a binary tree of bones, so parents always have a lower index than their children, and adds a position and
+	 * a rotation curve for each bone to @p curves.
+	 */
+	void createTestRig(UINT32 numBones, UINT32 numKeys, float keyInterval, Vector<BONE_DESC>& bones,
+		AnimationCurves& curves);
+
 	/** @endcond */
 
 	/**	Contains a set of unit tests for the editor. */
@@ -90,6 +110,51 @@ namespace BansheeEngine
 
 		/**	Tests the frame allocator. */
 		void TestFrameAlloc();
+
+		/** Tests text layout cache hits, invalidation on font and size changes, and eviction. */
+		void TestTextLayoutCache();
+
+		/** Tests that GUI layout updates skip hierarchies that weren't modified, including ones inside containers. */
+		void TestGUILayoutUpdate();
+
+		/** Tests CPU scene picking against known triangles, including objects hidden behind other objects. */
+		void TestScenePicking();
+
+		/** Tests that compressed animation curves stay within tolerance of the originals. */
+		void TestAnimationCompression();
+
+		/** Tests skeleton pose evaluation and blending against a scalar reference, for various rig sizes. */
+		void TestSkeletonPose();
+
+		/** Tests CPU skinning of positions and normals against a scalar reference. */
+		void TestSkinVertices();
+
+		/** Tests looped evaluation of baked animation curves, and that curves with different ranges aren't baked. */
+		void TestAnimationBaking();
+
+		/** Tests mesh vertex welding and triangle reordering, including the reordering of generated LOD levels. */
+		void TestMeshOptimize();
+
+		/** Tests mesh simplification and generation of levels of detail for a mesh with multiple sub-meshes. */
+		void TestMeshSimplify();
+
+		/** Tests normal and tangent calculation against a single-threaded scalar reference. */
+		void TestTangentSpace();
+
+		/** Tests that compressed vertices decoded the same way as in the shaders stay within their precision bounds. */
+		void TestVertexCompression();
+
+		/** Tests that the software occlusion buffer only culls bounds fully hidden behind a rasterized occluder. */
+		void TestOcclusionCulling();
+
+		/** Tests that animations evaluating to the same pose share their bone transforms, and different ones don't. */
+		void TestAnimationPoseSharing();
+
+		/** Tests that bones skipped due to the animation LOD bone limit keep their transforms across updates. */
+		void TestAnimationLOD();
+
+		/** Tests that the project library scan journal requires a rescan once a directory's children change. */
+		void TestProjectLibraryScanJournal();
 	};
 
 	/** @} */
@@ -49,6 +49,7 @@ namespace BansheeEngine
 
 			GUIToggle* mFoldoutBtn;
 			GUILabel* mElement;
+			HEvent mFoldoutToggledConn;
 
 			String mName;
 
@@ -97,6 +98,17 @@ namespace BansheeEngine
 			GUITexture* background;
 		};
 
+		/** Contains data about a single row of a virtualized tree view, in the order the rows are displayed. */
+		struct VirtualRow
+		{
+			VirtualRow(TreeElement* element, UINT32 indent)
+				:element(element), indent(indent)
+			{ }
+
+			TreeElement* element;
+			UINT32 indent;
+		};
+
 	public:
 		/** Returns type name of the GUI element used for finding GUI element styles. */
 		static const String& getGUITypeName();
@@ -119,6 +131,20 @@ namespace BansheeEngine
 		/**	Starts rename operation on the currently selected element. */
 		void renameSelected();
 
+		/**
+		 * Enables or disables virtualization. When enabled GUI elements are only created for rows in the visible area of
+		 * the tree view (plus a small margin), and are reused as the tree view is scrolled. This keeps the number of GUI 
+		 * elements constant regardless of the number of entries in the tree view.
+		 *
+		 * @note	
+		 * All rows of a virtualized tree view are assumed to be of the same height. Optimal width of a virtualized tree
+		 * view only accounts for rows that were displayed so far.
+		 */
+		void setVirtualized(bool enabled);
+
+		/**	Checks is virtualization enabled. See setVirtualized(). */
+		bool isVirtualized() const { return mIsVirtualized; }
+
 		/** @name Internal
 		 *  @{
 		 */
@@ -141,6 +167,9 @@ namespace BansheeEngine
 		/** @copydoc GUIElement::updateClippedBounds */
 		void updateClippedBounds() override;
 
+		/** @copydoc GUIElement::_updateOptimalLayoutSizes */
+		void _updateOptimalLayoutSizes() override;
+
 		/** @copydoc GUIElement::_updateLayoutInternal */
 		void _updateLayoutInternal(const GUILayoutData& data) override;
 
@@ -237,6 +266,45 @@ namespace BansheeEngine
 		/**	Rebuilds the needed GUI elements for the provided TreeElement. */
 		void updateElementGUI(TreeElement* element);
 
+		/** 
+		 * Creates GUI elements for the provided TreeElement, or reuses previously released ones if virtualization is
+		 * enabled, and updates them with the element's current contents.
+		 */
+		void bindElementGUI(TreeElement* element);
+
+		/**
+		 * Destroys GUI elements of the provided TreeElement, or stores them for later reuse if virtualization is 
+		 * enabled.
+		 */
+		void unbindElementGUI(TreeElement* element);
+
+		/** Destroys the foldout button of the provided TreeElement, or stores it for later reuse. */
+		void unbindFoldoutGUI(TreeElement* element);
+
+		/** Returns the height of a single row (element and the spacing above it) in a virtualized tree view. */
+		UINT32 getVirtualRowHeight() const;
+
+		/** 
+		 * Returns the index of the row displaying the provided TreeElement in a virtualized tree view, or -1 if the element
+		 * isn't displayed. Uses the rows as of the last call to updateVirtualRows().
+		 */
+		INT32 findRowIndex(const TreeElement* element) const;
+
+		/** Rebuilds the list of rows displayed by a virtualized tree view, if the tree hierarchy changed since last call. */
+		void updateVirtualRows();
+
+		/**
+		 * Assigns layout data to the GUI elements of the provided row, and registers it for interaction.
+		 *
+		 * @param[in]		element		Element displayed in the row.
+		 * @param[in]		indent		Depth of the element in the tree hierarchy.
+		 * @param[in]		elementSize	Size of the element's label.
+		 * @param[in]		data		Layout data of the tree view.
+		 * @param[in, out]	offset		Position of the row. Advanced to the position of the next row on return.
+		 */
+		void updateRowLayout(TreeElement* element, UINT32 indent, const Vector2I& elementSize, const GUILayoutData& data,
+			Vector2I& offset);
+
 		/**	Close any elements that were temporarily expanded due to a drag operation hovering over them. */
 		void closeTemporarilyExpandedElements();
 
@@ -285,6 +353,18 @@ namespace BansheeEngine
 
 		Vector<InteractableElement> mVisibleElements;
 
+		bool mIsVirtualized;
+		GUILabel* mRowTemplate;
+		Vector<GUILabel*> mLabelPool;
+		Vector<GUIToggle*> mFoldoutPool;
+		UINT32 mVirtualContentWidth;
+		bool mVirtualContentWidthDirty;
+		Vector<VirtualRow> mVirtualRows;
+		bool mVirtualRowsDirty;
+		bool mVirtualRowsRebuilt;
+		UINT32 mFirstBoundRow;
+		UINT32 mLastBoundRow;
+
 		bool mIsElementSelected;
 		Vector<SelectedElement> mSelectedElements;
 
@@ -313,6 +393,7 @@ namespace BansheeEngine
 		static const UINT32 INDENT_SIZE;
 		static const UINT32 INITIAL_INDENT_OFFSET;
 		static const UINT32 DRAG_MIN_DISTANCE;
+		static const UINT32 VIRTUAL_ROW_MARGIN;
 		static const float AUTO_EXPAND_DELAY_SEC;
 		static const float SCROLL_AREA_HEIGHT_PCT;
 		static const UINT32 SCROLL_SPEED_PX_PER_SEC;
@@ -245,6 +245,14 @@ namespace BansheeEngine
 		 */
 		void renderForPicking(const SPtr<Camera>& camera, std::function<Color(UINT32)> idxToColorCallback);
 
+		/**
+		 * Checks are there any pickable gizmos queued since the last call to clearGizmos(). Allows picking to skip 
+		 * rendering gizmos if there is nothing to pick.
+		 *
+		 * @note	Internal method.
+		 */
+		bool hasPickableGizmos() const;
+
 		/** @} */
 
 	private:
@@ -0,0 +1,73 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Library-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Stores results of resource imports on disk, keyed by the contents of the source file, its import options and the
+	 * version of the importer. This allows a resource to be restored without importing it again, when the same source
+	 * file was previously imported by any project using the same cache folder (e.g. after a fresh checkout, or when
+	 * switching branches).
+	 *
+	 * Each entry is a folder named after its key, containing the resource meta-data along with a copy of every imported
+	 * resource. Entries are never modified once written, so a cache folder can safely be shared between multiple editor
+	 * instances or machines.
+	 */
+	class BS_ED_EXPORT ImportCache
+	{
+	public:
+		/**
+		 * Generates a key that uniquely identifies the results of importing the provided file with the provided options.
+		 *
+		 * @note	Thread safe.
+		 */
+		static String generateKey(const Path& sourcePath, const SPtr<ImportOptions>& importOptions);
+
+		/**
+		 * Looks up the cache entry with the provided key.
+		 *
+		 * @param[in]	cacheFolder		Absolute path to the folder containing the cache.
+		 * @param[in]	key				Key generated by generateKey().
+		 * @return						Meta-data of the resources stored in the entry, or null if the entry doesn't exist.
+		 *
+		 * @note	Thread safe.
+		 */
+		static SPtr<ProjectFileMeta> find(const Path& cacheFolder, const String& key);
+
+		/** Returns the path to the cached copy of the resource with the provided UUID, as stored in the entry meta-data. */
+		static Path getResourcePath(const Path& cacheFolder, const String& key, const String& uuid);
+
+		/**
+		 * Adds a new entry to the cache. Does nothing if an entry with the same key already exists.
+		 *
+		 * @param[in]	cacheFolder		Absolute path to the folder containing the cache.
+		 * @param[in]	key				Key generated by generateKey().
+		 * @param[in]	meta			Meta-data of the imported resources.
+		 * @param[in]	resourcePaths	Paths to the saved resources, in the same order as the resource meta-data in
+		 *								@p meta.
+		 */
+		static void store(const Path& cacheFolder, const String& key, const SPtr<ProjectFileMeta>& meta, 
+			const Vector<Path>& resourcePaths);
+
+		/** 
+		 * Version of the cache layout and key generation. Should be increased whenever either changes, so older entries
+		 * are ignored.
+		 */
+		static const UINT32 VERSION;
+
+	private:
+		/** Returns the path to the folder containing the entry with the provided key. */
+		static Path getEntryFolder(const Path& cacheFolder, const String& key);
+
+		static const WString META_FILENAME;
+	};
+
+	/** @} */
+}
@@ -7,6 +7,8 @@
 
 namespace BansheeEngine
 {
+	struct SubResourceRaw;
+
 	/** @addtogroup Library
 	 *  @{
 	 */
@@ -60,6 +62,7 @@ namespace BansheeEngine
 			DirectoryEntry(const Path& path, const WString& name, DirectoryEntry* parent);
 
 			Vector<LibraryEntry*> mChildren; /**< Child files or folders. */
+			std::time_t lastScanTime; /**< Timestamp of when we last matched the children against the file system. */
 		};
 
 	public:
@@ -81,7 +84,8 @@ namespace BansheeEngine
 		 *
 		 * @param[in]	path			Absolute path of the file or folder to check. If a folder is provided all its 
 		 *								children will be checked recursively.
-		 * @param[in]	import			Should the dirty resources be automatically reimported.
+		 * @param[in]	import			Should the dirty resources be automatically reimported. Resources are imported in
+		 *								parallel on the task scheduler, after all the modifications have been found.
 		 * @param[in]	dirtyResources	A list of resources that should be reimported.
 		 */
 		void checkForModifications(const Path& path, bool import, Vector<Path>& dirtyResources);
@@ -233,6 +237,14 @@ namespace BansheeEngine
 		/** Returns the path to the project's resource folder where all the assets are stored. */
 		const Path& getResourcesFolder() const { return mResourcesFolder; }
 
+		/** 
+		 * Returns the path to the folder where imported resources are cached. This is the folder set in editor settings
+		 * if one is set, or a folder within the project's internal folder otherwise.
+		 *
+		 * @see		ImportCache
+		 */
+		Path getImportCacheFolder() const;
+
 		/**
 		 * Saves all the project library data so it may be restored later, at the default save location in the project
 		 * folder. Project must be loaded when calling this.
@@ -257,6 +269,13 @@ namespace BansheeEngine
 		/** Triggered when a resource is being (re)imported. Path provided is absolute. */
 		Event<void(const Path&)> onEntryImported; 
 
+		/**
+		 * Triggered when a resource finishes importing as a part of a batch started by checkForModifications(). Provides
+		 * the absolute path to the resource, the number of resources imported so far and the total number of resources
+		 * in the batch.
+		 */
+		Event<void(const Path&, UINT32, UINT32)> onImportProgress;
+
 		/** @name Internal 
 		 *  @{
 		 */
@@ -264,11 +283,31 @@ namespace BansheeEngine
 		/**	Returns the resource manifest managed by the project library. */
 		const SPtr<ResourceManifest>& _getManifest() const { return mResourceManifest; }
 
+		/**
+		 * Checks do the children of a directory entry need to be matched against the file system. This is the case if
+		 * the directory was never scanned, or if a child was added, removed or renamed since its last scan.
+		 */
+		static bool _isScanRequired(const DirectoryEntry& entry);
+
 		/** @} */
 
 		static const Path RESOURCES_DIR;
 		static const Path INTERNAL_RESOURCES_DIR;
 	private:
+		/** Resource whose import was deferred until the end of checkForModifications(). */
+		struct QueuedImport
+		{
+			FileEntry* entry;
+			SPtr<ImportOptions> importOptions;
+			bool pruneResourceMetas;
+		};
+
+		/** 
+		 * Performs the work of checkForModifications(const Path&, bool, Vector<Path>&), except that resources are only
+		 * queued for import instead of being imported immediately.
+		 */
+		void checkForModificationsInternal(const Path& path, bool import, Vector<Path>& dirtyResources);
+
 		/**
 		 * Common code for adding a new resource entry to the library.
 		 *
@@ -327,6 +366,47 @@ namespace BansheeEngine
 		void reimportResourceInternal(FileEntry* file, const SPtr<ImportOptions>& importOptions = nullptr, 
 			bool forceReimport = false, bool pruneResourceMetas = false);
 
+		/**
+		 * Updates the library entry, its meta-data and the internal resources after the raw resources were imported from
+		 * the file.
+		 *
+		 * @param[in]	file				Entry of the imported resource.
+		 * @param[in]	importOptions		Import options the resources were imported with.
+		 * @param[in]	importedResources	Raw resources output by the importer. Ignored for native resources.
+		 * @param[in]	pruneResourceMetas	@see reimportResourceInternal
+		 */
+		void finishImport(FileEntry* file, const SPtr<ImportOptions>& importOptions, 
+			const Vector<SubResourceRaw>& importedResources, bool pruneResourceMetas);
+
+		/**
+		 * Imports all the resources queued during checkForModifications(). Resources are split into groups so that
+		 * resources are imported after any resources they are known to depend on, and resources within a group are
+		 * imported in parallel. Library data is saved once all of them are done.
+		 */
+		void importQueued();
+
+		/**
+		 * Restores resources of a file from an import cache entry, instead of importing them. Entry meta-data and the
+		 * internal resources are updated the same as in finishImport().
+		 *
+		 * @param[in]	file				Entry of the resource to restore.
+		 * @param[in]	importOptions		Import options the cached resources were imported with.
+		 * @param[in]	cachedMeta			Meta-data of the cache entry, as returned by ImportCache::find().
+		 * @param[in]	cacheKey			Key of the cache entry.
+		 * @param[in]	pruneResourceMetas	@see reimportResourceInternal
+		 * @return							True if the resources were restored. False if any of the cached resources is
+		 *									missing or if the resources are currently loaded, in which case nothing was
+		 *									modified and the file should be imported normally.
+		 */
+		bool restoreFromCache(FileEntry* file, const SPtr<ImportOptions>& importOptions, 
+			const SPtr<ProjectFileMeta>& cachedMeta, const String& cacheKey, bool pruneResourceMetas);
+
+		/** 
+		 * Stores the resources of a file in the import cache, after they were imported. Resources that reference other 
+		 * resources are not cached, as the references are specific to the project.
+		 */
+		void storeInCache(FileEntry* file, const String& cacheKey);
+
 		/**
 		 * Creates a full hierarchy of directory entries up to the provided directory, if any are needed.
 		 *
@@ -391,6 +471,10 @@ namespace BansheeEngine
 
 		UnorderedMap<Path, Vector<Path>> mDependencies;
 		UnorderedMap<String, Path> mUUIDToPath;
+
+		bool mIsQueueingImports;
+		Vector<QueuedImport> mQueuedImports;
+		UnorderedSet<Path> mPendingImports;
 	};
 
 	/**	Provides easy access to ProjectLibrary. */
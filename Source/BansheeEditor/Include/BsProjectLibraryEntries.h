@@ -22,20 +22,28 @@ namespace BansheeEngine
 
 	public:
 		explicit ProjectLibraryEntries(const ConstructPrivately& dummy);
-		ProjectLibraryEntries(const ProjectLibrary::DirectoryEntry& rootEntry);
+		ProjectLibraryEntries(const ProjectLibrary::DirectoryEntry& rootEntry, 
+			const UnorderedMap<Path, UINT64>& directoryScanTimes);
 
 		/**
 		 * Creates new project library entries based on a ProjectLibrary root directory entry.
 		 *
-		 * @param[in]	rootEntry	Root directory entry in ProjectLibrary.
+		 * @param[in]	rootEntry			Root directory entry in ProjectLibrary.
+		 * @param[in]	directoryScanTimes	Scan journal containing times at which directory contents were last matched
+		 *									against the file system, mapped by directory path.
 		 */
-		static SPtr<ProjectLibraryEntries> create(const ProjectLibrary::DirectoryEntry& rootEntry);
+		static SPtr<ProjectLibraryEntries> create(const ProjectLibrary::DirectoryEntry& rootEntry, 
+			const UnorderedMap<Path, UINT64>& directoryScanTimes);
 		
 		/**	Returns the root directory entry that references the entire entry hierarchy. */
 		const ProjectLibrary::DirectoryEntry& getRootEntry() const { return mRootEntry; }
 
+		/** Returns the times at which directory contents were last matched against the file system. */
+		const UnorderedMap<Path, UINT64>& getDirectoryScanTimes() const { return mDirectoryScanTimes; }
+
 	private:
 		ProjectLibrary::DirectoryEntry mRootEntry;
+		UnorderedMap<Path, UINT64> mDirectoryScanTimes;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
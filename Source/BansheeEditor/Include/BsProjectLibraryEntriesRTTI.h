@@ -19,10 +19,15 @@ namespace BansheeEngine
 		ProjectLibrary::DirectoryEntry& getRootElement(ProjectLibraryEntries* obj) { return obj->mRootEntry; }
 		void setRootElement(ProjectLibraryEntries* obj, ProjectLibrary::DirectoryEntry& val) { obj->mRootEntry = val; } 
 
+		UnorderedMap<Path, UINT64>& getDirectoryScanTimes(ProjectLibraryEntries* obj) { return obj->mDirectoryScanTimes; }
+		void setDirectoryScanTimes(ProjectLibraryEntries* obj, UnorderedMap<Path, UINT64>& val) { obj->mDirectoryScanTimes = val; }
+
 	public:
 		ProjectLibraryEntriesRTTI()
 		{
 			addPlainField("mRootElement", 0, &ProjectLibraryEntriesRTTI::getRootElement, &ProjectLibraryEntriesRTTI::setRootElement);
+			addPlainField("mDirectoryScanTimes", 1, &ProjectLibraryEntriesRTTI::getDirectoryScanTimes, 
+				&ProjectLibraryEntriesRTTI::setDirectoryScanTimes);
 		}
 
 		virtual const String& getRTTIName()
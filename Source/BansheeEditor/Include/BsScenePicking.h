@@ -6,6 +6,8 @@
 #include "BsModule.h"
 #include "BsMatrix4.h"
 #include "BsGpuParam.h"
+#include "BsBVH.h"
+#include "BsAsyncOp.h"
 
 namespace BansheeEngine
 {
@@ -44,6 +46,36 @@ namespace BansheeEngine
 			HTexture mainTexture;
 		};
 
+		/** Renderable that can be picked on the CPU, along with the state of its material relevant for picking. */
+		struct PickableSource
+		{
+			HSceneObject sceneObject;
+			HMesh mesh;
+			CullingMode cullMode;
+		};
+
+		/** Contains information about a single renderable referenced by the hierarchy used for CPU picking. */
+		struct PickableRenderable
+		{
+			HSceneObject sceneObject;
+			Mesh* mesh;
+			SPtr<MeshBVH> meshBVH;
+			Matrix4 worldTfrm;
+			Matrix4 invWorldTfrm;
+			UINT32 tfrmHash;
+			CullingMode cullMode; /**< Cull mode of the material, adjusted for mirroring by the world transform. */
+		};
+
+		/** Triangle hierarchy of a single mesh, cached so it only needs to be built once per mesh. */
+		struct MeshBVHEntry
+		{
+			std::weak_ptr<Mesh> mesh;
+			SPtr<MeshBVH> bvh;
+
+			SPtr<MeshData> readData; /**< Buffer the mesh data is being read into, while the read is in progress. */
+			AsyncOp readOp;
+		};
+
 	public:
 		ScenePicking();
 		~ScenePicking();
@@ -64,8 +96,8 @@ namespace BansheeEngine
 			Vector<HSceneObject>& ignoreRenderables, SnapData* data = nullptr);
 
 		/**
-		 * Attempts to find all scene objects under the provided position and area. This does not mean objects occluded by
-		 * other objects.
+		 * Attempts to find all scene objects under the provided position and area. This does not include objects occluded
+		 * by other objects. CPU picking returns the renderables sorted from nearest to furthest.
 		 *
 		 * @param[in]	cam					Camera to perform the picking from.
 		 * @param[in]	position			Pointer position relative to the camera viewport, in pixels.
@@ -78,6 +110,23 @@ namespace BansheeEngine
 		Vector<HSceneObject> pickObjects(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area, 
 			Vector<HSceneObject>& ignoreRenderables, SnapData* data = nullptr);
 
+		/** 
+		 * Determines should renderables be picked by querying their geometry on the CPU, or by rendering them and reading
+		 * back the result from the GPU. Gizmos are always picked on the GPU, as well as renderables whose materials use
+		 * alpha blending (tested against the alpha cutoff) or whose sub-meshes use different cull modes. Renderables
+		 * picked on the GPU don't occlude the ones picked on the CPU, and vice versa. Enabled by default.
+		 */
+		void setCPUPicking(bool enabled) { mCPUPicking = enabled; }
+
+		/** @copydoc setCPUPicking */
+		bool getCPUPicking() const { return mCPUPicking; }
+
+		/** 
+		 * Starts reading back the data of meshes used by any newly added renderables, so their triangle hierarchies are
+		 * ready by the time they need to be picked. Should be called once per frame.
+		 */
+		void update();
+
 	private:
 		friend class ScenePickingCore;
 
@@ -89,7 +138,80 @@ namespace BansheeEngine
 		/** Decodes a color into a unique object identifier. Color should have initially been encoded with encodeIndex(). */
 		static UINT32 decodeIndex(Color color);
 
+		/**
+		 * Picks objects by rendering them into an off-screen target and reading the result back on the CPU. 
+		 *
+		 * @param[in]	cam					Camera to perform the picking from.
+		 * @param[in]	position			Pointer position relative to the camera viewport, in pixels.
+		 * @param[in]	area				Width/height of the checked area in pixels.
+		 * @param[in]	ignoreRenderables	A list of objects that should be ignored during scene picking.
+		 * @param[out]	data				Picking data regarding position and normal.
+		 * @param[in]	allRenderables		If false only gizmos and the renderables that can't be picked on the CPU are
+		 *									rendered.
+		 * @return							A list of SceneObject%s under the provided area.
+		 */
+		Vector<HSceneObject> pickObjectsGPU(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area, 
+			Vector<HSceneObject>& ignoreRenderables, SnapData* data, bool allRenderables);
+
+		/**
+		 * Picks renderables by testing their geometry on the CPU. Single pixel areas are tested with a ray and return
+		 * at most one object, while larger areas return all objects visible in at least one of the area pixels.
+		 *
+		 * @param[in]	cam					Camera to perform the picking from.
+		 * @param[in]	position			Pointer position relative to the camera viewport, in pixels.
+		 * @param[in]	area				Width/height of the checked area in pixels.
+		 * @param[in]	ignoreRenderables	A list of objects that should be ignored during scene picking.
+		 * @param[out]	data				Optional picking data regarding position and normal. Only written to if the ray
+		 *									under @p position hits an object.
+		 * @param[out]	results				List to append the picked objects to.
+		 */
+		void pickObjectsCPU(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area, 
+			Vector<HSceneObject>& ignoreRenderables, SnapData* data, Vector<HSceneObject>& results);
+
+		/** 
+		 * Updates the list of pickable renderables and rebuilds the scene hierarchy over them, if any renderables were
+		 * added, removed, moved or had their mesh changed since the last call.
+		 */
+		void updatePickableRenderables();
+
+		/** Finds all renderables that can be picked on the CPU, along with their meshes. */
+		void findPickableRenderables(Vector<PickableSource>& output) const;
+
+		/** 
+		 * Determines the cull mode used when picking a renderable on the CPU. Returns false if the renderable must be 
+		 * picked on the GPU instead, because its materials require alpha testing or its sub-meshes use different cull
+		 * modes.
+		 */
+		static bool getCPUPickingState(const Renderable& renderable, CullingMode& cullMode);
+
+		/** Determines the cull mode and whether alpha testing is required when rendering a material for picking. */
+		static void getPickingState(const HMaterial& material, bool& alpha, CullingMode& cullMode);
+
+		/**
+		 * Builds triangle hierarchies for any of the provided meshes that don't have one yet. Meshes with CPU cached data
+		 * are processed immediately, while others have their data read back from the core thread without waiting on it.
+		 *
+		 * @param[in]	renderables		Renderables whose meshes to process.
+		 * @return						True if any hierarchy was finished building since the last call.
+		 */
+		bool updateMeshBVHs(const Vector<PickableSource>& renderables);
+
+		/** 
+		 * Finds the pickable renderable hit closest to the ray origin. Returns -1 if nothing was hit. Renderables whose
+		 * mesh data is still being read back are tested using their bounds. Returned normal is in world space.
+		 */
+		INT32 findClosestHit(const Ray& ray, const Vector<HSceneObject>& ignoreRenderables, float& distance, 
+			Vector3& normal) const;
+
+		/** Checks is the provided object present in the ignore list. */
+		static bool isIgnored(const HSceneObject& so, const Vector<HSceneObject>& ignoreRenderables);
+
 		ScenePickingCore* mCore;
+		bool mCPUPicking;
+
+		Vector<PickableRenderable> mPickables;
+		BVH mSceneBVH;
+		UnorderedMap<Mesh*, MeshBVHEntry> mMeshBVHs;
 	};
 
 	/** @} */
@@ -114,6 +236,9 @@ namespace BansheeEngine
 			GpuParamColorCore mParamPickingColor;
 			GpuParamColorCore mParamPickingAlphaColor;
 			GpuParamTextureCore mParamPickingAlphaTexture;
+			GpuParamFloatCore mParamPickingOctahedralNormals;
+			GpuParamFloatCore mParamPickingAlphaOctahedralNormals;
+			GpuParamVec4Core mParamPickingAlphaUVScaleOffset;
 		};
 
 	public:
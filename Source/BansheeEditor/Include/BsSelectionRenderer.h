@@ -84,6 +84,7 @@ namespace BansheeEngine
 		GpuParamMat4Core mMatWorldViewProj[2];
 		GpuParamColorCore mColor[2];
 		GpuParamBufferCore mBoneMatrices;
+		GpuParamMat4Core mDecodePosition;
 
 		UINT32 mDefaultTechniqueIdx;
 		UINT32 mAnimatedTechniqueIdx;
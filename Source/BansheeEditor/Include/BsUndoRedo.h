@@ -68,6 +68,19 @@ namespace BansheeEngine
 		/**	Resets the undo/redo stacks. */
 		void clear();
 
+		/**
+		 * Sets the maximum number of bytes the commands on the undo and redo stacks are allowed to use. Once exceeded the
+		 * oldest commands are removed from the undo stack when new commands are registered. Commands within undo/redo
+		 * groups are never removed in this manner.
+		 */
+		void setMemoryBudget(UINT32 budget) { mMemoryBudget = budget; }
+
+		/** Returns the maximum number of bytes the commands on the undo and redo stacks are allowed to use. */
+		UINT32 getMemoryBudget() const { return mMemoryBudget; }
+
+		/** Returns the approximate number of bytes used by all the commands on the undo and redo stacks. */
+		UINT32 getMemoryUsage() const;
+
 	private:
 		/**	Removes the last undo command from the undo stack, and returns it. */
 		EditorCommand* removeLastFromUndoStack();
@@ -81,7 +94,11 @@ namespace BansheeEngine
 		/**	Removes all entries from the redo stack. */
 		void clearRedoStack();
 
+		/** Removes the oldest commands from the undo stack until the memory used by the commands fits the budget. */
+		void enforceMemoryBudget();
+
 		static const UINT32 MAX_STACK_ELEMENTS;
+		static const UINT32 DEFAULT_MEMORY_BUDGET;
 
 		EditorCommand** mUndoStack;
 		EditorCommand** mRedoStack;
@@ -93,6 +110,7 @@ namespace BansheeEngine
 		UINT32 mRedoNumElements;
 
 		UINT32 mNextCommandId;
+		UINT32 mMemoryBudget;
 
 		Stack<GroupData> mGroups;
 	};
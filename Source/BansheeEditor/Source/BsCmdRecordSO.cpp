@@ -4,12 +4,17 @@
 #include "BsSceneObject.h"
 #include "BsComponent.h"
 #include "BsMemorySerializer.h"
+#include "BsBinarySerializer.h"
+#include "BsBinaryDiff.h"
+#include "BsPrefabDiff.h"
+#include "BsDataStream.h"
+#include "BsSerializedObject.h"
 
 namespace BansheeEngine
 {
 	CmdRecordSO::CmdRecordSO(const WString& description, const HSceneObject& sceneObject, bool recordHierarchy)
 		: EditorCommand(description), mSceneObject(sceneObject), mRecordHierarchy(recordHierarchy)
-		, mSerializedObject(nullptr), mSerializedObjectSize(0)
+		, mSerializedObject(nullptr), mSerializedObjectSize(0), mHasDiff(false)
 	{
 
 	}
@@ -29,6 +34,12 @@ namespace BansheeEngine
 			bs_free(mSerializedObject);
 			mSerializedObject = nullptr;
 		}
+
+		mRecordedState.clear();
+
+		clearDiff(mUndoDiff);
+		clearDiff(mRedoDiff);
+		mHasDiff = false;
 	}
 
 	void CmdRecordSO::execute(const HSceneObject& sceneObject, bool recordHierarchy, const WString& description)
@@ -41,6 +52,15 @@ namespace BansheeEngine
 
 	void CmdRecordSO::commit()
 	{
+		// Re-applying the change after it was undone
+		if (mHasDiff)
+		{
+			if (mSceneObject != nullptr && !mSceneObject.isDestroyed())
+				applyDiff(mRedoDiff);
+
+			return;
+		}
+
 		clear();
 
 		if (mSceneObject == nullptr || mSceneObject.isDestroyed())
@@ -54,6 +74,14 @@ namespace BansheeEngine
 		if (mSceneObject == nullptr || mSceneObject.isDestroyed())
 			return;
 
+		compact();
+
+		if (mHasDiff)
+		{
+			applyDiff(mUndoDiff);
+			return;
+		}
+
 		HSceneObject parent = mSceneObject->getParent();
 
 		UINT32 numChildren = mSceneObject->getNumChildren();
@@ -89,6 +117,115 @@ namespace BansheeEngine
 		}
 	}
 
+	void CmdRecordSO::compact()
+	{
+		if (mHasDiff || mRecordedState.empty())
+			return;
+
+		if (mSceneObject == nullptr || mSceneObject.isDestroyed())
+			return;
+
+		Vector<ObjectState> currentState;
+		recordState(currentState, false);
+
+		// Differences can only be applied in-place if no objects or components were added or removed
+		bool sameStructure = currentState.size() == mRecordedState.size();
+		for (UINT32 i = 0; sameStructure && i < (UINT32)currentState.size(); i++)
+		{
+			const ObjectState& current = currentState[i];
+			const ObjectState& recorded = mRecordedState[i];
+
+			if (current.id != recorded.id || current.children != recorded.children ||
+				current.components.size() != recorded.components.size())
+			{
+				sameStructure = false;
+				break;
+			}
+
+			for (UINT32 j = 0; j < (UINT32)current.components.size(); j++)
+			{
+				if (current.components[j].id != recorded.components[j].id)
+				{
+					sameStructure = false;
+					break;
+				}
+			}
+		}
+
+		// Recorded component data is only extracted from the serialized object now, so the object doesn't need to be
+		// serialized twice when the command is executed
+		if (sameStructure)
+			sameStructure = readRecordedComponents();
+
+		if (!sameStructure)
+		{
+			// Object will be restored from the serialized data instead
+			mRecordedState.clear();
+			return;
+		}
+
+		currentState.clear();
+		recordState(currentState, true);
+
+		generateDiff(currentState, mRecordedState, mUndoDiff);
+		generateDiff(mRecordedState, currentState, mRedoDiff);
+		mHasDiff = true;
+
+		// Full state is no longer needed, as the objects are never re-created
+		mRecordedState.clear();
+		mSceneObjectProxy = EditorUtility::SceneObjProxy();
+
+		if (mSerializedObject != nullptr)
+		{
+			bs_free(mSerializedObject);
+			mSerializedObject = nullptr;
+		}
+
+		mSerializedObjectSize = 0;
+	}
+
+	UINT32 CmdRecordSO::getMemoryUsage() const
+	{
+		UINT32 memoryUsage = mSerializedObjectSize;
+
+		// Recorded state only exists until the command is compacted, and holds no component data until then
+		for (auto& state : mRecordedState)
+		{
+			memoryUsage += sizeof(ObjectState) + (UINT32)state.name.size();
+			memoryUsage += (UINT32)(state.components.size() * sizeof(ComponentState));
+			memoryUsage += (UINT32)(state.children.size() * sizeof(UINT64));
+		}
+
+		// Proxy is kept as long as the object might need to be restored from the serialized data
+		Stack<const EditorUtility::SceneObjProxy*> todo;
+		todo.push(&mSceneObjectProxy);
+
+		while (!todo.empty())
+		{
+			const EditorUtility::SceneObjProxy* proxy = todo.top();
+			todo.pop();
+
+			memoryUsage += sizeof(EditorUtility::SceneObjProxy);
+			memoryUsage += (UINT32)(proxy->componentInstanceData.size() * sizeof(GameObjectInstanceDataPtr));
+
+			for (auto& child : proxy->children)
+				todo.push(&child);
+		}
+
+		for (auto& diffs : { &mUndoDiff, &mRedoDiff })
+		{
+			for (auto& objectDiff : *diffs)
+			{
+				memoryUsage += sizeof(ObjectDiff) + (UINT32)objectDiff.name.size();
+
+				for (auto& componentDiff : objectDiff.components)
+					memoryUsage += sizeof(ComponentDiff) + componentDiff.size;
+			}
+		}
+
+		return memoryUsage;
+	}
+
 	void CmdRecordSO::recordSO(const HSceneObject& sceneObject)
 	{
 		UINT32 numChildren = mSceneObject->getNumChildren();
@@ -118,5 +255,259 @@ namespace BansheeEngine
 
 			bs_stack_delete(children, numChildren);
 		}
+
+		recordState(mRecordedState, false);
+	}
+
+	void CmdRecordSO::recordState(Vector<ObjectState>& output, bool recordComponentData) const
+	{
+		Stack<HSceneObject> todo;
+		todo.push(mSceneObject);
+
+		while (!todo.empty())
+		{
+			HSceneObject current = todo.top();
+			todo.pop();
+
+			output.push_back(ObjectState());
+			ObjectState& state = output.back();
+
+			state.id = current->getInstanceId();
+			state.name = current->getName();
+			state.position = current->getPosition();
+			state.rotation = current->getRotation();
+			state.scale = current->getScale();
+			state.active = current->getActive(true);
+
+			const Vector<HComponent>& components = current->getComponents();
+			for (auto& component : components)
+			{
+				ComponentState componentState;
+				componentState.id = component->getInstanceId();
+
+				if (recordComponentData)
+				{
+					BinarySerializer bs;
+					componentState.data = bs._encodeToIntermediate(component.get());
+				}
+
+				state.components.push_back(componentState);
+			}
+
+			if (mRecordHierarchy)
+			{
+				UINT32 numChildren = current->getNumChildren();
+				for (UINT32 i = 0; i < numChildren; i++)
+				{
+					HSceneObject child = current->getChild(i);
+					state.children.push_back(child->getInstanceId());
+				}
+
+				for (UINT32 i = numChildren; i > 0; i--)
+					todo.push(current->getChild(i - 1));
+			}
+		}
+	}
+
+	bool CmdRecordSO::readRecordedComponents()
+	{
+		if (mSerializedObject == nullptr)
+			return false;
+
+		SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>(mSerializedObject, mSerializedObjectSize, false);
+
+		BinarySerializer bs;
+		SPtr<SerializedObject> serializedSO = bs._decodeToIntermediate(stream, mSerializedObjectSize, true);
+		if (serializedSO == nullptr)
+			return false;
+
+		RTTITypeBase* soRTTI = SceneObject::getRTTIStatic();
+		UINT32 soTypeId = soRTTI->getRTTIId();
+		UINT32 childrenFieldId = soRTTI->findField("mChildren")->mUniqueId;
+		UINT32 componentsFieldId = soRTTI->findField("mComponents")->mUniqueId;
+
+		auto findArray = [&](const SPtr<SerializedObject>& object, UINT32 fieldId) -> SPtr<SerializedArray>
+		{
+			for (auto& subObject : object->subObjects)
+			{
+				if (subObject.typeId != soTypeId)
+					continue;
+
+				auto iterFind = subObject.entries.find(fieldId);
+				if (iterFind != subObject.entries.end())
+					return std::static_pointer_cast<SerializedArray>(iterFind->second.serialized);
+
+				break;
+			}
+
+			return nullptr;
+		};
+
+		// Objects are visited in the same order as in recordState()
+		Stack<SPtr<SerializedObject>> todo;
+		todo.push(serializedSO);
+
+		UINT32 stateIdx = 0;
+		while (!todo.empty())
+		{
+			SPtr<SerializedObject> current = todo.top();
+			todo.pop();
+
+			if (current == nullptr || stateIdx >= (UINT32)mRecordedState.size())
+				return false;
+
+			ObjectState& state = mRecordedState[stateIdx++];
+
+			SPtr<SerializedArray> components = findArray(current, componentsFieldId);
+			UINT32 numComponents = components != nullptr ? components->numElements : 0;
+			if (numComponents != (UINT32)state.components.size())
+				return false;
+
+			for (UINT32 i = 0; i < numComponents; i++)
+			{
+				auto iterFind = components->entries.find(i);
+				if (iterFind == components->entries.end())
+					return false;
+
+				state.components[i].data = std::static_pointer_cast<SerializedObject>(iterFind->second.serialized);
+			}
+
+			if (mRecordHierarchy)
+			{
+				SPtr<SerializedArray> children = findArray(current, childrenFieldId);
+				UINT32 numChildren = children != nullptr ? children->numElements : 0;
+
+				for (UINT32 i = numChildren; i > 0; i--)
+				{
+					auto iterFind = children->entries.find(i - 1);
+					if (iterFind == children->entries.end())
+						return false;
+
+					todo.push(std::static_pointer_cast<SerializedObject>(iterFind->second.serialized));
+				}
+			}
+		}
+
+		return stateIdx == (UINT32)mRecordedState.size();
+	}
+
+	void CmdRecordSO::generateDiff(const Vector<ObjectState>& from, const Vector<ObjectState>& to, Vector<ObjectDiff>& output)
+	{
+		for (UINT32 i = 0; i < (UINT32)to.size(); i++)
+		{
+			const ObjectState& fromState = from[i];
+			const ObjectState& toState = to[i];
+
+			ObjectDiff diff;
+			diff.id = toState.id;
+			diff.flags = 0;
+			diff.active = toState.active;
+
+			if (fromState.name != toState.name)
+			{
+				diff.name = toState.name;
+				diff.flags |= (UINT32)SceneObjectDiffFlags::Name;
+			}
+
+			if (fromState.position != toState.position)
+			{
+				diff.position = toState.position;
+				diff.flags |= (UINT32)SceneObjectDiffFlags::Position;
+			}
+
+			if (fromState.rotation != toState.rotation)
+			{
+				diff.rotation = toState.rotation;
+				diff.flags |= (UINT32)SceneObjectDiffFlags::Rotation;
+			}
+
+			if (fromState.scale != toState.scale)
+			{
+				diff.scale = toState.scale;
+				diff.flags |= (UINT32)SceneObjectDiffFlags::Scale;
+			}
+
+			if (fromState.active != toState.active)
+				diff.flags |= (UINT32)SceneObjectDiffFlags::Active;
+
+			for (UINT32 j = 0; j < (UINT32)toState.components.size(); j++)
+			{
+				const ComponentState& fromComponent = fromState.components[j];
+				const ComponentState& toComponent = toState.components[j];
+
+				RTTITypeBase* rtti = IReflectable::_getRTTIfromTypeId(toComponent.data->getRootTypeId());
+				IDiff& diffHandler = rtti->getDiffHandler();
+
+				SPtr<SerializedObject> componentDiff = diffHandler.generateDiff(fromComponent.data, toComponent.data);
+				if (componentDiff == nullptr)
+					continue;
+
+				ComponentDiff entry;
+				entry.id = toComponent.id;
+
+				MemorySerializer serializer;
+				entry.data = serializer.encode(componentDiff.get(), entry.size);
+
+				diff.components.push_back(entry);
+			}
+
+			if (diff.flags != 0 || !diff.components.empty())
+				output.push_back(diff);
+		}
+	}
+
+	void CmdRecordSO::applyDiff(const Vector<ObjectDiff>& diff)
+	{
+		GameObjectManager::instance().setDeserializationMode(GODM_RestoreExternal | GODM_UseNewIds);
+		GameObjectManager::instance().startDeserialization();
+
+		for (auto& objectDiff : diff)
+		{
+			HSceneObject so = GameObjectManager::instance().getObject(objectDiff.id);
+			if (so == nullptr || so.isDestroyed())
+				continue;
+
+			if ((objectDiff.flags & (UINT32)SceneObjectDiffFlags::Name) != 0)
+				so->setName(objectDiff.name);
+
+			if ((objectDiff.flags & (UINT32)SceneObjectDiffFlags::Position) != 0)
+				so->setPosition(objectDiff.position);
+
+			if ((objectDiff.flags & (UINT32)SceneObjectDiffFlags::Rotation) != 0)
+				so->setRotation(objectDiff.rotation);
+
+			if ((objectDiff.flags & (UINT32)SceneObjectDiffFlags::Scale) != 0)
+				so->setScale(objectDiff.scale);
+
+			if ((objectDiff.flags & (UINT32)SceneObjectDiffFlags::Active) != 0)
+				so->setActive(objectDiff.active);
+
+			for (auto& componentDiff : objectDiff.components)
+			{
+				HComponent component = GameObjectManager::instance().getObject(componentDiff.id);
+				if (component == nullptr || component.isDestroyed())
+					continue;
+
+				MemorySerializer serializer;
+				SPtr<SerializedObject> diffData = std::static_pointer_cast<SerializedObject>(
+					serializer.decode(componentDiff.data, componentDiff.size));
+
+				IDiff& diffHandler = component->getRTTI()->getDiffHandler();
+				diffHandler.applyDiff(component.getInternalPtr(), diffData);
+			}
+		}
+
+		GameObjectManager::instance().endDeserialization();
+	}
+
+	void CmdRecordSO::clearDiff(Vector<ObjectDiff>& diff)
+	{
+		for (auto& objectDiff : diff)
+		{
+			for (auto& componentDiff : objectDiff.components)
+				bs_free(componentDiff.data);
+		}
+
+		diff.clear();
 	}
 }
\ No newline at end of file
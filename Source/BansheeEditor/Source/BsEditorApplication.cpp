@@ -156,6 +156,7 @@ namespace BansheeEngine
 
 		EditorWidgetManager::instance().update();
 		DropDownWindowManager::instance().update();
+		ScenePicking::instance().update();
 	}
 
 	void EditorApplication::postUpdate()
@@ -0,0 +1,264 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsEditorBenchmarkSuite.h"
+#include "BsEditorTestSuite.h"
+#include "BsTextLayoutCache.h"
+#include "BsFont.h"
+#include "BsTimer.h"
+#include "BsDebug.h"
+#include "BsAnimationClip.h"
+#include "BsAnimationCompression.h"
+#include "BsSkeleton.h"
+#include "BsSkeletonMask.h"
+#include "BsMeshUtility.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsVector4.h"
+
+namespace BansheeEngine
+{
+	EditorBenchmarkSuite::EditorBenchmarkSuite()
+	{
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkTextLayoutCache)
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkAnimationCompression)
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkSkeletonPose)
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkSkinVertices)
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkTangentSpace)
+	}
+
+	void EditorBenchmarkSuite::BenchmarkTextLayoutCache()
+	{
+		static const UINT32 NUM_ITERATIONS = 1000;
+
+		TEXT_SPRITE_DESC desc;
+		desc.font = createTestFont(10);
+		desc.fontSize = 10;
+		desc.width = 200;
+		desc.height = 20;
+
+		TextLayoutCache cache(16 * 1024 * 1024);
+		Timer timer;
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+		{
+			desc.text = L"layout row " + toWString(i);
+			cache.getLayout(desc);
+		}
+
+		UINT64 missTime = timer.getMicroseconds();
+
+		timer.reset();
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+		{
+			desc.text = L"layout row " + toWString(i);
+			cache.getLayout(desc);
+		}
+
+		UINT64 hitTime = timer.getMicroseconds();
+		BS_TEST_ASSERT(cache.getNumHits() == NUM_ITERATIONS && cache.getNumMisses() == NUM_ITERATIONS);
+
+		LOGDBG("Text layout of " + toString(NUM_ITERATIONS) + " strings: " + toString(missTime) + " us uncached, " + 
+			toString(hitTime) + " us cached.");
+	}
+
+	void EditorBenchmarkSuite::BenchmarkAnimationCompression()
+	{
+		static const UINT32 NUM_CURVES = 50;
+		static const UINT32 NUM_KEYS = 300;
+		static const float KEY_INTERVAL = 1.0f / 30.0f;
+		static const UINT32 NUM_ITERATIONS = 10;
+
+		AnimationCurves original;
+		createTestAnimationCurves(NUM_CURVES, NUM_KEYS, KEY_INTERVAL, original);
+
+		AnimationCurves compressed = original;
+
+		Timer timer;
+		AnimationCompressionStats stats = AnimationCompression::compress(compressed);
+		UINT64 compressTime = timer.getMicroseconds();
+
+		auto evaluateAll = [&](const AnimationCurves& curves)
+		{
+			Vector<TCurveCache<Vector3>> positionCaches(NUM_CURVES);
+			Vector<TCurveCache<Quaternion>> rotationCaches(NUM_CURVES);
+
+			Vector3 positionSum = Vector3::ZERO;
+			Quaternion rotationSum(0.0f, 0.0f, 0.0f, 0.0f);
+			for (UINT32 j = 0; j < NUM_KEYS * 2; j++)
+			{
+				float t = j * KEY_INTERVAL * 0.5f;
+				for (UINT32 i = 0; i < NUM_CURVES; i++)
+				{
+					positionSum += curves.evaluatePosition(i, t, positionCaches[i], false);
+					rotationSum = rotationSum + curves.evaluateRotation(i, t, rotationCaches[i], false);
+				}
+			}
+
+			return positionSum.x + rotationSum.w;
+		};
+
+		// Checksum keeps the evaluation from being optimized out
+		float checksum = 0.0f;
+		timer.reset();
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			checksum += evaluateAll(original);
+
+		UINT64 originalTime = timer.getMicroseconds();
+
+		timer.reset();
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			checksum += evaluateAll(compressed);
+
+		UINT64 compressedTime = timer.getMicroseconds();
+
+		LOGDBG("Animation compression of " + toString(NUM_CURVES * 2) + " curves: " + toString(stats.originalSize) + 
+			" bytes to " + toString(stats.compressedSize) + " bytes in " + toString(compressTime) + " us. Evaluation: " + 
+			toString(originalTime) + " us original, " + toString(compressedTime) + " us compressed (checksum " + 
+			toString(checksum) + ").");
+	}
+
+	void EditorBenchmarkSuite::BenchmarkSkeletonPose()
+	{
+		static const UINT32 NUM_KEYS = 30;
+		static const float KEY_INTERVAL = 1.0f / 30.0f;
+		static const UINT32 NUM_ITERATIONS = 1000;
+
+		UINT32 rigSizes[] = { 50, 150, 300 };
+		for (auto numBones : rigSizes)
+		{
+			Vector<BONE_DESC> bones;
+			SPtr<AnimationCurves> curves = bs_shared_ptr_new<AnimationCurves>();
+			createTestRig(numBones, NUM_KEYS, KEY_INTERVAL, bones, *curves);
+
+			SPtr<Skeleton> skeleton = Skeleton::create(bones.data(), numBones);
+			SPtr<AnimationClip> clip = AnimationClip::_createPtr(curves);
+			SkeletonMask mask(numBones);
+
+			Vector<Matrix4> pose(numBones);
+			LocalSkeletonPose localPose(numBones);
+			LocalSkeletonPose fromPose(numBones);
+			LocalSkeletonPose toPose(numBones);
+			for (UINT32 i = 0; i < numBones; i++)
+			{
+				localPose.hasOverride[i] = false;
+
+				fromPose.positions[i] = Vector3((float)i, 0.0f, 0.0f);
+				fromPose.rotations[i] = Quaternion(Vector3::UNIT_Y, Radian(i * 0.1f));
+				fromPose.scales[i] = Vector3::ONE;
+				fromPose.hasOverride[i] = false;
+
+				toPose.positions[i] = Vector3(0.0f, (float)i, 1.0f);
+				toPose.rotations[i] = Quaternion(Vector3::UNIT_X, Radian(i * 0.2f));
+				toPose.scales[i] = Vector3(2.0f, 1.0f, 1.0f);
+				toPose.hasOverride[i] = false;
+			}
+
+			Timer timer;
+			for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			{
+				float sampleTime = (i % NUM_KEYS) * KEY_INTERVAL;
+				skeleton->getPose(pose.data(), localPose, mask, *clip, sampleTime, false);
+			}
+
+			UINT64 evaluateTime = timer.getMicroseconds();
+
+			timer.reset();
+			for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+				skeleton->getPose(pose.data(), localPose, fromPose, toPose, (i % 100) / 100.0f);
+
+			UINT64 blendTime = timer.getMicroseconds();
+
+			LOGDBG("Skeleton pose with " + toString(numBones) + " bones, " + toString(NUM_ITERATIONS) + " iterations: " + 
+				toString(evaluateTime) + " us evaluating the clip, " + toString(blendTime) + " us blending poses.");
+		}
+	}
+
+	void EditorBenchmarkSuite::BenchmarkSkinVertices()
+	{
+		static const UINT32 NUM_VERTICES = 20000;
+		static const UINT32 NUM_BONES = 3;
+		static const UINT32 NUM_ITERATIONS = 100;
+
+		Matrix4 bones[NUM_BONES] =
+		{
+			Matrix4::TRS(Vector3(1.0f, 0.0f, 0.0f), Quaternion::IDENTITY, Vector3::ONE),
+			Matrix4::TRS(Vector3(0.0f, 2.0f, 0.0f), Quaternion(Vector3::UNIT_Y, Degree(90.0f)), Vector3::ONE),
+			Matrix4::TRS(Vector3::ZERO, Quaternion(Vector3::UNIT_X, Degree(45.0f)), Vector3(2.0f, 2.0f, 2.0f))
+		};
+
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+		vertexDesc->addVertElem(VET_FLOAT3, VES_NORMAL);
+		vertexDesc->addVertElem(VET_UBYTE4, VES_BLEND_INDICES);
+		vertexDesc->addVertElem(VET_FLOAT4, VES_BLEND_WEIGHTS);
+
+		// Every vertex is influenced by all the bones
+		Vector<Vector3> positions(NUM_VERTICES);
+		Vector<Vector3> normals(NUM_VERTICES);
+		Vector<UINT8> blendIndices(NUM_VERTICES * 4);
+		Vector<Vector4> blendWeights(NUM_VERTICES, Vector4(0.5f, 0.3f, 0.2f, 0.0f));
+		for (UINT32 i = 0; i < NUM_VERTICES; i++)
+		{
+			positions[i] = Vector3((float)(i % 100), (float)(i / 100), 1.0f);
+			normals[i] = Vector3::normalize(Vector3(1.0f, (float)(i % 7), 2.0f));
+
+			UINT8* indices = &blendIndices[i * 4];
+			indices[0] = 0; indices[1] = 1; indices[2] = 2; indices[3] = 0;
+		}
+
+		SPtr<MeshData> meshData = MeshData::create(NUM_VERTICES, 0, vertexDesc);
+		meshData->setVertexData(VES_POSITION, (UINT8*)positions.data(), NUM_VERTICES * sizeof(Vector3));
+		meshData->setVertexData(VES_NORMAL, (UINT8*)normals.data(), NUM_VERTICES * sizeof(Vector3));
+		meshData->setVertexData(VES_BLEND_INDICES, blendIndices.data(), NUM_VERTICES * 4);
+		meshData->setVertexData(VES_BLEND_WEIGHTS, (UINT8*)blendWeights.data(), NUM_VERTICES * sizeof(Vector4));
+
+		Vector<Vector3> skinnedPositions(NUM_VERTICES);
+		Vector<Vector3> skinnedNormals(NUM_VERTICES);
+
+		Timer timer;
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+			MeshUtility::skinVertices(*meshData, bones, NUM_BONES, skinnedPositions.data(), skinnedNormals.data());
+
+		UINT64 skinTime = timer.getMicroseconds();
+
+		LOGDBG("Skinning " + toString(NUM_VERTICES) + " vertices " + toString(NUM_ITERATIONS) + " times: " + 
+			toString(skinTime) + " us.");
+	}
+
+	void EditorBenchmarkSuite::BenchmarkTangentSpace()
+	{
+		static const UINT32 GRID_SIZE = 128;
+		static const UINT32 NUM_ITERATIONS = 20;
+
+		Vector<Vector3> positions;
+		Vector<UINT32> indices;
+		createTestGrid(GRID_SIZE, positions, indices);
+
+		UINT32 numVertices = (UINT32)positions.size();
+		UINT32 numIndices = (UINT32)indices.size();
+
+		Vector<Vector2> uvs(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			UINT32 x = i % (GRID_SIZE + 1);
+			UINT32 z = i / (GRID_SIZE + 1);
+
+			uvs[i] = Vector2(x / (float)GRID_SIZE, z / (float)GRID_SIZE);
+		}
+
+		Vector<Vector3> normals(numVertices);
+		Vector<Vector3> tangents(numVertices);
+		Vector<Vector3> bitangents(numVertices);
+
+		Timer timer;
+		for (UINT32 i = 0; i < NUM_ITERATIONS; i++)
+		{
+			MeshUtility::calculateTangentSpace(positions.data(), uvs.data(), (UINT8*)indices.data(), numVertices, 
+				numIndices, normals.data(), tangents.data(), bitangents.data(), sizeof(UINT32));
+		}
+
+		UINT64 tangentTime = timer.getMicroseconds();
+
+		LOGDBG("Tangent space of " + toString(numVertices) + " vertices, " + toString(NUM_ITERATIONS) + " times: " + 
+			toString(tangentTime) + " us.");
+	}
+}
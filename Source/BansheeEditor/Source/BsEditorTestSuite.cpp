@@ -15,6 +15,34 @@
 #include "BsPrefabDiff.h"
 #include "BsFrameAlloc.h"
 #include "BsFileSystem.h"
+#include "BsTextLayoutCache.h"
+#include "BsFont.h"
+#include "BsGUIPanel.h"
+#include "BsGUILayoutY.h"
+#include "BsGUISpace.h"
+#include "BsGUIScrollArea.h"
+#include "BsScenePicking.h"
+#include "BsMeshBVH.h"
+#include "BsMesh.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsCCamera.h"
+#include "BsCRenderable.h"
+#include "BsCoreApplication.h"
+#include "BsRenderWindow.h"
+#include "BsAnimationClip.h"
+#include "BsAnimationCompression.h"
+#include "BsSkeleton.h"
+#include "BsSkeletonMask.h"
+#include "BsAnimation.h"
+#include "BsAnimationManager.h"
+#include "BsProjectLibrary.h"
+#include "BsDataStream.h"
+#include "BsMeshUtility.h"
+#include "BsBakedAnimationCurves.h"
+#include "BsVector4.h"
+#include "BsBitwise.h"
+#include "BsOcclusionCulling.h"
 
 namespace BansheeEngine
 {
@@ -405,6 +433,240 @@ namespace BansheeEngine
 		return TestComponentD::getRTTIStatic();
 	}
 
+	HFont createTestFont(UINT32 size)
+	{
+		SPtr<FontBitmap> bitmap = bs_shared_ptr_new<FontBitmap>();
+		bitmap->size = size;
+		bitmap->fontDesc.baselineOffset = (INT32)size;
+		bitmap->fontDesc.lineHeight = size;
+		bitmap->fontDesc.spaceWidth = size / 2;
+		bitmap->texturePages.push_back(HTexture());
+
+		for (UINT32 i = 'a'; i <= 'z'; i++)
+		{
+			CHAR_DESC charDesc;
+			charDesc.charId = i;
+			charDesc.page = 0;
+			charDesc.uvX = (i - 'a') / 26.0f;
+			charDesc.uvY = 0.0f;
+			charDesc.uvWidth = 1.0f / 26.0f;
+			charDesc.uvHeight = 1.0f;
+			charDesc.width = size / 2;
+			charDesc.height = size;
+			charDesc.xOffset = 0;
+			charDesc.yOffset = 0;
+			charDesc.xAdvance = (INT32)(size / 2 + 1);
+			charDesc.yAdvance = 0;
+
+			bitmap->fontDesc.characters[i] = charDesc;
+		}
+
+		bitmap->fontDesc.missingGlyph = bitmap->fontDesc.characters['a'];
+		return Font::create({ bitmap });
+	}
+
+	/** Clears the flags that the parent GUI widget clears once it processes a layout update. */
+	void markGUIHierarchyAsClean(GUIElementBase* element)
+	{
+		element->_markAsClean();
+
+		UINT32 numChildren = element->_getNumChildren();
+		for (UINT32 i = 0; i < numChildren; i++)
+			markGUIHierarchyAsClean(element->_getChild(i));
+	}
+
+	/** Creates mesh data containing only positions, and 32-bit indices. */
+	SPtr<MeshData> createTestMeshData(const Vector<Vector3>& positions, const Vector<UINT32>& indices)
+	{
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+
+		SPtr<MeshData> meshData = MeshData::create((UINT32)positions.size(), (UINT32)indices.size(), vertexDesc);
+		meshData->setVertexData(VES_POSITION, (UINT8*)positions.data(), (UINT32)(positions.size() * sizeof(Vector3)));
+		memcpy(meshData->getIndices32(), indices.data(), indices.size() * sizeof(UINT32));
+
+		return meshData;
+	}
+
+	void createTestGrid(UINT32 size, Vector<Vector3>& positions, Vector<UINT32>& indices)
+	{
+		UINT32 numRowVertices = size + 1;
+
+		positions.resize(numRowVertices * numRowVertices);
+		for (UINT32 z = 0; z < numRowVertices; z++)
+		{
+			for (UINT32 x = 0; x < numRowVertices; x++)
+			{
+				float height = std::sin(x * 0.3f) * std::cos(z * 0.3f);
+				positions[z * numRowVertices + x] = Vector3((float)x, height, (float)z);
+			}
+		}
+
+		indices.clear();
+		for (UINT32 z = 0; z < size; z++)
+		{
+			for (UINT32 x = 0; x < size; x++)
+			{
+				UINT32 a = z * numRowVertices + x;
+				UINT32 b = a + 1;
+				UINT32 c = a + numRowVertices;
+				UINT32 d = c + 1;
+
+				// Wound so the triangles face up
+				indices.insert(indices.end(), { a, c, b, b, c, d });
+			}
+		}
+	}
+
+	void createTestAnimationCurves(UINT32 numCurves, UINT32 numKeys, float keyInterval, AnimationCurves& curves)
+	{
+		for (UINT32 i = 0; i < numCurves; i++)
+		{
+			float frequency = 0.5f + i * 0.1f;
+
+			Vector<TKeyframe<Vector3>> positionKeys(numKeys);
+			Vector<TKeyframe<Quaternion>> rotationKeys(numKeys);
+			for (UINT32 j = 0; j < numKeys; j++)
+			{
+				float t = j * keyInterval;
+
+				TKeyframe<Vector3>& positionKey = positionKeys[j];
+				positionKey.time = t;
+				positionKey.value = Vector3(std::sin(t * frequency), std::cos(t * frequency), t) * 5.0f;
+				positionKey.inTangent = Vector3(std::cos(t * frequency), -std::sin(t * frequency), 0.2f) * 5.0f * frequency;
+				positionKey.outTangent = positionKey.inTangent;
+
+				TKeyframe<Quaternion>& rotationKey = rotationKeys[j];
+				rotationKey.time = t;
+				rotationKey.value = Quaternion(Radian(t * frequency), Radian(std::sin(t) * 0.5f), Radian(0.0f));
+				rotationKey.inTangent = Quaternion(0.0f, 0.0f, 0.0f, 0.0f);
+				rotationKey.outTangent = rotationKey.inTangent;
+			}
+
+			curves.addPositionCurve("Bone" + toString(i), TAnimationCurve<Vector3>(positionKeys));
+			curves.addRotationCurve("Bone" + toString(i), TAnimationCurve<Quaternion>(rotationKeys));
+		}
+	}
+
+	void createTestRig(UINT32 numBones, UINT32 numKeys, float keyInterval, Vector<BONE_DESC>& bones,
+		AnimationCurves& curves)
+	{
+		bones.resize(numBones);
+		for (UINT32 i = 0; i < numBones; i++)
+		{
+			float angle = i * 0.1f;
+
+			bones[i].name = "Bone" + toString(i);
+			bones[i].parent = i == 0 ? (UINT32)-1 : (i - 1) / 2;
+			bones[i].invBindPose = Matrix4::TRS(Vector3(0.0f, -(float)i, 0.0f), 
+				Quaternion(Vector3::UNIT_Z, Radian(-angle)), Vector3::ONE);
+
+			Vector<TKeyframe<Vector3>> positionKeys(numKeys);
+			Vector<TKeyframe<Quaternion>> rotationKeys(numKeys);
+			for (UINT32 j = 0; j < numKeys; j++)
+			{
+				float t = j * keyInterval;
+
+				positionKeys[j] = { Vector3(std::sin(t + angle), 1.0f, 0.0f), Vector3::ZERO, Vector3::ZERO, t };
+				rotationKeys[j] = { Quaternion(Radian(angle), Radian(t), Radian(0.0f)), 
+					Quaternion(0.0f, 0.0f, 0.0f, 0.0f), Quaternion(0.0f, 0.0f, 0.0f, 0.0f), t };
+			}
+
+			curves.addPositionCurve(bones[i].name, TAnimationCurve<Vector3>(positionKeys));
+			curves.addRotationCurve(bones[i].name, TAnimationCurve<Quaternion>(rotationKeys));
+		}
+	}
+
+	/** Returns the average number of vertices transformed per triangle, assuming a FIFO vertex cache of 16 entries. */
+	float calculateTestACMR(const UINT32* indices, UINT32 numIndices)
+	{
+		static const UINT32 CACHE_SIZE = 16;
+
+		Vector<UINT32> cache;
+		UINT32 numMisses = 0;
+		for (UINT32 i = 0; i < numIndices; i++)
+		{
+			if (std::find(cache.begin(), cache.end(), indices[i]) != cache.end())
+				continue;
+
+			cache.push_back(indices[i]);
+			if (cache.size() > CACHE_SIZE)
+				cache.erase(cache.begin());
+
+			numMisses++;
+		}
+
+		return numIndices > 0 ? numMisses / (float)(numIndices / 3) : 0.0f;
+	}
+
+	/** 
+	 * Returns the triangles of a triangle list in sorted order, each rotated so its smallest index is first while keeping
+	 * its winding. Two triangle lists containing the same triangles in any order return identical arrays.
+	 */
+	Vector<std::tuple<UINT32, UINT32, UINT32>> getSortedTriangles(const UINT32* indices, UINT32 numIndices)
+	{
+		Vector<std::tuple<UINT32, UINT32, UINT32>> triangles;
+		for (UINT32 i = 0; i + 2 < numIndices; i += 3)
+		{
+			UINT32 a = indices[i + 0];
+			UINT32 b = indices[i + 1];
+			UINT32 c = indices[i + 2];
+
+			if (b < a && b < c)
+				triangles.push_back(std::make_tuple(b, c, a));
+			else if (c < a && c < b)
+				triangles.push_back(std::make_tuple(c, a, b));
+			else
+				triangles.push_back(std::make_tuple(a, b, c));
+		}
+
+		std::sort(triangles.begin(), triangles.end());
+		return triangles;
+	}
+
+	/** Returns the edges used by only a single triangle of a triangle list, in sorted order. */
+	Vector<UINT64> getBorderEdges(const UINT32* indices, UINT32 numIndices)
+	{
+		UnorderedMap<UINT64, UINT32> edgeUseCounts;
+		for (UINT32 i = 0; i + 2 < numIndices; i += 3)
+		{
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				UINT32 a = indices[i + j];
+				UINT32 b = indices[i + (j + 1) % 3];
+
+				edgeUseCounts[((UINT64)std::min(a, b) << 32) | std::max(a, b)]++;
+			}
+		}
+
+		Vector<UINT64> borderEdges;
+		for (auto& entry : edgeUseCounts)
+		{
+			if (entry.second == 1)
+				borderEdges.push_back(entry.first);
+		}
+
+		std::sort(borderEdges.begin(), borderEdges.end());
+		return borderEdges;
+	}
+
+	/** Counts the triangles facing down, for a triangle list generated by createTestGrid() or simplified from one. */
+	UINT32 countFlippedTriangles(const Vector<Vector3>& positions, const UINT32* indices, UINT32 numIndices)
+	{
+		UINT32 numFlipped = 0;
+		for (UINT32 i = 0; i + 2 < numIndices; i += 3)
+		{
+			const Vector3& a = positions[indices[i + 0]];
+			const Vector3& b = positions[indices[i + 1]];
+			const Vector3& c = positions[indices[i + 2]];
+
+			if (Vector3::cross(b - a, c - a).y < 0.0f)
+				numFlipped++;
+		}
+
+		return numFlipped;
+	}
+
 	EditorTestSuite::EditorTestSuite()
 	{
 		BS_ADD_TEST(EditorTestSuite::SceneObjectRecord_UndoRedo);
@@ -412,6 +674,21 @@ namespace BansheeEngine
 		BS_ADD_TEST(EditorTestSuite::BinaryDiff);
 		BS_ADD_TEST(EditorTestSuite::TestPrefabDiff);
 		BS_ADD_TEST(EditorTestSuite::TestFrameAlloc)
+		BS_ADD_TEST(EditorTestSuite::TestTextLayoutCache)
+		BS_ADD_TEST(EditorTestSuite::TestGUILayoutUpdate)
+		BS_ADD_TEST(EditorTestSuite::TestScenePicking)
+		BS_ADD_TEST(EditorTestSuite::TestAnimationCompression)
+		BS_ADD_TEST(EditorTestSuite::TestSkeletonPose)
+		BS_ADD_TEST(EditorTestSuite::TestSkinVertices)
+		BS_ADD_TEST(EditorTestSuite::TestAnimationBaking)
+		BS_ADD_TEST(EditorTestSuite::TestMeshOptimize)
+		BS_ADD_TEST(EditorTestSuite::TestMeshSimplify)
+		BS_ADD_TEST(EditorTestSuite::TestTangentSpace)
+		BS_ADD_TEST(EditorTestSuite::TestVertexCompression)
+		BS_ADD_TEST(EditorTestSuite::TestOcclusionCulling)
+		BS_ADD_TEST(EditorTestSuite::TestAnimationPoseSharing)
+		BS_ADD_TEST(EditorTestSuite::TestAnimationLOD)
+		BS_ADD_TEST(EditorTestSuite::TestProjectLibraryScanJournal)
 	}
 
 	void EditorTestSuite::SceneObjectRecord_UndoRedo()
@@ -457,6 +734,68 @@ namespace BansheeEngine
 		BS_TEST_ASSERT(cmpB1_1->val1 == "InitialValue");
 		BS_TEST_ASSERT(so0_0->getName() == "so0_0");
 
+		// Undo compacted the command into a diff, which must re-apply the change in-place
+		UndoRedo::instance().redo();
+		BS_TEST_ASSERT(!cmpB1_1.isDestroyed());
+		BS_TEST_ASSERT(cmpB1_1->val1 == "ModifiedValue");
+		BS_TEST_ASSERT(so0_0->getName() == "modified");
+		BS_TEST_ASSERT(cmpB1_1->ref1 == soExternal);
+
+		UndoRedo::instance().undo();
+		BS_TEST_ASSERT(cmpB1_1->val1 == "InitialValue");
+		BS_TEST_ASSERT(so0_0->getName() == "so0_0");
+
+		// Registering a newer command compacts the previous one, which must then use less memory than the full record
+		UndoRedo::instance().clear();
+
+		CmdRecordSO::execute(so0_0, true);
+		UINT32 recordedMemory = UndoRedo::instance().getMemoryUsage();
+		BS_TEST_ASSERT(recordedMemory > 0);
+
+		cmpB1_1->val1 = "CompactedValue";
+		CmdRecordSO::execute(so0_0, true);
+
+		BS_TEST_ASSERT(UndoRedo::instance().getMemoryUsage() < recordedMemory * 2);
+
+		UndoRedo::instance().undo();
+		UndoRedo::instance().undo();
+		BS_TEST_ASSERT(!cmpB1_1.isDestroyed());
+		BS_TEST_ASSERT(cmpB1_1->val1 == "InitialValue");
+
+		UndoRedo::instance().redo();
+		BS_TEST_ASSERT(cmpB1_1->val1 == "CompactedValue");
+
+		// Adding a component can't be represented by a diff, so the object must be restored from the full record
+		UndoRedo::instance().clear();
+
+		CmdRecordSO::execute(so1_1);
+		so1_1->addComponent<TestComponentB>();
+		UndoRedo::instance().undo();
+
+		BS_TEST_ASSERT(!so1_1.isDestroyed());
+		BS_TEST_ASSERT(so1_1->getComponents().size() == 1);
+		BS_TEST_ASSERT(!cmpA1_1.isDestroyed());
+
+		// Oldest commands are dropped once over the budget, but the most recent one is always kept
+		UndoRedo::instance().clear();
+
+		UINT32 oldBudget = UndoRedo::instance().getMemoryBudget();
+		UndoRedo::instance().setMemoryBudget(1);
+
+		CmdRecordSO::execute(so0_0);
+		so0_0->setName("budget0");
+		CmdRecordSO::execute(so0_0);
+		so0_0->setName("budget1");
+
+		UndoRedo::instance().undo();
+		BS_TEST_ASSERT(so0_0->getName() == "budget0");
+
+		UndoRedo::instance().undo();
+		BS_TEST_ASSERT(so0_0->getName() == "budget0");
+
+		UndoRedo::instance().setMemoryBudget(oldBudget);
+		UndoRedo::instance().clear();
+
 		so0_0->destroy();
 		soExternal->destroy();
 	}
@@ -732,4 +1071,1353 @@ namespace BansheeEngine
 		alloc.dealloc(a13);
 		alloc.clear();
 	}
-}
\ No newline at end of file
+
+	void EditorTestSuite::TestTextLayoutCache()
+	{
+		HFont fontA = createTestFont(10);
+		HFont fontB = createTestFont(10);
+
+		TextLayoutCache cache(1024 * 1024);
+
+		TEXT_SPRITE_DESC desc;
+		desc.text = L"cached text layout";
+		desc.font = fontA;
+		desc.fontSize = 10;
+		desc.width = 200;
+		desc.height = 20;
+
+		const TextLayout& layout = cache.getLayout(desc);
+		BS_TEST_ASSERT(cache.getNumMisses() == 1 && cache.getNumHits() == 0);
+		BS_TEST_ASSERT(layout.pages.size() == 1 && layout.pages[0].numQuads > 0);
+
+		Vector<Vector2> originalVertices = layout.pages[0].vertices;
+
+		// Bounds don't affect left/top aligned text that doesn't wrap, so resizing must hit the cache
+		desc.width = 300;
+		desc.height = 40;
+
+		const TextLayout& resizedLayout = cache.getLayout(desc);
+		BS_TEST_ASSERT(cache.getNumMisses() == 1 && cache.getNumHits() == 1);
+		BS_TEST_ASSERT(resizedLayout.pages[0].vertices == originalVertices);
+
+		// Centered text depends on the bounds width
+		desc.horzAlign = THA_Center;
+		cache.getLayout(desc);
+		BS_TEST_ASSERT(cache.getNumMisses() == 2);
+		desc.horzAlign = THA_Left;
+
+		// Font size and font changes must never return a layout generated for another font
+		desc.fontSize = 20;
+		cache.getLayout(desc);
+		BS_TEST_ASSERT(cache.getNumMisses() == 3);
+		desc.fontSize = 10;
+
+		desc.font = fontB;
+		cache.getLayout(desc);
+		BS_TEST_ASSERT(cache.getNumMisses() == 4);
+		desc.font = fontA;
+
+		// Cached layout must be identical to a freshly generated one
+		TextLayoutCache freshCache(1024 * 1024);
+		const TextLayout& freshLayout = freshCache.getLayout(desc);
+		const TextLayout& cachedLayout = cache.getLayout(desc);
+		BS_TEST_ASSERT(cache.getNumMisses() == 4 && cache.getNumHits() == 2);
+		BS_TEST_ASSERT(cachedLayout.pages.size() == freshLayout.pages.size());
+		BS_TEST_ASSERT(cachedLayout.pages[0].vertices == freshLayout.pages[0].vertices);
+		BS_TEST_ASSERT(cachedLayout.pages[0].uvs == freshLayout.pages[0].uvs);
+		BS_TEST_ASSERT(cachedLayout.pages[0].indices == freshLayout.pages[0].indices);
+
+		// Shrinking the budget evicts least recently used layouts first
+		cache.setMemoryBudget(cache.getMemoryUsage() / 2);
+		BS_TEST_ASSERT(cache.getMemoryUsage() <= cache.getMemoryBudget());
+
+		UINT64 numHits = cache.getNumHits();
+		cache.getLayout(desc);
+		BS_TEST_ASSERT(cache.getNumHits() == numHits + 1);
+	}
+
+	void EditorTestSuite::TestGUILayoutUpdate()
+	{
+		// Panel children are positioned independently of their siblings, so modifying one can't move the others
+		GUIPanel* root = GUIPanel::create();
+
+		GUIScrollArea* scrollArea = root->addNewElement<GUIScrollArea>();
+		GUIFixedSpace* scrollSpace = scrollArea->getLayout().addNewElement<GUIFixedSpace>(10);
+
+		GUILayoutY* layoutA = root->addNewElement<GUILayoutY>();
+		GUIFixedSpace* spaceA = layoutA->addNewElement<GUIFixedSpace>(10);
+
+		GUILayoutY* layoutB = root->addNewElement<GUILayoutY>();
+		GUIFixedSpace* spaceB = layoutB->addNewElement<GUIFixedSpace>(10);
+
+		GUILayoutData layoutData;
+		layoutData.area = Rect2I(0, 0, 200, 200);
+		layoutData.clipRect = layoutData.area;
+
+		// Initial update must reach every element, including the ones inside the scroll area
+		root->_updateLayout(layoutData);
+		BS_TEST_ASSERT(!root->_isOptimalSizeDirty() && !scrollArea->_isOptimalSizeDirty());
+		BS_TEST_ASSERT(!scrollSpace->_isOptimalSizeDirty() && !spaceA->_isOptimalSizeDirty());
+		BS_TEST_ASSERT(scrollSpace->_isHierarchyDirty() && spaceA->_isHierarchyDirty() && spaceB->_isHierarchyDirty());
+
+		markGUIHierarchyAsClean(root);
+
+		// Modifying an element only flags its own hierarchy
+		spaceB->setSize(20);
+		BS_TEST_ASSERT(spaceB->_isOptimalSizeDirty() && layoutB->_isOptimalSizeDirty() && root->_isOptimalSizeDirty());
+		BS_TEST_ASSERT(!layoutA->_isOptimalSizeDirty() && !scrollArea->_isOptimalSizeDirty());
+
+		// Only the modified hierarchy is laid out again, unmodified siblings are skipped
+		root->_updateLayout(layoutData);
+		BS_TEST_ASSERT(!root->_isOptimalSizeDirty() && !layoutB->_isOptimalSizeDirty() && !spaceB->_isOptimalSizeDirty());
+		BS_TEST_ASSERT(layoutB->_isHierarchyDirty() && spaceB->_isHierarchyDirty());
+		BS_TEST_ASSERT(!layoutA->_isHierarchyDirty() && !spaceA->_isHierarchyDirty());
+		BS_TEST_ASSERT(!scrollArea->_isHierarchyDirty() && !scrollSpace->_isHierarchyDirty());
+
+		markGUIHierarchyAsClean(root);
+
+		// Resizing the scroll area changes the layout data of its contents, so they must be updated
+		scrollArea->setHeight(5);
+		root->_updateLayout(layoutData);
+		BS_TEST_ASSERT(scrollArea->_isHierarchyDirty() && scrollSpace->_isHierarchyDirty());
+		BS_TEST_ASSERT(!layoutA->_isHierarchyDirty() && !layoutB->_isHierarchyDirty());
+
+		GUILayout::destroy(root);
+	}
+
+	void EditorTestSuite::TestScenePicking()
+	{
+		// Triangle in the XY plane, containing the origin. Wound clockwise when viewed from +Z, so it faces that way with
+		// the default counter-clockwise culling.
+		Vector<Vector3> positions = { Vector3(-1.0f, -1.0f, 0.0f), Vector3(1.0f, -1.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f) };
+		Vector<UINT32> indices = { 0, 2, 1 };
+		SPtr<MeshData> meshData = createTestMeshData(positions, indices);
+
+		// Ray against the triangle hierarchy directly
+		HMesh mesh = Mesh::create(meshData, MU_STATIC | MU_CPUCACHED);
+		SPtr<MeshBVH> meshBVH = MeshBVH::create(*meshData, mesh->getProperties());
+		BS_TEST_ASSERT(meshBVH != nullptr);
+
+		float distance;
+		Vector3 normal;
+		Ray frontRay(Vector3(0.0f, 0.0f, 5.0f), -Vector3::UNIT_Z);
+		BS_TEST_ASSERT(meshBVH->intersects(frontRay, distance, normal));
+		BS_TEST_ASSERT(Math::approxEquals(distance, 5.0f) && Math::approxEquals(normal.z, 1.0f));
+		BS_TEST_ASSERT(!meshBVH->intersects(Ray(Vector3(2.0f, 0.0f, 5.0f), -Vector3::UNIT_Z), distance, normal));
+
+		// Normal faces the ray origin, and culled sides are ignored
+		Ray backRay(Vector3(0.0f, 0.0f, -5.0f), Vector3::UNIT_Z);
+		BS_TEST_ASSERT(meshBVH->intersects(backRay, distance, normal) && Math::approxEquals(normal.z, -1.0f));
+		BS_TEST_ASSERT(meshBVH->intersects(frontRay, distance, normal, CULL_COUNTERCLOCKWISE));
+		BS_TEST_ASSERT(!meshBVH->intersects(frontRay, distance, normal, CULL_CLOCKWISE));
+		BS_TEST_ASSERT(!meshBVH->intersects(backRay, distance, normal, CULL_COUNTERCLOCKWISE));
+		BS_TEST_ASSERT(meshBVH->intersects(backRay, distance, normal, CULL_CLOCKWISE));
+
+		// Place the scene far away from anything else that might be in the scene
+		Vector3 origin(10000.0f, 10000.0f, 10000.0f);
+
+		SPtr<RenderWindow> window = gCoreApplication().getPrimaryWindow();
+		HSceneObject cameraSO = SceneObject::create("PickingCamera");
+		HCamera camera = cameraSO->addComponent<CCamera>(window, 0.0f, 0.0f, 1.0f, 1.0f);
+		camera->setLayers(0);
+		camera->setNearClipDistance(0.1f);
+		camera->setFarClipDistance(100.0f);
+
+		cameraSO->setPosition(origin);
+		cameraSO->lookAt(origin - Vector3::UNIT_Z);
+
+		SPtr<Viewport> viewport = camera->getViewport();
+		camera->setAspectRatio(viewport->getWidth() / (float)viewport->getHeight());
+		Vector2I center(viewport->getWidth() / 2, viewport->getHeight() / 2);
+
+		// Occluder is closer to the camera, so it fully covers the target on screen
+		HSceneObject targetSO = SceneObject::create("PickingTarget");
+		targetSO->addComponent<CRenderable>()->setMesh(mesh);
+		targetSO->setPosition(origin - Vector3(0.0f, 0.0f, 10.0f));
+
+		HSceneObject occluderSO = SceneObject::create("PickingOccluder");
+		occluderSO->addComponent<CRenderable>()->setMesh(mesh);
+		occluderSO->setPosition(origin - Vector3(0.0f, 0.0f, 5.0f));
+
+		ScenePicking& picking = ScenePicking::instance();
+		bool wasCPUPicking = picking.getCPUPicking();
+		picking.setCPUPicking(true);
+
+		Vector<HSceneObject> ignored;
+		SnapData snapData;
+		HSceneObject picked = picking.pickClosestObject(camera->_getCamera(), center, Vector2I(1, 1), ignored, &snapData);
+		BS_TEST_ASSERT(picked == occluderSO);
+		BS_TEST_ASSERT(Math::approxEquals(snapData.pickPosition.z, origin.z - 5.0f, 0.01f));
+
+		Vector2I rectPos(center.x - 10, center.y - 10);
+		Vector<HSceneObject> rectPicked = picking.pickObjects(camera->_getCamera(), rectPos, Vector2I(20, 20), ignored);
+		BS_TEST_ASSERT(rectPicked.size() == 1 && rectPicked[0] == occluderSO);
+
+		// Ignored objects don't occlude
+		ignored.push_back(occluderSO);
+		picked = picking.pickClosestObject(camera->_getCamera(), center, Vector2I(1, 1), ignored, &snapData);
+		BS_TEST_ASSERT(picked == targetSO);
+		BS_TEST_ASSERT(Math::approxEquals(snapData.pickPosition.z, origin.z - 10.0f, 0.01f));
+		ignored.clear();
+
+		// Once the occluder is moved aside, both are visible, nearest first
+		occluderSO->setPosition(origin + Vector3(1.0f, 0.0f, -5.0f));
+		rectPicked = picking.pickObjects(camera->_getCamera(), Vector2I(0, 0), 
+			Vector2I(viewport->getWidth(), viewport->getHeight()), ignored);
+		BS_TEST_ASSERT(rectPicked.size() == 2 && rectPicked[0] == occluderSO && rectPicked[1] == targetSO);
+
+		// Back faces are culled the same as when rendering, so a triangle facing away doesn't occlude
+		Vector<UINT32> backIndices = { 0, 1, 2 };
+		HMesh backMesh = Mesh::create(createTestMeshData(positions, backIndices), MU_STATIC | MU_CPUCACHED);
+
+		HSceneObject backSO = SceneObject::create("PickingBackFacing");
+		backSO->addComponent<CRenderable>()->setMesh(backMesh);
+		backSO->setPosition(origin - Vector3(0.0f, 0.0f, 5.0f));
+
+		picked = picking.pickClosestObject(camera->_getCamera(), center, Vector2I(1, 1), ignored, &snapData);
+		BS_TEST_ASSERT(picked == targetSO);
+		backSO->destroy();
+
+		// Snap normal of a rotated and non-uniformly scaled object must be perpendicular to its world space surface. The
+		// triangle is tilted in local space, so scaling changes the direction of its normal.
+		Vector<Vector3> tiltedPositions = 
+			{ Vector3(-1.0f, -1.0f, 1.0f), Vector3(1.0f, -1.0f, -1.0f), Vector3(0.0f, 1.0f, 0.0f) };
+		HMesh tiltedMesh = Mesh::create(createTestMeshData(tiltedPositions, indices), MU_STATIC | MU_CPUCACHED);
+
+		HSceneObject tiltedSO = SceneObject::create("PickingTilted");
+		tiltedSO->addComponent<CRenderable>()->setMesh(tiltedMesh);
+		tiltedSO->setPosition(origin - Vector3(0.0f, 0.0f, 3.0f));
+		tiltedSO->setRotation(Quaternion(Vector3::UNIT_Z, Degree(30.0f)));
+		tiltedSO->setScale(Vector3(1.0f, 1.0f, 3.0f));
+
+		picked = picking.pickClosestObject(camera->_getCamera(), center, Vector2I(1, 1), ignored, &snapData);
+		BS_TEST_ASSERT(picked == tiltedSO);
+
+		Matrix4 tiltedTfrm = tiltedSO->getWorldTfrm();
+		Vector3 worldA = tiltedTfrm.multiplyAffine(tiltedPositions[0]);
+		Vector3 worldB = tiltedTfrm.multiplyAffine(tiltedPositions[1]);
+		Vector3 worldC = tiltedTfrm.multiplyAffine(tiltedPositions[2]);
+
+		Vector3 expectedNormal = Vector3::normalize(Vector3::cross(worldB - worldA, worldC - worldA));
+		if (expectedNormal.z < 0.0f)
+			expectedNormal = -expectedNormal;
+
+		BS_TEST_ASSERT(snapData.normal.distance(expectedNormal) < 0.01f);
+		BS_TEST_ASSERT(Math::approxEquals(snapData.pickPosition.z, origin.z - 3.0f, 0.01f));
+		tiltedSO->destroy();
+
+		picking.setCPUPicking(wasCPUPicking);
+
+		targetSO->destroy();
+		occluderSO->destroy();
+		cameraSO->destroy();
+	}
+
+	void EditorTestSuite::TestAnimationCompression()
+	{
+		static const UINT32 NUM_CURVES = 50;
+		static const UINT32 NUM_KEYS = 300;
+		static const float KEY_INTERVAL = 1.0f / 30.0f;
+
+		AnimationCurves original;
+		createTestAnimationCurves(NUM_CURVES, NUM_KEYS, KEY_INTERVAL, original);
+
+		AnimationCurves compressed = original;
+		AnimationCompressionStats stats = AnimationCompression::compress(compressed);
+		BS_TEST_ASSERT(stats.compressedSize < stats.originalSize);
+		BS_TEST_ASSERT(stats.compressedNumKeys <= stats.originalNumKeys);
+
+		// Quantization adds a small error on top of the keyframe reduction error
+		static const float POSITION_TOLERANCE = 0.005f;
+		static const float ROTATION_TOLERANCE = 0.005f;
+
+		auto rotationError = [](const Quaternion& a, const Quaternion& b)
+		{
+			return 2.0f * std::acos(std::min(1.0f, std::abs(a.dot(b))));
+		};
+
+		float maxPositionError = 0.0f;
+		float maxRotationError = 0.0f;
+		for (UINT32 i = 0; i < NUM_CURVES; i++)
+		{
+			TCurveCache<Vector3> originalPositionCache, compressedPositionCache;
+			TCurveCache<Quaternion> originalRotationCache, compressedRotationCache;
+
+			// Sample at the keys and half-way between them
+			for (UINT32 j = 0; j < NUM_KEYS * 2; j++)
+			{
+				float t = j * KEY_INTERVAL * 0.5f;
+
+				Vector3 originalPosition = original.evaluatePosition(i, t, originalPositionCache, false);
+				Vector3 compressedPosition = compressed.evaluatePosition(i, t, compressedPositionCache, false);
+				maxPositionError = std::max(maxPositionError, originalPosition.distance(compressedPosition));
+
+				Quaternion originalRotation = original.evaluateRotation(i, t, originalRotationCache, false);
+				Quaternion compressedRotation = compressed.evaluateRotation(i, t, compressedRotationCache, false);
+				maxRotationError = std::max(maxRotationError, rotationError(originalRotation, compressedRotation));
+			}
+		}
+
+		BS_TEST_ASSERT(maxPositionError < POSITION_TOLERANCE);
+		BS_TEST_ASSERT(maxRotationError < ROTATION_TOLERANCE);
+
+		// Reported error is measured on the quantized curves, at the same samples as above
+		BS_TEST_ASSERT(Math::approxEquals(stats.maxPositionError, maxPositionError, 0.0001f));
+
+		// Keyframes can still be retrieved after the uncompressed ones were released
+		for (UINT32 i = 0; i < NUM_CURVES; i++)
+		{
+			TNamedAnimationCurve<Vector3> positionCurve = compressed.getPositionCurve(i);
+			BS_TEST_ASSERT(positionCurve.name == original.position[i].name);
+			BS_TEST_ASSERT(positionCurve.curve.getNumKeyFrames() == compressed.compressedPosition[i].getNumKeyFrames());
+
+			TNamedAnimationCurve<Quaternion> rotationCurve = compressed.getRotationCurve(i);
+			BS_TEST_ASSERT(rotationCurve.curve.getNumKeyFrames() == compressed.compressedRotation[i].getNumKeyFrames());
+
+			float t = NUM_KEYS * KEY_INTERVAL * 0.37f;
+
+			TCurveCache<Vector3> originalCache, decompressedCache;
+			Vector3 originalPosition = original.evaluatePosition(i, t, originalCache, false);
+			Vector3 decompressedPosition = positionCurve.curve.evaluate(t, decompressedCache, false);
+			BS_TEST_ASSERT(originalPosition.distance(decompressedPosition) < POSITION_TOLERANCE);
+		}
+	}
+
+	void EditorTestSuite::TestSkeletonPose()
+	{
+		static const UINT32 NUM_KEYS = 30;
+		static const float KEY_INTERVAL = 1.0f / 30.0f;
+		static const float EPSILON = 0.001f;
+
+		// Bones deep in the hierarchy accumulate large translations, so differences are relative to their magnitude
+		auto maxMatrixDifference = [](const Matrix4& a, const Matrix4& b)
+		{
+			float maxDiff = 0.0f;
+			for (UINT32 row = 0; row < 4; row++)
+			{
+				for (UINT32 col = 0; col < 4; col++)
+					maxDiff = std::max(maxDiff, std::abs(a[row][col] - b[row][col]));
+			}
+
+			return maxDiff / std::max(1.0f, b.getTranslation().length());
+		};
+
+		UINT32 rigSizes[] = { 50, 150, 300 };
+		for (auto numBones : rigSizes)
+		{
+			Vector<BONE_DESC> bones;
+			SPtr<AnimationCurves> curves = bs_shared_ptr_new<AnimationCurves>();
+			createTestRig(numBones, NUM_KEYS, KEY_INTERVAL, bones, *curves);
+
+			SPtr<Skeleton> skeleton = Skeleton::create(bones.data(), numBones);
+			SPtr<AnimationClip> clip = AnimationClip::_createPtr(curves);
+			SkeletonMask mask(numBones);
+
+			Vector<Matrix4> pose(numBones);
+			Vector<Matrix4> referencePose(numBones);
+			LocalSkeletonPose localPose(numBones);
+			for (UINT32 i = 0; i < numBones; i++)
+				localPose.hasOverride[i] = false;
+
+			// Clip evaluation must match evaluating each curve and building the hierarchy by hand
+			float time = NUM_KEYS * KEY_INTERVAL * 0.4f;
+			skeleton->getPose(pose.data(), localPose, mask, *clip, time, false);
+
+			for (UINT32 i = 0; i < numBones; i++)
+			{
+				TCurveCache<Vector3> positionCache;
+				TCurveCache<Quaternion> rotationCache;
+
+				Vector3 position = curves->position[i].curve.evaluate(time, positionCache, false);
+				Quaternion rotation = curves->rotation[i].curve.evaluate(time, rotationCache, false);
+				rotation.normalize();
+
+				referencePose[i] = Matrix4::TRS(position, rotation, Vector3::ONE);
+				if (bones[i].parent != (UINT32)-1)
+					referencePose[i] = referencePose[bones[i].parent].concatenateAffine(referencePose[i]);
+			}
+
+			float maxDiff = 0.0f;
+			for (UINT32 i = 0; i < numBones; i++)
+			{
+				Matrix4 reference = referencePose[i].concatenateAffine(bones[i].invBindPose);
+				maxDiff = std::max(maxDiff, maxMatrixDifference(pose[i], reference));
+			}
+
+			BS_TEST_ASSERT(maxDiff < EPSILON);
+
+			// Blending between two poses must match blending each bone with the scalar math types
+			LocalSkeletonPose fromPose(numBones);
+			LocalSkeletonPose toPose(numBones);
+			for (UINT32 i = 0; i < numBones; i++)
+			{
+				float angle = i * 0.1f;
+
+				fromPose.positions[i] = Vector3((float)i, 0.0f, 0.0f);
+				fromPose.rotations[i] = Quaternion(Vector3::UNIT_Y, Radian(angle));
+				fromPose.scales[i] = Vector3::ONE;
+				fromPose.hasOverride[i] = false;
+
+				// Every other bone uses the negated rotation, which must blend along the shortest arc regardless
+				toPose.positions[i] = Vector3(0.0f, (float)i, 1.0f);
+				toPose.rotations[i] = Quaternion(Vector3::UNIT_X, Radian(angle * 2.0f));
+				if (i % 2 == 1)
+					toPose.rotations[i] = -toPose.rotations[i];
+
+				toPose.scales[i] = Vector3(2.0f, 1.0f, 1.0f);
+				toPose.hasOverride[i] = false;
+			}
+
+			static const float BLEND_T = 0.3f;
+			skeleton->getPose(pose.data(), localPose, fromPose, toPose, BLEND_T);
+
+			maxDiff = 0.0f;
+			for (UINT32 i = 0; i < numBones; i++)
+			{
+				Vector3 position = Vector3::lerp(BLEND_T, fromPose.positions[i], toPose.positions[i]);
+				Quaternion rotation = Quaternion::lerp(BLEND_T, fromPose.rotations[i], toPose.rotations[i]);
+				Vector3 scale = Vector3::lerp(BLEND_T, fromPose.scales[i], toPose.scales[i]);
+
+				maxDiff = std::max(maxDiff, std::abs(localPose.rotations[i].dot(rotation) - 1.0f));
+
+				referencePose[i] = Matrix4::TRS(position, rotation, scale);
+				if (bones[i].parent != (UINT32)-1)
+					referencePose[i] = referencePose[bones[i].parent].concatenateAffine(referencePose[i]);
+			}
+
+			BS_TEST_ASSERT(maxDiff < EPSILON);
+
+			maxDiff = 0.0f;
+			for (UINT32 i = 0; i < numBones; i++)
+			{
+				Matrix4 reference = referencePose[i].concatenateAffine(bones[i].invBindPose);
+				maxDiff = std::max(maxDiff, maxMatrixDifference(pose[i], reference));
+			}
+
+			BS_TEST_ASSERT(maxDiff < EPSILON);
+		}
+	}
+
+	void EditorTestSuite::TestSkinVertices()
+	{
+		// Enough vertices for the work to be split across multiple tasks
+		static const UINT32 NUM_VERTICES = 20000;
+		static const UINT32 NUM_BONES = 3;
+		static const float EPSILON = 0.001f;
+
+		Matrix4 bones[NUM_BONES] =
+		{
+			Matrix4::TRS(Vector3(1.0f, 0.0f, 0.0f), Quaternion::IDENTITY, Vector3::ONE),
+			Matrix4::TRS(Vector3(0.0f, 2.0f, 0.0f), Quaternion(Vector3::UNIT_Y, Degree(90.0f)), Vector3::ONE),
+			Matrix4::TRS(Vector3::ZERO, Quaternion(Vector3::UNIT_X, Degree(45.0f)), Vector3(2.0f, 2.0f, 2.0f))
+		};
+
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+		vertexDesc->addVertElem(VET_FLOAT3, VES_NORMAL);
+		vertexDesc->addVertElem(VET_UBYTE4, VES_BLEND_INDICES);
+		vertexDesc->addVertElem(VET_FLOAT4, VES_BLEND_WEIGHTS);
+
+		Vector<Vector3> positions(NUM_VERTICES);
+		Vector<Vector3> normals(NUM_VERTICES);
+		Vector<UINT8> blendIndices(NUM_VERTICES * 4);
+		Vector<Vector4> blendWeights(NUM_VERTICES);
+		for (UINT32 i = 0; i < NUM_VERTICES; i++)
+		{
+			positions[i] = Vector3((float)(i % 100), (float)(i / 100), 1.0f);
+			normals[i] = Vector3::normalize(Vector3(1.0f, (float)(i % 7), 2.0f));
+
+			// Cycle through single influences, blended influences, no influences and out of range bones
+			UINT8* indices = &blendIndices[i * 4];
+			switch (i % 4)
+			{
+			case 0:
+				indices[0] = 1; indices[1] = 0; indices[2] = 0; indices[3] = 0;
+				blendWeights[i] = Vector4(1.0f, 0.0f, 0.0f, 0.0f);
+				break;
+			case 1:
+				indices[0] = 0; indices[1] = 1; indices[2] = 2; indices[3] = 0;
+				blendWeights[i] = Vector4(0.5f, 0.3f, 0.2f, 0.0f);
+				break;
+			case 2:
+				indices[0] = 0; indices[1] = 0; indices[2] = 0; indices[3] = 0;
+				blendWeights[i] = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
+				break;
+			case 3:
+				indices[0] = 2; indices[1] = 200; indices[2] = 0; indices[3] = 0;
+				blendWeights[i] = Vector4(0.6f, 0.4f, 0.0f, 0.0f);
+				break;
+			}
+		}
+
+		SPtr<MeshData> meshData = MeshData::create(NUM_VERTICES, 0, vertexDesc);
+		meshData->setVertexData(VES_POSITION, (UINT8*)positions.data(), NUM_VERTICES * sizeof(Vector3));
+		meshData->setVertexData(VES_NORMAL, (UINT8*)normals.data(), NUM_VERTICES * sizeof(Vector3));
+		meshData->setVertexData(VES_BLEND_INDICES, blendIndices.data(), NUM_VERTICES * 4);
+		meshData->setVertexData(VES_BLEND_WEIGHTS, (UINT8*)blendWeights.data(), NUM_VERTICES * sizeof(Vector4));
+
+		Vector<Vector3> skinnedPositions(NUM_VERTICES);
+		Vector<Vector3> skinnedNormals(NUM_VERTICES);
+		MeshUtility::skinVertices(*meshData, bones, NUM_BONES, skinnedPositions.data(), skinnedNormals.data());
+
+		// Reference transforms each vertex by each influencing bone separately, and blends the results
+		float maxPositionError = 0.0f;
+		float maxNormalError = 0.0f;
+		for (UINT32 i = 0; i < NUM_VERTICES; i++)
+		{
+			Vector3 position = Vector3::ZERO;
+			Vector3 normal = Vector3::ZERO;
+			float totalWeight = 0.0f;
+
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				UINT8 boneIdx = blendIndices[i * 4 + j];
+				float weight = blendWeights[i][j];
+				if (weight == 0.0f || boneIdx >= NUM_BONES)
+					continue;
+
+				position += bones[boneIdx].multiplyAffine(positions[i]) * weight;
+				normal += bones[boneIdx].multiplyDirection(normals[i]) * weight;
+				totalWeight += weight;
+			}
+
+			if (totalWeight == 0.0f)
+			{
+				position = positions[i];
+				normal = normals[i];
+			}
+
+			normal.normalize();
+
+			maxPositionError = std::max(maxPositionError, position.distance(skinnedPositions[i]));
+			maxNormalError = std::max(maxNormalError, normal.distance(skinnedNormals[i]));
+		}
+
+		BS_TEST_ASSERT(maxPositionError < EPSILON);
+		BS_TEST_ASSERT(maxNormalError < EPSILON);
+	}
+
+	void EditorTestSuite::TestAnimationBaking()
+	{
+		// Curves that don't start at zero, with matching values at both ends so they loop smoothly
+		static const float START = 0.5f;
+		static const float LENGTH = 2.0f;
+		static const UINT32 NUM_KEYS = 61;
+		static const UINT32 SAMPLE_RATE = 60;
+		static const float TOLERANCE = 0.001f;
+
+		Vector<TKeyframe<Vector3>> positionKeys(NUM_KEYS);
+		Vector<TKeyframe<Quaternion>> rotationKeys(NUM_KEYS);
+		for (UINT32 i = 0; i < NUM_KEYS; i++)
+		{
+			float t = START + LENGTH * i / (float)(NUM_KEYS - 1);
+			float phase = (t - START) * Math::TWO_PI / LENGTH;
+			float phaseDerivative = Math::TWO_PI / LENGTH;
+
+			TKeyframe<Vector3>& positionKey = positionKeys[i];
+			positionKey.time = t;
+			positionKey.value = Vector3(std::sin(phase), std::cos(phase), 0.0f);
+			positionKey.inTangent = Vector3(std::cos(phase), -std::sin(phase), 0.0f) * phaseDerivative;
+			positionKey.outTangent = positionKey.inTangent;
+
+			TKeyframe<Quaternion>& rotationKey = rotationKeys[i];
+			rotationKey.time = t;
+			rotationKey.value = Quaternion(Vector3::UNIT_Y, Radian(std::sin(phase)));
+			rotationKey.inTangent = Quaternion(0.0f, 0.0f, 0.0f, 0.0f);
+			rotationKey.outTangent = rotationKey.inTangent;
+		}
+
+		TAnimationCurve<Vector3> positionCurve(positionKeys);
+		TAnimationCurve<Quaternion> rotationCurve(rotationKeys);
+
+		AnimationCurves curves;
+		curves.addPositionCurve("Bone", positionCurve);
+		curves.addRotationCurve("Bone", rotationCurve);
+
+		AnimationBakingStats stats = BakedAnimationCurves::bake(curves, SAMPLE_RATE);
+		BS_TEST_ASSERT(stats.numFrames > 0);
+		BS_TEST_ASSERT(!curves.baked.isEmpty());
+
+		// Sample before, within and after the curve range, both looping and clamping
+		TCurveCache<Vector3> positionCache;
+		TCurveCache<Quaternion> rotationCache;
+
+		float maxPositionError = 0.0f;
+		float maxRotationError = 0.0f;
+		for (float time = -3.0f; time < 7.0f; time += 0.037f)
+		{
+			for (UINT32 i = 0; i < 2; i++)
+			{
+				bool loop = i == 0;
+
+				Vector3 position = curves.evaluatePosition(0, time, positionCache, loop);
+				Quaternion rotation = curves.evaluateRotation(0, time, rotationCache, loop);
+
+				maxPositionError = std::max(maxPositionError, position.distance(positionCurve.evaluate(time, loop)));
+
+				Quaternion originalRotation = rotationCurve.evaluate(time, loop);
+				originalRotation.normalize();
+				rotation.normalize();
+
+				maxRotationError = std::max(maxRotationError, 1.0f - Math::abs(rotation.dot(originalRotation)));
+			}
+		}
+
+		BS_TEST_ASSERT(maxPositionError < TOLERANCE);
+		BS_TEST_ASSERT(maxRotationError < TOLERANCE);
+
+		// Curves with different ranges would loop at different times, so they must not be baked
+		Vector<TKeyframe<Vector3>> scaleKeys(2);
+		scaleKeys[0].time = 0.0f;
+		scaleKeys[0].value = Vector3::ONE;
+		scaleKeys[0].inTangent = Vector3::ZERO;
+		scaleKeys[0].outTangent = Vector3::ZERO;
+		scaleKeys[1] = scaleKeys[0];
+		scaleKeys[1].time = 1.0f;
+
+		curves.addScaleCurve("Bone", TAnimationCurve<Vector3>(scaleKeys));
+
+		stats = BakedAnimationCurves::bake(curves, SAMPLE_RATE);
+		BS_TEST_ASSERT(stats.numFrames == 0);
+		BS_TEST_ASSERT(curves.baked.isEmpty());
+	}
+
+	void EditorTestSuite::TestMeshOptimize()
+	{
+		static const UINT32 GRID_SIZE = 32;
+
+		Vector<Vector3> gridPositions;
+		Vector<UINT32> gridIndices;
+		createTestGrid(GRID_SIZE, gridPositions, gridIndices);
+
+		UINT32 numIndices = (UINT32)gridIndices.size();
+		UINT32 numTriangles = numIndices / 3;
+
+		// Scatter the triangles so the original order makes poor use of the vertex cache
+		Vector<UINT32> scatteredIndices(numIndices);
+		for (UINT32 i = 0; i < numTriangles; i++)
+		{
+			UINT32 srcTriangle = (i * 7919) % numTriangles;
+			for (UINT32 j = 0; j < 3; j++)
+				scatteredIndices[i * 3 + j] = gridIndices[srcTriangle * 3 + j];
+		}
+
+		// Give each triangle its own copy of its vertices, so they need to be welded
+		Vector<Vector3> soupPositions(numIndices);
+		Vector<UINT32> soupIndices(numIndices);
+		for (UINT32 i = 0; i < numIndices; i++)
+		{
+			soupPositions[i] = gridPositions[scatteredIndices[i]];
+			soupIndices[i] = i;
+		}
+
+		SPtr<MeshData> soupMeshData = createTestMeshData(soupPositions, soupIndices);
+
+		Vector<UINT32> vertexRemap;
+		MeshOptimizeStats stats;
+		SPtr<MeshData> optimized = MeshUtility::optimize(soupMeshData, Vector<SubMesh>(), MeshOptimizeFlag::All, 
+			vertexRemap, stats);
+
+		BS_TEST_ASSERT(stats.numVerticesBefore == numIndices);
+		BS_TEST_ASSERT(stats.numVerticesAfter == (GRID_SIZE + 1) * (GRID_SIZE + 1));
+		BS_TEST_ASSERT(optimized->getNumVertices() == stats.numVerticesAfter);
+		BS_TEST_ASSERT(optimized->getNumIndices() == numIndices);
+		BS_TEST_ASSERT(stats.acmrAfter < stats.acmrBefore);
+
+		UINT32* optimizedIndices = optimized->getIndices32();
+		float soupACMR = calculateTestACMR(soupIndices.data(), numIndices);
+		float optimizedACMR = calculateTestACMR(optimizedIndices, numIndices);
+		BS_TEST_ASSERT(optimizedACMR < soupACMR);
+		BS_TEST_ASSERT(optimizedACMR < 1.0f);
+
+		// Remapped vertices must keep their data, and the remapped original triangles must match the output triangles
+		UINT8* optimizedPositions = optimized->getElementData(VES_POSITION);
+		BS_TEST_ASSERT(vertexRemap.size() == numIndices);
+
+		bool remapValid = true;
+		for (UINT32 i = 0; i < numIndices && remapValid; i++)
+		{
+			Vector3 position;
+			memcpy(&position, optimizedPositions + vertexRemap[i] * sizeof(Vector3), sizeof(Vector3));
+
+			remapValid = vertexRemap[i] < stats.numVerticesAfter && position == soupPositions[i];
+		}
+
+		BS_TEST_ASSERT(remapValid);
+
+		Vector<UINT32> remappedIndices(numIndices);
+		for (UINT32 i = 0; i < numIndices; i++)
+			remappedIndices[i] = vertexRemap[soupIndices[i]];
+
+		BS_TEST_ASSERT(getSortedTriangles(remappedIndices.data(), numIndices) == 
+			getSortedTriangles(optimizedIndices, numIndices));
+
+		// Levels of detail are appended after the optimized indices, so they must be reordered for the cache separately
+		static const float REDUCTION = 0.5f;
+
+		SPtr<MeshData> scatteredMeshData = createTestMeshData(gridPositions, scatteredIndices);
+
+		Vector<MeshLOD> lods;
+		SPtr<MeshData> lodMeshData = MeshUtility::generateLODs(scatteredMeshData, Vector<SubMesh>(), 1, REDUCTION, lods);
+		BS_TEST_ASSERT(lods.size() == 1);
+
+		if (lods.size() == 1)
+		{
+			const SubMesh& lodSubMesh = lods[0].subMeshes[0];
+			UINT32* lodIndices = lodMeshData->getIndices32() + lodSubMesh.indexOffset;
+
+			Vector<UINT32> simplifiedIndices;
+			MeshUtility::simplify(gridPositions.data(), (UINT32)gridPositions.size(), scatteredIndices.data(), numIndices, 
+				(UINT32)(numTriangles * REDUCTION) * 3, simplifiedIndices);
+
+			BS_TEST_ASSERT(lodSubMesh.indexCount == (UINT32)simplifiedIndices.size());
+			BS_TEST_ASSERT(getSortedTriangles(lodIndices, lodSubMesh.indexCount) == 
+				getSortedTriangles(simplifiedIndices.data(), (UINT32)simplifiedIndices.size()));
+
+			float simplifiedACMR = calculateTestACMR(simplifiedIndices.data(), (UINT32)simplifiedIndices.size());
+			float lodACMR = calculateTestACMR(lodIndices, lodSubMesh.indexCount);
+			BS_TEST_ASSERT(lodACMR < simplifiedACMR);
+		}
+	}
+
+	void EditorTestSuite::TestMeshSimplify()
+	{
+		static const UINT32 GRID_SIZE = 32;
+		static const float REDUCTION = 0.5f;
+
+		Vector<Vector3> positions;
+		Vector<UINT32> indices;
+		createTestGrid(GRID_SIZE, positions, indices);
+
+		UINT32 numVertices = (UINT32)positions.size();
+		UINT32 numIndices = (UINT32)indices.size();
+
+		// Simplify the entire grid
+		UINT32 targetNumIndices = (UINT32)(numIndices / 3 * REDUCTION) * 3;
+
+		Vector<UINT32> simplified;
+		MeshUtility::simplify(positions.data(), numVertices, indices.data(), numIndices, targetNumIndices, simplified);
+
+		UINT32 numSimplifiedIndices = (UINT32)simplified.size();
+		BS_TEST_ASSERT(numSimplifiedIndices % 3 == 0);
+		BS_TEST_ASSERT(numSimplifiedIndices < numIndices);
+		BS_TEST_ASSERT(numSimplifiedIndices <= targetNumIndices + numIndices / 10);
+		BS_TEST_ASSERT(countFlippedTriangles(positions, simplified.data(), numSimplifiedIndices) == 0);
+
+		// Border vertices can't move, so the outline of the grid must consist of exactly the same edges
+		BS_TEST_ASSERT(getBorderEdges(simplified.data(), numSimplifiedIndices) == 
+			getBorderEdges(indices.data(), numIndices));
+
+		// Split the grid into two triangle list sub-meshes, followed by a line list sub-mesh that can't be simplified
+		UINT32 halfNumIndices = (GRID_SIZE / 2) * GRID_SIZE * 6;
+
+		Vector<SubMesh> subMeshes;
+		subMeshes.push_back(SubMesh(0, halfNumIndices, DOT_TRIANGLE_LIST));
+		subMeshes.push_back(SubMesh(halfNumIndices, numIndices - halfNumIndices, DOT_TRIANGLE_LIST));
+		subMeshes.push_back(SubMesh(numIndices, 4, DOT_LINE_LIST));
+
+		Vector<UINT32> meshIndices = indices;
+		meshIndices.insert(meshIndices.end(), { 0, 1, 1, 2 });
+
+		SPtr<MeshData> meshData = createTestMeshData(positions, meshIndices);
+		UINT32 numMeshIndices = (UINT32)meshIndices.size();
+
+		static const UINT32 NUM_LODS = 3;
+
+		Vector<MeshLOD> lods;
+		SPtr<MeshData> lodMeshData = MeshUtility::generateLODs(meshData, subMeshes, NUM_LODS, REDUCTION, lods);
+		BS_TEST_ASSERT(!lods.empty() && lods.size() <= NUM_LODS);
+		BS_TEST_ASSERT(lodMeshData->getNumVertices() == numVertices);
+		BS_TEST_ASSERT(lodMeshData->getNumIndices() > numMeshIndices);
+
+		// Original indices must be kept as is, so the original sub-mesh ranges remain valid
+		UINT32* lodIndices = lodMeshData->getIndices32();
+		BS_TEST_ASSERT(memcmp(lodIndices, meshIndices.data(), numMeshIndices * sizeof(UINT32)) == 0);
+
+		// Vertices referenced by each of the original triangle list sub-meshes
+		Vector<bool> usedVertices[2];
+		for (UINT32 i = 0; i < 2; i++)
+		{
+			usedVertices[i].resize(numVertices, false);
+			for (UINT32 j = 0; j < subMeshes[i].indexCount; j++)
+				usedVertices[i][indices[subMeshes[i].indexOffset + j]] = true;
+		}
+
+		// Each level must reduce the number of triangles without growing any sub-mesh, and its ranges must not overlap 
+		// any other level's ranges
+		UINT32 nextFreeIndex = numMeshIndices;
+		float prevScreenSize = 1.0f;
+		Vector<SubMesh> prevSubMeshes = subMeshes;
+		for (auto& lod : lods)
+		{
+			BS_TEST_ASSERT(lod.subMeshes.size() == subMeshes.size());
+			if (lod.subMeshes.size() != subMeshes.size())
+				break;
+
+			BS_TEST_ASSERT(lod.screenSize < prevScreenSize);
+			prevScreenSize = lod.screenSize;
+
+			BS_TEST_ASSERT(lod.subMeshes[0].indexCount + lod.subMeshes[1].indexCount < 
+				prevSubMeshes[0].indexCount + prevSubMeshes[1].indexCount);
+
+			for (UINT32 i = 0; i < 2; i++)
+			{
+				const SubMesh& subMesh = lod.subMeshes[i];
+				BS_TEST_ASSERT(subMesh.drawOp == DOT_TRIANGLE_LIST);
+				BS_TEST_ASSERT(subMesh.indexOffset >= nextFreeIndex);
+				BS_TEST_ASSERT(subMesh.indexOffset + subMesh.indexCount <= lodMeshData->getNumIndices());
+				BS_TEST_ASSERT(subMesh.indexCount % 3 == 0);
+				BS_TEST_ASSERT(subMesh.indexCount <= prevSubMeshes[i].indexCount);
+
+				nextFreeIndex = std::max(nextFreeIndex, subMesh.indexOffset + subMesh.indexCount);
+
+				const UINT32* subMeshIndices = lodIndices + subMesh.indexOffset;
+				BS_TEST_ASSERT(countFlippedTriangles(positions, subMeshIndices, subMesh.indexCount) == 0);
+
+				bool verticesValid = true;
+				for (UINT32 j = 0; j < subMesh.indexCount; j++)
+					verticesValid &= subMeshIndices[j] < numVertices && usedVertices[i][subMeshIndices[j]];
+
+				BS_TEST_ASSERT(verticesValid);
+
+				// Edges between the two sub-meshes are borders of both, so the halves must stay connected
+				BS_TEST_ASSERT(getBorderEdges(subMeshIndices, subMesh.indexCount) == 
+					getBorderEdges(indices.data() + subMeshes[i].indexOffset, subMeshes[i].indexCount));
+			}
+
+			const SubMesh& lineSubMesh = lod.subMeshes[2];
+			BS_TEST_ASSERT(lineSubMesh.drawOp == DOT_LINE_LIST);
+			BS_TEST_ASSERT(lineSubMesh.indexOffset == numIndices && lineSubMesh.indexCount == 4);
+
+			prevSubMeshes = lod.subMeshes;
+		}
+	}
+
+	void EditorTestSuite::TestTangentSpace()
+	{
+		// Large enough for faces and vertices to be split across multiple tasks, small enough for 16-bit indices
+		static const UINT32 GRID_SIZE = 128;
+		static const UINT32 DEGENERATE_ROW = 5;
+		static const float EPSILON = 0.0001f;
+
+		Vector<Vector3> positions;
+		Vector<UINT32> indices32;
+		createTestGrid(GRID_SIZE, positions, indices32);
+
+		UINT32 numVertices = (UINT32)positions.size();
+		UINT32 numIndices = (UINT32)indices32.size();
+		UINT32 numFaces = numIndices / 3;
+
+		Vector<UINT16> indices16(numIndices);
+		for (UINT32 i = 0; i < numIndices; i++)
+			indices16[i] = (UINT16)indices32[i];
+
+		// Give the row following the degenerate row the same V coordinate, so the triangles between them have no UV area
+		Vector<Vector2> uvs(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			UINT32 x = i % (GRID_SIZE + 1);
+			UINT32 z = i / (GRID_SIZE + 1);
+
+			if (z == DEGENERATE_ROW + 1)
+				z = DEGENERATE_ROW;
+
+			uvs[i] = Vector2(x / (float)GRID_SIZE, z / (float)GRID_SIZE);
+		}
+
+		// Single-threaded scalar reference, scattering face values to their vertices
+		Vector<Vector3> refNormals(numVertices);
+		Vector<Vector3> refTangents(numVertices);
+		Vector<Vector3> refBitangents(numVertices);
+		auto calculateReference = [&]()
+		{
+			memset(refNormals.data(), 0, numVertices * sizeof(Vector3));
+			memset(refTangents.data(), 0, numVertices * sizeof(Vector3));
+			memset(refBitangents.data(), 0, numVertices * sizeof(Vector3));
+
+			for (UINT32 i = 0; i < numFaces; i++)
+			{
+				const UINT32* triangle = &indices32[i * 3];
+
+				Vector3 q0 = positions[triangle[1]] - positions[triangle[0]];
+				Vector3 q1 = positions[triangle[2]] - positions[triangle[0]];
+				Vector3 normal = Vector3::normalize(Vector3::cross(q0, q1));
+
+				Vector2 s(uvs[triangle[1]].x - uvs[triangle[0]].x, uvs[triangle[2]].x - uvs[triangle[0]].x);
+				Vector2 t(uvs[triangle[1]].y - uvs[triangle[0]].y, uvs[triangle[2]].y - uvs[triangle[0]].y);
+
+				Vector3 tangent = Vector3::ZERO;
+				Vector3 bitangent = Vector3::ZERO;
+
+				float denom = s.x * t.y - s.y * t.x;
+				if (fabs(denom) >= 1e-8f)
+				{
+					float r = 1.0f / denom;
+					tangent = Vector3::normalize((t.y * r) * q0 - (t.x * r) * q1);
+					bitangent = Vector3::normalize((s.x * r) * q0 - (s.y * r) * q1);
+				}
+
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					refNormals[triangle[j]] += normal;
+					refTangents[triangle[j]] += tangent;
+					refBitangents[triangle[j]] += bitangent;
+				}
+			}
+
+			for (UINT32 i = 0; i < numVertices; i++)
+			{
+				Vector3 normal = Vector3::normalize(refNormals[i]);
+				Vector3 tangent = Vector3::normalize(refTangents[i]);
+				Vector3 bitangent = Vector3::normalize(refBitangents[i]);
+
+				tangent = Vector3::normalize(tangent - normal.dot(tangent) * normal);
+				bitangent = Vector3::normalize(bitangent - (normal.dot(bitangent) * normal + tangent.dot(bitangent) * tangent));
+
+				refNormals[i] = normal;
+				refTangents[i] = tangent;
+				refBitangents[i] = bitangent;
+			}
+		};
+
+		calculateReference();
+
+		Vector<Vector3> normals(numVertices);
+		Vector<Vector3> tangents(numVertices);
+		Vector<Vector3> bitangents(numVertices);
+		auto getMaxError = [&]()
+		{
+			float maxError = 0.0f;
+			for (UINT32 i = 0; i < numVertices; i++)
+			{
+				maxError = std::max(maxError, normals[i].distance(refNormals[i]));
+				maxError = std::max(maxError, tangents[i].distance(refTangents[i]));
+				maxError = std::max(maxError, bitangents[i].distance(refBitangents[i]));
+			}
+
+			return maxError;
+		};
+
+		// Both index sizes must produce the same results
+		MeshUtility::calculateTangentSpace(positions.data(), uvs.data(), (UINT8*)indices16.data(), numVertices, 
+			numIndices, normals.data(), tangents.data(), bitangents.data(), sizeof(UINT16));
+		BS_TEST_ASSERT(getMaxError() < EPSILON);
+
+		MeshUtility::calculateTangentSpace(positions.data(), uvs.data(), (UINT8*)indices32.data(), numVertices, 
+			numIndices, normals.data(), tangents.data(), bitangents.data(), sizeof(UINT32));
+		BS_TEST_ASSERT(getMaxError() < EPSILON);
+
+		// Vertices next to faces with degenerate UVs still get a valid tangent from their other faces
+		UINT32 degenerateVertex = DEGENERATE_ROW * (GRID_SIZE + 1) + GRID_SIZE / 2;
+		BS_TEST_ASSERT(Math::approxEquals(tangents[degenerateVertex].length(), 1.0f, 0.001f));
+	}
+
+	void EditorTestSuite::TestVertexCompression()
+	{
+		static const UINT32 NUM_DIRECTIONS = 500;
+		static const float NORMAL_TOLERANCE = 0.001f; // Radians
+
+		// Directions spread over the sphere, plus the poles and the octahedron edges that need to be folded
+		Vector<Vector3> directions;
+		for (UINT32 i = 0; i < NUM_DIRECTIONS; i++)
+		{
+			float z = 1.0f - 2.0f * (i + 0.5f) / NUM_DIRECTIONS;
+			float radius = std::sqrt(1.0f - z * z);
+			float phi = i * 2.39996323f;
+
+			directions.push_back(Vector3(radius * std::cos(phi), radius * std::sin(phi), z));
+		}
+
+		directions.insert(directions.end(), { Vector3::UNIT_Z, -Vector3::UNIT_Z, Vector3::UNIT_Y, -Vector3::UNIT_Y,
+			Vector3::normalize(Vector3(1.0f, -1.0f, 0.0f)), Vector3::normalize(Vector3(-1.0f, 0.0f, -1.0f)) });
+
+		UINT32 numVertices = (UINT32)directions.size();
+
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+		vertexDesc->addVertElem(VET_FLOAT3, VES_NORMAL);
+		vertexDesc->addVertElem(VET_FLOAT4, VES_TANGENT);
+		vertexDesc->addVertElem(VET_FLOAT2, VES_TEXCOORD);
+
+		Vector<Vector3> positions(numVertices);
+		Vector<Vector3> normals(numVertices);
+		Vector<Vector4> tangents(numVertices);
+		Vector<Vector2> uvs(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			normals[i] = directions[i];
+			positions[i] = directions[i] * 1.5f + Vector3(1.0f, -3.0f, 0.5f);
+
+			// Tangents include directions whose second octahedral component is -1, and both bitangent signs
+			Vector3 tangent = Vector3::cross(directions[i], Math::abs(directions[i].x) < 0.9f ? Vector3::UNIT_X : Vector3::UNIT_Y);
+			tangent.normalize();
+			if (i == 0)
+				tangent = -Vector3::UNIT_Y;
+
+			tangents[i] = Vector4(tangent.x, tangent.y, tangent.z, i % 2 == 0 ? 1.0f : -1.0f);
+			uvs[i] = Vector2(-0.5f + 3.5f * (i % 17) / 16.0f, 0.25f + 0.5f * (i % 5) / 4.0f);
+		}
+
+		auto createMeshData = [&](const Vector<Vector3>& meshPositions)
+		{
+			SPtr<MeshData> meshData = MeshData::create(numVertices, 0, vertexDesc);
+			meshData->setVertexData(VES_POSITION, (UINT8*)meshPositions.data(), numVertices * sizeof(Vector3));
+			meshData->setVertexData(VES_NORMAL, (UINT8*)normals.data(), numVertices * sizeof(Vector3));
+			meshData->setVertexData(VES_TANGENT, (UINT8*)tangents.data(), numVertices * sizeof(Vector4));
+			meshData->setVertexData(VES_TEXCOORD, (UINT8*)uvs.data(), numVertices * sizeof(Vector2));
+
+			return meshData;
+		};
+
+		MeshVertexCompression compression;
+		VertexCompressionStats stats;
+		SPtr<MeshData> compressed = MeshUtility::compressVertices(createMeshData(positions), VertexCompressionFlag::All,
+			compression, stats);
+
+		BS_TEST_ASSERT(stats.positionsCompressed && compression.octahedralNormals);
+		BS_TEST_ASSERT(stats.compressedSize < stats.originalSize);
+
+		const SPtr<VertexDataDesc>& compressedDesc = compressed->getVertexDesc();
+		for (UINT32 i = 0; i < compressedDesc->getNumElements(); i++)
+		{
+			const VertexElement& element = compressedDesc->getElement(i);
+			BS_TEST_ASSERT(element.getType() == (element.getSemantic() == VES_POSITION ? VET_HALF4 : VET_SHORT2_NORM));
+		}
+
+		// Decoding below mirrors PerObjectData.bslinc, with normalized integers converted as the GPU does
+		auto fromSNorm = [](INT16 value) { return std::max(value / 32767.0f, -1.0f); };
+		auto decodeOctahedral = [](float x, float y)
+		{
+			Vector3 output(x, y, 1.0f - Math::abs(x) - Math::abs(y));
+
+			float t = Math::clamp01(-output.z);
+			output.x += output.x >= 0.0f ? -t : t;
+			output.y += output.y >= 0.0f ? -t : t;
+
+			return Vector3::normalize(output);
+		};
+
+		UINT32 stride = compressedDesc->getVertexStride(0);
+		const UINT8* positionData = compressed->getElementData(VES_POSITION);
+		const UINT8* normalData = compressed->getElementData(VES_NORMAL);
+		const UINT8* tangentData = compressed->getElementData(VES_TANGENT);
+		const UINT8* uvData = compressed->getElementData(VES_TEXCOORD);
+
+		// Half-floats round components normalized to [-1, 1] by at most 2^-12, and 16-bit integers by at most 2^-16.
+		// Small slack accounts for float rounding when decoding.
+		float positionTolerance = compression.positionScale.length() / 4096.0f + 0.00001f;
+		float uvTolerance = compression.uvScale.length() / 32767.0f;
+
+		float maxPositionError = 0.0f;
+		float maxNormalError = 0.0f;
+		float maxTangentError = 0.0f;
+		float maxUVError = 0.0f;
+		bool signsMatch = true;
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			const UINT16* encodedPosition = (const UINT16*)(positionData + i * stride);
+			Vector3 position(Bitwise::halfToFloat(encodedPosition[0]), Bitwise::halfToFloat(encodedPosition[1]), 
+				Bitwise::halfToFloat(encodedPosition[2]));
+			position = position * compression.positionScale + compression.positionOffset;
+
+			maxPositionError = std::max(maxPositionError, position.distance(positions[i]));
+
+			const INT16* encodedNormal = (const INT16*)(normalData + i * stride);
+			Vector3 normal = decodeOctahedral(fromSNorm(encodedNormal[0]), fromSNorm(encodedNormal[1]));
+
+			maxNormalError = std::max(maxNormalError, std::acos(Math::clamp(normal.dot(normals[i]), -1.0f, 1.0f)));
+
+			const INT16* encodedTangent = (const INT16*)(tangentData + i * stride);
+			float epsilon = 1.0f / 32767.0f;
+			float tangentY = fromSNorm(encodedTangent[1]);
+			float y = (Math::abs(tangentY) - epsilon) / (1.0f - epsilon) * 2.0f - 1.0f;
+
+			Vector3 tangent = decodeOctahedral(fromSNorm(encodedTangent[0]), y);
+			float sign = tangentY >= 0.0f ? 1.0f : -1.0f;
+
+			Vector3 originalTangent(tangents[i].x, tangents[i].y, tangents[i].z);
+			maxTangentError = std::max(maxTangentError, std::acos(Math::clamp(tangent.dot(originalTangent), -1.0f, 1.0f)));
+			signsMatch &= sign == tangents[i].w;
+
+			const INT16* encodedUV = (const INT16*)(uvData + i * stride);
+			Vector2 uv(fromSNorm(encodedUV[0]), fromSNorm(encodedUV[1]));
+			uv = uv * compression.uvScale + compression.uvOffset;
+
+			maxUVError = std::max(maxUVError, (uv - uvs[i]).length());
+		}
+
+		BS_TEST_ASSERT(maxPositionError <= positionTolerance);
+		BS_TEST_ASSERT(Math::approxEquals(maxPositionError, stats.maxPositionError, 0.00001f));
+		BS_TEST_ASSERT(maxNormalError < NORMAL_TOLERANCE);
+		BS_TEST_ASSERT(maxTangentError < NORMAL_TOLERANCE);
+		BS_TEST_ASSERT(signsMatch);
+		BS_TEST_ASSERT(maxUVError <= uvTolerance);
+
+		// CPU position reads must match the shader decode
+		Vector<Vector3> readPositions(numVertices);
+		BS_TEST_ASSERT(MeshUtility::readPositions(*compressed, compression, readPositions.data()));
+
+		float maxReadError = 0.0f;
+		for (UINT32 i = 0; i < numVertices; i++)
+			maxReadError = std::max(maxReadError, readPositions[i].distance(positions[i]));
+
+		BS_TEST_ASSERT(maxReadError <= positionTolerance);
+
+		// Positions of meshes too large to stay within the error are left uncompressed, while other attributes still are
+		Vector<Vector3> largePositions(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+			largePositions[i] = positions[i] * 1000.0f;
+
+		SPtr<MeshData> largeCompressed = MeshUtility::compressVertices(createMeshData(largePositions), 
+			VertexCompressionFlag::All, compression, stats);
+
+		BS_TEST_ASSERT(!stats.positionsCompressed && stats.maxPositionError == 0.0f);
+		BS_TEST_ASSERT(compression.positionScale == Vector3::ONE && compression.positionOffset == Vector3::ZERO);
+		BS_TEST_ASSERT(compression.octahedralNormals);
+
+		const SPtr<VertexDataDesc>& largeDesc = largeCompressed->getVertexDesc();
+		for (UINT32 i = 0; i < largeDesc->getNumElements(); i++)
+		{
+			const VertexElement& element = largeDesc->getElement(i);
+			BS_TEST_ASSERT(element.getType() == (element.getSemantic() == VES_POSITION ? VET_FLOAT3 : VET_SHORT2_NORM));
+		}
+
+		Vector<Vector3> largeReadPositions(numVertices);
+		BS_TEST_ASSERT(MeshUtility::readPositions(*largeCompressed, compression, largeReadPositions.data()));
+		BS_TEST_ASSERT(largeReadPositions == largePositions);
+	}
+
+	void EditorTestSuite::TestOcclusionCulling()
+	{
+		// View looking down -Z with an orthographic projection, mapping [-4, 4] to the 64x64 buffer (8 pixels per unit)
+		Matrix4 proj;
+		proj.makeProjectionOrtho(-4.0f, 4.0f, 4.0f, -4.0f, 0.1f, 100.0f);
+
+		OcclusionBuffer buffer(64, 64);
+		buffer.clear(proj);
+		BS_TEST_ASSERT(!buffer.hasOccluders());
+		BS_TEST_ASSERT(!buffer.isOccluded(AABox(Vector3(-1.0f, -1.0f, -8.0f), Vector3(1.0f, 1.0f, -6.0f))));
+
+		// Quad occluder at depth 5. Its edges fall inside a pixel (at 48.56 on screen), past the pixel center, so the
+		// border pixels are marked as covered even though the occluder only covers part of them.
+		const float QUAD_EXTENT = 2.07f;
+
+		OccluderGeometry quad;
+		quad.positions =
+		{
+			Vector3(-QUAD_EXTENT, -QUAD_EXTENT, -5.0f), Vector3(QUAD_EXTENT, -QUAD_EXTENT, -5.0f),
+			Vector3(QUAD_EXTENT, QUAD_EXTENT, -5.0f), Vector3(-QUAD_EXTENT, QUAD_EXTENT, -5.0f)
+		};
+		quad.indices = { 0, 1, 2, 0, 2, 3 };
+
+		buffer.addOccluder(quad, Matrix4::IDENTITY);
+		buffer.rasterize();
+		BS_TEST_ASSERT(buffer.hasOccluders());
+
+		// Box fully behind the quad
+		BS_TEST_ASSERT(buffer.isOccluded(AABox(Vector3(-1.0f, -1.0f, -8.0f), Vector3(1.0f, 1.0f, -6.0f))));
+
+		// Same box in front of the quad, or overlapping it in depth
+		BS_TEST_ASSERT(!buffer.isOccluded(AABox(Vector3(-1.0f, -1.0f, -4.0f), Vector3(1.0f, 1.0f, -3.0f))));
+		BS_TEST_ASSERT(!buffer.isOccluded(AABox(Vector3(-1.0f, -1.0f, -6.0f), Vector3(1.0f, 1.0f, -4.0f))));
+
+		// Box behind the quad, but sticking out past its edge
+		BS_TEST_ASSERT(!buffer.isOccluded(AABox(Vector3(1.5f, -1.0f, -8.0f), Vector3(3.0f, 1.0f, -6.0f))));
+
+		// Box sticking out past the edge only within a border pixel whose center is covered by the quad
+		BS_TEST_ASSERT(!buffer.isOccluded(AABox(Vector3(1.0f, -1.0f, -8.0f), Vector3(2.1f, 1.0f, -6.0f))));
+		BS_TEST_ASSERT(!buffer.isOccluded(AABox(Vector3(-1.0f, -2.1f, -8.0f), Vector3(1.0f, -1.0f, -6.0f))));
+
+		// Box behind the quad and entirely off to the side
+		BS_TEST_ASSERT(!buffer.isOccluded(AABox(Vector3(3.0f, 3.0f, -8.0f), Vector3(3.5f, 3.5f, -6.0f))));
+
+		// Clearing removes the occluder
+		buffer.clear(proj);
+		BS_TEST_ASSERT(!buffer.isOccluded(AABox(Vector3(-1.0f, -1.0f, -8.0f), Vector3(1.0f, 1.0f, -6.0f))));
+	}
+
+	void EditorTestSuite::TestAnimationPoseSharing()
+	{
+		static const UINT32 NUM_BONES = 16;
+		static const UINT32 NUM_KEYS = 30;
+		static const float KEY_INTERVAL = 1.0f / 30.0f;
+
+		Vector<BONE_DESC> bones;
+		SPtr<AnimationCurves> curves = bs_shared_ptr_new<AnimationCurves>();
+		createTestRig(NUM_BONES, NUM_KEYS, KEY_INTERVAL, bones, *curves);
+
+		Vector<BONE_DESC> otherBones;
+		SPtr<AnimationCurves> otherCurves = bs_shared_ptr_new<AnimationCurves>();
+		createTestRig(NUM_BONES, NUM_KEYS, KEY_INTERVAL * 2.0f, otherBones, *otherCurves);
+
+		SPtr<Skeleton> skeleton = Skeleton::create(bones.data(), NUM_BONES);
+		HAnimationClip clip = AnimationClip::create(curves);
+		HAnimationClip otherClip = AnimationClip::create(otherCurves);
+
+		auto createAnimation = [&](const HAnimationClip& animClip, float time)
+		{
+			SPtr<Animation> anim = Animation::create();
+			anim->setSkeleton(skeleton);
+			anim->play(animClip);
+
+			AnimationClipState state;
+			anim->getState(animClip, state);
+			state.time = time;
+			anim->setState(animClip, state);
+
+			return anim;
+		};
+
+		auto getStartIdx = [](const RendererAnimationData& data, const SPtr<Animation>& anim)
+		{
+			return data.infos.at(anim->_getId()).poseInfo.startIdx;
+		};
+
+		AnimationManager& animManager = AnimationManager::instance();
+		RendererAnimationData output;
+
+		// Identical animations at the same time are evaluated and uploaded once
+		SPtr<Animation> animA = createAnimation(clip, 0.5f);
+		SPtr<Animation> animB = createAnimation(clip, 0.5f);
+
+		animManager._evaluatePoses({ animA, animB }, 0.0f, 0, output);
+		BS_TEST_ASSERT(getStartIdx(output, animA) == getStartIdx(output, animB));
+		BS_TEST_ASSERT(output.transforms.size() == NUM_BONES);
+
+		// Same clip at a different time must not share
+		SPtr<Animation> animTime = createAnimation(clip, 0.25f);
+
+		animManager._evaluatePoses({ animA, animTime }, 0.0f, 1, output);
+		BS_TEST_ASSERT(getStartIdx(output, animA) != getStartIdx(output, animTime));
+		BS_TEST_ASSERT(output.transforms.size() == NUM_BONES * 2);
+
+		// Different clip at the same time must not share
+		SPtr<Animation> animClip = createAnimation(otherClip, 0.5f);
+
+		animManager._evaluatePoses({ animA, animClip }, 0.0f, 2, output);
+		BS_TEST_ASSERT(getStartIdx(output, animA) != getStartIdx(output, animClip));
+		BS_TEST_ASSERT(output.transforms.size() == NUM_BONES * 2);
+	}
+
+	void EditorTestSuite::TestAnimationLOD()
+	{
+		static const UINT32 NUM_BONES = 16;
+		static const UINT32 NUM_KEYS = 30;
+		static const float KEY_INTERVAL = 1.0f / 30.0f;
+		static const UINT32 LOD_MAX_BONES = 4;
+		static const UINT32 LOD_UPDATE_INTERVAL = 2;
+		static const UINT32 NUM_UPDATES = LOD_UPDATE_INTERVAL * 3;
+		static const float EPSILON = 0.001f;
+
+		auto maxMatrixDifference = [](const Matrix4& a, const Matrix4& b)
+		{
+			float maxDiff = 0.0f;
+			for (UINT32 row = 0; row < 4; row++)
+			{
+				for (UINT32 col = 0; col < 4; col++)
+					maxDiff = std::max(maxDiff, std::abs(a[row][col] - b[row][col]));
+			}
+
+			return maxDiff;
+		};
+
+		Vector<BONE_DESC> bones;
+		SPtr<AnimationCurves> curves = bs_shared_ptr_new<AnimationCurves>();
+		createTestRig(NUM_BONES, NUM_KEYS, KEY_INTERVAL, bones, *curves);
+
+		SPtr<Skeleton> skeleton = Skeleton::create(bones.data(), NUM_BONES);
+		HAnimationClip clip = AnimationClip::create(curves);
+
+		// Single LOD so its selection doesn't depend on the camera
+		SPtr<Animation> anim = Animation::create();
+		anim->setSkeleton(skeleton);
+		anim->setLODs({ AnimationLOD(0.0f, LOD_UPDATE_INTERVAL, LOD_MAX_BONES) });
+		anim->play(clip);
+
+		AnimationManager& animManager = AnimationManager::instance();
+		RendererAnimationData output;
+
+		// Output transforms include the inverse bind pose, so remove it and the parent transform to get the local pose
+		auto getLocalTransform = [&](UINT32 boneIdx)
+		{
+			const RendererAnimationData::PoseInfo& poseInfo = output.infos.at(anim->_getId()).poseInfo;
+			const Matrix4* pose = &output.transforms[poseInfo.startIdx];
+
+			Matrix4 world = pose[boneIdx] * bones[boneIdx].invBindPose.inverseAffine();
+
+			UINT32 parentIdx = bones[boneIdx].parent;
+			if (parentIdx == (UINT32)-1)
+				return world;
+
+			Matrix4 parentWorld = pose[parentIdx] * bones[parentIdx].invBindPose.inverseAffine();
+			return parentWorld.inverseAffine() * world;
+		};
+
+		// First evaluation always evaluates all bones
+		animManager._evaluatePoses({ anim }, 0.0f, 0, output);
+
+		Vector<Matrix4> initialLocal(NUM_BONES);
+		for (UINT32 i = 0; i < NUM_BONES; i++)
+			initialLocal[i] = getLocalTransform(i);
+
+		float maxSkippedDiff = 0.0f;
+		float maxAnimatedDiff = 0.0f;
+		for (UINT32 i = 1; i <= NUM_UPDATES; i++)
+		{
+			animManager._evaluatePoses({ anim }, KEY_INTERVAL, i, output);
+
+			for (UINT32 j = 0; j < LOD_MAX_BONES; j++)
+				maxAnimatedDiff = std::max(maxAnimatedDiff, maxMatrixDifference(getLocalTransform(j), initialLocal[j]));
+
+			for (UINT32 j = LOD_MAX_BONES; j < NUM_BONES; j++)
+				maxSkippedDiff = std::max(maxSkippedDiff, maxMatrixDifference(getLocalTransform(j), initialLocal[j]));
+		}
+
+		BS_TEST_ASSERT(maxSkippedDiff < EPSILON);
+		BS_TEST_ASSERT(maxAnimatedDiff > EPSILON * 10.0f);
+	}
+
+	void EditorTestSuite::TestProjectLibraryScanJournal()
+	{
+		Path testDir = Path::combine(FileSystem::getTempDirectoryPath(), "testscanjournal");
+		if (FileSystem::exists(testDir))
+			FileSystem::remove(testDir);
+
+		FileSystem::createDir(testDir);
+
+		Path existingFile = Path::combine(testDir, "existing.txt");
+		FileSystem::createAndOpenFile(existingFile)->close();
+
+		ProjectLibrary::DirectoryEntry dirEntry(testDir, testDir.getWTail(), nullptr);
+
+		// Directories never scanned before must always be scanned
+		BS_TEST_ASSERT(ProjectLibrary::_isScanRequired(dirEntry));
+
+		// Modification times have a resolution of a second, so wait until a scan starting now is strictly newer than 
+		// the directory contents
+		std::time_t lastModifiedTime = FileSystem::getLastModifiedTime(testDir);
+		while (std::time(nullptr) <= lastModifiedTime)
+		{
+			BS_THREAD_SLEEP(10)
+		}
+
+		dirEntry.lastScanTime = std::time(nullptr);
+		BS_TEST_ASSERT(!ProjectLibrary::_isScanRequired(dirEntry));
+
+		// Modifying an existing file is caught by its own timestamp check, and doesn't require enumerating the directory
+		{
+			SPtr<DataStream> stream = FileSystem::openFile(existingFile, false);
+			UINT32 value = 0;
+			stream->write(&value, sizeof(value));
+			stream->close();
+		}
+
+		BS_TEST_ASSERT(!ProjectLibrary::_isScanRequired(dirEntry));
+
+		// Adding a file must trigger a rescan, even in the same second as the scan
+		FileSystem::createAndOpenFile(Path::combine(testDir, "added.txt"))->close();
+		BS_TEST_ASSERT(ProjectLibrary::_isScanRequired(dirEntry));
+
+		FileSystem::remove(testDir);
+	}
+}
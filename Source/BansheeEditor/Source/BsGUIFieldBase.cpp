@@ -25,8 +25,7 @@ namespace BansheeEngine
 
 	void GUIFieldBase::_updateLayoutInternal(const GUILayoutData& data)
 	{
-		mLayout->_setLayoutData(data);
-		mLayout->_updateLayoutInternal(data);
+		updateChildLayout(mLayout, data);
 	}
 
 	Vector2I GUIFieldBase::_getOptimalSize() const
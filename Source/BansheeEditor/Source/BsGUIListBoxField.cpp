@@ -184,8 +184,7 @@ namespace BansheeEngine
 
 	void GUIListBoxField::_updateLayoutInternal(const GUILayoutData& data)
 	{
-		mLayout->_setLayoutData(data);
-		mLayout->_updateLayoutInternal(data);
+		updateChildLayout(mLayout, data);
 	}
 
 	Vector2I GUIListBoxField::_getOptimalSize() const
@@ -37,6 +37,7 @@ namespace BansheeEngine
 		dragSepHighlightStyle, dimensions), mCutFlag(false)
 	{
 		SceneTreeViewLocator::_provide(this);
+		setVirtualized(true);
 
 		SPtr<GUIContextMenu> contextMenu = bs_shared_ptr_new<GUIContextMenu>();
 
@@ -124,11 +124,9 @@ namespace BansheeEngine
 
 	void GUIStatusBar::_updateLayoutInternal(const GUILayoutData& data)
 	{
-		mPanel->_setLayoutData(data);
-		mPanel->_updateLayoutInternal(data);
+		updateChildLayout(mPanel, data);
 
-		mBgPanel->_setLayoutData(data);
-		mBgPanel->_updateLayoutInternal(data);
+		updateChildLayout(mBgPanel, data);
 	}
 
 	Vector2I GUIStatusBar::_getOptimalSize() const
@@ -279,7 +279,7 @@ namespace BansheeEngine
 			GUILayoutData childData = data;
 			childData.area.height = optimalSize.y;
 
-			mBackgroundImage->_setLayoutData(childData);
+			updateChildLayout(mBackgroundImage, childData);
 		}
 
 		UINT32 curX = data.area.x + FIRST_TAB_OFFSET;
@@ -311,7 +311,7 @@ namespace BansheeEngine
 			childData.area.height = optimalSize.y;
 			childData.clipRect = tabClipRect;
 
-			btn->_setLayoutData(childData);
+			updateChildLayout(btn, childData);
 
 			curX += optimalSize.x;
 		}
@@ -328,7 +328,7 @@ namespace BansheeEngine
 			childData.area.width = minBtnOptimalSize.x;
 			childData.area.height = minBtnOptimalSize.y;
 
-			mMaxBtn->_setLayoutData(childData);
+			updateChildLayout(mMaxBtn, childData);
 		}
 
 		optionBtnXPos += minBtnOptimalSize.x + OPTION_BTN_SPACING;
@@ -343,7 +343,7 @@ namespace BansheeEngine
 			childData.area.width = closeBtnOptimalSize.x;
 			childData.area.height = closeBtnOptimalSize.y;
 
-			mCloseBtn->_setLayoutData(childData);
+			updateChildLayout(mCloseBtn, childData);
 		}
 	}
 
@@ -171,8 +171,7 @@ namespace BansheeEngine
 
 	void GUITextField::_updateLayoutInternal(const GUILayoutData& data)
 	{
-		mLayout->_setLayoutData(data);
-		mLayout->_updateLayoutInternal(data);
+		updateChildLayout(mLayout, data);
 	}
 
 	Vector2I GUITextField::_getOptimalSize() const
@@ -25,6 +25,7 @@ namespace BansheeEngine
 	const UINT32 GUITreeView::INDENT_SIZE = 10;
 	const UINT32 GUITreeView::INITIAL_INDENT_OFFSET = 16;
 	const UINT32 GUITreeView::DRAG_MIN_DISTANCE = 3;
+	const UINT32 GUITreeView::VIRTUAL_ROW_MARGIN = 5;
 	const float GUITreeView::AUTO_EXPAND_DELAY_SEC = 0.5f;
 	const float GUITreeView::SCROLL_AREA_HEIGHT_PCT = 0.1f;
 	const UINT32 GUITreeView::SCROLL_SPEED_PX_PER_SEC = 100;
@@ -89,7 +90,9 @@ namespace BansheeEngine
 		, mDragHighlightStyle(dragHighlightStyle), mDragSepHighlightStyle(dragSepHighlightStyle), mIsElementSelected(false)
 		, mIsElementHighlighted(false), mEditElement(nullptr), mNameEditBox(nullptr), mDragInProgress(false)
 		, mDragHighlight(nullptr), mDragSepHighlight(nullptr), mScrollState(ScrollState::None), mLastScrollTime(0.0f)
-		, mMouseOverDragElement(nullptr), mMouseOverDragElementTime(0.0f)
+		, mMouseOverDragElement(nullptr), mMouseOverDragElementTime(0.0f), mIsVirtualized(false), mRowTemplate(nullptr)
+		, mVirtualContentWidth(0), mVirtualContentWidthDirty(false), mVirtualRowsDirty(true), mVirtualRowsRebuilt(false)
+		, mFirstBoundRow(0), mLastBoundRow(0)
 	{
 		if(mBackgroundStyle == StringUtil::BLANK)
 			mBackgroundStyle = "TreeViewBackground";
@@ -158,6 +161,14 @@ namespace BansheeEngine
 
 		updateTreeElementHierarchy();
 
+		// Width of a virtualized tree view grows as rows are displayed. Parents can't be notified during layout update
+		// itself, as the flags would get cleared once the update finishes.
+		if(mVirtualContentWidthDirty)
+		{
+			mVirtualContentWidthDirty = false;
+			_markLayoutAsDirty();
+		}
+
 		// Attempt to scroll if needed
 		if(mScrollState != ScrollState::None)
 		{
@@ -241,54 +252,77 @@ namespace BansheeEngine
 								TreeElement* selectionRoot = mSelectedElements[0].element;
 								unselectAll();
 
-								auto iterStartFind = std::find_if(mVisibleElements.begin(), mVisibleElements.end(),
-									[&](const InteractableElement& x) { return x.parent == selectionRoot->mParent; });
-
-								bool foundStart = false;
-								bool foundEnd = false;
-								for (; iterStartFind != mVisibleElements.end(); ++iterStartFind)
+								if (mIsVirtualized)
 								{
-									if (!iterStartFind->isTreeElement())
-										continue;
+									// Rows outside of the visible area have no interactable elements, so rows are used
+									// to find the range instead
+									updateVirtualRows();
 
-									TreeElement* curElem = iterStartFind->getTreeElement();
-									if (curElem == selectionRoot)
+									INT32 startIdx = findRowIndex(selectionRoot);
+									INT32 endIdx = findRowIndex(treeElement);
+
+									if (startIdx >= 0 && endIdx >= 0)
 									{
-										foundStart = true;
-										break;
+										INT32 first = std::min(startIdx, endIdx);
+										INT32 last = std::max(startIdx, endIdx);
+
+										for (INT32 i = first; i <= last; i++)
+											selectElement(mVirtualRows[i].element);
 									}
+									else
+										selectElement(treeElement);
 								}
-
-								auto iterEndFind = std::find_if(mVisibleElements.begin(), mVisibleElements.end(),
-									[&](const InteractableElement& x) { return &x == element; });
-
-								if (iterEndFind != mVisibleElements.end())
-									foundEnd = true;
-
-								if (foundStart && foundEnd)
+								else
 								{
-									if (iterStartFind < iterEndFind)
+									auto iterStartFind = std::find_if(mVisibleElements.begin(), mVisibleElements.end(),
+										[&](const InteractableElement& x) { return x.parent == selectionRoot->mParent; });
+
+									bool foundStart = false;
+									bool foundEnd = false;
+									for (; iterStartFind != mVisibleElements.end(); ++iterStartFind)
 									{
-										for (; iterStartFind != (iterEndFind + 1); ++iterStartFind)
+										if (!iterStartFind->isTreeElement())
+											continue;
+
+										TreeElement* curElem = iterStartFind->getTreeElement();
+										if (curElem == selectionRoot)
 										{
-											if (iterStartFind->isTreeElement())
-												selectElement(iterStartFind->getTreeElement());
+											foundStart = true;
+											break;
 										}
 									}
-									else if (iterEndFind < iterStartFind)
+
+									auto iterEndFind = std::find_if(mVisibleElements.begin(), mVisibleElements.end(),
+										[&](const InteractableElement& x) { return &x == element; });
+
+									if (iterEndFind != mVisibleElements.end())
+										foundEnd = true;
+
+									if (foundStart && foundEnd)
 									{
-										for (; iterEndFind != (iterStartFind + 1); ++iterEndFind)
+										if (iterStartFind < iterEndFind)
 										{
-											if (iterEndFind->isTreeElement())
-												selectElement(iterEndFind->getTreeElement());
+											for (; iterStartFind != (iterEndFind + 1); ++iterStartFind)
+											{
+												if (iterStartFind->isTreeElement())
+													selectElement(iterStartFind->getTreeElement());
+											}
 										}
+										else if (iterEndFind < iterStartFind)
+										{
+											for (; iterEndFind != (iterStartFind + 1); ++iterEndFind)
+											{
+												if (iterEndFind->isTreeElement())
+													selectElement(iterEndFind->getTreeElement());
+											}
+										}
+										else
+											selectElement(treeElement);
 									}
-									else
+
+									if (!foundStart || !foundEnd)
 										selectElement(treeElement);
 								}
-
-								if (!foundStart || !foundEnd)
-									selectElement(treeElement);
 							}
 							else
 							{
@@ -444,9 +478,30 @@ namespace BansheeEngine
 
 	bool GUITreeView::_commandEvent(const GUICommandEvent& ev)
 	{
+		// Rows outside of the visible area have no interactable elements, so rows are used to find the neighbors instead
+		if(mIsVirtualized)
+			updateVirtualRows();
+
 		if(ev.getType() == GUICommandEventType::MoveUp || ev.getType() == GUICommandEventType::SelectUp)
 		{
 			TreeElement* topMostElement = getTopMostSelectedElement();
+
+			if(mIsVirtualized)
+			{
+				INT32 rowIdx = topMostElement != nullptr ? findRowIndex(topMostElement) : -1;
+				if(rowIdx > 0)
+				{
+					if(ev.getType() == GUICommandEventType::MoveUp)
+						unselectAll();
+
+					TreeElement* treeElement = mVirtualRows[rowIdx - 1].element;
+					selectElement(treeElement);
+					scrollToElement(treeElement, false);
+				}
+
+				return GUIElementContainer::_commandEvent(ev);
+			}
+
 			auto topMostIter = std::find_if(mVisibleElements.begin(), mVisibleElements.end(), 
 				[&] (const InteractableElement& x) { return x.getTreeElement() == topMostElement; });
 
@@ -471,6 +526,23 @@ namespace BansheeEngine
 		else if(ev.getType() == GUICommandEventType::MoveDown || ev.getType() == GUICommandEventType::SelectDown)
 		{
 			TreeElement* bottoMostElement = getBottomMostSelectedElement();
+
+			if(mIsVirtualized)
+			{
+				INT32 rowIdx = bottoMostElement != nullptr ? findRowIndex(bottoMostElement) : -1;
+				if(rowIdx >= 0 && (rowIdx + 1) < (INT32)mVirtualRows.size())
+				{
+					if(ev.getType() == GUICommandEventType::MoveDown)
+						unselectAll();
+
+					TreeElement* treeElement = mVirtualRows[rowIdx + 1].element;
+					selectElement(treeElement);
+					scrollToElement(treeElement, false);
+				}
+
+				return GUIElementContainer::_commandEvent(ev);
+			}
+
 			auto bottomMostIter = std::find_if(mVisibleElements.begin(), mVisibleElements.end(), 
 				[&] (const InteractableElement& x) { return x.getTreeElement() == bottoMostElement; });
 
@@ -747,80 +819,252 @@ namespace BansheeEngine
 
 	void GUITreeView::updateElementGUI(TreeElement* element)
 	{
+		// Visibility, children or names (and therefore sort order) of the element might have changed
+		mVirtualRowsDirty = true;
+
 		if(element == &getRootElement())
 			return;
 
 		if(element->mIsVisible)
 		{
-			HString name(toWString(element->mName));
-			if(element->mElement == nullptr)
+			// Virtualized rows outside of the visible area get their GUI elements once they are scrolled into view
+			if(!mIsVirtualized || element->mElement != nullptr)
+				bindElementGUI(element);
+		}
+		else
+		{
+			unbindElementGUI(element);
+
+			if(element->mIsSelected && element->mIsExpanded)
+				unselectElement(element);
+		}
+
+		_markLayoutAsDirty();
+	}
+
+	void GUITreeView::bindElementGUI(TreeElement* element)
+	{
+		HString name(toWString(element->mName));
+		if(element->mElement == nullptr)
+		{
+			if(!mLabelPool.empty())
+			{
+				element->mElement = mLabelPool.back();
+				mLabelPool.pop_back();
+
+				// Label of the element being renamed stays hidden behind the edit box
+				element->mElement->setVisible(element != mEditElement);
+			}
+			else
 			{
 				element->mElement = GUILabel::create(name, mElementBtnStyle);
 				_registerChildElement(element->mElement);
 			}
+		}
 
-			if (element->mIsCut)
-			{
-				Color cutTint = element->mTint;
-				cutTint.a = CUT_COLOR.a;
+		if (element->mIsCut)
+		{
+			Color cutTint = element->mTint;
+			cutTint.a = CUT_COLOR.a;
 
-				element->mElement->setTint(cutTint);
-			}
-			else if(element->mIsDisabled)
-			{
-				Color disabledTint = element->mTint;
-				disabledTint.a = DISABLED_COLOR.a;
+			element->mElement->setTint(cutTint);
+		}
+		else if(element->mIsDisabled)
+		{
+			Color disabledTint = element->mTint;
+			disabledTint.a = DISABLED_COLOR.a;
 
-				element->mElement->setTint(disabledTint);
-			}
-			else
-				element->mElement->setTint(element->mTint);
+			element->mElement->setTint(disabledTint);
+		}
+		else
+			element->mElement->setTint(element->mTint);
 
-			if(element->mChildren.size() > 0)
+		if(element->mChildren.size() > 0)
+		{
+			if(element->mFoldoutBtn == nullptr)
 			{
-				if(element->mFoldoutBtn == nullptr)
+				if(!mFoldoutPool.empty())
+				{
+					element->mFoldoutBtn = mFoldoutPool.back();
+					mFoldoutPool.pop_back();
+
+					// Restore the state before connecting, so it doesn't trigger an expand or a collapse
+					if(element->mIsExpanded)
+						element->mFoldoutBtn->toggleOn();
+					else
+						element->mFoldoutBtn->toggleOff();
+
+					element->mFoldoutBtn->setVisible(true);
+					element->mFoldoutToggledConn = element->mFoldoutBtn->onToggled.connect(
+						std::bind(&GUITreeView::elementToggled, this, element, _1));
+				}
+				else
 				{
 					element->mFoldoutBtn = GUIToggle::create(GUIContent(HString(L"")), mFoldoutBtnStyle);
 					_registerChildElement(element->mFoldoutBtn);
 
-					element->mFoldoutBtn->onToggled.connect(std::bind(&GUITreeView::elementToggled, this, element, _1));
+					element->mFoldoutToggledConn = element->mFoldoutBtn->onToggled.connect(
+						std::bind(&GUITreeView::elementToggled, this, element, _1));
 
 					if(element->mIsExpanded)
 						element->mFoldoutBtn->toggleOn();
 				}
 			}
-			else
+		}
+		else
+			unbindFoldoutGUI(element);
+
+		element->mElement->setContent(GUIContent(name));
+	}
+
+	void GUITreeView::unbindElementGUI(TreeElement* element)
+	{
+		if(element->mElement != nullptr)
+		{
+			if(mIsVirtualized)
 			{
-				if(element->mFoldoutBtn != nullptr)
-				{
-					GUIElement::destroy(element->mFoldoutBtn);
-					element->mFoldoutBtn = nullptr;
-				}
+				element->mElement->setVisible(false);
+				mLabelPool.push_back(element->mElement);
 			}
+			else
+				GUIElement::destroy(element->mElement);
+
+			element->mElement = nullptr;
+		}
+
+		unbindFoldoutGUI(element);
+	}
+
+	void GUITreeView::unbindFoldoutGUI(TreeElement* element)
+	{
+		if(element->mFoldoutBtn == nullptr)
+			return;
 
-			element->mElement->setContent(GUIContent(name));
+		if(mIsVirtualized)
+		{
+			element->mFoldoutToggledConn.disconnect();
+			element->mFoldoutBtn->setVisible(false);
+			mFoldoutPool.push_back(element->mFoldoutBtn);
 		}
 		else
+			GUIElement::destroy(element->mFoldoutBtn);
+
+		element->mFoldoutBtn = nullptr;
+	}
+
+	void GUITreeView::setVirtualized(bool enabled)
+	{
+		if(mIsVirtualized == enabled)
+			return;
+
+		if(enabled)
 		{
-			if(element->mElement != nullptr)
+			// Never displayed, only used for determining the height of the rows
+			if(mRowTemplate == nullptr)
 			{
-				GUIElement::destroy(element->mElement);
-				element->mElement = nullptr;
+				mRowTemplate = GUILabel::create(HString(L"Ag"), mElementBtnStyle);
+				mRowTemplate->setVisible(false);
+
+				_registerChildElement(mRowTemplate);
 			}
 
-			if(element->mFoldoutBtn != nullptr)
+			mIsVirtualized = true;
+			mVirtualRowsDirty = true;
+		}
+		else
+		{
+			for(auto& label : mLabelPool)
+				GUIElement::destroy(label);
+
+			for(auto& foldoutBtn : mFoldoutPool)
+				GUIElement::destroy(foldoutBtn);
+
+			mLabelPool.clear();
+			mFoldoutPool.clear();
+			mIsVirtualized = false;
+
+			// All visible rows require GUI elements when not virtualized
+			Stack<TreeElement*> todo;
+			todo.push(&getRootElement());
+
+			while(!todo.empty())
 			{
-				GUIElement::destroy(element->mFoldoutBtn);
-				element->mFoldoutBtn = nullptr;
-			}
+				TreeElement* current = todo.top();
+				todo.pop();
 
-			if(element->mIsSelected && element->mIsExpanded)
-				unselectElement(element);
+				if(current != &getRootElement() && current->mElement == nullptr)
+					bindElementGUI(current);
+
+				for(auto& child : current->mChildren)
+				{
+					if(child->mIsVisible)
+						todo.push(child);
+				}
+			}
 		}
 
 		_markLayoutAsDirty();
 	}
 
+	UINT32 GUITreeView::getVirtualRowHeight() const
+	{
+		if(mRowTemplate == nullptr)
+			return ELEMENT_EXTRA_SPACING;
+
+		return (UINT32)mRowTemplate->_getOptimalSize().y + ELEMENT_EXTRA_SPACING;
+	}
+
+	INT32 GUITreeView::findRowIndex(const TreeElement* element) const
+	{
+		if(!element->mIsVisible)
+			return -1;
+
+		for(UINT32 i = 0; i < (UINT32)mVirtualRows.size(); i++)
+		{
+			if(mVirtualRows[i].element == element)
+				return (INT32)i;
+		}
+
+		return -1;
+	}
+
+	void GUITreeView::updateVirtualRows()
+	{
+		if(!mVirtualRowsDirty)
+			return;
+
+		mVirtualRows.clear();
+
+		Stack<VirtualRow> todo;
+		todo.push(VirtualRow(&getRootElement(), 0));
+
+		Vector<TreeElement*> tempOrderedElements;
+		while(!todo.empty())
+		{
+			VirtualRow current = todo.top();
+			todo.pop();
+
+			if(current.element != &getRootElement())
+				mVirtualRows.push_back(current);
+
+			tempOrderedElements.clear();
+			tempOrderedElements.resize(current.element->mChildren.size(), nullptr);
+			for(auto& child : current.element->mChildren)
+				tempOrderedElements[child->mSortedIdx] = child;
+
+			for(auto iter = tempOrderedElements.rbegin(); iter != tempOrderedElements.rend(); ++iter)
+			{
+				TreeElement* child = *iter;
+
+				if(child->mIsVisible)
+					todo.push(VirtualRow(child, current.indent + 1));
+			}
+		}
+
+		mVirtualRowsDirty = false;
+		mVirtualRowsRebuilt = true;
+	}
+
 	void GUITreeView::elementToggled(TreeElement* element, bool toggled)
 	{
 		clearPing();
@@ -906,32 +1150,44 @@ namespace BansheeEngine
 		}
 		else
 		{
-			Stack<UpdateTreeElement> todo;
-			todo.push(UpdateTreeElement(&getRootElementConst(), 0));
+			if(mIsVirtualized)
+			{
+				// All rows are of the same height, so only their number is needed. Rows are kept up to date by
+				// _updateOptimalLayoutSizes().
+				UINT32 numRows = (UINT32)mVirtualRows.size();
 
-			while(!todo.empty())
+				optimalSize.x = (INT32)mVirtualContentWidth;
+				optimalSize.y = (INT32)(numRows * getVirtualRowHeight());
+			}
+			else
 			{
-				UpdateTreeElement currentUpdateElement = todo.top();
-				const TreeElement* current = currentUpdateElement.element;
-				todo.pop();
+				Stack<UpdateTreeElement> todo;
+				todo.push(UpdateTreeElement(&getRootElementConst(), 0));
 
-				INT32 yOffset = 0;
-				if(current->mElement != nullptr)
+				while(!todo.empty())
 				{
-					Vector2I curOptimalSize = current->mElement->_getOptimalSize();
-					optimalSize.x = std::max(optimalSize.x, 
-						(INT32)(INITIAL_INDENT_OFFSET + curOptimalSize.x + currentUpdateElement.indent * INDENT_SIZE));
-					yOffset = curOptimalSize.y + ELEMENT_EXTRA_SPACING;
-				}
+					UpdateTreeElement currentUpdateElement = todo.top();
+					const TreeElement* current = currentUpdateElement.element;
+					todo.pop();
 
-				optimalSize.y += yOffset;
+					INT32 yOffset = 0;
+					if(current->mElement != nullptr)
+					{
+						Vector2I curOptimalSize = current->mElement->_getOptimalSize();
+						optimalSize.x = std::max(optimalSize.x, 
+							(INT32)(INITIAL_INDENT_OFFSET + curOptimalSize.x + currentUpdateElement.indent * INDENT_SIZE));
+						yOffset = curOptimalSize.y + ELEMENT_EXTRA_SPACING;
+					}
 
-				for(auto& child : current->mChildren)
-				{
-					if(!child->mIsVisible)
-						continue;
+					optimalSize.y += yOffset;
+
+					for(auto& child : current->mChildren)
+					{
+						if(!child->mIsVisible)
+							continue;
 
-					todo.push(UpdateTreeElement(child, currentUpdateElement.indent + 1));
+						todo.push(UpdateTreeElement(child, currentUpdateElement.indent + 1));
+					}
 				}
 			}
 
@@ -961,6 +1217,14 @@ namespace BansheeEngine
 		return optimalSize;
 	}
 
+	void GUITreeView::_updateOptimalLayoutSizes()
+	{
+		if(mIsVirtualized)
+			updateVirtualRows();
+
+		GUIElementContainer::_updateOptimalLayoutSizes();
+	}
+
 	void GUITreeView::updateClippedBounds()
 	{
 		mClippedBounds = mLayoutData.area;
@@ -981,88 +1245,99 @@ namespace BansheeEngine
 
 		mVisibleElements.clear();
 
-		Stack<UpdateTreeElement> todo;
-		todo.push(UpdateTreeElement(&getRootElement(), 0));
-
-		// NOTE - Instead of iterating through all elements, try to find those within the clip rect
-		// and only iterate through those. Others should somehow be marked in-active (similar to GUIElement::isDisabled()?)
-
-		Vector<TreeElement*> tempOrderedElements;
-
 		Vector2I offset(data.area.x, data.area.y);
 
-		while(!todo.empty())
+		if(mIsVirtualized)
 		{
-			UpdateTreeElement currentUpdateElement = todo.top();
-			TreeElement* current = currentUpdateElement.element;
-			UINT32 indent = currentUpdateElement.indent;
-			todo.pop();
+			// Only rows within the clip rect (plus a margin) get GUI elements and are laid out. Rest of the rows are only
+			// accounted for, and their GUI elements are released so they can be reused by rows that scroll into view.
+			// The clip rect assigned by the parent scroll area is offset by the scroll amount, so no other information
+			// from the scroll area is needed.
+			updateVirtualRows();
 
-			INT32 btnHeight = 0;
-			INT32 yOffset = 0;
-			if(current->mElement != nullptr)
-			{
-				Vector2I elementSize = current->mElement->_getOptimalSize();
-				btnHeight = elementSize.y;
+			UINT32 rowHeight = getVirtualRowHeight();
+			INT32 numRows = (INT32)mVirtualRows.size();
 
-				mVisibleElements.push_back(InteractableElement(current->mParent, current->mSortedIdx * 2 + 0, Rect2I(data.area.x, offset.y, data.area.width, ELEMENT_EXTRA_SPACING)));
-				mVisibleElements.push_back(InteractableElement(current->mParent, current->mSortedIdx * 2 + 1, Rect2I(data.area.x, offset.y + ELEMENT_EXTRA_SPACING, data.area.width, btnHeight)));
+			INT32 visibleTop = data.clipRect.y - data.area.y - (INT32)(VIRTUAL_ROW_MARGIN * rowHeight);
+			INT32 visibleBottom = visibleTop + (INT32)data.clipRect.height + (INT32)(2 * VIRTUAL_ROW_MARGIN * rowHeight);
 
-				offset.x = data.area.x + INITIAL_INDENT_OFFSET + indent * INDENT_SIZE;
-				offset.y += ELEMENT_EXTRA_SPACING;
-
-				GUILayoutData childData = data;
-				childData.area.x = offset.x;
-				childData.area.y = offset.y;
-				childData.area.width = elementSize.x;
-				childData.area.height = elementSize.y;
+			UINT32 firstRow = (UINT32)Math::clamp(visibleTop / (INT32)rowHeight, 0, numRows);
+			UINT32 lastRow = (UINT32)Math::clamp(visibleBottom / (INT32)rowHeight + 1, (INT32)firstRow, numRows);
 
-				current->mElement->_setLayoutData(childData);
+			// Row indices are only comparable with the previous update if the rows weren't rebuilt in the meantime
+			UINT32 releaseStart = mVirtualRowsRebuilt ? 0 : std::min(mFirstBoundRow, (UINT32)numRows);
+			UINT32 releaseEnd = mVirtualRowsRebuilt ? (UINT32)numRows : std::min(mLastBoundRow, (UINT32)numRows);
 
-				yOffset = btnHeight;
+			for(UINT32 i = releaseStart; i < releaseEnd; i++)
+			{
+				if(i < firstRow || i >= lastRow)
+					unbindElementGUI(mVirtualRows[i].element);
 			}
 
-			if(current->mFoldoutBtn != nullptr)
-			{
-				Vector2I elementSize = current->mFoldoutBtn->_getOptimalSize();
+			mVirtualRowsRebuilt = false;
+			mFirstBoundRow = firstRow;
+			mLastBoundRow = lastRow;
 
-				offset.x -= std::min((INT32)INITIAL_INDENT_OFFSET, elementSize.x + 2);
+			UINT32 contentWidth = 0;
+			offset.y += (INT32)(firstRow * rowHeight);
 
-				Vector2I myOffset = offset;
-				myOffset.y += 1;
+			for(UINT32 i = firstRow; i < lastRow; i++)
+			{
+				TreeElement* current = mVirtualRows[i].element;
+				UINT32 indent = mVirtualRows[i].indent;
 
-				if(elementSize.y > btnHeight)
-				{
-					UINT32 diff = elementSize.y - btnHeight;
-					float half = diff * 0.5f;
-					myOffset.y -= Math::floorToInt(half);
-				}
+				if(current->mElement == nullptr)
+					bindElementGUI(current);
 
-				GUILayoutData childData = data;
-				childData.area.x = myOffset.x;
-				childData.area.y = myOffset.y;
-				childData.area.width = elementSize.x;
-				childData.area.height = elementSize.y;
+				Vector2I elementSize;
+				elementSize.x = current->mElement->_getOptimalSize().x;
+				elementSize.y = (INT32)(rowHeight - ELEMENT_EXTRA_SPACING);
 
-				current->mFoldoutBtn->_setLayoutData(childData);
+				contentWidth = std::max(contentWidth, INITIAL_INDENT_OFFSET + indent * INDENT_SIZE + elementSize.x);
+
+				updateRowLayout(current, indent, elementSize, data, offset);
 			}
 
-			offset.y += yOffset;
+			offset.y = data.area.y + numRows * (INT32)rowHeight;
 
-			tempOrderedElements.resize(current->mChildren.size(), nullptr);
-			for(auto& child : current->mChildren)
+			if(contentWidth > mVirtualContentWidth)
 			{
-				tempOrderedElements[child->mSortedIdx] = child;
+				mVirtualContentWidth = contentWidth;
+				mVirtualContentWidthDirty = true;
 			}
+		}
+		else
+		{
+			Stack<UpdateTreeElement> todo;
+			todo.push(UpdateTreeElement(&getRootElement(), 0));
 
-			for(auto iter = tempOrderedElements.rbegin(); iter != tempOrderedElements.rend(); ++iter)
+			Vector<TreeElement*> tempOrderedElements;
+
+			while(!todo.empty())
 			{
-				TreeElement* child = *iter;
+				UpdateTreeElement currentUpdateElement = todo.top();
+				TreeElement* current = currentUpdateElement.element;
+				UINT32 indent = currentUpdateElement.indent;
+				todo.pop();
+
+				if(current->mElement != nullptr)
+					updateRowLayout(current, indent, current->mElement->_getOptimalSize(), data, offset);
+
+				tempOrderedElements.resize(current->mChildren.size(), nullptr);
+				for(auto& child : current->mChildren)
+				{
+					tempOrderedElements[child->mSortedIdx] = child;
+				}
 
-				if(!child->mIsVisible)
-					continue;
+				for(auto iter = tempOrderedElements.rbegin(); iter != tempOrderedElements.rend(); ++iter)
+				{
+					TreeElement* child = *iter;
 
-				todo.push(UpdateTreeElement(child, indent + 1));
+					if(!child->mIsVisible)
+						continue;
+
+					todo.push(UpdateTreeElement(child, indent + 1));
+				}
 			}
 		}
 
@@ -1074,14 +1349,19 @@ namespace BansheeEngine
 		for(auto selectedElem : mSelectedElements)
 		{
 			GUILabel* targetElement = selectedElem.element->mElement;
-			if (targetElement == nullptr)
-				continue;
-
 			GUILayoutData childData = data;
-			childData.area.y = targetElement->_getLayoutData().area.y;
-			childData.area.height = targetElement->_getLayoutData().area.height;
 
-			selectedElem.background->_setLayoutData(childData);
+			if (targetElement != nullptr)
+			{
+				childData.area.y = targetElement->_getLayoutData().area.y;
+				childData.area.height = targetElement->_getLayoutData().area.height;
+			}
+			else if (mIsVirtualized) // Row scrolled out of view
+				childData.area.height = 0;
+			else
+				continue;
+
+			updateChildLayout(selectedElem.background, childData);
 		}
 
 		if (mIsElementHighlighted)
@@ -1093,7 +1373,14 @@ namespace BansheeEngine
 				childData.area.y = targetElement->_getLayoutData().area.y;
 				childData.area.height = targetElement->_getLayoutData().area.height;
 
-				mHighlightedElement.background->_setLayoutData(childData);
+				updateChildLayout(mHighlightedElement.background, childData);
+			}
+			else if (mIsVirtualized) // Row scrolled out of view
+			{
+				GUILayoutData childData = data;
+				childData.area.height = 0;
+
+				updateChildLayout(mHighlightedElement.background, childData);
 			}
 		}
 
@@ -1108,7 +1395,14 @@ namespace BansheeEngine
 				childData.area = targetElement->_getLayoutData().area;
 				childData.area.width = remainingWidth;
 
-				mNameEditBox->_setLayoutData(childData);
+				updateChildLayout(mNameEditBox, childData);
+			}
+			else if (mIsVirtualized) // Row scrolled out of view
+			{
+				GUILayoutData childData = data;
+				childData.area.height = 0;
+
+				updateChildLayout(mNameEditBox, childData);
 			}
 		}
 
@@ -1131,7 +1425,7 @@ namespace BansheeEngine
 					GUILayoutData childData = data;
 					childData.area = interactableElement->bounds;
 
-					mDragHighlight->_setLayoutData(childData);
+					updateChildLayout(mDragHighlight, childData);
 				}
 				else
 				{
@@ -1141,7 +1435,7 @@ namespace BansheeEngine
 					GUILayoutData childData = data;
 					childData.area = interactableElement->bounds;
 
-					mDragSepHighlight->_setLayoutData(childData);
+					updateChildLayout(mDragSepHighlight, childData);
 				}
 			}
 		}
@@ -1165,6 +1459,53 @@ namespace BansheeEngine
 		mBottomScrollBounds.height = scrollHeight;
 	}
 
+	void GUITreeView::updateRowLayout(TreeElement* element, UINT32 indent, const Vector2I& elementSize, 
+		const GUILayoutData& data, Vector2I& offset)
+	{
+		INT32 btnHeight = elementSize.y;
+
+		mVisibleElements.push_back(InteractableElement(element->mParent, element->mSortedIdx * 2 + 0, Rect2I(data.area.x, offset.y, data.area.width, ELEMENT_EXTRA_SPACING)));
+		mVisibleElements.push_back(InteractableElement(element->mParent, element->mSortedIdx * 2 + 1, Rect2I(data.area.x, offset.y + ELEMENT_EXTRA_SPACING, data.area.width, btnHeight)));
+
+		offset.x = data.area.x + INITIAL_INDENT_OFFSET + indent * INDENT_SIZE;
+		offset.y += ELEMENT_EXTRA_SPACING;
+
+		GUILayoutData childData = data;
+		childData.area.x = offset.x;
+		childData.area.y = offset.y;
+		childData.area.width = elementSize.x;
+		childData.area.height = elementSize.y;
+
+		updateChildLayout(element->mElement, childData);
+
+		if(element->mFoldoutBtn != nullptr)
+		{
+			Vector2I foldoutSize = element->mFoldoutBtn->_getOptimalSize();
+
+			offset.x -= std::min((INT32)INITIAL_INDENT_OFFSET, foldoutSize.x + 2);
+
+			Vector2I myOffset = offset;
+			myOffset.y += 1;
+
+			if(foldoutSize.y > btnHeight)
+			{
+				UINT32 diff = foldoutSize.y - btnHeight;
+				float half = diff * 0.5f;
+				myOffset.y -= Math::floorToInt(half);
+			}
+
+			GUILayoutData foldoutData = data;
+			foldoutData.area.x = myOffset.x;
+			foldoutData.area.y = myOffset.y;
+			foldoutData.area.width = foldoutSize.x;
+			foldoutData.area.height = foldoutSize.y;
+
+			updateChildLayout(element->mFoldoutBtn, foldoutData);
+		}
+
+		offset.y += btnHeight;
+	}
+
 	const GUITreeView::InteractableElement* GUITreeView::findElementUnderCoord(const Vector2I& coord) const
 	{
 		for(auto& element : mVisibleElements)
@@ -1180,6 +1521,19 @@ namespace BansheeEngine
 
 	GUITreeView::TreeElement* GUITreeView::getTopMostSelectedElement() const
 	{
+		if(mIsVirtualized)
+		{
+			INT32 topMostIdx = -1;
+			for(auto& selectedElement : mSelectedElements)
+			{
+				INT32 rowIdx = findRowIndex(selectedElement.element);
+				if(rowIdx >= 0 && (topMostIdx < 0 || rowIdx < topMostIdx))
+					topMostIdx = rowIdx;
+			}
+
+			return topMostIdx >= 0 ? mVirtualRows[topMostIdx].element : nullptr;
+		}
+
 		auto topMostElement = mVisibleElements.end();
 
 		for(auto& selectedElement : mSelectedElements)
@@ -1207,6 +1561,15 @@ namespace BansheeEngine
 
 	GUITreeView::TreeElement* GUITreeView::getBottomMostSelectedElement() const
 	{
+		if(mIsVirtualized)
+		{
+			INT32 bottomMostIdx = -1;
+			for(auto& selectedElement : mSelectedElements)
+				bottomMostIdx = std::max(bottomMostIdx, findRowIndex(selectedElement.element));
+
+			return bottomMostIdx >= 0 ? mVirtualRows[bottomMostIdx].element : nullptr;
+		}
+
 		auto botMostElement = mVisibleElements.end();
 
 		for(auto& selectedElement : mSelectedElements)
@@ -1293,7 +1656,23 @@ namespace BansheeEngine
 
 	void GUITreeView::scrollToElement(TreeElement* element, bool center)
 	{
-		if(element->mElement == nullptr)
+		Rect2I elementArea;
+		if(element->mElement != nullptr)
+			elementArea = element->mElement->_getLayoutData().area;
+		else if(mIsVirtualized)
+		{
+			// Row is out of view and has no GUI elements, but its position is known from its index
+			updateVirtualRows();
+
+			INT32 rowIdx = findRowIndex(element);
+			if(rowIdx < 0)
+				return;
+
+			UINT32 rowHeight = getVirtualRowHeight();
+			elementArea.y = mLayoutData.area.y + rowIdx * (INT32)rowHeight + ELEMENT_EXTRA_SPACING;
+			elementArea.height = rowHeight - ELEMENT_EXTRA_SPACING;
+		}
+		else
 			return;
 
 		GUIScrollArea* scrollArea = findParentScrollArea();
@@ -1304,7 +1683,7 @@ namespace BansheeEngine
 		{
 			Rect2I myBounds = _getClippedBounds();
 			INT32 clipVertCenter = myBounds.y + (INT32)Math::roundToInt(myBounds.height * 0.5f);
-			INT32 elemVertCenter = element->mElement->_getLayoutData().area.y + (INT32)Math::roundToInt(element->mElement->_getLayoutData().area.height * 0.5f);
+			INT32 elemVertCenter = elementArea.y + (INT32)Math::roundToInt(elementArea.height * 0.5f);
 
 			if(elemVertCenter > clipVertCenter)
 				scrollArea->scrollDownPx(elemVertCenter - clipVertCenter);
@@ -1314,8 +1693,8 @@ namespace BansheeEngine
 		else
 		{
 			Rect2I myBounds = _getClippedBounds();
-			INT32 elemVertTop = element->mElement->_getLayoutData().area.y;
-			INT32 elemVertBottom = element->mElement->_getLayoutData().area.y + element->mElement->_getLayoutData().area.height;
+			INT32 elemVertTop = elementArea.y;
+			INT32 elemVertBottom = elementArea.y + elementArea.height;
 
 			INT32 top = myBounds.y;
 			INT32 bottom = myBounds.y + myBounds.height;
@@ -925,6 +925,28 @@ namespace BansheeEngine
 		fadedColor.a *= 0.2f;
 	}
 
+	/** Checks if any of the provided gizmo entries are marked as pickable. */
+	template<class T>
+	bool anyPickable(const Vector<T>& entries)
+	{
+		for (auto& entry : entries)
+		{
+			if (entry.pickable)
+				return true;
+		}
+
+		return false;
+	}
+
+	bool GizmoManager::hasPickableGizmos() const
+	{
+		return anyPickable(mSolidCubeData) || anyPickable(mWireCubeData) || anyPickable(mSolidSphereData) ||
+			anyPickable(mWireSphereData) || anyPickable(mSolidConeData) || anyPickable(mWireConeData) ||
+			anyPickable(mLineData) || anyPickable(mLineListData) || anyPickable(mWireDiscData) ||
+			anyPickable(mWireArcData) || anyPickable(mWireMeshData) || anyPickable(mFrustumData) ||
+			anyPickable(mIconData) || anyPickable(mTextData);
+	}
+
 	HSceneObject GizmoManager::getSceneObject(UINT32 gizmoIdx)
 	{
 		auto iterFind = mIdxToSceneObjectMap.find(gizmoIdx);
@@ -0,0 +1,126 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsImportCache.h"
+#include "BsProjectResourceMeta.h"
+#include "BsImporter.h"
+#include "BsImportOptions.h"
+#include "BsMemorySerializer.h"
+#include "BsFileSerializer.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsUUID.h"
+
+namespace BansheeEngine
+{
+	const UINT32 ImportCache::VERSION = 1;
+	const WString ImportCache::META_FILENAME = L"Meta.asset";
+
+	String ImportCache::generateKey(const Path& sourcePath, const SPtr<ImportOptions>& importOptions)
+	{
+		SPtr<DataStream> sourceStream = FileSystem::openFile(sourcePath);
+		if (sourceStream == nullptr)
+			return StringUtil::BLANK;
+
+		String contentHash = md5(sourceStream);
+		sourceStream->close();
+
+		String optionsHash;
+		if (importOptions != nullptr)
+		{
+			MemorySerializer ms;
+
+			UINT32 size = 0;
+			UINT8* data = ms.encode(importOptions.get(), size);
+
+			SPtr<DataStream> optionsStream = bs_shared_ptr_new<MemoryDataStream>(data, size);
+			optionsHash = md5(optionsStream);
+		}
+
+		String extension = sourcePath.getExtension();
+		StringUtil::toLowerCase(extension);
+
+		UINT32 importerVersion = gImporter()._getImporterVersion(sourcePath);
+		return md5(contentHash + "_" + optionsHash + "_" + extension + "_" + toString(importerVersion) + "_" + 
+			toString(VERSION));
+	}
+
+	SPtr<ProjectFileMeta> ImportCache::find(const Path& cacheFolder, const String& key)
+	{
+		if (key.empty())
+			return nullptr;
+
+		Path metaPath = getEntryFolder(cacheFolder, key);
+		metaPath.setFilename(META_FILENAME);
+
+		// Meta file is written last, so its existence means all the resources are present
+		if (!FileSystem::isFile(metaPath))
+			return nullptr;
+
+		FileDecoder fs(metaPath);
+		SPtr<IReflectable> loadedMeta = fs.decode();
+
+		if (loadedMeta == nullptr || !loadedMeta->isDerivedFrom(ProjectFileMeta::getRTTIStatic()))
+			return nullptr;
+
+		return std::static_pointer_cast<ProjectFileMeta>(loadedMeta);
+	}
+
+	Path ImportCache::getResourcePath(const Path& cacheFolder, const String& key, const String& uuid)
+	{
+		Path resourcePath = getEntryFolder(cacheFolder, key);
+		resourcePath.setFilename(toWString(uuid) + L".asset");
+
+		return resourcePath;
+	}
+
+	void ImportCache::store(const Path& cacheFolder, const String& key, const SPtr<ProjectFileMeta>& meta, 
+		const Vector<Path>& resourcePaths)
+	{
+		if (key.empty() || meta == nullptr)
+			return;
+
+		Path entryFolder = getEntryFolder(cacheFolder, key);
+
+		Path metaPath = entryFolder;
+		metaPath.setFilename(META_FILENAME);
+
+		if (FileSystem::isFile(metaPath))
+			return;
+
+		auto& resourceMetas = meta->getResourceMetaData();
+		if (resourceMetas.size() != resourcePaths.size())
+			return;
+
+		if (!FileSystem::isDirectory(entryFolder))
+			FileSystem::createDir(entryFolder);
+
+		for (UINT32 i = 0; i < (UINT32)resourceMetas.size(); i++)
+		{
+			Path cachedPath = getResourcePath(cacheFolder, key, resourceMetas[i]->getUUID());
+			FileSystem::copy(resourcePaths[i], cachedPath);
+		}
+
+		// Write the meta file under a temporary name first, so other editor instances sharing the cache never see
+		// a partially written entry
+		Path tempMetaPath = entryFolder;
+		tempMetaPath.setFilename(toWString(UUIDGenerator::generateRandom()) + L".tmp");
+
+		{
+			FileEncoder fs(tempMetaPath);
+			fs.encode(meta.get());
+		}
+
+		FileSystem::move(tempMetaPath, metaPath, false);
+
+		if (FileSystem::exists(tempMetaPath))
+			FileSystem::remove(tempMetaPath);
+	}
+
+	Path ImportCache::getEntryFolder(const Path& cacheFolder, const String& key)
+	{
+		Path entryFolder = cacheFolder;
+		entryFolder.append(toWString(key) + L"/");
+
+		return entryFolder;
+	}
+}
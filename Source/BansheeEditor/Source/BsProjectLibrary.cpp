@@ -16,6 +16,12 @@
 #include "BsResource.h"
 #include "BsEditorApplication.h"
 #include "BsShader.h"
+#include "BsSpecificImporter.h"
+#include "BsTaskScheduler.h"
+#include "BsCoreThread.h"
+#include "BsImportCache.h"
+#include "BsEditorSettings.h"
+#include "BsUUID.h"
 #include <regex>
 
 using namespace std::placeholders;
@@ -44,14 +50,15 @@ namespace BansheeEngine
 	{ }
 
 	ProjectLibrary::DirectoryEntry::DirectoryEntry()
+		:lastScanTime(0)
 	{ }
 
 	ProjectLibrary::DirectoryEntry::DirectoryEntry(const Path& path, const WString& name, DirectoryEntry* parent)
-		:LibraryEntry(path, name, parent, LibraryEntryType::Directory)
+		:LibraryEntry(path, name, parent, LibraryEntryType::Directory), lastScanTime(0)
 	{ }
 
 	ProjectLibrary::ProjectLibrary()
-		: mRootEntry(nullptr), mIsLoaded(false)
+		: mRootEntry(nullptr), mIsLoaded(false), mIsQueueingImports(false)
 	{
 		mRootEntry = bs_new<DirectoryEntry>(mResourcesFolder, mResourcesFolder.getWTail(), nullptr);
 	}
@@ -68,6 +75,22 @@ namespace BansheeEngine
 	}
 
 	void ProjectLibrary::checkForModifications(const Path& fullPath, bool import, Vector<Path>& dirtyResources)
+	{
+		// Imports are performed all at once after the check, unless this is called during an already running check
+		bool startedQueueing = import && !mIsQueueingImports;
+		if (startedQueueing)
+			mIsQueueingImports = true;
+
+		checkForModificationsInternal(fullPath, import, dirtyResources);
+
+		if (startedQueueing)
+		{
+			mIsQueueingImports = false;
+			importQueued();
+		}
+	}
+
+	void ProjectLibrary::checkForModificationsInternal(const Path& fullPath, bool import, Vector<Path>& dirtyResources)
 	{
 		if (!mResourcesFolder.includes(fullPath))
 			return; // Folder not part of our resources path, so no modifications
@@ -119,7 +142,7 @@ namespace BansheeEngine
 					{
 						addDirectoryInternal(entryParent, pathToSearch);
 
-						checkForModifications(pathToSearch, import, dirtyResources);
+						checkForModificationsInternal(pathToSearch, import, dirtyResources);
 					}
 				}
 			}
@@ -156,12 +179,37 @@ namespace BansheeEngine
 				Vector<Path> childDirectories;
 				Vector<bool> existingEntries;
 				Vector<LibraryEntry*> toDelete;
+				UnorderedMap<Path, UINT32> childLookup;
 
 				while(!todo.empty())
 				{
 					DirectoryEntry* currentDir = todo.top();
 					todo.pop();
 
+					// Adding, removing or renaming a child updates the directory's modification time. If that didn't 
+					// happen since the last scan, only the existing files need to be checked for modifications.
+					std::time_t scanTime = std::time(nullptr);
+					if (!_isScanRequired(*currentDir))
+					{
+						for(auto& child : currentDir->mChildren)
+						{
+							if(child->type == LibraryEntryType::File)
+							{
+								FileEntry* fileEntry = static_cast<FileEntry*>(child);
+
+								if (import)
+									reimportResourceInternal(fileEntry);
+
+								if (!isUpToDate(fileEntry))
+									dirtyResources.push_back(fileEntry->path);
+							}
+							else if(child->type == LibraryEntryType::Directory)
+								todo.push(static_cast<DirectoryEntry*>(child));
+						}
+
+						continue;
+					}
+
 					existingEntries.clear();
 					existingEntries.resize(currentDir->mChildren.size());
 					for(UINT32 i = 0; i < (UINT32)currentDir->mChildren.size(); i++)
@@ -171,6 +219,10 @@ namespace BansheeEngine
 					childDirectories.clear();
 
 					FileSystem::getChildren(currentDir->path, childFiles, childDirectories);
+
+					childLookup.clear();
+					for(UINT32 i = 0; i < (UINT32)currentDir->mChildren.size(); i++)
+						childLookup[currentDir->mChildren[i]->path] = i;
 			
 					for(auto& filePath : childFiles)
 					{
@@ -189,17 +241,15 @@ namespace BansheeEngine
 						else
 						{
 							FileEntry* existingEntry = nullptr;
-							UINT32 idx = 0;
-							for(auto& child : currentDir->mChildren)
+							auto iterFind = childLookup.find(filePath);
+							if(iterFind != childLookup.end())
 							{
-								if(child->type == LibraryEntryType::File && child->path == filePath)
+								LibraryEntry* child = currentDir->mChildren[iterFind->second];
+								if(child->type == LibraryEntryType::File)
 								{
-									existingEntries[idx] = true;
+									existingEntries[iterFind->second] = true;
 									existingEntry = static_cast<FileEntry*>(child);
-									break;
 								}
-
-								idx++;
 							}
 
 							if(existingEntry != nullptr)
@@ -223,17 +273,15 @@ namespace BansheeEngine
 					for(auto& dirPath : childDirectories)
 					{
 						DirectoryEntry* existingEntry = nullptr;
-						UINT32 idx = 0;
-						for(auto& child : currentDir->mChildren)
+						auto iterFind = childLookup.find(dirPath);
+						if(iterFind != childLookup.end())
 						{
-							if(child->type == LibraryEntryType::Directory && child->path == dirPath)
+							LibraryEntry* child = currentDir->mChildren[iterFind->second];
+							if(child->type == LibraryEntryType::Directory)
 							{
-								existingEntries[idx] = true;
+								existingEntries[iterFind->second] = true;
 								existingEntry = static_cast<DirectoryEntry*>(child);
-								break;
 							}
-
-							idx++;
 						}
 
 						if(existingEntry == nullptr)
@@ -260,6 +308,10 @@ namespace BansheeEngine
 						toDelete.clear();
 					}
 
+					// Only record the scan if new files were actually added to the library
+					if (import)
+						currentDir->lastScanTime = scanTime;
+
 					for(auto& child : currentDir->mChildren)
 					{
 						if(child->type == LibraryEntryType::Directory)
@@ -293,6 +345,17 @@ namespace BansheeEngine
 
 	void ProjectLibrary::deleteResourceInternal(FileEntry* resource)
 	{
+		if (mPendingImports.erase(resource->path) > 0)
+		{
+			auto iterRemove = std::remove_if(mQueuedImports.begin(), mQueuedImports.end(),
+				[&](const QueuedImport& x)
+			{
+				return x.entry == resource;
+			});
+
+			mQueuedImports.erase(iterRemove, mQueuedImports.end());
+		}
+
 		if(resource->meta != nullptr)
 		{
 			auto& resourceMetas = resource->meta->getResourceMetaData();
@@ -410,154 +473,372 @@ namespace BansheeEngine
 			else
 				curImportOptions = importOptions;
 
-			Vector<SubResource> importedResources;
-			if (isNativeResource)
+			// Native resources are only copied, so there's nothing to gain from deferring them
+			if (mIsQueueingImports && !isNativeResource)
 			{
-				// If meta exists make sure it is registered in the manifest before load, otherwise it will get assigned a new UUID.
-				// This can happen if library isn't properly saved before exiting the application.
-				if (fileEntry->meta != nullptr)
+				if (mPendingImports.find(fileEntry->path) == mPendingImports.end())
 				{
-					auto& resourceMetas = fileEntry->meta->getResourceMetaData();
-					mResourceManifest->registerResource(resourceMetas[0]->getUUID(), fileEntry->path);
+					mQueuedImports.push_back({ fileEntry, curImportOptions, pruneResourceMetas });
+					mPendingImports.insert(fileEntry->path);
 				}
 
-				// Don't load dependencies because we don't need them, but also because they might not be in the manifest
-				// which would screw up their UUIDs.
-				importedResources.push_back({ L"primary", gResources().load(fileEntry->path, ResourceLoadFlag::KeepSourceData) });
+				return;
 			}
 
-			if(fileEntry->meta == nullptr)
+			if (isNativeResource)
 			{
-				if (!isNativeResource)
-					importedResources = Importer::instance().importAll(fileEntry->path, curImportOptions);
+				finishImport(fileEntry, curImportOptions, Vector<SubResourceRaw>(), pruneResourceMetas);
+				return;
+			}
 
-				fileEntry->meta = ProjectFileMeta::create(curImportOptions);
+			String cacheKey = ImportCache::generateKey(fileEntry->path, curImportOptions);
+			SPtr<ProjectFileMeta> cachedMeta = ImportCache::find(getImportCacheFolder(), cacheKey);
 
-				for(auto& entry : importedResources)
-				{
-					SPtr<ResourceMetaData> subMeta = entry.value->getMetaData();
-					UINT32 typeId = entry.value->getTypeId();
-					const String& UUID = entry.value.getUUID();
+			if (cachedMeta != nullptr)
+			{
+				if (restoreFromCache(fileEntry, curImportOptions, cachedMeta, cacheKey, pruneResourceMetas))
+					return;
+			}
 
-					SPtr<ProjectResourceMeta> resMeta = ProjectResourceMeta::create(entry.name, UUID, typeId, subMeta);
-					fileEntry->meta->add(resMeta);
-				}
+			Vector<SubResourceRaw> importedResourcesRaw = gImporter()._importAllRaw(fileEntry->path, curImportOptions);
+			finishImport(fileEntry, curImportOptions, importedResourcesRaw, pruneResourceMetas);
+			storeInCache(fileEntry, cacheKey);
+		}
+	}
 
-				if(importedResources.size() > 0)
-				{
-					HResource primary = importedResources[0].value;
+	void ProjectLibrary::finishImport(FileEntry* fileEntry, const SPtr<ImportOptions>& importOptions,
+		const Vector<SubResourceRaw>& importedResourcesRaw, bool pruneResourceMetas)
+	{
+		Path metaPath = fileEntry->path;
+		metaPath.setFilename(metaPath.getWFilename() + L".meta");
 
-					mUUIDToPath[primary.getUUID()] = fileEntry->path;
-					for (UINT32 i = 1; i < (UINT32)importedResources.size(); i++)
-					{
-						SubResource& entry = importedResources[i];
+		bool isNativeResource = isNative(fileEntry->path);
 
-						const String& UUID = entry.value.getUUID();
-						mUUIDToPath[UUID] = fileEntry->path + entry.name;
-					}
-				}
+		Vector<SubResource> importedResources;
+		if (isNativeResource)
+		{
+			// If meta exists make sure it is registered in the manifest before load, otherwise it will get assigned a new UUID.
+			// This can happen if library isn't properly saved before exiting the application.
+			if (fileEntry->meta != nullptr)
+			{
+				auto& resourceMetas = fileEntry->meta->getResourceMetaData();
+				mResourceManifest->registerResource(resourceMetas[0]->getUUID(), fileEntry->path);
+			}
 
-				FileEncoder fs(metaPath);
-				fs.encode(fileEntry->meta.get());
+			// Don't load dependencies because we don't need them, but also because they might not be in the manifest
+			// which would screw up their UUIDs.
+			importedResources.push_back({ L"primary", gResources().load(fileEntry->path, ResourceLoadFlag::KeepSourceData) });
+		}
+
+		if(fileEntry->meta == nullptr)
+		{
+			if (!isNativeResource)
+			{
+				for (auto& entry : importedResourcesRaw)
+					importedResources.push_back({ entry.name, gResources()._createResourceHandle(entry.value) });
 			}
-			else
+
+			fileEntry->meta = ProjectFileMeta::create(importOptions);
+
+			for(auto& entry : importedResources)
+			{
+				SPtr<ResourceMetaData> subMeta = entry.value->getMetaData();
+				UINT32 typeId = entry.value->getTypeId();
+				const String& UUID = entry.value.getUUID();
+
+				SPtr<ProjectResourceMeta> resMeta = ProjectResourceMeta::create(entry.name, UUID, typeId, subMeta);
+				fileEntry->meta->add(resMeta);
+			}
+
+			if(importedResources.size() > 0)
 			{
-				removeDependencies(fileEntry);
+				HResource primary = importedResources[0].value;
 
-				if (!isNativeResource)
+				mUUIDToPath[primary.getUUID()] = fileEntry->path;
+				for (UINT32 i = 1; i < (UINT32)importedResources.size(); i++)
 				{
-					Vector<SubResourceRaw> importedResourcesRaw = gImporter()._importAllRaw(fileEntry->path, curImportOptions);
-					Vector<SPtr<ProjectResourceMeta>> existingResourceMetas = fileEntry->meta->getAllResourceMetaData();
-					fileEntry->meta->clearResourceMetaData();
+					SubResource& entry = importedResources[i];
 
-					for(auto& resEntry : importedResourcesRaw)
-					{
-						bool foundMeta = false;
-						for (auto iter = existingResourceMetas.begin(); iter != existingResourceMetas.end(); ++iter)
-						{
-							SPtr<ProjectResourceMeta> metaEntry = *iter;
+					const String& UUID = entry.value.getUUID();
+					mUUIDToPath[UUID] = fileEntry->path + entry.name;
+				}
+			}
 
-							if(resEntry.name == metaEntry->getUniqueName())
-							{
-								HResource importedResource = gResources()._getResourceHandle(metaEntry->getUUID());
-								gResources().update(importedResource, resEntry.value);
+			FileEncoder fs(metaPath);
+			fs.encode(fileEntry->meta.get());
+		}
+		else
+		{
+			removeDependencies(fileEntry);
 
-								importedResources.push_back({ resEntry.name, importedResource });
-								fileEntry->meta->add(metaEntry);
+			if (!isNativeResource)
+			{
+				Vector<SPtr<ProjectResourceMeta>> existingResourceMetas = fileEntry->meta->getAllResourceMetaData();
+				fileEntry->meta->clearResourceMetaData();
 
-								existingResourceMetas.erase(iter);
-								foundMeta = true;
-								break;
-							}
-						}
+				for(auto& resEntry : importedResourcesRaw)
+				{
+					bool foundMeta = false;
+					for (auto iter = existingResourceMetas.begin(); iter != existingResourceMetas.end(); ++iter)
+					{
+						SPtr<ProjectResourceMeta> metaEntry = *iter;
 
-						if(!foundMeta)
+						if(resEntry.name == metaEntry->getUniqueName())
 						{
-							HResource importedResource = gResources()._createResourceHandle(resEntry.value);
-							importedResources.push_back({ resEntry.name, importedResource });
+							HResource importedResource = gResources()._getResourceHandle(metaEntry->getUUID());
+							gResources().update(importedResource, resEntry.value);
 
-							SPtr<ResourceMetaData> subMeta = resEntry.value->getMetaData();
-							UINT32 typeId = resEntry.value->getTypeId();
-							const String& UUID = importedResource.getUUID();
+							importedResources.push_back({ resEntry.name, importedResource });
+							fileEntry->meta->add(metaEntry);
 
-							SPtr<ProjectResourceMeta> resMeta = ProjectResourceMeta::create(resEntry.name, UUID, typeId, subMeta);
-							fileEntry->meta->add(resMeta);
+							existingResourceMetas.erase(iter);
+							foundMeta = true;
+							break;
 						}
 					}
 
-					// Keep resource metas that we are not currently using, in case they get restored so their references
-					// don't get broken
-					if(!pruneResourceMetas)
+					if(!foundMeta)
 					{
-						for (auto& entry : existingResourceMetas)
-							fileEntry->meta->addInactive(entry);
-					}
+						HResource importedResource = gResources()._createResourceHandle(resEntry.value);
+						importedResources.push_back({ resEntry.name, importedResource });
 
-					// Update UUID to path mapping
-					auto& resourceMetas = fileEntry->meta->getResourceMetaData();
-					if (resourceMetas.size() > 0)
-					{
-						mUUIDToPath[resourceMetas[0]->getUUID()] = fileEntry->path;
+						SPtr<ResourceMetaData> subMeta = resEntry.value->getMetaData();
+						UINT32 typeId = resEntry.value->getTypeId();
+						const String& UUID = importedResource.getUUID();
 
-						for (UINT32 i = 1; i < (UINT32)resourceMetas.size(); i++)
-						{
-							SPtr<ProjectResourceMeta> entry = resourceMetas[i];
-							mUUIDToPath[entry->getUUID()] = fileEntry->path + entry->getUniqueName();
-						}
+						SPtr<ProjectResourceMeta> resMeta = ProjectResourceMeta::create(resEntry.name, UUID, typeId, subMeta);
+						fileEntry->meta->add(resMeta);
 					}
 				}
 
-				fileEntry->meta->mImportOptions = curImportOptions;
+				// Keep resource metas that we are not currently using, in case they get restored so their references
+				// don't get broken
+				if(!pruneResourceMetas)
+				{
+					for (auto& entry : existingResourceMetas)
+						fileEntry->meta->addInactive(entry);
+				}
 
-				FileEncoder fs(metaPath);
-				fs.encode(fileEntry->meta.get());
+				// Update UUID to path mapping
+				auto& resourceMetas = fileEntry->meta->getResourceMetaData();
+				if (resourceMetas.size() > 0)
+				{
+					mUUIDToPath[resourceMetas[0]->getUUID()] = fileEntry->path;
+
+					for (UINT32 i = 1; i < (UINT32)resourceMetas.size(); i++)
+					{
+						SPtr<ProjectResourceMeta> entry = resourceMetas[i];
+						mUUIDToPath[entry->getUUID()] = fileEntry->path + entry->getUniqueName();
+					}
+				}
 			}
 
-			addDependencies(fileEntry);
+			fileEntry->meta->mImportOptions = importOptions;
+
+			FileEncoder fs(metaPath);
+			fs.encode(fileEntry->meta.get());
+		}
+
+		addDependencies(fileEntry);
+
+		if (importedResources.size() > 0)
+		{
+			Path internalResourcesPath = mProjectFolder;
+			internalResourcesPath.append(INTERNAL_RESOURCES_DIR);
 
-			if (importedResources.size() > 0)
+			if (!FileSystem::isDirectory(internalResourcesPath))
+				FileSystem::createDir(internalResourcesPath);
+
+			for (auto& entry : importedResources)
 			{
-				Path internalResourcesPath = mProjectFolder;
-				internalResourcesPath.append(INTERNAL_RESOURCES_DIR);
+				internalResourcesPath.setFilename(toWString(entry.value.getUUID()) + L".asset");
+				gResources().save(entry.value, internalResourcesPath, true);
 
-				if (!FileSystem::isDirectory(internalResourcesPath))
-					FileSystem::createDir(internalResourcesPath);
+				String uuid = entry.value.getUUID();
+				mResourceManifest->registerResource(uuid, internalResourcesPath);
+			}
+		}
 
-				for (auto& entry : importedResources)
-				{
-					internalResourcesPath.setFilename(toWString(entry.value.getUUID()) + L".asset");
-					gResources().save(entry.value, internalResourcesPath, true);
+		fileEntry->lastUpdateTime = std::time(nullptr);
+
+		onEntryImported(fileEntry->path);
+		reimportDependants(fileEntry->path);
+	}
 
-					String uuid = entry.value.getUUID();
-					mResourceManifest->registerResource(uuid, internalResourcesPath);
+	bool ProjectLibrary::restoreFromCache(FileEntry* fileEntry, const SPtr<ImportOptions>& importOptions,
+		const SPtr<ProjectFileMeta>& cachedMeta, const String& cacheKey, bool pruneResourceMetas)
+	{
+		auto& cachedResourceMetas = cachedMeta->getResourceMetaData();
+		if (cachedResourceMetas.size() == 0)
+			return false;
+
+		Path cacheFolder = getImportCacheFolder();
+
+		Vector<SPtr<ProjectResourceMeta>> existingResourceMetas;
+		if (fileEntry->meta != nullptr)
+			existingResourceMetas = fileEntry->meta->getAllResourceMetaData();
+
+		struct RestoredResource
+		{
+			SPtr<ProjectResourceMeta> cachedMeta;
+			SPtr<ProjectResourceMeta> existingMeta;
+			String uuid;
+			Path cachedPath;
+		};
+
+		// Validate everything before modifying anything, so the resource can still be imported normally on failure
+		Vector<RestoredResource> restoredResources;
+		for (auto& cachedResMeta : cachedResourceMetas)
+		{
+			RestoredResource restored;
+			restored.cachedMeta = cachedResMeta;
+			restored.cachedPath = ImportCache::getResourcePath(cacheFolder, cacheKey, cachedResMeta->getUUID());
+
+			if (!FileSystem::isFile(restored.cachedPath))
+				return false;
+
+			// Keep the existing UUIDs so references to the resources remain valid
+			for (auto iter = existingResourceMetas.begin(); iter != existingResourceMetas.end(); ++iter)
+			{
+				if ((*iter)->getUniqueName() == cachedResMeta->getUniqueName())
+				{
+					restored.existingMeta = *iter;
+					existingResourceMetas.erase(iter);
+					break;
 				}
 			}
 
-			fileEntry->lastUpdateTime = std::time(nullptr);
+			if (restored.existingMeta != nullptr)
+				restored.uuid = restored.existingMeta->getUUID();
+			else
+			{
+				// UUIDs of cached resources come from whichever project imported them first
+				restored.uuid = cachedResMeta->getUUID();
+				if (mUUIDToPath.find(restored.uuid) != mUUIDToPath.end() || mResourceManifest->uuidExists(restored.uuid))
+					restored.uuid = UUIDGenerator::generateRandom();
+			}
 
-			onEntryImported(fileEntry->path);
-			reimportDependants(fileEntry->path);
+			// Loaded resources need to be updated in-place, which requires the resource to be imported
+			if (gResources().isLoaded(restored.uuid))
+				return false;
+
+			restoredResources.push_back(restored);
+		}
+
+		Path internalResourcesPath = mProjectFolder;
+		internalResourcesPath.append(INTERNAL_RESOURCES_DIR);
+
+		if (!FileSystem::isDirectory(internalResourcesPath))
+			FileSystem::createDir(internalResourcesPath);
+
+		for (auto& entry : restoredResources)
+		{
+			internalResourcesPath.setFilename(toWString(entry.uuid) + L".asset");
+			FileSystem::copy(entry.cachedPath, internalResourcesPath);
+
+			mResourceManifest->registerResource(entry.uuid, internalResourcesPath);
 		}
+
+		if (fileEntry->meta == nullptr)
+			fileEntry->meta = ProjectFileMeta::create(importOptions);
+		else
+		{
+			removeDependencies(fileEntry);
+			fileEntry->meta->clearResourceMetaData();
+		}
+
+		for (auto& entry : restoredResources)
+		{
+			SPtr<ProjectResourceMeta> resMeta = entry.existingMeta;
+			if (resMeta != nullptr)
+			{
+				resMeta->mResourceMeta = entry.cachedMeta->getResourceMetaData();
+				resMeta->mTypeId = entry.cachedMeta->getTypeID();
+			}
+			else
+			{
+				resMeta = ProjectResourceMeta::create(entry.cachedMeta->getUniqueName(), entry.uuid, 
+					entry.cachedMeta->getTypeID(), entry.cachedMeta->getResourceMetaData());
+			}
+
+			fileEntry->meta->add(resMeta);
+		}
+
+		// Keep resource metas that we are not currently using, in case they get restored so their references don't get
+		// broken
+		if (!pruneResourceMetas)
+		{
+			for (auto& entry : existingResourceMetas)
+				fileEntry->meta->addInactive(entry);
+		}
+
+		auto& resourceMetas = fileEntry->meta->getResourceMetaData();
+		mUUIDToPath[resourceMetas[0]->getUUID()] = fileEntry->path;
+
+		for (UINT32 i = 1; i < (UINT32)resourceMetas.size(); i++)
+		{
+			SPtr<ProjectResourceMeta> entry = resourceMetas[i];
+			mUUIDToPath[entry->getUUID()] = fileEntry->path + entry->getUniqueName();
+		}
+
+		fileEntry->meta->mImportOptions = importOptions;
+
+		Path metaPath = fileEntry->path;
+		metaPath.setFilename(metaPath.getWFilename() + L".meta");
+
+		FileEncoder fs(metaPath);
+		fs.encode(fileEntry->meta.get());
+
+		addDependencies(fileEntry);
+		fileEntry->lastUpdateTime = std::time(nullptr);
+
+		onEntryImported(fileEntry->path);
+		reimportDependants(fileEntry->path);
+
+		return true;
+	}
+
+	void ProjectLibrary::storeInCache(FileEntry* fileEntry, const String& cacheKey)
+	{
+		if (cacheKey.empty() || fileEntry->meta == nullptr)
+			return;
+
+		auto& resourceMetas = fileEntry->meta->getResourceMetaData();
+		if (resourceMetas.size() == 0)
+			return;
+
+		// Only store the data that doesn't depend on the project (e.g. no user data or inactive resources)
+		SPtr<ProjectFileMeta> cachedMeta = ProjectFileMeta::create(fileEntry->meta->getImportOptions());
+
+		Vector<Path> resourcePaths;
+		for (auto& resMeta : resourceMetas)
+		{
+			Path internalPath;
+			if (!mResourceManifest->uuidToFilePath(resMeta->getUUID(), internalPath))
+				return;
+
+			if (!gResources().getDependencies(internalPath).empty())
+				return;
+
+			cachedMeta->add(ProjectResourceMeta::create(resMeta->getUniqueName(), resMeta->getUUID(), 
+				resMeta->getTypeID(), resMeta->getResourceMetaData()));
+			resourcePaths.push_back(internalPath);
+		}
+
+		ImportCache::store(getImportCacheFolder(), cacheKey, cachedMeta, resourcePaths);
+	}
+
+	Path ProjectLibrary::getImportCacheFolder() const
+	{
+		Path cacheFolder = gEditorApplication().getEditorSettings()->getImportCacheFolder();
+		if (!cacheFolder.isEmpty())
+			return cacheFolder;
+
+		cacheFolder = mProjectFolder;
+		cacheFolder.append(PROJECT_INTERNAL_DIR);
+		cacheFolder.append(L"ImportCache/");
+
+		return cacheFolder;
 	}
 
 	bool ProjectLibrary::isUpToDate(FileEntry* resource) const
@@ -580,6 +861,17 @@ namespace BansheeEngine
 		return lastModifiedTime <= resource->lastUpdateTime;
 	}
 
+	bool ProjectLibrary::_isScanRequired(const DirectoryEntry& entry)
+	{
+		if (entry.lastScanTime == 0)
+			return true;
+
+		// Modification times have a resolution of a second, so changes made in the same second as the scan must be 
+		// treated as newer than the scan
+		std::time_t lastModifiedTime = FileSystem::getLastModifiedTime(entry.path);
+		return lastModifiedTime >= entry.lastScanTime;
+	}
+
 	Vector<ProjectLibrary::LibraryEntry*> ProjectLibrary::search(const WString& pattern)
 	{
 		return search(pattern, {});
@@ -1345,8 +1637,30 @@ namespace BansheeEngine
 			return;
 
 		// Make all paths relative before saving
-		makeEntriesRelative();		
-		SPtr<ProjectLibraryEntries> libEntries = ProjectLibraryEntries::create(*mRootEntry);
+		makeEntriesRelative();
+
+		UnorderedMap<Path, UINT64> directoryScanTimes;
+		{
+			Stack<DirectoryEntry*> todo;
+			todo.push(mRootEntry);
+
+			while (!todo.empty())
+			{
+				DirectoryEntry* curDir = todo.top();
+				todo.pop();
+
+				if (curDir->lastScanTime != 0)
+					directoryScanTimes[curDir->path] = (UINT64)curDir->lastScanTime;
+
+				for (auto& child : curDir->mChildren)
+				{
+					if (child->type == LibraryEntryType::Directory)
+						todo.push(static_cast<DirectoryEntry*>(child));
+				}
+			}
+		}
+
+		SPtr<ProjectLibraryEntries> libEntries = ProjectLibraryEntries::create(*mRootEntry, directoryScanTimes);
 
 		Path libraryEntriesPath = mProjectFolder;
 		libraryEntriesPath.append(PROJECT_INTERNAL_DIR);
@@ -1389,6 +1703,28 @@ namespace BansheeEngine
 				child->parent = mRootEntry;
 
 			mRootEntry->parent = nullptr;
+
+			// Restore the scan journal, so directories unchanged since the last session don't need to be enumerated
+			const UnorderedMap<Path, UINT64>& directoryScanTimes = libEntries->getDirectoryScanTimes();
+
+			Stack<DirectoryEntry*> todo;
+			todo.push(mRootEntry);
+
+			while (!todo.empty())
+			{
+				DirectoryEntry* curDir = todo.top();
+				todo.pop();
+
+				auto iterFind = directoryScanTimes.find(curDir->path);
+				if (iterFind != directoryScanTimes.end())
+					curDir->lastScanTime = (std::time_t)iterFind->second;
+
+				for (auto& child : curDir->mChildren)
+				{
+					if (child->type == LibraryEntryType::Directory)
+						todo.push(static_cast<DirectoryEntry*>(child));
+				}
+			}
 		}
 
 		// Entries are stored relative to project folder, but we want their absolute paths now
@@ -1595,6 +1931,10 @@ namespace BansheeEngine
 		Vector<Path> dependencies = iterFind->second;
 		for (auto& dependency : dependencies)
 		{
+			// Will be imported later anyway, as part of the currently running batch
+			if (mPendingImports.find(dependency) != mPendingImports.end())
+				continue;
+
 			LibraryEntry* entry = findEntry(dependency);
 			if (entry != nullptr && entry->type == LibraryEntryType::File)
 			{
@@ -1609,6 +1949,145 @@ namespace BansheeEngine
 		}
 	}
 
+	void ProjectLibrary::importQueued()
+	{
+		if (mQueuedImports.empty())
+			return;
+
+		Vector<QueuedImport> queuedImports = std::move(mQueuedImports);
+		mQueuedImports.clear();
+
+		UINT32 numQueued = (UINT32)queuedImports.size();
+
+		UnorderedMap<Path, UINT32> queuedIndices;
+		for (UINT32 i = 0; i < numQueued; i++)
+			queuedIndices[queuedImports[i].entry->path] = i;
+
+		// Resources are imported after any other queued resources they depend on (e.g. shaders after their includes).
+		// Dependencies are only known for resources that were imported before, and any others are handled by
+		// reimportDependants() once their dependencies finish importing.
+		Vector<UINT32> groups(numQueued, (UINT32)-1);
+		std::function<UINT32(UINT32)> findGroup = [&](UINT32 idx) -> UINT32
+		{
+			if (groups[idx] != (UINT32)-1)
+				return groups[idx];
+
+			groups[idx] = 0; // Breaks cyclic dependencies
+
+			UINT32 group = 0;
+			Vector<Path> dependencies = getImportDependencies(queuedImports[idx].entry);
+			for (auto& dependency : dependencies)
+			{
+				auto iterFind = queuedIndices.find(dependency);
+				if (iterFind == queuedIndices.end() || iterFind->second == idx)
+					continue;
+
+				group = std::max(group, findGroup(iterFind->second) + 1);
+			}
+
+			groups[idx] = group;
+			return group;
+		};
+
+		UINT32 numGroups = 0;
+		for (UINT32 i = 0; i < numQueued; i++)
+			numGroups = std::max(numGroups, findGroup(i) + 1);
+
+		struct ImportJob
+		{
+			QueuedImport import;
+			Vector<SubResourceRaw> importedResources;
+			String cacheKey;
+			SPtr<ProjectFileMeta> cachedMeta;
+			SPtr<Task> task;
+			bool failed;
+		};
+
+		Path cacheFolder = getImportCacheFolder();
+
+		UINT32 numImported = 0;
+		for (UINT32 group = 0; group < numGroups; group++)
+		{
+			Vector<ImportJob> jobs;
+			for (UINT32 i = 0; i < numQueued; i++)
+			{
+				if (groups[i] == group)
+					jobs.push_back({ queuedImports[i], Vector<SubResourceRaw>(), String(), nullptr, nullptr, false });
+			}
+
+			for (auto& job : jobs)
+			{
+				ImportJob* jobPtr = &job;
+				auto worker = [jobPtr, cacheFolder]()
+				{
+					// Hashing the source file is done here as well, as it requires reading the entire file
+					jobPtr->cacheKey = ImportCache::generateKey(jobPtr->import.entry->path, jobPtr->import.importOptions);
+					jobPtr->cachedMeta = ImportCache::find(cacheFolder, jobPtr->cacheKey);
+
+					if (jobPtr->cachedMeta == nullptr)
+					{
+						jobPtr->importedResources = gImporter()._importAllRaw(jobPtr->import.entry->path,
+							jobPtr->import.importOptions);
+
+						// Importers report failures by returning no resources
+						if (jobPtr->importedResources.empty())
+						{
+							LOGERR("Failed to import resource: " + jobPtr->import.entry->path.toString());
+							jobPtr->failed = true;
+						}
+					}
+
+					// Importers might have queued core thread commands on this thread's accessor. Make sure they are
+					// executed before the resources are used on the main thread.
+					gCoreAccessor().submitToCoreThread(true);
+				};
+
+				job.task = Task::create("Import: " + job.import.entry->path.getFilename(), worker);
+				TaskScheduler::instance().addTask(job.task);
+			}
+
+			// Entries and meta-data are only modified on this thread, as the importers finish
+			for (auto& job : jobs)
+			{
+				job.task->wait();
+
+				FileEntry* entry = job.import.entry;
+				mPendingImports.erase(entry->path);
+
+				bool restored = false;
+				if (job.cachedMeta != nullptr)
+				{
+					restored = restoreFromCache(entry, job.import.importOptions, job.cachedMeta, job.cacheKey,
+						job.import.pruneResourceMetas);
+
+					// Cache entry couldn't be used, fall back to a normal import
+					if (!restored)
+					{
+						job.importedResources = gImporter()._importAllRaw(entry->path, job.import.importOptions);
+						job.failed = job.importedResources.empty();
+					}
+				}
+
+				// Failed imports are finished the same as in the non-batched path, but never cached so they are retried
+				if (!restored)
+				{
+					finishImport(entry, job.import.importOptions, job.importedResources, job.import.pruneResourceMetas);
+
+					if (!job.failed)
+						storeInCache(entry, job.cacheKey);
+				}
+
+				numImported++;
+				onImportProgress(entry->path, numImported, numQueued);
+			}
+		}
+
+		mPendingImports.clear();
+
+		// Write the library index once for the entire batch
+		saveLibrary();
+	}
+
 	BS_ED_EXPORT ProjectLibrary& gProjectLibrary()
 	{
 		return ProjectLibrary::instance();
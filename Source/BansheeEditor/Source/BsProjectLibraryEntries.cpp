@@ -5,16 +5,18 @@
 
 namespace BansheeEngine
 {
-	ProjectLibraryEntries::ProjectLibraryEntries(const ProjectLibrary::DirectoryEntry& rootEntry)
-		:mRootEntry(rootEntry)
+	ProjectLibraryEntries::ProjectLibraryEntries(const ProjectLibrary::DirectoryEntry& rootEntry, 
+		const UnorderedMap<Path, UINT64>& directoryScanTimes)
+		:mRootEntry(rootEntry), mDirectoryScanTimes(directoryScanTimes)
 	{ }
 
 	ProjectLibraryEntries::ProjectLibraryEntries(const ConstructPrivately& dummy)
 	{ }
 
-	SPtr<ProjectLibraryEntries> ProjectLibraryEntries::create(const ProjectLibrary::DirectoryEntry& rootEntry)
+	SPtr<ProjectLibraryEntries> ProjectLibraryEntries::create(const ProjectLibrary::DirectoryEntry& rootEntry, 
+		const UnorderedMap<Path, UINT64>& directoryScanTimes)
 	{
-		return bs_shared_ptr_new<ProjectLibraryEntries>(rootEntry);
+		return bs_shared_ptr_new<ProjectLibraryEntries>(rootEntry, directoryScanTimes);
 	}
 
 	SPtr<ProjectLibraryEntries> ProjectLibraryEntries::createEmpty()
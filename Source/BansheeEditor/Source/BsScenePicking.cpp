@@ -26,6 +26,8 @@
 #include "BsCoreRenderer.h"
 #include "BsGizmoManager.h"
 #include "BsRendererUtility.h"
+#include "BsMeshBVH.h"
+#include "BsMeshData.h"
 
 using namespace std::placeholders;
 
@@ -34,6 +36,7 @@ namespace BansheeEngine
 	const float ScenePickingCore::ALPHA_CUTOFF = 0.5f;
 
 	ScenePicking::ScenePicking()
+		:mCPUPicking(true)
 	{
 		mCore = bs_new<ScenePickingCore>();
 
@@ -60,19 +63,26 @@ namespace BansheeEngine
 		Vector<HSceneObject> selectedObjects = pickObjects(cam, position, area, ignoreRenderables, data);
 		if (selectedObjects.size() == 0)
 			return HSceneObject();
-			
-		if (data != nullptr)
-		{
-			Matrix3 rotation;
-			selectedObjects[0]->getWorldRotation().toRotationMatrix(rotation);
-			data->normal = rotation.inverse().transpose().transform(data->normal);
-		}
 		
 		return selectedObjects[0];
 	}
 
 	Vector<HSceneObject> ScenePicking::pickObjects(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area, 
 		Vector<HSceneObject>& ignoreRenderables, SnapData* data)
+	{
+		if (!mCPUPicking)
+			return pickObjectsGPU(cam, position, area, ignoreRenderables, data, true);
+
+		// Gizmos and alpha tested renderables can only be picked by rendering them
+		Vector<HSceneObject> results = pickObjectsGPU(cam, position, area, ignoreRenderables, data, false);
+
+		// Gizmos are always drawn on top, so if one was picked its snap data takes precedence
+		pickObjectsCPU(cam, position, area, ignoreRenderables, results.empty() ? data : nullptr, results);
+		return results;
+	}
+
+	Vector<HSceneObject> ScenePicking::pickObjectsGPU(const SPtr<Camera>& cam, const Vector2I& position, 
+		const Vector2I& area, Vector<HSceneObject>& ignoreRenderables, SnapData* data, bool allRenderables)
 	{
 		auto comparePickElement = [&] (const ScenePicking::RenderablePickData& a, const ScenePicking::RenderablePickData& b)
 		{
@@ -90,10 +100,10 @@ namespace BansheeEngine
 
 		Matrix4 viewProjMatrix = cam->getProjectionMatrixRS() * cam->getViewMatrix();
 
-		const Map<Renderable*, SceneRenderableData>& renderables = SceneManager::instance().getAllRenderables();
 		RenderableSet pickData(comparePickElement);
 		Map<UINT32, HSceneObject> idxToRenderable;
 
+		const Map<Renderable*, SceneRenderableData>& renderables = SceneManager::instance().getAllRenderables();
 		for (auto& renderableData : renderables)
 		{
 			SPtr<Renderable> renderable = renderableData.second.renderable;
@@ -106,6 +116,10 @@ namespace BansheeEngine
 			if (!mesh.isLoaded())
 				continue;
 
+			CullingMode cpuCullMode;
+			if (!allRenderables && getCPUPickingState(*renderable, cpuCullMode))
+				continue;
+
 			bool found = false;
 			for (int i = 0; i < ignoreRenderables.size(); i++)
 			{
@@ -115,7 +129,7 @@ namespace BansheeEngine
 					break;
 				}
 			}
-			
+		
 			if (found)
 				continue;
 
@@ -135,24 +149,11 @@ namespace BansheeEngine
 					{
 						UINT32 idx = (UINT32)pickData.size();
 
-						bool useAlphaShader = false;
-						SPtr<RasterizerState> rasterizerState;
-
 						HMaterial originalMat = renderable->getMaterial(i);
-						if (originalMat != nullptr && originalMat->getNumPasses() > 0)
-						{
-							SPtr<Pass> firstPass = originalMat->getPass(0); // Note: We only ever check the first pass, problem?
-							useAlphaShader = firstPass->hasBlending();
 
-							if (firstPass->getRasterizerState() == nullptr)
-								rasterizerState = RasterizerState::getDefault();
-							else
-								rasterizerState = firstPass->getRasterizerState();
-						}
-						else
-							rasterizerState = RasterizerState::getDefault();
-
-						CullingMode cullMode = rasterizerState->getProperties().getCullMode();
+						bool useAlphaShader;
+						CullingMode cullMode;
+						getPickingState(originalMat, useAlphaShader, cullMode);
 
 						HTexture mainTexture;
 						if (useAlphaShader)
@@ -170,13 +171,18 @@ namespace BansheeEngine
 
 						idxToRenderable[idx] = so;
 
-						Matrix4 wvpTransform = viewProjMatrix * worldTransform;
+						const MeshVertexCompression& compression = mesh->getProperties().getVertexCompression();
+						Matrix4 wvpTransform = viewProjMatrix * worldTransform * compression.getPositionDecodeTransform();
 						pickData.insert({ mesh->getCore(), idx, wvpTransform, useAlphaShader, cullMode, mainTexture });
 					}
 				}
 			}
 		}
 
+		// Avoid waiting on the core thread if there is nothing to render
+		if (pickData.empty() && !GizmoManager::instance().hasPickableGizmos())
+			return Vector<HSceneObject>();
+
 		UINT32 firstGizmoIdx = (UINT32)pickData.size();
 
 		SPtr<RenderTargetCore> target = cam->getViewport()->getTarget()->getCore();
@@ -220,9 +226,345 @@ namespace BansheeEngine
 			}
 		}
 
+		// Normals are rendered in local space of the object, transform them to world space
+		if (data != nullptr && !results.empty())
+		{
+			Matrix3 invRotScale;
+			results[0]->getWorldTfrm().inverseAffine().extract3x3Matrix(invRotScale);
+
+			data->normal = Vector3::normalize(invRotScale.transpose().transform(data->normal));
+		}
+
 		return results;
 	}
 
+	void ScenePicking::pickObjectsCPU(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area, 
+		Vector<HSceneObject>& ignoreRenderables, SnapData* data, Vector<HSceneObject>& results)
+	{
+		updatePickableRenderables();
+
+		if (mSceneBVH.isEmpty())
+			return;
+
+		Ray ray = cam->screenPointToRay(position);
+
+		bool singlePixel = area.x <= 1 || area.y <= 1;
+		if (singlePixel || data != nullptr)
+		{
+			float distance;
+			Vector3 normal;
+			INT32 hitIdx = findClosestHit(ray, ignoreRenderables, distance, normal);
+
+			if (hitIdx != -1)
+			{
+				if (data != nullptr)
+				{
+					data->pickPosition = ray.getPoint(distance);
+					data->normal = normal;
+				}
+
+				if (singlePixel)
+					results.push_back(mPickables[hitIdx].sceneObject);
+			}
+		}
+
+		if (singlePixel)
+			return;
+
+		// Cast a ray through each pixel of the area, same as the pixels the GPU would render, so objects hidden behind
+		// nearer geometry aren't picked. Very large areas are sampled sparser to keep the number of rays bounded.
+		static const UINT32 MAX_SAMPLES_PER_AXIS = 128;
+
+		UINT32 stepX = std::max(1U, ((UINT32)area.x + MAX_SAMPLES_PER_AXIS - 1) / MAX_SAMPLES_PER_AXIS);
+		UINT32 stepY = std::max(1U, ((UINT32)area.y + MAX_SAMPLES_PER_AXIS - 1) / MAX_SAMPLES_PER_AXIS);
+
+		UnorderedMap<UINT32, float> visible;
+		for (UINT32 y = 0; y < (UINT32)area.y; y += stepY)
+		{
+			for (UINT32 x = 0; x < (UINT32)area.x; x += stepX)
+			{
+				Ray sampleRay = cam->screenPointToRay(Vector2I(position.x + (INT32)x, position.y + (INT32)y));
+
+				float distance;
+				Vector3 normal;
+				INT32 hitIdx = findClosestHit(sampleRay, ignoreRenderables, distance, normal);
+				if (hitIdx == -1)
+					continue;
+
+				auto iterFind = visible.find((UINT32)hitIdx);
+				if (iterFind == visible.end())
+					visible[(UINT32)hitIdx] = distance;
+				else
+					iterFind->second = std::min(iterFind->second, distance);
+			}
+		}
+
+		Vector<std::pair<float, UINT32>> hits;
+		for (auto& entry : visible)
+			hits.push_back(std::make_pair(entry.second, entry.first));
+
+		std::sort(hits.begin(), hits.end());
+		for (auto& hit : hits)
+			results.push_back(mPickables[hit.second].sceneObject);
+	}
+
+	void ScenePicking::update()
+	{
+		if (!mCPUPicking)
+			return;
+
+		Vector<PickableSource> renderables;
+		findPickableRenderables(renderables);
+
+		if (updateMeshBVHs(renderables))
+			mPickables.clear(); // Forces the pickables to be rebuilt with the new hierarchies on next pick
+	}
+
+	void ScenePicking::updatePickableRenderables()
+	{
+		Vector<PickableSource> current;
+		findPickableRenderables(current);
+
+		// Only rebuild if something changed, which is the common case when just clicking around the scene
+		bool dirty = updateMeshBVHs(current) || current.size() != mPickables.size();
+		for (UINT32 i = 0; i < (UINT32)current.size() && !dirty; i++)
+		{
+			const PickableRenderable& pickable = mPickables[i];
+			dirty = pickable.sceneObject != current[i].sceneObject || pickable.mesh != current[i].mesh.get() ||
+				pickable.tfrmHash != current[i].sceneObject->getTransformHash();
+		}
+
+		// Materials don't affect the hierarchy, so their state is refreshed without a rebuild
+		auto updateCullModes = [&]()
+		{
+			for (UINT32 i = 0; i < (UINT32)current.size(); i++)
+			{
+				PickableRenderable& pickable = mPickables[i];
+				pickable.cullMode = current[i].cullMode;
+
+				// Mirroring transforms flip the winding of the triangles as seen on screen
+				if (pickable.worldTfrm.determinant3x3() < 0.0f)
+				{
+					if (pickable.cullMode == CULL_CLOCKWISE)
+						pickable.cullMode = CULL_COUNTERCLOCKWISE;
+					else if (pickable.cullMode == CULL_COUNTERCLOCKWISE)
+						pickable.cullMode = CULL_CLOCKWISE;
+				}
+			}
+		};
+
+		if (!dirty)
+		{
+			updateCullModes();
+			return;
+		}
+
+		mPickables.resize(current.size());
+
+		Vector<AABox> bounds(current.size());
+		for (UINT32 i = 0; i < (UINT32)current.size(); i++)
+		{
+			HSceneObject so = current[i].sceneObject;
+			HMesh mesh = current[i].mesh;
+
+			PickableRenderable& pickable = mPickables[i];
+			pickable.sceneObject = so;
+			pickable.mesh = mesh.get();
+			pickable.meshBVH = mMeshBVHs[mesh.get()].bvh;
+			pickable.worldTfrm = so->getWorldTfrm();
+			pickable.invWorldTfrm = pickable.worldTfrm.inverseAffine();
+			pickable.tfrmHash = so->getTransformHash();
+
+			Bounds worldBounds = mesh->getProperties().getBounds();
+			worldBounds.transformAffine(pickable.worldTfrm);
+
+			bounds[i] = worldBounds.getBox();
+		}
+
+		updateCullModes();
+		mSceneBVH.build(bounds, 1);
+	}
+
+	void ScenePicking::findPickableRenderables(Vector<PickableSource>& output) const
+	{
+		const Map<Renderable*, SceneRenderableData>& renderables = SceneManager::instance().getAllRenderables();
+		for (auto& renderableData : renderables)
+		{
+			HSceneObject so = renderableData.second.sceneObject;
+			if (!so->getActive())
+				continue;
+
+			HMesh mesh = renderableData.second.renderable->getMesh();
+			if (!mesh.isLoaded())
+				continue;
+
+			CullingMode cullMode;
+			if (!getCPUPickingState(*renderableData.second.renderable, cullMode))
+				continue;
+
+			output.push_back({ so, mesh, cullMode });
+		}
+	}
+
+	bool ScenePicking::getCPUPickingState(const Renderable& renderable, CullingMode& cullMode)
+	{
+		cullMode = CULL_NONE;
+
+		UINT32 numSubMeshes = renderable.getMesh()->getProperties().getNumSubMeshes();
+		for (UINT32 i = 0; i < numSubMeshes; i++)
+		{
+			bool alpha;
+			CullingMode subMeshCullMode;
+			getPickingState(renderable.getMaterial(i), alpha, subMeshCullMode);
+
+			// Triangle hierarchies are built for the whole mesh, so all sub-meshes need to be culled the same way
+			if (alpha || (i > 0 && subMeshCullMode != cullMode))
+				return false;
+
+			cullMode = subMeshCullMode;
+		}
+
+		return true;
+	}
+
+	void ScenePicking::getPickingState(const HMaterial& material, bool& alpha, CullingMode& cullMode)
+	{
+		alpha = false;
+
+		SPtr<RasterizerState> rasterizerState;
+		if (material != nullptr && material->getNumPasses() > 0)
+		{
+			SPtr<Pass> firstPass = material->getPass(0); // Note: We only ever check the first pass, problem?
+			alpha = firstPass->hasBlending();
+			rasterizerState = firstPass->getRasterizerState();
+		}
+
+		if (rasterizerState == nullptr)
+			rasterizerState = RasterizerState::getDefault();
+
+		cullMode = rasterizerState->getProperties().getCullMode();
+	}
+
+	bool ScenePicking::updateMeshBVHs(const Vector<PickableSource>& renderables)
+	{
+		for (auto iter = mMeshBVHs.begin(); iter != mMeshBVHs.end();)
+		{
+			if (iter->second.mesh.expired())
+				iter = mMeshBVHs.erase(iter);
+			else
+				++iter;
+		}
+
+		bool anyBuilt = false;
+		for (auto& entry : renderables)
+		{
+			SPtr<Mesh> mesh = entry.mesh.getInternalPtr();
+
+			auto iterFind = mMeshBVHs.find(mesh.get());
+			if (iterFind != mMeshBVHs.end() && iterFind->second.mesh.lock() == mesh)
+			{
+				MeshBVHEntry& bvhEntry = iterFind->second;
+				if (bvhEntry.readData != nullptr && bvhEntry.readOp.hasCompleted())
+				{
+					bvhEntry.bvh = MeshBVH::create(*bvhEntry.readData, mesh->getProperties());
+					bvhEntry.readData = nullptr;
+					anyBuilt = true;
+				}
+
+				continue;
+			}
+
+			MeshBVHEntry& bvhEntry = mMeshBVHs[mesh.get()];
+			bvhEntry.mesh = mesh;
+			bvhEntry.bvh = nullptr;
+
+			SPtr<MeshData> meshData = mesh->allocateSubresourceBuffer(0);
+			if ((mesh->getUsage() & MU_CPUCACHED) != 0)
+			{
+				mesh->readData(*meshData);
+
+				bvhEntry.bvh = MeshBVH::create(*meshData, mesh->getProperties());
+				bvhEntry.readData = nullptr;
+				anyBuilt = true;
+			}
+			else
+			{
+				// Don't wait on the read, the hierarchy is built on one of the following calls once the data arrives
+				bvhEntry.readData = meshData;
+				bvhEntry.readOp = mesh->readSubresource(gCoreAccessor(), 0, meshData);
+			}
+		}
+
+		return anyBuilt;
+	}
+
+	INT32 ScenePicking::findClosestHit(const Ray& ray, const Vector<HSceneObject>& ignoreRenderables, float& distance, 
+		Vector3& normal) const
+	{
+		INT32 closestIdx = -1;
+		distance = std::numeric_limits<float>::max();
+
+		Vector3 localNormal;
+		mSceneBVH.intersects(ray, distance, 
+			[&](UINT32 idx, float& maxDistance)
+		{
+			const PickableRenderable& pickable = mPickables[idx];
+			if (isIgnored(pickable.sceneObject, ignoreRenderables))
+				return;
+
+			// Direction is intentionally left unnormalized so distances in local space match the ones in world space
+			Ray localRay(pickable.invWorldTfrm.multiplyAffine(ray.getOrigin()), 
+				pickable.invWorldTfrm.multiplyDirection(ray.getDirection()));
+
+			float hitDistance;
+			Vector3 hitNormal;
+			if (pickable.meshBVH != nullptr)
+			{
+				if (!pickable.meshBVH->intersects(localRay, hitDistance, hitNormal, pickable.cullMode))
+					return;
+			}
+			else
+			{
+				// No triangle data available, fall back to the bounds
+				auto boundsHit = pickable.mesh->getProperties().getBounds().getBox().intersects(localRay);
+				if (!boundsHit.first)
+					return;
+
+				hitDistance = boundsHit.second;
+				hitNormal = -Vector3::normalize(localRay.getDirection());
+			}
+
+			if (hitDistance < maxDistance)
+			{
+				maxDistance = hitDistance;
+				localNormal = hitNormal;
+				closestIdx = (INT32)idx;
+			}
+		});
+
+		// Normals transform with the inverse transpose, so they remain perpendicular to non-uniformly scaled surfaces
+		if (closestIdx != -1)
+		{
+			Matrix3 invRotScale;
+			mPickables[closestIdx].invWorldTfrm.extract3x3Matrix(invRotScale);
+
+			normal = Vector3::normalize(invRotScale.transpose().transform(localNormal));
+		}
+
+		return closestIdx;
+	}
+
+	bool ScenePicking::isIgnored(const HSceneObject& so, const Vector<HSceneObject>& ignoreRenderables)
+	{
+		for (auto& entry : ignoreRenderables)
+		{
+			if (entry == so)
+				return true;
+		}
+
+		return false;
+	}
+
 	Color ScenePicking::encodeIndex(UINT32 index)
 	{
 		Color encoded;
@@ -259,6 +601,10 @@ namespace BansheeEngine
 
 				vertParams->getParam("matWorldViewProj", md.mParamPickingWVP);
 				fragParams->getParam("colorIndex", md.mParamPickingColor);
+
+				// Normals aren't output by all render API variants of the shader
+				if (vertParams->hasParam("octahedralNormals"))
+					vertParams->getParam("octahedralNormals", md.mParamPickingOctahedralNormals);
 			}
 
 			{
@@ -269,6 +615,10 @@ namespace BansheeEngine
 				vertParams->getParam("matWorldViewProj", md.mParamPickingAlphaWVP);
 				fragParams->getParam("colorIndex", md.mParamPickingAlphaColor);
 				fragParams->getTextureParam("mainTexture", md.mParamPickingAlphaTexture);
+				vertParams->getParam("uvScaleOffset", md.mParamPickingAlphaUVScaleOffset);
+
+				if (vertParams->hasParam("octahedralNormals"))
+					vertParams->getParam("octahedralNormals", md.mParamPickingAlphaOctahedralNormals);
 
 				GpuParamFloatCore alphaCutoffParam;
 				fragParams->getParam("alphaCutoff", alphaCutoffParam);
@@ -336,11 +686,20 @@ namespace BansheeEngine
 			Color color = ScenePicking::encodeIndex(renderable.index);
 			MaterialData& md = mMaterialData[(UINT32)activeMaterialCull];
 
+			// Position decode is folded into the world-view-projection transform, normals and UVs are decoded by the shader
+			const MeshVertexCompression& compression = renderable.mesh->getProperties().getVertexCompression();
+			float octahedralNormals = compression.octahedralNormals ? 1.0f : 0.0f;
+
 			if (activeMaterialIsAlpha)
 			{
+				Vector4 uvScaleOffset(compression.uvScale.x, compression.uvScale.y, compression.uvOffset.x, 
+					compression.uvOffset.y);
+
 				md.mParamPickingAlphaWVP.set(renderable.wvpTransform);
 				md.mParamPickingAlphaColor.set(color);
 				md.mParamPickingAlphaTexture.set(renderable.mainTexture->getCore());
+				md.mParamPickingAlphaOctahedralNormals.set(octahedralNormals);
+				md.mParamPickingAlphaUVScaleOffset.set(uvScaleOffset);
 
 				gRendererUtility().setPassParams(md.mPickingAlphaParams);
 			}
@@ -348,6 +707,7 @@ namespace BansheeEngine
 			{
 				md.mParamPickingWVP.set(renderable.wvpTransform);
 				md.mParamPickingColor.set(color);
+				md.mParamPickingOctahedralNormals.set(octahedralNormals);
 
 				gRendererUtility().setPassParams(md.mPickingParams);
 			}
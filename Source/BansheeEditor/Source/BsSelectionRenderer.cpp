@@ -114,6 +114,7 @@ namespace BansheeEngine
 
 		SPtr<GpuParamsCore> vertParams = mParams[mAnimatedTechniqueIdx]->getGpuParams(GPT_VERTEX_PROGRAM);
 		vertParams->getBufferParam("boneMatrices", mBoneMatrices);
+		vertParams->getParam("matDecodePosition", mDecodePosition);
 	}
 
 	void SelectionRendererCore::updateData(const SPtr<CameraCore>& camera, const Vector<SPtr<RenderableCore>>& objects)
@@ -151,6 +152,14 @@ namespace BansheeEngine
 			Matrix4 worldViewProjMat = viewProjMat * renderable->getTransform();
 			UINT32 techniqueIdx = renderable->isAnimated() ? mAnimatedTechniqueIdx : mDefaultTechniqueIdx;
 
+			// Compressed positions must be decoded before skinning, so only static meshes can fold the decode transform
+			// into the world-view-projection matrix
+			Matrix4 decodePosition = mesh->getProperties().getVertexCompression().getPositionDecodeTransform();
+			if (renderable->isAnimated())
+				mDecodePosition.set(decodePosition);
+			else
+				worldViewProjMat = worldViewProjMat * decodePosition;
+
 			mMatWorldViewProj[techniqueIdx].set(worldViewProjMat);
 			mColor[techniqueIdx].set(SELECTION_COLOR);
 
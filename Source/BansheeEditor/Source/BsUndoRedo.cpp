@@ -6,10 +6,11 @@
 namespace BansheeEngine
 {
 	const UINT32 UndoRedo::MAX_STACK_ELEMENTS = 1000;
+	const UINT32 UndoRedo::DEFAULT_MEMORY_BUDGET = 64 * 1024 * 1024;
 
 	UndoRedo::UndoRedo()
 		: mUndoStack(nullptr), mRedoStack(nullptr), mUndoStackPtr(0), mUndoNumElements(0), mRedoStackPtr(0)
-		, mRedoNumElements(0), mNextCommandId(0)
+		, mRedoNumElements(0), mNextCommandId(0), mMemoryBudget(DEFAULT_MEMORY_BUDGET)
 	{
 		mUndoStack = bs_newN<EditorCommand*>(MAX_STACK_ELEMENTS);
 		mRedoStack = bs_newN<EditorCommand*>(MAX_STACK_ELEMENTS);
@@ -87,9 +88,15 @@ namespace BansheeEngine
 	void UndoRedo::registerCommand(EditorCommand* command)
 	{
 		command->mId = mNextCommandId++;
+
+		// Objects are now in the state the previous command left them in, allowing it to store only the difference
+		if (mUndoNumElements > 0)
+			mUndoStack[mUndoStackPtr]->compact();
+
 		addToUndoStack(command);
 
 		clearRedoStack();
+		enforceMemoryBudget();
 	}
 
 	UINT32 UndoRedo::getTopCommandId() const
@@ -151,6 +158,47 @@ namespace BansheeEngine
 		clearRedoStack();
 	}
 
+	UINT32 UndoRedo::getMemoryUsage() const
+	{
+		UINT32 memoryUsage = 0;
+
+		UINT32 undoPtr = mUndoStackPtr;
+		for (UINT32 i = 0; i < mUndoNumElements; i++)
+		{
+			memoryUsage += mUndoStack[undoPtr]->getMemoryUsage();
+			undoPtr = (undoPtr + MAX_STACK_ELEMENTS - 1) % MAX_STACK_ELEMENTS;
+		}
+
+		UINT32 redoPtr = mRedoStackPtr;
+		for (UINT32 i = 0; i < mRedoNumElements; i++)
+		{
+			memoryUsage += mRedoStack[redoPtr]->getMemoryUsage();
+			redoPtr = (redoPtr + MAX_STACK_ELEMENTS - 1) % MAX_STACK_ELEMENTS;
+		}
+
+		return memoryUsage;
+	}
+
+	void UndoRedo::enforceMemoryBudget()
+	{
+		// Group entries are counted from the top of the stack, so removing the bottom entries would break them
+		if (!mGroups.empty())
+			return;
+
+		UINT32 memoryUsage = getMemoryUsage();
+
+		// Always keep the most recent command
+		while (memoryUsage > mMemoryBudget && mUndoNumElements > 1)
+		{
+			UINT32 oldestPtr = (mUndoStackPtr + MAX_STACK_ELEMENTS - (mUndoNumElements - 1)) % MAX_STACK_ELEMENTS;
+			EditorCommand* command = mUndoStack[oldestPtr];
+			mUndoNumElements--;
+
+			memoryUsage -= std::min(memoryUsage, command->getMemoryUsage());
+			EditorCommand::destroy(command);
+		}
+	}
+
 	EditorCommand* UndoRedo::removeLastFromUndoStack()
 	{
 		EditorCommand* command = mUndoStack[mUndoStackPtr];
@@ -97,6 +97,7 @@ set(BS_BANSHEEENGINE_INC_RENDERER
 	"Include/BsRenderQueue.h"
 	"Include/BsSceneManager.h"
 	"Include/BsRendererUtility.h"
+	"Include/BsOcclusionCulling.h"
 	"Include/BsStandardPostProcessSettings.h"	
 )
 
@@ -109,6 +110,7 @@ set(BS_BANSHEEENGINE_SRC_2D
 	"Source/BsSprite.cpp"
 	"Source/BsSpriteTexture.cpp"
 	"Source/BsTextSprite.cpp"
+	"Source/BsTextLayoutCache.cpp"
 	"Source/BsSpriteMaterial.cpp"
 	"Source/BsSpriteMaterials.cpp"
 	"Source/BsSpriteManager.cpp"
@@ -128,6 +130,7 @@ set(BS_BANSHEEENGINE_INC_2D
 	"Include/BsSprite.h"
 	"Include/BsSpriteTexture.h"
 	"Include/BsTextSprite.h"
+	"Include/BsTextLayoutCache.h"
 	"Include/BsSpriteMaterial.h"
 	"Include/BsSpriteMaterials.h"
 	"Include/BsSpriteManager.h"
@@ -200,6 +203,7 @@ set(BS_BANSHEEENGINE_SRC_RENDERER
 	"Source/BsRenderQueue.cpp"
 	"Source/BsSceneManager.cpp"
 	"Source/BsRendererUtility.cpp"
+	"Source/BsOcclusionCulling.cpp"
 	"Source/BsStandardPostProcessSettings.cpp"	
 )
 
@@ -101,6 +101,12 @@ namespace BansheeEngine
 		/** Checks whether the animation will be evaluated when it is out of view. */
 		bool getEnableCull() const { return mEnableCull; }
 
+		/** @copydoc Animation::setLODs */
+		void setLODs(const Vector<AnimationLOD>& lods);
+
+		/** @copydoc Animation::getLODs */
+		const Vector<AnimationLOD>& getLODs() const { return mLODs; }
+
 		/** Triggered whenever an animation event is reached. */
 		Event<void(const HAnimationClip&, const String&)> onEventTriggered;
 
@@ -190,6 +196,7 @@ namespace BansheeEngine
 		bool mEnableCull;
 		bool mUseBounds;
 		AABox mBounds;
+		Vector<AnimationLOD> mLODs;
 
 		Vector<SceneObjectMappingInfo> mMappingInfos;
 
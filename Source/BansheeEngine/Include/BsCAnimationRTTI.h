@@ -23,6 +23,7 @@ namespace BansheeEngine
 			BS_RTTI_MEMBER_PLAIN(mEnableCull, 3)
 			BS_RTTI_MEMBER_PLAIN(mUseBounds, 4)
 			BS_RTTI_MEMBER_PLAIN(mBounds, 5)
+			BS_RTTI_MEMBER_PLAIN_ARRAY(mLODs, 6)
 		BS_END_RTTI_MEMBERS
 	public:
 		CAnimationRTTI()
@@ -36,6 +36,12 @@ namespace BansheeEngine
 		/** @copydoc Renderable::getLayer */
 		UINT64 getLayer() const { return mInternal->getLayer(); }
 
+		/** @copydoc Renderable::setOccluder */
+		void setOccluder(const SPtr<MeshData>& occluder) { mInternal->setOccluder(occluder); }
+
+		/** @copydoc Renderable::getOccluder */
+		SPtr<MeshData> getOccluder() const { return mInternal->getOccluder(); }
+
 		/** @copydoc Renderable::getMesh */
 		HMesh getMesh() const { return mInternal->getMesh(); }
 
@@ -39,7 +39,9 @@ namespace BansheeEngine
 			GUIElem_HiddenSelf = 0x08,
 			GUIElem_InactiveSelf = 0x10,
 			GUIElem_Disabled = 0x20,
-			GUIElem_DisabledSelf = 0x40
+			GUIElem_DisabledSelf = 0x40,
+			GUIElem_OptimalSizeDirty = 0x80,
+			GUIElem_HierarchyDirty = 0x100
 		};
 
 	public:
@@ -141,7 +143,10 @@ namespace BansheeEngine
 		 */
 		virtual void _updateLayout(const GUILayoutData& data);
 
-		/** Calculates optimal sizes of all child elements, as determined by their style and layout options. */
+		/**
+		 * Calculates optimal sizes of all child elements, as determined by their style and layout options. Only children
+		 * whose optimal size was marked as dirty since the last call are recalculated.
+		 */
 		virtual void _updateOptimalLayoutSizes();
 
 		/** @copydoc _updateLayout */
@@ -282,6 +287,18 @@ namespace BansheeEngine
 		/**	Returns true if elements contents have changed since last update. */
 		bool _isDirty() const { return (mFlags & GUIElem_Dirty) != 0; }
 
+		/** 
+		 * Returns true if the size range of this element, or of any of its children, changed since the last call to
+		 * _updateOptimalLayoutSizes().
+		 */
+		bool _isOptimalSizeDirty() const { return (mFlags & GUIElem_OptimalSizeDirty) != 0; }
+
+		/**
+		 * Returns true if this element or any of its children requested a layout update, or if the layout data of this
+		 * element changed during the last layout update and the change wasn't yet processed by the parent widget.
+		 */
+		bool _isHierarchyDirty() const { return (mFlags & GUIElem_HierarchyDirty) != 0; }
+
 		/**	Marks the element contents to be up to date (meaning it's processed by the GUI system). */
 		void _markAsClean();
 
@@ -315,13 +332,22 @@ namespace BansheeEngine
 		 */
 		void setUpdateParent(GUIElementBase* updateParent);
 
+		/**
+		 * Assigns new layout data to a child element and updates the layout of its children. The update is skipped if the
+		 * layout data didn't change and nothing in the child's hierarchy requested a layout update.
+		 */
+		void updateChildLayout(GUIElementBase* child, const GUILayoutData& data);
+
+		/** Marks optimal sizes of all child elements as dirty, ensuring they are recalculated on the next layout update. */
+		void markChildOptimalSizesDirty();
+
 		GUIWidget* mParentWidget;
 		GUIPanel* mAnchorParent;
 		GUIElementBase* mUpdateParent;
 		GUIElementBase* mParentElement;
 
 		Vector<GUIElementBase*> mChildren;	
-		UINT8 mFlags;
+		UINT16 mFlags;
 
 		GUIDimensions mDimensions;
 		GUILayoutData mLayoutData;
@@ -11,6 +11,7 @@
 #include "BsModule.h"
 #include "BsColor.h"
 #include "BsMatrix4.h"
+#include "BsRect2I.h"
 #include "BsEvent.h"
 #include "BsMaterialParam.h"
 
@@ -46,14 +47,37 @@ namespace BansheeEngine
 			Dragging
 		};
 
+		/** Information about a single render element of a GUI element, stored in a GUI mesh. */
+		struct GUIMeshElement
+		{
+			GUIElement* element;
+			UINT32 renderElement;
+			UINT32 depth;
+			UINT32 vertexOffset;
+			UINT32 indexOffset;
+			UINT32 numVertices;
+			UINT32 numIndices;
+		};
+
 		/** Data required for rendering a single GUI mesh. */
 		struct GUIMeshData
 		{
 			SPtr<TransientMesh> mesh;
+			SPtr<MeshData> meshData; /**< Contents of the mesh. Must not be modified, as it is shared with the core thread. */
 			SpriteMaterial* material;
 			SpriteMaterialInfo matInfo;
 			GUIWidget* widget;
 			bool isLine;
+			UINT64 mergeHash;
+			Rect2I bounds; /**< Area elements of the mesh are allowed to cover without breaking the rendering order. */
+			Vector<GUIMeshElement> elements;
+		};
+
+		/** Location of a single render element within GUIRenderData::cachedMeshes. */
+		struct GUIMeshElementRef
+		{
+			UINT32 meshIdx;
+			UINT32 elementIdx;
 		};
 
 		/**	GUI render data for a single viewport. */
@@ -66,6 +90,9 @@ namespace BansheeEngine
 			Vector<GUIMeshData> cachedMeshes;
 			Vector<GUIWidget*> widgets;
 			bool isDirty;
+
+			/** Locations of all render elements of a GUI element in the cached meshes, indexed by render element index. */
+			UnorderedMap<GUIElement*, Vector<GUIMeshElementRef>> elementLookup;
 		};
 
 		/**	Render data for a single GUI group used for notifying the core GUI renderer. */
@@ -182,6 +209,12 @@ namespace BansheeEngine
 		 */
 		GUIInputSelection* getInputSelectionTool() const { return mInputSelection; }
 
+		/** 
+		 * Returns the number of GUI elements whose layout was updated during the last frame, across all widgets. Useful
+		 * for profiling, as unmodified element hierarchies are skipped during layout updates.
+		 */
+		UINT32 getNumUpdatedLayoutElements() const { return mNumUpdatedLayoutElements; }
+
 		/**
 		 * Allows you to bridge GUI input from a GUI element into another render target.
 		 *
@@ -227,6 +260,34 @@ namespace BansheeEngine
 		/**	Recreates all dirty GUI meshes and makes them ready for rendering. */
 		void updateMeshes();
 
+		/** 
+		 * Groups all visible GUI elements of the viewport into as few meshes as possible, without breaking the back to
+		 * front rendering order, and builds the meshes.
+		 */
+		void rebuildMeshes(GUIRenderData& renderData);
+
+		/**
+		 * Rebuilds only the parts of the cached meshes that belong to the provided elements, keeping the existing
+		 * grouping. 
+		 *
+		 * @param[in]	renderData		Render data of the viewport the elements belong to.
+		 * @param[in]	dirtyElements	Elements whose contents changed.
+		 * @return						False if any of the elements changed in a way that requires the elements to be
+		 *								regrouped (e.g. depth, material or mesh type changed, or the element moved outside
+		 *								of its mesh's bounds). In that case no meshes are modified, and rebuildMeshes()
+		 *								should be called instead.
+		 */
+		bool updateDirtyMeshes(GUIRenderData& renderData, const Vector<GUIElement*>& dirtyElements);
+
+		/** 
+		 * Assigns vertex and index ranges to all elements of the mesh using their current sizes, and fills a newly 
+		 * allocated mesh data with their contents. 
+		 */
+		void buildMeshData(GUIMeshData& guiMeshData);
+
+		/** Fills the vertex and index range of a single render element in the provided mesh data. */
+		static void fillMeshElement(const GUIMeshElement& meshElement, MeshData& meshData);
+
 		/**	Recreates the input caret texture. */
 		void updateCaretTexture();
 
@@ -348,6 +409,7 @@ namespace BansheeEngine
 		UnorderedMap<const Viewport*, GUIRenderData> mCachedGUIData;
 		SPtr<MeshHeap> mTriangleMeshHeap;
 		SPtr<MeshHeap> mLineMeshHeap;
+		Vector<GUIElement*> mDirtyElements; // Transient
 
 		std::atomic<GUIManagerCore*> mCore;
 		bool mCoreDirty;
@@ -417,6 +479,11 @@ namespace BansheeEngine
 		HEvent mWindowLostFocusConn;
 
 		HEvent mMouseLeftWindowConn;
+
+		HEvent mGlyphPageEvictedConn;
+		bool mGlyphsEvicted;
+
+		UINT32 mNumUpdatedLayoutElements;
 	};
 
 	/**	Handles GUI rendering on the core thread. */
@@ -120,17 +120,33 @@ namespace BansheeEngine
 		void _markMeshDirty(GUIElementBase* elem);
 
 		/**
-		 * Marks the elements content as dirty, meaning its internal mesh will need to be rebuilt (this implies the entire
-		 * widget mesh will be rebuilt as well).
+		 * Marks the elements content as dirty, meaning its internal mesh will need to be rebuilt. Unlike _markMeshDirty()
+		 * this doesn't require the widget's elements to be re-batched, as long as the element's depth and material stay
+		 * the same.
 		 */
 		void _markContentDirty(GUIElementBase* elem);
 
+		/** 
+		 * Checks does the widget require all of its elements to be re-batched (e.g. elements were added, removed or 
+		 * their depth changed). 
+		 */
+		bool _isMeshDirty() const { return mWidgetIsDirty; }
+
+		/** Returns a list of elements whose content changed since the last call to isDirty(true). */
+		const Set<GUIElement*>& _getDirtyContents() const { return mDirtyContents; }
+
 		/**	Updates the layout of all child elements, repositioning and resizing them as needed. */
 		void _updateLayout();
 
 		/**	Updates the layout of the provided element, and queues content updates. */
 		void _updateLayout(GUIElementBase* elem);
 
+		/** 
+		 * Returns the number of elements whose layout was updated since the last call to _updateLayout(). Elements in
+		 * hierarchies that weren't modified are skipped during layout updates and are not counted.
+		 */
+		UINT32 _getNumUpdatedLayoutElements() const { return mNumUpdatedLayoutElements; }
+
 		/**
 		 * Updates internal transform values from the specified scene object, in case that scene object's transform changed
 		 * since the last call.
@@ -196,6 +212,8 @@ namespace BansheeEngine
 		mutable bool mWidgetIsDirty;
 		mutable Rect2I mBounds;
 
+		UINT32 mNumUpdatedLayoutElements;
+
 		HGUISkin mSkin;
 	};
 
@@ -0,0 +1,112 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "BsMatrix4.h"
+#include "BsAABox.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Renderer-Engine-Internal
+	 *  @{
+	 */
+
+	/** Triangle geometry used for rendering an occluder into an OcclusionBuffer. */
+	struct BS_EXPORT OccluderGeometry
+	{
+		/**
+		 * Extracts vertex positions and indices from the provided mesh data. Returns null if the mesh data contains no
+		 * positions or triangles.
+		 */
+		static SPtr<OccluderGeometry> create(const MeshData& meshData);
+
+		Vector<Vector3> positions;
+		Vector<UINT32> indices;
+	};
+
+	/**
+	 * Low resolution depth buffer rasterized on the CPU from a set of occluder triangles. Once rasterized it can be used
+	 * for determining if an object is fully hidden behind the occluders, without requiring any GPU readback.
+	 *
+	 * Usage: call clear() to set up the view, add geometry through addOccluder(), call rasterize() and then test objects
+	 * with isOccluded().
+	 */
+	class BS_EXPORT OcclusionBuffer
+	{
+	public:
+		/**
+		 * Creates a new occlusion buffer with the provided resolution. Width will be rounded up to a multiple of four, as
+		 * the buffer is processed in groups of four pixels.
+		 */
+		OcclusionBuffer(UINT32 width, UINT32 height);
+
+		/**
+		 * Clears the buffer and any queued occluders, and sets up the transform used for projecting occluders and tested
+		 * objects.
+		 *
+		 * @param[in]	viewProj	View-projection matrix of the view the buffer is being rendered for. Expected to
+		 *							follow the [-1, 1] depth range convention (e.g. as returned by
+		 *							CameraBase::getProjectionMatrix()).
+		 */
+		void clear(const Matrix4& viewProj);
+
+		/**
+		 * Transforms, clips and queues occluder triangles for rasterization.
+		 *
+		 * @param[in]	geometry	Occluder geometry in local space.
+		 * @param[in]	transform	Transform from occluder local space to world space.
+		 */
+		void addOccluder(const OccluderGeometry& geometry, const Matrix4& transform);
+
+		/**
+		 * Rasterizes all queued occluders into the depth buffer. If there are enough triangles the work will be split
+		 * into horizontal bands processed in parallel by the task scheduler.
+		 */
+		void rasterize();
+
+		/**
+		 * Tests the provided world space bounds against the depth buffer. Returns true if the bounds are fully hidden
+		 * behind previously rasterized occluders. The test is conservative, bounds that reach within a pixel of an
+		 * occluder edge are considered visible. Must be called after rasterize().
+		 */
+		bool isOccluded(const AABox& bounds) const;
+
+		/** Checks does the buffer contain any occluder triangles. */
+		bool hasOccluders() const { return !mTriangles.empty(); }
+
+		/** Returns the width of the buffer, in pixels. */
+		UINT32 getWidth() const { return mWidth; }
+
+		/** Returns the height of the buffer, in pixels. */
+		UINT32 getHeight() const { return mHeight; }
+
+	private:
+		/** Triangle prepared for rasterization, with edge equations and depth plane in screen space. */
+		struct Triangle
+		{
+			float edgeX[3], edgeY[3], edgeC[3]; /**< Edge functions in the form of x * edgeX + y * edgeY + edgeC. */
+			float depthX, depthY, depthC; /**< Depth plane in the form of x * depthX + y * depthY + depthC. */
+			INT32 minX, minY, maxX, maxY; /**< Inclusive pixel bounds, clamped to the buffer. */
+		};
+
+		/** Prepares a clip space triangle for rasterization and queues it, if it covers any pixels. */
+		void setupTriangle(const Vector4& a, const Vector4& b, const Vector4& c);
+
+		/** Rasterizes all queued triangles, limiting the output to the provided range of rows. */
+		void rasterizeRows(INT32 startRow, INT32 endRow);
+
+		/** Minimum number of triangles required before rasterization is split over multiple threads. */
+		static const UINT32 MIN_TRIANGLES_PER_TASK;
+
+		UINT32 mWidth;
+		UINT32 mHeight;
+		Matrix4 mViewProj;
+
+		Vector<float> mDepth;
+		Vector<Triangle> mTriangles;
+		Vector<Vector4> mClipVertices; // Transient
+	};
+
+	/** @} */
+}
@@ -188,6 +188,7 @@ namespace BansheeEngine
 
 	// 2D
 	class TextSprite;
+	class TextLayoutCache;
 	class ImageSprite;
 	class SpriteTexture;
 	class SpriteMaterial;
@@ -239,6 +239,9 @@ namespace BansheeEngine
 		GUILabel* mGPUIndexBufferBindsLbl;
 		GUILabel* mGPUGPUProgramBufferBindsLbl;
 		GUILabel* mGPUGPUProgramBindsLbl;
+		GUILabel* mGPUParamsWrittenLbl;
+		GUILabel* mGPUOcclusionCulledLbl;
+		GUILabel* mGPURenderTargetMemoryLbl;
 
 		HString mGPUFrameNumStr;
 		HString mGPUTimeStr;
@@ -263,6 +266,9 @@ namespace BansheeEngine
 		HString mGPUIndexBufferBindsStr;
 		HString mGPUGPUProgramBufferBindsStr;
 		HString mGPUGPUProgramBindsStr;
+		HString mGPUParamsWrittenStr;
+		HString mGPUOcclusionCulledStr;
+		HString mGPURenderTargetMemoryStr;
 
 		Vector<BasicRow> mBasicRows;
 		Vector<PreciseRow> mPreciseRows;
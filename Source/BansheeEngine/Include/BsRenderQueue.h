@@ -44,6 +44,8 @@ namespace BansheeEngine
 		/**	Data used for renderable element sorting. Represents a single pass for a single mesh. */
 		struct SortableElement
 		{
+			RenderableElement* element;
+			bool separablePasses;
 			UINT32 seqIdx;
 			INT32 priority;
 			float distFromCamera;
@@ -63,10 +65,28 @@ namespace BansheeEngine
 		 */
 		void add(RenderableElement* element, float distFromCamera);
 
+		/**
+		 * Inserts a new entry into the render queue. If the queue is already sorted the entry is inserted at its sorted
+		 * position, so the following call to sort() doesn't need to re-sort the existing entries.
+		 *
+		 * @param[in]	element			Renderable element to add to the queue.
+		 * @param[in]	distFromCamera	Distance of this object from the camera. Used for distance sorting.
+		 */
+		void insert(RenderableElement* element, float distFromCamera);
+
+		/** 
+		 * Removes all entries belonging to the provided renderable element from the queue. Remaining entries keep their
+		 * order, so the following call to sort() doesn't need to re-sort them.
+		 */
+		void remove(RenderableElement* element);
+
 		/**	Clears all render operations from the queue. */
 		void clear();
 		
-		/**	Sorts all the render operations using user-defined rules. */
+		/**	
+		 * Sorts all the render operations using user-defined rules. If no entries were added using add() since the last
+		 * sort, only the list of sorted elements is regenerated. 
+		 */
 		virtual void sort();
 
 		/** Returns a list of sorted render elements. Caller must ensure sort() is called before this method. */
@@ -76,9 +96,20 @@ namespace BansheeEngine
 		 * Controls if and how a render queue groups renderable objects by material in order to reduce number of state 
 		 * changes.
 		 */
-		void setStateReduction(StateReduction mode) { mStateReductionMode = mode; }
+		void setStateReduction(StateReduction mode) { mStateReductionMode = mode; mIsSorted = false; }
 
 	protected:
+		typedef bool(*SortMethod)(UINT32, UINT32, const Vector<SortableElement>&);
+
+		/** 
+		 * Creates sortable entries for every pass of the provided element. If @p keepSorted is true the entries are 
+		 * inserted at their sorted position, otherwise they are appended and the queue is marked as unsorted.
+		 */
+		void addSortableElements(RenderableElement* element, float distFromCamera, bool keepSorted);
+
+		/** Returns the method used for comparing sortable elements, depending on the active state reduction mode. */
+		SortMethod getSortMethod() const;
+
 		/**	Callback used for sorting elements with no material grouping. */
 		static bool elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
 
@@ -90,7 +121,9 @@ namespace BansheeEngine
 
 		Vector<SortableElement> mSortableElements;
 		Vector<UINT32> mSortableElementIdx;
-		Vector<RenderableElement*> mElements;
+		Vector<UINT32> mFreeSortableElements;
+		UINT32 mNextSeqIdx;
+		bool mIsSorted;
 
 		Vector<RenderQueueElement> mSortedRenderElements;
 		StateReduction mStateReductionMode;
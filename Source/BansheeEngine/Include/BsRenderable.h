@@ -95,6 +95,18 @@ namespace BansheeEngine
 		 */
 		void setUseOverrideBounds(bool enable);
 
+		/**
+		 * Sets simplified geometry that will be rendered into the renderer's occlusion buffer, allowing the renderable to
+		 * hide other objects behind it. The geometry should be fully contained within the visible mesh (e.g. a box inside
+		 * a wall), and ideally consist of only a few dozen triangles. Only vertex positions and indices are used. 
+		 * Provide null to stop the renderable from acting as an occluder (default).
+		 *
+		 * @param[in]	occluder	Occluder geometry in local space. Must not be modified after it has been assigned.
+		 *
+		 * @note	Occluder geometry is a runtime-only property and is not saved along with the renderable.
+		 */
+		void setOccluder(const SPtr<MeshData>& occluder);
+
 		/**
 		 * Gets the layer bitfield that controls whether a renderable is considered visible in a specific camera. 
 		 * Renderable layer must match camera layer in order for the camera to render the component.
@@ -119,6 +131,9 @@ namespace BansheeEngine
 		/**	Gets whether the object should be rendered or not. */
 		bool getIsActive() const { return mIsActive; }
 
+		/** Returns occluder geometry set by setOccluder(), or null if the renderable is not an occluder. */
+		SPtr<MeshData> getOccluder() const { return mOccluder; }
+
 		/**	Retrieves the world position of the renderable. */
 		Vector3 getPosition() const { return mPosition; }
 
@@ -147,6 +162,7 @@ namespace BansheeEngine
 		UINT64 mLayer;
 		AABox mOverrideBounds;
 		bool mUseOverrideBounds;
+		SPtr<MeshData> mOccluder;
 		Vector3 mPosition;
 		Matrix4 mTransform;
 		Matrix4 mTransformNoScale;
@@ -5,6 +5,7 @@
 #include "BsPrerequisites.h"
 #include "BsModule.h"
 #include "BsSpriteMaterial.h"
+#include "BsEvent.h"
 
 namespace BansheeEngine
 {
@@ -12,7 +13,7 @@ namespace BansheeEngine
 	 *  @{
 	 */
 
-	/** Contains materials used for sprite rendering. */
+	/** Contains materials used for sprite rendering, and a cache of laid out text used by text sprites. */
 	class BS_EXPORT SpriteManager : public Module<SpriteManager>
 	{
 		/** Types of sprite materials accessible by default. */
@@ -48,6 +49,9 @@ namespace BansheeEngine
 		/** Returns a sprite material with the specified ID. Returns null if one cannot be found. */
 		SpriteMaterial* getMaterial(UINT32 id) const;
 
+		/** Returns the cache of recently laid out text strings, shared by all text sprites. */
+		TextLayoutCache& getTextLayoutCache() const { return *mTextLayoutCache; }
+
 		/** 
 		 * Registers a new material in the sprite manager. Caller must ensure the material has a unique ID that doesn't
 		 * already exist in the sprite manager, otherwise the call will be ignored.
@@ -75,6 +79,12 @@ namespace BansheeEngine
 	private:
 		UnorderedMap<UINT32, SpriteMaterial*> mMaterials;
 		UINT32 builtinMaterialIds[(UINT32)BuiltinSpriteMaterialType::Count];
+
+		TextLayoutCache* mTextLayoutCache;
+		HEvent mGlyphPageEvictedConn;
+
+		/** Default number of bytes the text layout cache is allowed to use. */
+		static const UINT32 TEXT_LAYOUT_CACHE_BUDGET;
 	};
 
 	/** @} */
@@ -0,0 +1,133 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "BsTextSprite.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup 2D-Internal
+	 *  @{
+	 */
+
+	/** Quads of a laid out text string that use a single font page. */
+	struct TextLayoutPage
+	{
+		HTexture texture;
+		UINT32 numQuads;
+		Vector<Vector2> vertices;
+		Vector<Vector2> uvs;
+		Vector<UINT32> indices;
+	};
+
+	/**
+	 * Result of laying out a text string in a specific set of bounds. Quads are relative to the bounds origin and can
+	 * be positioned or clipped without requiring the text to be laid out again.
+	 */
+	struct TextLayout
+	{
+		Vector<TextLayoutPage> pages;
+	};
+
+	/**
+	 * Keeps track of recently laid out text strings so that text sprites with the same text, font and bounds can reuse
+	 * their quads instead of performing word splitting, line breaking and glyph lookup again. Least recently used
+	 * layouts are evicted once the cache exceeds its memory budget.
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_EXPORT TextLayoutCache
+	{
+		/** Contains all the properties that determine the layout of a text string. */
+		struct Key
+		{
+			Key(const TEXT_SPRITE_DESC& desc);
+
+			class HashFunction
+			{
+			public:
+				size_t operator()(const Key* key) const { return key->hash; }
+			};
+
+			class EqualFunction
+			{
+			public:
+				bool operator()(const Key* lhs, const Key* rhs) const;
+			};
+
+			WString text;
+			UINT64 fontId;
+			UINT32 fontSize;
+			UINT32 width;
+			UINT32 height;
+			TextHorzAlign horzAlign;
+			TextVertAlign vertAlign;
+			SpriteAnchor anchor;
+			bool wordWrap;
+			bool wordBreak;
+			size_t hash;
+		};
+
+		/** Cached layout along with the key it was generated for. */
+		struct Entry
+		{
+			Entry(Key&& key)
+				:key(std::move(key)), memorySize(0)
+			{ }
+
+			Key key;
+			TextLayout layout;
+			UINT32 memorySize;
+		};
+
+	public:
+		/**
+		 * Creates a new cache.
+		 *
+		 * @param[in]	memoryBudget	Maximum number of bytes all the cached layouts are allowed to use.
+		 */
+		TextLayoutCache(UINT32 memoryBudget);
+
+		/**
+		 * Returns the layout of the text described by @p desc, either from the cache or by laying out the text if it isn't
+		 * cached. Returned layout is only valid until the next call to getLayout() or clear().
+		 */
+		const TextLayout& getLayout(const TEXT_SPRITE_DESC& desc);
+
+		/** Removes all cached layouts. */
+		void clear();
+
+		/** Changes the maximum number of bytes all the cached layouts are allowed to use, evicting layouts if needed. */
+		void setMemoryBudget(UINT32 memoryBudget);
+
+		/** Returns the maximum number of bytes all the cached layouts are allowed to use. */
+		UINT32 getMemoryBudget() const { return mMemoryBudget; }
+
+		/** Returns the number of bytes used by all the cached layouts. */
+		UINT32 getMemoryUsage() const { return mMemoryUsage; }
+
+		/** Returns the number of getLayout() calls that were serviced from the cache. */
+		UINT64 getNumHits() const { return mNumHits; }
+
+		/** Returns the number of getLayout() calls that required the text to be laid out. */
+		UINT64 getNumMisses() const { return mNumMisses; }
+
+	private:
+		/** Evicts least recently used layouts until the usage drops to or below the provided number of bytes. */
+		void evict(UINT32 targetUsage);
+
+		/** Performs word splitting, line breaking and quad generation for the text described by @p desc. */
+		static void generate(const TEXT_SPRITE_DESC& desc, Entry& entry);
+
+		List<Entry> mEntries; // Most recently used at front
+		UnorderedMap<const Key*, List<Entry>::iterator, Key::HashFunction, Key::EqualFunction> mLookup;
+
+		UINT32 mMemoryBudget;
+		UINT32 mMemoryUsage;
+		UINT64 mNumHits;
+		UINT64 mNumMisses;
+	};
+
+	/** @} */
+}
@@ -162,6 +162,14 @@ namespace BansheeEngine
 			mInternal->setCulling(enable);
 	}
 
+	void CAnimation::setLODs(const Vector<AnimationLOD>& lods)
+	{
+		mLODs = lods;
+
+		if (mInternal != nullptr)
+			mInternal->setLODs(lods);
+	}
+
 	void CAnimation::onInitialized()
 	{
 		
@@ -204,6 +212,7 @@ namespace BansheeEngine
 		mInternal->setWrapMode(mWrapMode);
 		mInternal->setSpeed(mSpeed);
 		mInternal->setCulling(mEnableCull);
+		mInternal->setLODs(mLODs);
 
 		_updateBounds();
 
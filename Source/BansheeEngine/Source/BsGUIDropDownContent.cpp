@@ -404,12 +404,12 @@ namespace BansheeEngine
 
 			yOffset += childData.area.height;
 
-			guiMainElement->_setLayoutData(childData);
+			updateChildLayout(guiMainElement, childData);
 
 			// Shortcut label
 			GUILabel* shortcutLabel = visElem.shortcutLabel;
 			if (shortcutLabel != nullptr)
-				shortcutLabel->_setLayoutData(childData);
+				updateChildLayout(shortcutLabel, childData);
 		}
 	}
 
@@ -84,8 +84,11 @@ namespace BansheeEngine
 
 	void GUIElement::_setElementDepth(UINT8 depth)
 	{
+		UINT32 oldDepth = mLayoutData.depth;
 		mLayoutData.depth = depth | (mLayoutData.depth & 0xFFFFFF00);
-		_markMeshAsDirty();
+
+		if (mLayoutData.depth != oldDepth)
+			_markMeshAsDirty();
 	}
 
 	UINT8 GUIElement::_getElementDepth() const
@@ -97,9 +100,18 @@ namespace BansheeEngine
 	{
 		// Preserve element depth as that is not controlled by layout but is stored
 		// there only for convenience
+		UINT32 oldDepth = mLayoutData.depth;
 		UINT8 elemDepth = _getElementDepth();
+
 		GUIElementBase::_setLayoutData(data);
-		_setElementDepth(elemDepth);
+		mLayoutData.depth = elemDepth | (mLayoutData.depth & 0xFFFFFF00);
+
+		// Depth change affects the order in which GUI meshes are batched, while other changes only require the element's
+		// own mesh to be rebuilt
+		if (mLayoutData.depth != oldDepth)
+			_markMeshAsDirty();
+		else
+			_markContentAsDirty();
 
 		updateClippedBounds();
 	}
@@ -12,14 +12,14 @@ namespace BansheeEngine
 {
 	GUIElementBase::GUIElementBase()
 		: mParentWidget(nullptr), mAnchorParent(nullptr), mUpdateParent(nullptr), mParentElement(nullptr)
-		, mFlags(GUIElem_Dirty)
+		, mFlags(GUIElem_Dirty | GUIElem_OptimalSizeDirty | GUIElem_HierarchyDirty)
 	{
 
 	}
 
 	GUIElementBase::GUIElementBase(const GUIDimensions& dimensions)
 		: mParentWidget(nullptr), mAnchorParent(nullptr), mUpdateParent(nullptr), mParentElement(nullptr)
-		, mFlags(GUIElem_Dirty), mDimensions(dimensions)
+		, mFlags(GUIElem_Dirty | GUIElem_OptimalSizeDirty | GUIElem_HierarchyDirty), mDimensions(dimensions)
 	{
 
 	}
@@ -187,18 +187,32 @@ namespace BansheeEngine
 	
 	void GUIElementBase::_markAsClean()
 	{
-		mFlags &= ~GUIElem_Dirty;
+		mFlags &= ~(GUIElem_Dirty | GUIElem_HierarchyDirty);
 	}
 
 	void GUIElementBase::_markLayoutAsDirty() 
 	{ 
-		if(!_isVisible())
-			return;
+		// Parents cache size ranges of their children, so they need to be marked as well. Hidden elements still take up
+		// space in their parent layouts, so this is done regardless of visibility.
+		UINT16 parentFlags = GUIElem_OptimalSizeDirty;
 
-		if (mUpdateParent != nullptr)
-			mUpdateParent->mFlags |= GUIElem_Dirty;
-		else
-			mFlags |= GUIElem_Dirty;
+		if(_isVisible())
+		{
+			if (mUpdateParent != nullptr)
+				mUpdateParent->mFlags |= GUIElem_Dirty;
+			else
+				mFlags |= GUIElem_Dirty;
+
+			// Lets layout updates find the dirty elements without searching, and skip over unmodified hierarchies
+			parentFlags |= GUIElem_HierarchyDirty;
+		}
+
+		GUIElementBase* currentElem = this;
+		while (currentElem != nullptr)
+		{
+			currentElem->mFlags |= parentFlags;
+			currentElem = currentElem->mParentElement;
+		}
 	}
 
 	void GUIElementBase::_markContentAsDirty()
@@ -392,8 +406,11 @@ namespace BansheeEngine
 	{
 		for(auto& child : mChildren)
 		{
-			child->_updateOptimalLayoutSizes();
+			if (child->_isOptimalSizeDirty())
+				child->_updateOptimalLayoutSizes();
 		}
+
+		mFlags &= ~GUIElem_OptimalSizeDirty;
 	}
 
 	void GUIElementBase::_updateLayoutInternal(const GUILayoutData& data)
@@ -450,6 +467,7 @@ namespace BansheeEngine
 
 		element->_setParent(this);
 		mChildren.push_back(element);
+		markChildOptimalSizesDirty();
 
 		element->_setActive(_isActive());
 		element->_setVisible(_isVisible());
@@ -469,6 +487,7 @@ namespace BansheeEngine
 			{
 				mChildren.erase(iter);
 				element->_setParent(nullptr);
+				markChildOptimalSizesDirty();
 				foundElem = true;
 
 				_markLayoutAsDirty();
@@ -579,6 +598,33 @@ namespace BansheeEngine
 		}
 	}
 
+	void GUIElementBase::updateChildLayout(GUIElementBase* child, const GUILayoutData& data)
+	{
+		const GUILayoutData& oldData = child->_getLayoutData();
+
+		// Lowest depth bits are controlled by the GUI elements themselves, so they're ignored
+		bool dataChanged = data.area != oldData.area || data.clipRect != oldData.clipRect ||
+			(data.depth & 0xFFFFFF00) != (oldData.depth & 0xFFFFFF00) || data.depthRangeMin != oldData.depthRangeMin ||
+			data.depthRangeMax != oldData.depthRangeMax;
+
+		if (!dataChanged && !child->_isHierarchyDirty())
+			return;
+
+		// Ensures the parent widget processes the child after the layout update
+		child->mFlags |= GUIElem_HierarchyDirty;
+
+		child->_setLayoutData(data);
+		child->_updateLayoutInternal(data);
+	}
+
+	void GUIElementBase::markChildOptimalSizesDirty()
+	{
+		// Parents store cached size ranges of their children by index, so they all need to be refreshed when the
+		// child list changes
+		for (auto& child : mChildren)
+			child->mFlags |= GUIElem_OptimalSizeDirty;
+	}
+
 	void GUIElementBase::setAnchorParent(GUIPanel* anchorParent)
 	{
 		mAnchorParent = anchorParent;
@@ -46,9 +46,6 @@ namespace BansheeEngine
 
 	void GUILayoutY::_updateOptimalLayoutSizes()
 	{
-		// Update all children first, otherwise we can't determine our own optimal size
-		GUIElementBase::_updateOptimalLayoutSizes();
-
 		if(mChildren.size() != mChildSizeRanges.size())
 			mChildSizeRanges.resize(mChildren.size());
 
@@ -62,11 +59,18 @@ namespace BansheeEngine
 
 			if (child->_isActive())
 			{
-				childSizeRange = child->_getLayoutSizeRange();
-				if (child->_getType() == GUIElementBase::Type::FixedSpace)
+				// Children whose size didn't change since the last update keep their cached size range. Children must be
+				// updated first, otherwise we can't determine our own optimal size.
+				if (child->_isOptimalSizeDirty())
 				{
-					childSizeRange.optimal.x = 0;
-					childSizeRange.min.x = 0;
+					child->_updateOptimalLayoutSizes();
+
+					childSizeRange = child->_getLayoutSizeRange();
+					if (child->_getType() == GUIElementBase::Type::FixedSpace)
+					{
+						childSizeRange.optimal.x = 0;
+						childSizeRange.min.x = 0;
+					}
 				}
 
 				UINT32 paddingX = child->_getPadding().left + child->_getPadding().right;
@@ -87,6 +91,8 @@ namespace BansheeEngine
 		mSizeRange = _getDimensions().calculateSizeRange(optimalSize);
 		mSizeRange.min.x = std::max(mSizeRange.min.x, minSize.x);
 		mSizeRange.min.y = std::max(mSizeRange.min.y, minSize.y);
+
+		mFlags &= ~GUIElem_OptimalSizeDirty;
 	}
 
 	void GUILayoutY::_getElementAreas(const Rect2I& layoutArea, Rect2I* elementAreas, UINT32 numElements,
@@ -414,8 +420,7 @@ namespace BansheeEngine
 				childData.clipRect = childData.area;
 				childData.clipRect.clip(data.clipRect);
 
-				child->_setLayoutData(childData);
-				child->_updateLayoutInternal(childData);
+				updateChildLayout(child, childData);
 			}
 
 			childIdx++;
@@ -37,6 +37,8 @@
 #include "BsSamplerState.h"
 #include "BsRenderStateManager.h"
 #include "BsBuiltinResources.h"
+#include "BsFontManager.h"
+#include "BsGlyphAtlas.h"
 
 using namespace std::placeholders;
 
@@ -59,6 +61,7 @@ namespace BansheeEngine
 	{
 		SpriteMaterial* material;
 		SpriteMaterialInfo matInfo;
+		UINT64 mergeHash;
 		GUIMeshType meshType;
 		UINT32 numVertices;
 		UINT32 numIndices;
@@ -77,7 +80,8 @@ namespace BansheeEngine
 		: mCoreDirty(false), mActiveMouseButton(GUIMouseButton::Left), mShowTooltip(false), mTooltipElementHoverStart(0.0f)
 		, mInputCaret(nullptr), mInputSelection(nullptr), mSeparateMeshesByWidget(true), mDragState(DragState::NoDrag)
 		, mCaretColor(1.0f, 0.6588f, 0.0f), mCaretBlinkInterval(0.5f), mCaretLastBlinkTime(0.0f), mIsCaretOn(false)
-		, mActiveCursor(CursorType::Arrow), mTextSelectionColor(0.0f, 114/255.0f, 188/255.0f)
+		, mActiveCursor(CursorType::Arrow), mTextSelectionColor(0.0f, 114/255.0f, 188/255.0f), mGlyphsEvicted(false)
+		, mNumUpdatedLayoutElements(0)
 	{
 		// Note: Hidden dependency. GUI must receive input events before other systems, in order so it can mark them as used
 		// if required. e.g. clicking on a context menu should mark the event as used so that other non-GUI systems know
@@ -94,6 +98,9 @@ namespace BansheeEngine
 		mWindowLostFocusConn = RenderWindowManager::instance().onFocusLost.connect(std::bind(&GUIManager::onWindowFocusLost, this, _1));
 		mMouseLeftWindowConn = RenderWindowManager::instance().onMouseLeftWindow.connect(std::bind(&GUIManager::onMouseLeftWindow, this, _1));
 
+		mGlyphPageEvictedConn = FontManager::instance().getGlyphAtlas().onPageEvicted.connect(
+			[this](UINT32 page) { mGlyphsEvicted = true; });
+
 		mInputCaret = bs_new<GUIInputCaret>();
 		mInputSelection = bs_new<GUIInputSelection>();
 
@@ -154,6 +161,7 @@ namespace BansheeEngine
 		mWindowLostFocusConn.disconnect();
 
 		mMouseLeftWindowConn.disconnect();
+		mGlyphPageEvictedConn.disconnect();
 
 		bs_delete(mInputCaret);
 		bs_delete(mInputSelection);
@@ -274,11 +282,25 @@ namespace BansheeEngine
 			}
 		}
 
+		// Text using characters from evicted glyph atlas pages needs to be laid out again
+		if (mGlyphsEvicted)
+		{
+			for (auto& widgetInfo : mWidgets)
+			{
+				for (auto& element : widgetInfo.widget->getElements())
+					element->_markContentAsDirty();
+			}
+
+			mGlyphsEvicted = false;
+		}
+
 		// Update layouts
 		gProfilerCPU().beginSample("UpdateLayout");
+		mNumUpdatedLayoutElements = 0;
 		for(auto& widgetInfo : mWidgets)
 		{
 			widgetInfo.widget->_updateLayout();
+			mNumUpdatedLayoutElements += widgetInfo.widget->_getNumUpdatedLayoutElements();
 		}
 		gProfilerCPU().endSample("UpdateLayout");
 
@@ -435,16 +457,28 @@ namespace BansheeEngine
 		{
 			GUIRenderData& renderData = cachedMeshData.second;
 
-			// Check if anything is dirty. If nothing is we can skip the update
+			// Check if anything is dirty. If nothing is we can skip the update. If only contents of some elements changed
+			// we can try updating just their parts of the existing meshes, otherwise all elements need to be regrouped.
 			bool isDirty = renderData.isDirty;
+			bool requiresRegroup = renderData.isDirty;
 			renderData.isDirty = false;
 
+			mDirtyElements.clear();
 			for(auto& widget : renderData.widgets)
 			{
-				if (widget->isDirty(true))
+				if (!widget->isDirty(false))
+					continue;
+
+				isDirty = true;
+				if (widget->_isMeshDirty())
+					requiresRegroup = true;
+				else if (!requiresRegroup)
 				{
-					isDirty = true;
+					const Set<GUIElement*>& dirtyContents = widget->_getDirtyContents();
+					mDirtyElements.insert(mDirtyElements.end(), dirtyContents.begin(), dirtyContents.end());
 				}
+
+				widget->isDirty(true);
 			}
 
 			if(!isDirty)
@@ -452,251 +486,436 @@ namespace BansheeEngine
 
 			mCoreDirty = true;
 
-			bs_frame_mark();
+			if (requiresRegroup || !updateDirtyMeshes(renderData, mDirtyElements))
+				rebuildMeshes(renderData);
+		}
+
+		mDirtyElements.clear();
+	}
+
+	void GUIManager::rebuildMeshes(GUIRenderData& renderData)
+	{
+		bs_frame_mark();
+		{
+			// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
+			auto elemComp = [](const GUIGroupElement& a, const GUIGroupElement& b)
 			{
-				// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
-				auto elemComp = [](const GUIGroupElement& a, const GUIGroupElement& b)
-				{
-					UINT32 aDepth = a.element->_getRenderElementDepth(a.renderElement);
-					UINT32 bDepth = b.element->_getRenderElementDepth(b.renderElement);
+				UINT32 aDepth = a.element->_getRenderElementDepth(a.renderElement);
+				UINT32 bDepth = b.element->_getRenderElementDepth(b.renderElement);
 
-					// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
-					// requires all elements to be unique
-					return (aDepth > bDepth) || 
-						(aDepth == bDepth && a.element > b.element) || 
-						(aDepth == bDepth && a.element == b.element && a.renderElement > b.renderElement); 
-				};
+				// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
+				// requires all elements to be unique
+				return (aDepth > bDepth) || 
+					(aDepth == bDepth && a.element > b.element) || 
+					(aDepth == bDepth && a.element == b.element && a.renderElement > b.renderElement); 
+			};
 
-				FrameSet<GUIGroupElement, std::function<bool(const GUIGroupElement&, const GUIGroupElement&)>> allElements(elemComp);
+			FrameSet<GUIGroupElement, std::function<bool(const GUIGroupElement&, const GUIGroupElement&)>> allElements(elemComp);
 
-				for (auto& widget : renderData.widgets)
+			for (auto& widget : renderData.widgets)
+			{
+				const Vector<GUIElement*>& elements = widget->getElements();
+
+				for (auto& element : elements)
 				{
-					const Vector<GUIElement*>& elements = widget->getElements();
+					if (!element->_isVisible())
+						continue;
 
-					for (auto& element : elements)
+					UINT32 numRenderElems = element->_getNumRenderElements();
+					for (UINT32 i = 0; i < numRenderElems; i++)
 					{
-						if (!element->_isVisible())
-							continue;
-
-						UINT32 numRenderElems = element->_getNumRenderElements();
-						for (UINT32 i = 0; i < numRenderElems; i++)
-						{
-							allElements.insert(GUIGroupElement(element, i));
-						}
+						allElements.insert(GUIGroupElement(element, i));
 					}
 				}
+			}
 
-				// Group the elements in such a way so that we end up with a smallest amount of
-				// meshes, without breaking back to front rendering order
-				FrameUnorderedMap<UINT64, FrameVector<GUIMaterialGroup>> materialGroups;
-				for (auto& elem : allElements)
-				{
-					GUIElement* guiElem = elem.element;
-					UINT32 renderElemIdx = elem.renderElement;
-					UINT32 elemDepth = guiElem->_getRenderElementDepth(renderElemIdx);
+			// Group the elements in such a way so that we end up with a smallest amount of
+			// meshes, without breaking back to front rendering order
+			FrameUnorderedMap<UINT64, FrameVector<GUIMaterialGroup>> materialGroups;
+			for (auto& elem : allElements)
+			{
+				GUIElement* guiElem = elem.element;
+				UINT32 renderElemIdx = elem.renderElement;
+				UINT32 elemDepth = guiElem->_getRenderElementDepth(renderElemIdx);
 
-					Rect2I tfrmedBounds = guiElem->_getClippedBounds();
-					tfrmedBounds.transform(guiElem->_getParentWidget()->getWorldTfrm());
+				Rect2I tfrmedBounds = guiElem->_getClippedBounds();
+				tfrmedBounds.transform(guiElem->_getParentWidget()->getWorldTfrm());
 
-					SpriteMaterial* spriteMaterial = nullptr;
-					const SpriteMaterialInfo& matInfo = guiElem->_getMaterial(renderElemIdx, &spriteMaterial);
-					assert(spriteMaterial != nullptr);
+				SpriteMaterial* spriteMaterial = nullptr;
+				const SpriteMaterialInfo& matInfo = guiElem->_getMaterial(renderElemIdx, &spriteMaterial);
+				assert(spriteMaterial != nullptr);
 
-					UINT64 hash = spriteMaterial->getMergeHash(matInfo);
-					FrameVector<GUIMaterialGroup>& groupsPerMaterial = materialGroups[hash];
-					
-					// Try to find a group this material will fit in:
-					//  - Group that has a depth value same or one below elements depth will always be a match
-					//  - Otherwise, we search higher depth values as well, but we only use them if no elements in between those depth values
-					//    overlap the current elements bounds.
-					GUIMaterialGroup* foundGroup = nullptr;
+				UINT64 hash = spriteMaterial->getMergeHash(matInfo);
+				FrameVector<GUIMaterialGroup>& groupsPerMaterial = materialGroups[hash];
+				
+				// Try to find a group this material will fit in:
+				//  - Group that has a depth value same or one below elements depth will always be a match
+				//  - Otherwise, we search higher depth values as well, but we only use them if no elements in between those depth values
+				//    overlap the current elements bounds.
+				GUIMaterialGroup* foundGroup = nullptr;
 
-					for (auto groupIter = groupsPerMaterial.rbegin(); groupIter != groupsPerMaterial.rend(); ++groupIter)
+				for (auto groupIter = groupsPerMaterial.rbegin(); groupIter != groupsPerMaterial.rend(); ++groupIter)
+				{
+					// If we separate meshes by widget, ignore any groups with widget parents other than mine
+					if (mSeparateMeshesByWidget)
 					{
-						// If we separate meshes by widget, ignore any groups with widget parents other than mine
-						if (mSeparateMeshesByWidget)
+						if (groupIter->elements.size() > 0)
 						{
-							if (groupIter->elements.size() > 0)
-							{
-								GUIElement* otherElem = groupIter->elements.begin()->element; // We only need to check the first element
-								if (otherElem->_getParentWidget() != guiElem->_getParentWidget())
-									continue;
-							}
+							GUIElement* otherElem = groupIter->elements.begin()->element; // We only need to check the first element
+							if (otherElem->_getParentWidget() != guiElem->_getParentWidget())
+								continue;
 						}
+					}
 
-						GUIMaterialGroup& group = *groupIter;
+					GUIMaterialGroup& group = *groupIter;
 
-						if (group.depth == elemDepth)
-						{
-							foundGroup = &group;
-							break;
-						}
-						else
-						{
-							UINT32 startDepth = elemDepth;
-							UINT32 endDepth = group.depth;
+					if (group.depth == elemDepth)
+					{
+						foundGroup = &group;
+						break;
+					}
+					else
+					{
+						UINT32 startDepth = elemDepth;
+						UINT32 endDepth = group.depth;
 
-							Rect2I potentialGroupBounds = group.bounds;
-							potentialGroupBounds.encapsulate(tfrmedBounds);
+						Rect2I potentialGroupBounds = group.bounds;
+						potentialGroupBounds.encapsulate(tfrmedBounds);
 
-							bool foundOverlap = false;
-							for (auto& material : materialGroups)
+						bool foundOverlap = false;
+						for (auto& material : materialGroups)
+						{
+							for (auto& matGroup : material.second)
 							{
-								for (auto& matGroup : material.second)
-								{
-									if (&matGroup == &group)
-										continue;
+								if (&matGroup == &group)
+									continue;
 
-									if ((matGroup.minDepth >= startDepth && matGroup.minDepth <= endDepth)
-										|| (matGroup.depth >= startDepth && matGroup.depth <= endDepth))
+								if ((matGroup.minDepth >= startDepth && matGroup.minDepth <= endDepth)
+									|| (matGroup.depth >= startDepth && matGroup.depth <= endDepth))
+								{
+									if (matGroup.bounds.overlaps(potentialGroupBounds))
 									{
-										if (matGroup.bounds.overlaps(potentialGroupBounds))
-										{
-											foundOverlap = true;
-											break;
-										}
+										foundOverlap = true;
+										break;
 									}
 								}
 							}
+						}
 
-							if (!foundOverlap)
-							{
-								foundGroup = &group;
-								break;
-							}
+						if (!foundOverlap)
+						{
+							foundGroup = &group;
+							break;
 						}
 					}
+				}
 
-					if (foundGroup == nullptr)
-					{
-						groupsPerMaterial.push_back(GUIMaterialGroup());
-						foundGroup = &groupsPerMaterial[groupsPerMaterial.size() - 1];
+				if (foundGroup == nullptr)
+				{
+					groupsPerMaterial.push_back(GUIMaterialGroup());
+					foundGroup = &groupsPerMaterial[groupsPerMaterial.size() - 1];
+
+					foundGroup->depth = elemDepth;
+					foundGroup->minDepth = elemDepth;
+					foundGroup->bounds = tfrmedBounds;
+					foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx));
+					foundGroup->matInfo = matInfo.clone();
+					foundGroup->material = spriteMaterial;
+					foundGroup->mergeHash = hash;
+
+					guiElem->_getMeshInfo(renderElemIdx, foundGroup->numVertices, foundGroup->numIndices, foundGroup->meshType);
+				}
+				else
+				{
+					foundGroup->bounds.encapsulate(tfrmedBounds);
+					foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx));
+					foundGroup->minDepth = std::min(foundGroup->minDepth, elemDepth);
+					
+					UINT32 numVertices;
+					UINT32 numIndices;
+					GUIMeshType meshType;
+					guiElem->_getMeshInfo(renderElemIdx, numVertices, numIndices, meshType);
+					assert(meshType == foundGroup->meshType); // It's expected that GUI element doesn't use same material for different mesh types so this should always be true
 
-						foundGroup->depth = elemDepth;
-						foundGroup->minDepth = elemDepth;
-						foundGroup->bounds = tfrmedBounds;
-						foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx));
-						foundGroup->matInfo = matInfo.clone();
-						foundGroup->material = spriteMaterial;
+					foundGroup->numVertices += numVertices;
+					foundGroup->numIndices += numIndices;
 
-						guiElem->_getMeshInfo(renderElemIdx, foundGroup->numVertices, foundGroup->numIndices, foundGroup->meshType);
-					}
-					else
-					{
-						foundGroup->bounds.encapsulate(tfrmedBounds);
-						foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx));
-						foundGroup->minDepth = std::min(foundGroup->minDepth, elemDepth);
-						
-						UINT32 numVertices;
-						UINT32 numIndices;
-						GUIMeshType meshType;
-						guiElem->_getMeshInfo(renderElemIdx, numVertices, numIndices, meshType);
-						assert(meshType == foundGroup->meshType); // It's expected that GUI element doesn't use same material for different mesh types so this should always be true
-
-						foundGroup->numVertices += numVertices;
-						foundGroup->numIndices += numIndices;
-
-						spriteMaterial->merge(foundGroup->matInfo, matInfo);
-					}
+					spriteMaterial->merge(foundGroup->matInfo, matInfo);
 				}
+			}
 
-				// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
-				auto groupComp = [](GUIMaterialGroup* a, GUIMaterialGroup* b)
+			// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
+			auto groupComp = [](GUIMaterialGroup* a, GUIMaterialGroup* b)
+			{
+				return (a->depth > b->depth) || (a->depth == b->depth && a > b);
+				// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
+				// requires all elements to be unique
+			};
+
+			UINT32 numMeshes = 0;
+			FrameSet<GUIMaterialGroup*, std::function<bool(GUIMaterialGroup*, GUIMaterialGroup*)>> sortedGroups(groupComp);
+			for(auto& material : materialGroups)
+			{
+				for(auto& group : material.second)
 				{
-					return (a->depth > b->depth) || (a->depth == b->depth && a > b);
-					// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
-					// requires all elements to be unique
-				};
-
-				UINT32 numMeshes = 0;
-				FrameSet<GUIMaterialGroup*, std::function<bool(GUIMaterialGroup*, GUIMaterialGroup*)>> sortedGroups(groupComp);
-				for(auto& material : materialGroups)
+					sortedGroups.insert(&group);
+					numMeshes++;
+				}
+			}
+
+			UINT32 oldNumMeshes = (UINT32)renderData.cachedMeshes.size();
+			for (UINT32 i = 0; i < oldNumMeshes; i++)
+			{
+				if(!renderData.cachedMeshes[i].isLine)
+					mTriangleMeshHeap->dealloc(renderData.cachedMeshes[i].mesh);
+				else
+					mLineMeshHeap->dealloc(renderData.cachedMeshes[i].mesh);
+			}
+
+			renderData.cachedMeshes.resize(numMeshes);
+			renderData.elementLookup.clear();
+
+			// Fill buffers for each group and update their meshes
+			UINT32 meshIdx = 0;
+			for(auto& group : sortedGroups)
+			{
+				GUIWidget* widget;
+
+				if (group->elements.size() == 0)
+					widget = nullptr;
+				else
 				{
-					for(auto& group : material.second)
-					{
-						sortedGroups.insert(&group);
-						numMeshes++;
-					}
+					GUIElement* elem = group->elements.begin()->element;
+					widget = elem->_getParentWidget();
 				}
 
-				UINT32 oldNumMeshes = (UINT32)renderData.cachedMeshes.size();
-				for (UINT32 i = 0; i < oldNumMeshes; i++)
+				GUIMeshData& guiMeshData = renderData.cachedMeshes[meshIdx];
+				guiMeshData.matInfo = group->matInfo;
+				guiMeshData.material = group->material;
+				guiMeshData.widget = widget;
+				guiMeshData.isLine = group->meshType == GUIMeshType::Line;
+				guiMeshData.mergeHash = group->mergeHash;
+				guiMeshData.bounds = group->bounds;
+				guiMeshData.elements.clear();
+
+				for(auto& matElement : group->elements)
 				{
-					if(!renderData.cachedMeshes[i].isLine)
-						mTriangleMeshHeap->dealloc(renderData.cachedMeshes[i].mesh);
-					else
-						mLineMeshHeap->dealloc(renderData.cachedMeshes[i].mesh);
+					GUIMeshElement meshElement;
+					meshElement.element = matElement.element;
+					meshElement.renderElement = matElement.renderElement;
+					meshElement.depth = matElement.element->_getRenderElementDepth(matElement.renderElement);
+					meshElement.vertexOffset = 0;
+					meshElement.indexOffset = 0;
+
+					GUIMeshType meshType;
+					matElement.element->_getMeshInfo(matElement.renderElement, meshElement.numVertices, 
+						meshElement.numIndices, meshType);
+
+					Vector<GUIMeshElementRef>& elementRefs = renderData.elementLookup[matElement.element];
+					if (elementRefs.size() <= matElement.renderElement)
+						elementRefs.resize(matElement.renderElement + 1);
+
+					elementRefs[matElement.renderElement].meshIdx = meshIdx;
+					elementRefs[matElement.renderElement].elementIdx = (UINT32)guiMeshData.elements.size();
+
+					guiMeshData.elements.push_back(meshElement);
 				}
 
-				renderData.cachedMeshes.resize(numMeshes);
-				
-				// Fill buffers for each group and update their meshes
-				UINT32 meshIdx = 0;
-				for(auto& group : sortedGroups)
+				buildMeshData(guiMeshData);
+
+				if (!guiMeshData.isLine)
+					guiMeshData.mesh = mTriangleMeshHeap->alloc(guiMeshData.meshData);
+				else
+					guiMeshData.mesh = mLineMeshHeap->alloc(guiMeshData.meshData, DOT_LINE_LIST);
+
+				meshIdx++;
+			}
+		}
+
+		bs_frame_clear();
+	}
+
+	bool GUIManager::updateDirtyMeshes(GUIRenderData& renderData, const Vector<GUIElement*>& dirtyElements)
+	{
+		// Make sure none of the elements changed in a way that affects grouping, before modifying anything
+		for (auto& element : dirtyElements)
+		{
+			auto iterFind = renderData.elementLookup.find(element);
+			if (iterFind == renderData.elementLookup.end())
+			{
+				// Hidden elements aren't part of any mesh, and showing them always requires a regroup
+				if (!element->_isVisible())
+					continue;
+
+				return false;
+			}
+
+			if (!element->_isVisible())
+				return false;
+
+			const Vector<GUIMeshElementRef>& elementRefs = iterFind->second;
+			UINT32 numRenderElems = element->_getNumRenderElements();
+			if (numRenderElems != (UINT32)elementRefs.size())
+				return false;
+
+			Rect2I tfrmedBounds = element->_getClippedBounds();
+			tfrmedBounds.transform(element->_getParentWidget()->getWorldTfrm());
+
+			for (UINT32 i = 0; i < numRenderElems; i++)
+			{
+				const GUIMeshData& guiMeshData = renderData.cachedMeshes[elementRefs[i].meshIdx];
+				const GUIMeshElement& meshElement = guiMeshData.elements[elementRefs[i].elementIdx];
+
+				if (element->_getRenderElementDepth(i) != meshElement.depth)
+					return false;
+
+				SpriteMaterial* spriteMaterial = nullptr;
+				const SpriteMaterialInfo& matInfo = element->_getMaterial(i, &spriteMaterial);
+
+				// Material info with the same merge hash is interchangeable, so the mesh's merged info remains valid
+				if (spriteMaterial != guiMeshData.material || spriteMaterial->getMergeHash(matInfo) != guiMeshData.mergeHash)
+					return false;
+
+				UINT32 numVertices;
+				UINT32 numIndices;
+				GUIMeshType meshType;
+				element->_getMeshInfo(i, numVertices, numIndices, meshType);
+
+				if ((meshType == GUIMeshType::Line) != guiMeshData.isLine)
+					return false;
+
+				// Moving outside of the mesh's bounds could make the element overlap elements of other meshes
+				Rect2I potentialBounds = guiMeshData.bounds;
+				potentialBounds.encapsulate(tfrmedBounds);
+
+				if (!(potentialBounds == guiMeshData.bounds))
+					return false;
+			}
+		}
+
+		bs_frame_mark();
+		{
+			UINT32 numMeshes = (UINT32)renderData.cachedMeshes.size();
+			FrameVector<bool> isMeshDirty(numMeshes, false);
+			FrameVector<bool> requiresFullRebuild(numMeshes, false);
+			FrameVector<GUIMeshElementRef> dirtyRanges;
+
+			for (auto& element : dirtyElements)
+			{
+				auto iterFind = renderData.elementLookup.find(element);
+				if (iterFind == renderData.elementLookup.end())
+					continue;
+
+				for (auto& elementRef : iterFind->second)
 				{
-					SPtr<MeshData> meshData;
-					GUIWidget* widget;
+					GUIMeshElement& meshElement = renderData.cachedMeshes[elementRef.meshIdx].elements[elementRef.elementIdx];
 
-					if (group->elements.size() == 0)
-						widget = nullptr;
-					else
+					UINT32 numVertices;
+					UINT32 numIndices;
+					GUIMeshType meshType;
+					element->_getMeshInfo(meshElement.renderElement, numVertices, numIndices, meshType);
+
+					if (numVertices != meshElement.numVertices || numIndices != meshElement.numIndices)
 					{
-						GUIElement* elem = group->elements.begin()->element;
-						widget = elem->_getParentWidget();
+						meshElement.numVertices = numVertices;
+						meshElement.numIndices = numIndices;
+
+						requiresFullRebuild[elementRef.meshIdx] = true;
 					}
+					else
+						dirtyRanges.push_back(elementRef);
 
-					GUIMeshData& guiMeshData = renderData.cachedMeshes[meshIdx];
-					guiMeshData.matInfo = group->matInfo;
-					guiMeshData.material = group->material;
-					guiMeshData.widget = widget;
+					isMeshDirty[elementRef.meshIdx] = true;
+				}
+			}
 
-					if (group->meshType == GUIMeshType::Triangle)
-					{
-						meshData = bs_shared_ptr_new<MeshData>(group->numVertices, group->numIndices, mTriangleVertexDesc);
-						guiMeshData.isLine = false;
-					}
-					else // Line
-					{
-						meshData = bs_shared_ptr_new<MeshData>(group->numVertices, group->numIndices, mLineVertexDesc);
-						guiMeshData.isLine = true;
-					}
+			// Mesh data is shared with the core thread, so it cannot be modified in place. Instead copy the meshes whose
+			// layout didn't change and re-fill only the dirty ranges.
+			for (UINT32 i = 0; i < numMeshes; i++)
+			{
+				if (!isMeshDirty[i] || requiresFullRebuild[i])
+					continue;
 
-					UINT8* vertices = meshData->getElementData(VES_POSITION);
-					UINT32* indices = meshData->getIndices32();
+				GUIMeshData& guiMeshData = renderData.cachedMeshes[i];
+				const SPtr<MeshData>& oldMeshData = guiMeshData.meshData;
 
-					UINT32 indexOffset = 0;
-					UINT32 vertexOffset = 0;
-					for(auto& matElement : group->elements)
-					{
-						matElement.element->_fillBuffer(vertices, indices, vertexOffset, indexOffset, group->numVertices,
-							group->numIndices, matElement.renderElement);
+				SPtr<MeshData> meshData = bs_shared_ptr_new<MeshData>(oldMeshData->getNumVertices(), 
+					oldMeshData->getNumIndices(), oldMeshData->getVertexDesc());
+				memcpy(meshData->getData(), oldMeshData->getData(), oldMeshData->getSize());
 
-						UINT32 numVertices;
-						UINT32 numIndices;
-						GUIMeshType meshType;
-						matElement.element->_getMeshInfo(matElement.renderElement, numVertices, numIndices, meshType);
+				guiMeshData.meshData = meshData;
+			}
 
-						UINT32 indexStart = indexOffset;
-						UINT32 indexEnd = indexStart + numIndices;
+			for (auto& elementRef : dirtyRanges)
+			{
+				if (requiresFullRebuild[elementRef.meshIdx])
+					continue;
 
-						for(UINT32 i = indexStart; i < indexEnd; i++)
-							indices[i] += vertexOffset;
+				GUIMeshData& guiMeshData = renderData.cachedMeshes[elementRef.meshIdx];
+				fillMeshElement(guiMeshData.elements[elementRef.elementIdx], *guiMeshData.meshData);
+			}
 
-						indexOffset += numIndices;
-						vertexOffset += numVertices;
-					}
+			for (UINT32 i = 0; i < numMeshes; i++)
+			{
+				if (!isMeshDirty[i])
+					continue;
 
-					if (group->meshType == GUIMeshType::Triangle)
-						guiMeshData.mesh = mTriangleMeshHeap->alloc(meshData);
-					else // Line
-						guiMeshData.mesh = mLineMeshHeap->alloc(meshData, DOT_LINE_LIST);
+				GUIMeshData& guiMeshData = renderData.cachedMeshes[i];
+				if (requiresFullRebuild[i])
+					buildMeshData(guiMeshData);
 
-					meshIdx++;
+				if (!guiMeshData.isLine)
+				{
+					mTriangleMeshHeap->dealloc(guiMeshData.mesh);
+					guiMeshData.mesh = mTriangleMeshHeap->alloc(guiMeshData.meshData);
+				}
+				else
+				{
+					mLineMeshHeap->dealloc(guiMeshData.mesh);
+					guiMeshData.mesh = mLineMeshHeap->alloc(guiMeshData.meshData, DOT_LINE_LIST);
 				}
 			}
+		}
+
+		bs_frame_clear();
+		return true;
+	}
+
+	void GUIManager::buildMeshData(GUIMeshData& guiMeshData)
+	{
+		UINT32 numVertices = 0;
+		UINT32 numIndices = 0;
+		for (auto& meshElement : guiMeshData.elements)
+		{
+			meshElement.vertexOffset = numVertices;
+			meshElement.indexOffset = numIndices;
 
-			bs_frame_clear();			
+			numVertices += meshElement.numVertices;
+			numIndices += meshElement.numIndices;
 		}
+
+		if (!guiMeshData.isLine)
+			guiMeshData.meshData = bs_shared_ptr_new<MeshData>(numVertices, numIndices, mTriangleVertexDesc);
+		else
+			guiMeshData.meshData = bs_shared_ptr_new<MeshData>(numVertices, numIndices, mLineVertexDesc);
+
+		for (auto& meshElement : guiMeshData.elements)
+			fillMeshElement(meshElement, *guiMeshData.meshData);
+	}
+
+	void GUIManager::fillMeshElement(const GUIMeshElement& meshElement, MeshData& meshData)
+	{
+		UINT8* vertices = meshData.getElementData(VES_POSITION);
+		UINT32* indices = meshData.getIndices32();
+
+		meshElement.element->_fillBuffer(vertices, indices, meshElement.vertexOffset, meshElement.indexOffset, 
+			meshData.getNumVertices(), meshData.getNumIndices(), meshElement.renderElement);
+
+		UINT32 indexStart = meshElement.indexOffset;
+		UINT32 indexEnd = indexStart + meshElement.numIndices;
+
+		for(UINT32 i = indexStart; i < indexEnd; i++)
+			indices[i] += meshElement.vertexOffset;
 	}
 
 	void GUIManager::updateCaretTexture()
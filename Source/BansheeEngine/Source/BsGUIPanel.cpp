@@ -82,9 +82,6 @@ namespace BansheeEngine
 
 	void GUIPanel::_updateOptimalLayoutSizes()
 	{
-		// Update all children first, otherwise we can't determine our own optimal size
-		GUIElementBase::_updateOptimalLayoutSizes();
-
 		if (mChildren.size() != mChildSizeRanges.size())
 			mChildSizeRanges.resize(mChildren.size());
 
@@ -98,7 +95,13 @@ namespace BansheeEngine
 
 			if (child->_isActive())
 			{
-				childSizeRange = _getElementSizeRange(child);
+				// Children whose size didn't change since the last update keep their cached size range. Children must be
+				// updated first, otherwise we can't determine our own optimal size.
+				if (child->_isOptimalSizeDirty())
+				{
+					child->_updateOptimalLayoutSizes();
+					childSizeRange = _getElementSizeRange(child);
+				}
 
 				UINT32 paddingX = child->_getPadding().left + child->_getPadding().right;
 				UINT32 paddingY = child->_getPadding().top + child->_getPadding().bottom;
@@ -125,6 +128,8 @@ namespace BansheeEngine
 		mSizeRange = _getDimensions().calculateSizeRange(optimalSize);
 		mSizeRange.min.x = std::max(mSizeRange.min.x, minSize.x);
 		mSizeRange.min.y = std::max(mSizeRange.min.y, minSize.y);
+
+		mFlags &= ~GUIElem_OptimalSizeDirty;
 	}
 
 	void GUIPanel::_getElementAreas(const Rect2I& layoutArea, Rect2I* elementAreas, UINT32 numElements,
@@ -258,8 +263,7 @@ namespace BansheeEngine
 		childData.clipRect = data.area;
 		childData.clipRect.clip(data.clipRect);
 
-		element->_setLayoutData(childData);
-		element->_updateLayoutInternal(childData);
+		updateChildLayout(element, childData);
 	}
 
 	GUIPanel* GUIPanel::create(INT16 depth, UINT16 depthRangeMin, UINT16 depthRangeMax)
@@ -47,7 +47,7 @@ namespace BansheeEngine
 
 	void GUIProgressBar::_updateLayoutInternal(const GUILayoutData& data)
 	{
-		mBackground->_setLayoutData(data);
+		updateChildLayout(mBackground, data);
 
 		const GUIElementStyle* style = _getStyle();
 		
@@ -62,7 +62,7 @@ namespace BansheeEngine
 		barLayoutData.area.width = (UINT32)Math::floorToInt(maxProgressBarWidth * mPercent);
 		barLayoutData.area.height = progressBarHeight;
 
-		mBar->_setLayoutData(barLayoutData);
+		updateChildLayout(mBar, barLayoutData);
 	}
 
 	void GUIProgressBar::styleUpdated()
@@ -304,8 +304,7 @@ namespace BansheeEngine
 			layoutData.area = layoutBounds;
 			layoutData.clipRect = layoutClipRect;
 
-			mContentLayout->_setLayoutData(layoutData);
-			mContentLayout->_updateLayoutInternal(layoutData);
+			updateChildLayout(mContentLayout, layoutData);
 		}
 
 		// Vertical scrollbar
@@ -316,8 +315,7 @@ namespace BansheeEngine
 			vertScrollData.clipRect = vertScrollBounds;
 			vertScrollData.clipRect.clip(data.clipRect);
 
-			mVertScroll->_setLayoutData(vertScrollData);
-			mVertScroll->_updateLayoutInternal(vertScrollData);
+			updateChildLayout(mVertScroll, vertScrollData);
 
 			// Set new handle size and update position to match the new size
 			UINT32 scrollableHeight = (UINT32)std::max(0, INT32(mContentSize.y) - INT32(vertScrollBounds.height));
@@ -338,8 +336,7 @@ namespace BansheeEngine
 			horzScrollData.clipRect = horzScrollBounds;
 			horzScrollData.clipRect.clip(data.clipRect);
 
-			mHorzScroll->_setLayoutData(horzScrollData);
-			mHorzScroll->_updateLayoutInternal(horzScrollData);
+			updateChildLayout(mHorzScroll, horzScrollData);
 
 			// Set new handle size and update position to match the new size
 			UINT32 scrollableWidth = (UINT32)std::max(0, INT32(mContentSize.x) - INT32(horzScrollBounds.width));
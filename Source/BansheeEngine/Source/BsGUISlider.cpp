@@ -76,7 +76,7 @@ namespace BansheeEngine
 			childData.clipRect = data.area;
 			childData.clipRect.clip(data.clipRect);
 
-			mBackground->_setLayoutData(childData);
+			updateChildLayout(mBackground, childData);
 
 			optimalSize = mSliderHandle->_getOptimalSize();
 			childData.area.height = optimalSize.y;
@@ -85,7 +85,7 @@ namespace BansheeEngine
 			childData.clipRect = data.area;
 			childData.clipRect.clip(data.clipRect);
 
-			mSliderHandle->_setLayoutData(childData);
+			updateChildLayout(mSliderHandle, childData);
 			UINT32 handleWidth = optimalSize.x;
 
 			optimalSize = mFillBackground->_getOptimalSize();
@@ -96,7 +96,7 @@ namespace BansheeEngine
 			childData.clipRect = data.area;
 			childData.clipRect.clip(data.clipRect);
 
-			mFillBackground->_setLayoutData(childData);
+			updateChildLayout(mFillBackground, childData);
 		}
 		else
 		{
@@ -107,7 +107,7 @@ namespace BansheeEngine
 			childData.clipRect = data.area;
 			childData.clipRect.clip(data.clipRect);
 
-			mBackground->_setLayoutData(childData);
+			updateChildLayout(mBackground, childData);
 
 			optimalSize = mSliderHandle->_getOptimalSize();
 			childData.area.width = optimalSize.x;
@@ -116,7 +116,7 @@ namespace BansheeEngine
 			childData.clipRect = data.area;
 			childData.clipRect.clip(data.clipRect);
 
-			mSliderHandle->_setLayoutData(childData);
+			updateChildLayout(mSliderHandle, childData);
 			UINT32 handleHeight = optimalSize.y;
 
 			optimalSize = mFillBackground->_getOptimalSize();
@@ -127,7 +127,7 @@ namespace BansheeEngine
 			childData.clipRect = data.area;
 			childData.clipRect.clip(data.clipRect);
 
-			mFillBackground->_setLayoutData(childData);
+			updateChildLayout(mFillBackground, childData);
 		}
 	}
 
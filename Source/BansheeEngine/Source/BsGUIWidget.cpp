@@ -16,7 +16,7 @@ namespace BansheeEngine
 {
 	GUIWidget::GUIWidget(const SPtr<Camera>& camera)
 		: mCamera(camera), mPanel(nullptr), mDepth(0), mIsActive(true), mPosition(BsZero), mRotation(BsIdentity)
-		, mScale(Vector3::ONE), mTransform(BsIdentity), mCachedRTId(0), mWidgetIsDirty(false)
+		, mScale(Vector3::ONE), mTransform(BsIdentity), mCachedRTId(0), mWidgetIsDirty(false), mNumUpdatedLayoutElements(0)
 	{
 		construct(camera);
 	}
@@ -24,6 +24,7 @@ namespace BansheeEngine
 	GUIWidget::GUIWidget(const HCamera& camera)
 		: mCamera(camera->_getCamera()), mPanel(nullptr), mDepth(0), mIsActive(true), mPosition(BsZero)
 		, mRotation(BsIdentity), mScale(Vector3::ONE), mTransform(BsIdentity), mCachedRTId(0), mWidgetIsDirty(false)
+		, mNumUpdatedLayoutElements(0)
 	{
 		construct(mCamera);
 	}
@@ -156,35 +157,67 @@ namespace BansheeEngine
 
 	void GUIWidget::_updateLayout()
 	{
-		bs_frame_mark();
-
-		// Determine dirty contents and layouts
-		FrameStack<GUIElementBase*> todo;
-		todo.push(mPanel);
+		mNumUpdatedLayoutElements = 0;
 
-		while (!todo.empty())
+		bs_frame_mark();
 		{
-			GUIElementBase* currentElem = todo.top();
-			todo.pop();
+			// Determine dirty contents and layouts. Only hierarchies containing modified elements are searched.
+			FrameStack<GUIElementBase*> todo;
+			FrameVector<GUIElementBase*> visited;
+			todo.push(mPanel);
 
-			if (currentElem->_isDirty())
+			while (!todo.empty())
 			{
-				GUIElementBase* updateParent = currentElem->_getUpdateParent();
-				assert(updateParent != nullptr || currentElem == mPanel);
+				GUIElementBase* currentElem = todo.top();
+				todo.pop();
+
+				if (currentElem->_isDirty())
+				{
+					GUIElementBase* updateParent = currentElem->_getUpdateParent();
+					assert(updateParent != nullptr || currentElem == mPanel);
 
-				if (updateParent != nullptr)
-					_updateLayout(updateParent);
-				else // Must be root panel
-					_updateLayout(mPanel);
+					if (updateParent != nullptr)
+						_updateLayout(updateParent);
+					else // Must be root panel
+						_updateLayout(mPanel);
+				}
+				else
+				{
+					visited.push_back(currentElem);
+
+					UINT32 numChildren = currentElem->_getNumChildren();
+					for (UINT32 i = 0; i < numChildren; i++)
+					{
+						GUIElementBase* child = currentElem->_getChild(i);
+						if (child->_isHierarchyDirty())
+							todo.push(child);
+					}
+				}
 			}
-			else
+
+			// Clean up elements that only led to the updated hierarchies. Parents are visited before their children, so
+			// iterating in reverse handles children first. Elements still leading to a dirty element are kept.
+			for (auto iter = visited.rbegin(); iter != visited.rend(); ++iter)
 			{
+				GUIElementBase* currentElem = *iter;
+				if (currentElem->_isDirty())
+					continue;
+
+				bool isChildDirty = false;
 				UINT32 numChildren = currentElem->_getNumChildren();
 				for (UINT32 i = 0; i < numChildren; i++)
-					todo.push(currentElem->_getChild(i));
+				{
+					if (currentElem->_getChild(i)->_isHierarchyDirty())
+					{
+						isChildDirty = true;
+						break;
+					}
+				}
+
+				if (!isChildDirty)
+					currentElem->_markAsClean();
 			}
 		}
-
 		bs_frame_clear();
 	}
 
@@ -206,8 +239,9 @@ namespace BansheeEngine
 		{
 			GUIPanel* panel = static_cast<GUIPanel*>(updateParent);
 
+			// Updates the panel's cached size ranges as well, only recalculating the children that changed
 			GUIElementBase* dirtyElement = elem;
-			dirtyElement->_updateOptimalLayoutSizes();
+			panel->_updateOptimalLayoutSizes();
 
 			LayoutSizeRange elementSizeRange = panel->_getElementSizeRange(dirtyElement);
 			Rect2I elementArea = panel->_getElementArea(panel->_getLayoutData().area, dirtyElement, elementSizeRange);
@@ -224,7 +258,7 @@ namespace BansheeEngine
 			updateParent->_updateLayout(childLayoutData);
 		}
 		
-		// Mark dirty contents
+		// Mark dirty contents. Only elements that were modified, or had their layout changed, need to be processed.
 		bs_frame_mark();
 		{
 			FrameStack<GUIElementBase*> todo;
@@ -239,10 +273,15 @@ namespace BansheeEngine
 					mDirtyContents.insert(static_cast<GUIElement*>(currentElem));
 
 				currentElem->_markAsClean();
+				mNumUpdatedLayoutElements++;
 
 				UINT32 numChildren = currentElem->_getNumChildren();
 				for (UINT32 i = 0; i < numChildren; i++)
-					todo.push(currentElem->_getChild(i));
+				{
+					GUIElementBase* child = currentElem->_getChild(i);
+					if (child->_isHierarchyDirty())
+						todo.push(child);
+				}
 			}
 		}
 		bs_frame_clear();
@@ -0,0 +1,401 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsOcclusionCulling.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsTaskScheduler.h"
+
+#if (BS_ARCH_TYPE == BS_ARCHITECTURE_x86_64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define BS_OCCLUSION_SSE 1
+#	include <emmintrin.h>
+#else
+#	define BS_OCCLUSION_SSE 0
+#endif
+
+namespace BansheeEngine
+{
+	SPtr<OccluderGeometry> OccluderGeometry::create(const MeshData& meshData)
+	{
+		if (!meshData.getVertexDesc()->hasElement(VES_POSITION))
+			return nullptr;
+
+		UINT32 numVertices = meshData.getNumVertices();
+		UINT32 numIndices = meshData.getNumIndices();
+		if (numVertices == 0 || numIndices < 3)
+			return nullptr;
+
+		SPtr<OccluderGeometry> output = bs_shared_ptr_new<OccluderGeometry>();
+		output->positions.resize(numVertices);
+		output->indices.resize(numIndices - numIndices % 3);
+
+		UINT8* positionData = meshData.getElementData(VES_POSITION);
+		UINT32 vertexStride = meshData.getVertexDesc()->getVertexStride(0);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			memcpy(&output->positions[i], positionData, sizeof(Vector3));
+			positionData += vertexStride;
+		}
+
+		UINT32 numTriIndices = (UINT32)output->indices.size();
+		if (meshData.getIndexType() == IT_16BIT)
+		{
+			UINT16* indices = meshData.getIndices16();
+			for (UINT32 i = 0; i < numTriIndices; i++)
+				output->indices[i] = indices[i];
+		}
+		else
+			memcpy(output->indices.data(), meshData.getIndices32(), numTriIndices * sizeof(UINT32));
+
+		// Discard any triangles referencing out of range vertices, so the rasterizer doesn't have to check
+		UINT32 numValidIndices = 0;
+		for (UINT32 i = 0; i < numTriIndices; i += 3)
+		{
+			UINT32* triangle = &output->indices[i];
+			if (triangle[0] >= numVertices || triangle[1] >= numVertices || triangle[2] >= numVertices)
+				continue;
+
+			output->indices[numValidIndices++] = triangle[0];
+			output->indices[numValidIndices++] = triangle[1];
+			output->indices[numValidIndices++] = triangle[2];
+		}
+
+		if (numValidIndices == 0)
+			return nullptr;
+
+		output->indices.resize(numValidIndices);
+		return output;
+	}
+
+	const UINT32 OcclusionBuffer::MIN_TRIANGLES_PER_TASK = 256;
+
+	OcclusionBuffer::OcclusionBuffer(UINT32 width, UINT32 height)
+		:mWidth(std::max(4U, (width + 3) & ~3U)), mHeight(std::max(1U, height)), mViewProj(BsIdentity)
+	{
+		mDepth.resize(mWidth * mHeight, std::numeric_limits<float>::max());
+	}
+
+	void OcclusionBuffer::clear(const Matrix4& viewProj)
+	{
+		mViewProj = viewProj;
+		mTriangles.clear();
+
+		std::fill(mDepth.begin(), mDepth.end(), std::numeric_limits<float>::max());
+	}
+
+	void OcclusionBuffer::addOccluder(const OccluderGeometry& geometry, const Matrix4& transform)
+	{
+		Matrix4 worldViewProj = mViewProj * transform;
+
+		UINT32 numVertices = (UINT32)geometry.positions.size();
+		mClipVertices.resize(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+			mClipVertices[i] = worldViewProj.multiply(Vector4(geometry.positions[i], 1.0f));
+
+		UINT32 numIndices = (UINT32)geometry.indices.size();
+		for (UINT32 i = 0; i < numIndices; i += 3)
+		{
+			const Vector4* verts[3] =
+			{
+				&mClipVertices[geometry.indices[i + 0]],
+				&mClipVertices[geometry.indices[i + 1]],
+				&mClipVertices[geometry.indices[i + 2]]
+			};
+
+			// Distance from the near plane (z >= -w for [-1, 1] depth range)
+			float nearDist[3];
+			UINT32 numInside = 0;
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				nearDist[j] = verts[j]->z + verts[j]->w;
+				if (nearDist[j] >= 0.0f)
+					numInside++;
+			}
+
+			if (numInside == 0)
+				continue;
+
+			if (numInside == 3)
+			{
+				setupTriangle(*verts[0], *verts[1], *verts[2]);
+				continue;
+			}
+
+			// Clip against the near plane. Only the near plane needs clipping, as the rest of the frustum is handled by
+			// clamping the triangle bounds to the buffer.
+			Vector4 clipped[4];
+			UINT32 numClipped = 0;
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				UINT32 next = (j + 1) % 3;
+
+				if (nearDist[j] >= 0.0f)
+					clipped[numClipped++] = *verts[j];
+
+				if ((nearDist[j] >= 0.0f) != (nearDist[next] >= 0.0f))
+				{
+					float t = nearDist[j] / (nearDist[j] - nearDist[next]);
+					clipped[numClipped++] = *verts[j] + (*verts[next] - *verts[j]) * t;
+				}
+			}
+
+			for (UINT32 j = 2; j < numClipped; j++)
+				setupTriangle(clipped[0], clipped[j - 1], clipped[j]);
+		}
+	}
+
+	void OcclusionBuffer::setupTriangle(const Vector4& a, const Vector4& b, const Vector4& c)
+	{
+		if (a.w <= 0.0f || b.w <= 0.0f || c.w <= 0.0f)
+			return;
+
+		// Project to screen space, with depth in [-1, 1] range
+		Vector3 verts[3];
+		const Vector4* clipVerts[3] = { &a, &b, &c };
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			float invW = 1.0f / clipVerts[i]->w;
+
+			verts[i].x = (clipVerts[i]->x * invW * 0.5f + 0.5f) * mWidth;
+			verts[i].y = (0.5f - clipVerts[i]->y * invW * 0.5f) * mHeight;
+			verts[i].z = clipVerts[i]->z * invW;
+		}
+
+		float area = (verts[1].x - verts[0].x) * (verts[2].y - verts[0].y) -
+			(verts[1].y - verts[0].y) * (verts[2].x - verts[0].x);
+
+		if (fabs(area) < 1e-6f)
+			return;
+
+		// Occluders are rendered double-sided, so just make sure the winding is consistent
+		if (area < 0.0f)
+		{
+			std::swap(verts[1], verts[2]);
+			area = -area;
+		}
+
+		// Pixel centers at (x + 0.5, y + 0.5) that fall within the triangle bounds
+		float minX = std::min(std::min(verts[0].x, verts[1].x), verts[2].x);
+		float minY = std::min(std::min(verts[0].y, verts[1].y), verts[2].y);
+		float maxX = std::max(std::max(verts[0].x, verts[1].x), verts[2].x);
+		float maxY = std::max(std::max(verts[0].y, verts[1].y), verts[2].y);
+
+		Triangle triangle;
+		triangle.minX = std::max((INT32)ceil(minX - 0.5f), 0);
+		triangle.minY = std::max((INT32)ceil(minY - 0.5f), 0);
+		triangle.maxX = std::min((INT32)floor(maxX - 0.5f), (INT32)mWidth - 1);
+		triangle.maxY = std::min((INT32)floor(maxY - 0.5f), (INT32)mHeight - 1);
+
+		if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY)
+			return;
+
+		// Edge opposite to each vertex. Evaluates to the (scaled) barycentric coordinate of that vertex, positive inside
+		// the triangle.
+		float invArea = 1.0f / area;
+		triangle.depthX = 0.0f;
+		triangle.depthY = 0.0f;
+		triangle.depthC = 0.0f;
+
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			const Vector3& start = verts[(i + 1) % 3];
+			const Vector3& end = verts[(i + 2) % 3];
+
+			triangle.edgeX[i] = start.y - end.y;
+			triangle.edgeY[i] = end.x - start.x;
+			triangle.edgeC[i] = (end.y - start.y) * start.x - (end.x - start.x) * start.y;
+
+			triangle.depthX += verts[i].z * triangle.edgeX[i] * invArea;
+			triangle.depthY += verts[i].z * triangle.edgeY[i] * invArea;
+			triangle.depthC += verts[i].z * triangle.edgeC[i] * invArea;
+		}
+
+		mTriangles.push_back(triangle);
+	}
+
+	void OcclusionBuffer::rasterize()
+	{
+		if (mTriangles.empty())
+			return;
+
+		UINT32 numBands = 1;
+		if (TaskScheduler::isStarted())
+		{
+			UINT32 maxBands = (UINT32)mTriangles.size() / MIN_TRIANGLES_PER_TASK;
+			numBands = std::min(TaskScheduler::instance().getNumWorkers(), maxBands);
+			numBands = std::min(numBands, mHeight / 8);
+		}
+
+		if (numBands <= 1)
+		{
+			rasterizeRows(0, (INT32)mHeight);
+			return;
+		}
+
+		// Split the buffer into horizontal bands. Each band only writes to its own rows so no synchronization is needed.
+		INT32 rowsPerBand = (INT32)((mHeight + numBands - 1) / numBands);
+
+		Vector<SPtr<Task>> tasks;
+		for (UINT32 i = 1; i < numBands; i++)
+		{
+			INT32 startRow = i * rowsPerBand;
+			INT32 endRow = std::min(startRow + rowsPerBand, (INT32)mHeight);
+
+			SPtr<Task> task = Task::create("OcclusionRasterize",
+				std::bind(&OcclusionBuffer::rasterizeRows, this, startRow, endRow), TaskPriority::High);
+			TaskScheduler::instance().addTask(task);
+
+			tasks.push_back(task);
+		}
+
+		rasterizeRows(0, rowsPerBand);
+
+		for (auto& task : tasks)
+			task->wait();
+	}
+
+	void OcclusionBuffer::rasterizeRows(INT32 startRow, INT32 endRow)
+	{
+		for (auto& triangle : mTriangles)
+		{
+			INT32 minY = std::max(triangle.minY, startRow);
+			INT32 maxY = std::min(triangle.maxY, endRow - 1);
+
+			// Process four pixels at a time. The buffer width is a multiple of four, so aligning the start is always in
+			// bounds. Pixels outside of the triangle bounds are rejected by the edge tests.
+			INT32 minX = triangle.minX & ~3;
+			INT32 maxX = triangle.maxX;
+
+			for (INT32 y = minY; y <= maxY; y++)
+			{
+				float* depthRow = &mDepth[y * mWidth];
+				float py = y + 0.5f;
+				float px = minX + 0.5f;
+
+				float edgeRow[3];
+				for (UINT32 i = 0; i < 3; i++)
+					edgeRow[i] = triangle.edgeX[i] * px + triangle.edgeY[i] * py + triangle.edgeC[i];
+
+				float depthRow0 = triangle.depthX * px + triangle.depthY * py + triangle.depthC;
+
+#if BS_OCCLUSION_SSE
+				__m128 laneOffsets = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+				__m128 zero = _mm_setzero_ps();
+
+				__m128 edge0 = _mm_add_ps(_mm_set1_ps(edgeRow[0]), _mm_mul_ps(_mm_set1_ps(triangle.edgeX[0]), laneOffsets));
+				__m128 edge1 = _mm_add_ps(_mm_set1_ps(edgeRow[1]), _mm_mul_ps(_mm_set1_ps(triangle.edgeX[1]), laneOffsets));
+				__m128 edge2 = _mm_add_ps(_mm_set1_ps(edgeRow[2]), _mm_mul_ps(_mm_set1_ps(triangle.edgeX[2]), laneOffsets));
+				__m128 depth = _mm_add_ps(_mm_set1_ps(depthRow0), _mm_mul_ps(_mm_set1_ps(triangle.depthX), laneOffsets));
+
+				__m128 edgeStep0 = _mm_set1_ps(triangle.edgeX[0] * 4.0f);
+				__m128 edgeStep1 = _mm_set1_ps(triangle.edgeX[1] * 4.0f);
+				__m128 edgeStep2 = _mm_set1_ps(triangle.edgeX[2] * 4.0f);
+				__m128 depthStep = _mm_set1_ps(triangle.depthX * 4.0f);
+
+				for (INT32 x = minX; x <= maxX; x += 4)
+				{
+					__m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(edge0, zero), _mm_cmpge_ps(edge1, zero)),
+						_mm_cmpge_ps(edge2, zero));
+
+					if (_mm_movemask_ps(inside) != 0)
+					{
+						__m128 existing = _mm_loadu_ps(depthRow + x);
+						__m128 nearest = _mm_min_ps(existing, depth);
+
+						_mm_storeu_ps(depthRow + x, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, existing)));
+					}
+
+					edge0 = _mm_add_ps(edge0, edgeStep0);
+					edge1 = _mm_add_ps(edge1, edgeStep1);
+					edge2 = _mm_add_ps(edge2, edgeStep2);
+					depth = _mm_add_ps(depth, depthStep);
+				}
+#else
+				for (INT32 x = minX; x <= maxX; x++)
+				{
+					if (edgeRow[0] >= 0.0f && edgeRow[1] >= 0.0f && edgeRow[2] >= 0.0f)
+						depthRow[x] = std::min(depthRow[x], depthRow0);
+
+					edgeRow[0] += triangle.edgeX[0];
+					edgeRow[1] += triangle.edgeX[1];
+					edgeRow[2] += triangle.edgeX[2];
+					depthRow0 += triangle.depthX;
+				}
+#endif
+			}
+		}
+	}
+
+	bool OcclusionBuffer::isOccluded(const AABox& bounds) const
+	{
+		if (mTriangles.empty())
+			return false;
+
+		float minX = std::numeric_limits<float>::max();
+		float minY = std::numeric_limits<float>::max();
+		float maxX = -std::numeric_limits<float>::max();
+		float maxY = -std::numeric_limits<float>::max();
+		float nearestDepth = std::numeric_limits<float>::max();
+
+		for (UINT32 i = 0; i < 8; i++)
+		{
+			Vector4 corner = mViewProj.multiply(Vector4(bounds.getCorner((AABox::CornerEnum)i), 1.0f));
+
+			// Bounds intersecting the near plane are always considered visible
+			if (corner.z + corner.w < 0.0f || corner.w <= 0.0f)
+				return false;
+
+			float invW = 1.0f / corner.w;
+			float x = (corner.x * invW * 0.5f + 0.5f) * mWidth;
+			float y = (0.5f - corner.y * invW * 0.5f) * mHeight;
+
+			minX = std::min(minX, x);
+			minY = std::min(minY, y);
+			maxX = std::max(maxX, x);
+			maxY = std::max(maxY, y);
+			nearestDepth = std::min(nearestDepth, corner.z * invW);
+		}
+
+		// Test every pixel touched by the projected bounds. Object is hidden only if occluders are closer everywhere.
+		// Occluders are only sampled at pixel centers, so a pixel on an occluder edge can be marked as covered even if
+		// the occluder only covers part of it. The rectangle is therefore expanded by a whole pixel on each side: any
+		// part of the bounds not covered by an occluder is then guaranteed to reach a tested pixel whose center is
+		// uncovered.
+		INT32 startX = std::max((INT32)floor(minX) - 1, 0);
+		INT32 startY = std::max((INT32)floor(minY) - 1, 0);
+		INT32 endX = std::min((INT32)floor(maxX) + 1, (INT32)mWidth - 1);
+		INT32 endY = std::min((INT32)floor(maxY) + 1, (INT32)mHeight - 1);
+
+		if (startX > endX || startY > endY)
+			return false;
+
+		for (INT32 y = startY; y <= endY; y++)
+		{
+			const float* depthRow = &mDepth[y * mWidth];
+			INT32 x = startX;
+
+#if BS_OCCLUSION_SSE
+			for (; x <= endX && (x & 3) != 0; x++)
+			{
+				if (depthRow[x] >= nearestDepth)
+					return false;
+			}
+
+			__m128 reference = _mm_set1_ps(nearestDepth);
+			for (; x + 3 <= endX; x += 4)
+			{
+				__m128 depth = _mm_loadu_ps(depthRow + x);
+				if (_mm_movemask_ps(_mm_cmpge_ps(depth, reference)) != 0)
+					return false;
+			}
+#endif
+
+			for (; x <= endX; x++)
+			{
+				if (depthRow[x] >= nearestDepth)
+					return false;
+			}
+		}
+
+		return true;
+	}
+}
@@ -471,6 +471,9 @@ namespace BansheeEngine
 		mGPUIndexBufferBindsStr = HEString(L"__ProfOvIBBinds", L"IB binds: {0}");
 		mGPUGPUProgramBufferBindsStr = HEString(L"__ProfOvProgBuffBinds", L"GPU program buffer binds: {0}");
 		mGPUGPUProgramBindsStr = HEString(L"__ProfOvProgBinds", L"GPU program binds: {0}");
+		mGPUParamsWrittenStr = HEString(L"__ProfOvParamsWritten", L"Params written: {0}");
+		mGPUOcclusionCulledStr = HEString(L"__ProfOvOcclusionCulled", L"Occlusion culled: {0}");
+		mGPURenderTargetMemoryStr = HEString(L"__ProfOvRTMemory", L"RT memory: {0} MB");
 
 		mGPUFrameNumLbl = GUILabel::create(mGPUFrameNumStr, GUIOptions(GUIOption::fixedWidth(200)));
 		mGPUTimeLbl = GUILabel::create(mGPUTimeStr, GUIOptions(GUIOption::fixedWidth(200)));
@@ -495,6 +498,9 @@ namespace BansheeEngine
 		mGPUIndexBufferBindsLbl = GUILabel::create(mGPUIndexBufferBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
 		mGPUGPUProgramBufferBindsLbl = GUILabel::create(mGPUGPUProgramBufferBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
 		mGPUGPUProgramBindsLbl = GUILabel::create(mGPUGPUProgramBindsStr, GUIOptions(GUIOption::fixedWidth(200)));
+		mGPUParamsWrittenLbl = GUILabel::create(mGPUParamsWrittenStr, GUIOptions(GUIOption::fixedWidth(200)));
+		mGPUOcclusionCulledLbl = GUILabel::create(mGPUOcclusionCulledStr, GUIOptions(GUIOption::fixedWidth(200)));
+		mGPURenderTargetMemoryLbl = GUILabel::create(mGPURenderTargetMemoryStr, GUIOptions(GUIOption::fixedWidth(200)));
 
 		mGPULayoutFrameContentsLeft->addElement(mGPUFrameNumLbl);
 		mGPULayoutFrameContentsLeft->addElement(mGPUTimeLbl);
@@ -520,6 +526,9 @@ namespace BansheeEngine
 		mGPULayoutFrameContentsRight->addElement(mGPUIndexBufferBindsLbl);
 		mGPULayoutFrameContentsRight->addElement(mGPUGPUProgramBufferBindsLbl);
 		mGPULayoutFrameContentsRight->addElement(mGPUGPUProgramBindsLbl);
+		mGPULayoutFrameContentsRight->addElement(mGPUParamsWrittenLbl);
+		mGPULayoutFrameContentsRight->addElement(mGPUOcclusionCulledLbl);
+		mGPULayoutFrameContentsRight->addElement(mGPURenderTargetMemoryLbl);
 		mGPULayoutFrameContentsRight->addNewElement<GUIFlexibleSpace>();
 
 		updateCPUSampleAreaSizes();
@@ -758,6 +767,9 @@ namespace BansheeEngine
 		mGPUIndexBufferBindsStr.setParameter(0, toWString(gpuReport.frameSample.numIndexBufferBinds));
 		mGPUGPUProgramBufferBindsStr.setParameter(0, toWString(gpuReport.frameSample.numGpuParamBufferBinds));
 		mGPUGPUProgramBindsStr.setParameter(0, toWString(gpuReport.frameSample.numGpuProgramBinds));
+		mGPUParamsWrittenStr.setParameter(0, toWString(gpuReport.frameSample.numParamsWritten));
+		mGPUOcclusionCulledStr.setParameter(0, toWString(gpuReport.frameSample.numOcclusionCulled));
+		mGPURenderTargetMemoryStr.setParameter(0, toWString(gpuReport.frameSample.peakRenderTargetMemory / (1024 * 1024)));
 
 		mGPUFrameNumLbl->setContent(mGPUFrameNumStr);
 		mGPUTimeLbl->setContent(mGPUTimeStr);
@@ -782,6 +794,9 @@ namespace BansheeEngine
 		mGPUIndexBufferBindsLbl->setContent(mGPUIndexBufferBindsStr);
 		mGPUGPUProgramBufferBindsLbl->setContent(mGPUGPUProgramBufferBindsStr);
 		mGPUGPUProgramBindsLbl->setContent(mGPUGPUProgramBindsStr);
+		mGPUParamsWrittenLbl->setContent(mGPUParamsWrittenStr);
+		mGPUOcclusionCulledLbl->setContent(mGPUOcclusionCulledStr);
+		mGPURenderTargetMemoryLbl->setContent(mGPURenderTargetMemoryStr);
 
 		GPUSampleRowFiller sampleRowFiller(mGPUSampleRows, *mGPULayoutSampleContents, *mWidget->_getInternal());
 		for (auto& sample : gpuReport.samples)
@@ -7,12 +7,10 @@
 #include "BsMaterial.h"
 #include "BsRenderableElement.h"
 
-using namespace std::placeholders;
-
 namespace BansheeEngine
 {
 	RenderQueue::RenderQueue(StateReduction mode)
-		:mStateReductionMode(mode)
+		:mNextSeqIdx(0), mIsSorted(true), mStateReductionMode(mode)
 	{
 
 	}
@@ -21,18 +19,45 @@ namespace BansheeEngine
 	{
 		mSortableElements.clear();
 		mSortableElementIdx.clear();
-		mElements.clear();
+		mFreeSortableElements.clear();
+		mNextSeqIdx = 0;
+		mIsSorted = true;
 
 		mSortedRenderElements.clear();
 	}
 
 	void RenderQueue::add(RenderableElement* element, float distFromCamera)
+	{
+		addSortableElements(element, distFromCamera, false);
+	}
+
+	void RenderQueue::insert(RenderableElement* element, float distFromCamera)
+	{
+		addSortableElements(element, distFromCamera, mIsSorted);
+	}
+
+	void RenderQueue::remove(RenderableElement* element)
+	{
+		auto iterNewEnd = std::remove_if(mSortableElementIdx.begin(), mSortableElementIdx.end(), 
+			[&](UINT32 idx)
+		{
+			SortableElement& sortableElem = mSortableElements[idx];
+			if (sortableElem.element != element)
+				return false;
+
+			sortableElem.element = nullptr;
+			mFreeSortableElements.push_back(idx);
+			return true;
+		});
+
+		mSortableElementIdx.erase(iterNewEnd, mSortableElementIdx.end());
+	}
+
+	void RenderQueue::addSortableElements(RenderableElement* element, float distFromCamera, bool keepSorted)
 	{
 		SPtr<MaterialCore> material = element->material;
 		SPtr<ShaderCore> shader = material->getShader();
 
-		mElements.push_back(element);
-		
 		UINT32 queuePriority = shader->getQueuePriority();
 		QueueSortType sortType = shader->getQueueSortType();
 		UINT32 shaderId = shader->getId();
@@ -54,62 +79,81 @@ namespace BansheeEngine
 		if (!separablePasses)
 			numPasses = std::min(1U, numPasses);
 
+		SortMethod sortMethod = getSortMethod();
 		for (UINT32 i = 0; i < numPasses; i++)
 		{
-			UINT32 idx = (UINT32)mSortableElementIdx.size();
-			mSortableElementIdx.push_back(idx);
-
-			mSortableElements.push_back(SortableElement());
-			SortableElement& sortableElem = mSortableElements.back();
+			UINT32 idx;
+			if (!mFreeSortableElements.empty())
+			{
+				idx = mFreeSortableElements.back();
+				mFreeSortableElements.pop_back();
+			}
+			else
+			{
+				idx = (UINT32)mSortableElements.size();
+				mSortableElements.push_back(SortableElement());
+			}
 
-			sortableElem.seqIdx = idx;
+			SortableElement& sortableElem = mSortableElements[idx];
+			sortableElem.element = element;
+			sortableElem.separablePasses = separablePasses;
+			sortableElem.seqIdx = mNextSeqIdx++;
 			sortableElem.priority = queuePriority;
 			sortableElem.shaderId = shaderId;
 			sortableElem.passIdx = i;
 			sortableElem.distFromCamera = distFromCamera;
+
+			if (keepSorted)
+			{
+				auto iterInsert = std::upper_bound(mSortableElementIdx.begin(), mSortableElementIdx.end(), idx,
+					[&](UINT32 a, UINT32 b) { return sortMethod(a, b, mSortableElements); });
+
+				mSortableElementIdx.insert(iterInsert, idx);
+			}
+			else
+				mSortableElementIdx.push_back(idx);
 		}
+
+		if (!keepSorted)
+			mIsSorted = false;
 	}
 
-	void RenderQueue::sort()
+	RenderQueue::SortMethod RenderQueue::getSortMethod() const
 	{
-		std::function<bool(UINT32, UINT32, const Vector<SortableElement>&)> sortMethod;
-
 		switch (mStateReductionMode)
 		{
 		case StateReduction::None:
-			sortMethod = &elementSorterNoGroup;
-			break;
+			return &elementSorterNoGroup;
 		case StateReduction::Material:
-			sortMethod = &elementSorterPreferGroup;
-			break;
+			return &elementSorterPreferGroup;
+		default:
 		case StateReduction::Distance:
-			sortMethod = &elementSorterPreferSort;
-			break;
+			return &elementSorterPreferSort;
 		}
+	}
 
+	void RenderQueue::sort()
+	{
 		// Sort only indices since we generate an entirely new data set anyway, it doesn't make sense to move sortable elements
-		std::sort(mSortableElementIdx.begin(), mSortableElementIdx.end(), std::bind(sortMethod, _1, _2, mSortableElements));
+		if (!mIsSorted)
+		{
+			SortMethod sortMethod = getSortMethod();
+			std::sort(mSortableElementIdx.begin(), mSortableElementIdx.end(), 
+				[&](UINT32 a, UINT32 b) { return sortMethod(a, b, mSortableElements); });
+
+			mIsSorted = true;
+		}
+
+		mSortedRenderElements.clear();
 
 		UINT32 prevShaderId = (UINT32)-1;
 		UINT32 prevPassIdx = (UINT32)-1;
-		RenderableElement* renderElem = nullptr;
-		INT32 currentElementIdx = -1;
-		UINT32 numPassesInCurrentElement = 0;
-		bool separablePasses = true;
 		for (UINT32 i = 0; i < (UINT32)mSortableElementIdx.size(); i++)
 		{
-			UINT32 idx = mSortableElementIdx[i];
+			const SortableElement& elem = mSortableElements[mSortableElementIdx[i]];
+			RenderableElement* renderElem = elem.element;
 
-			while (numPassesInCurrentElement == 0)
-			{
-				currentElementIdx++;
-				renderElem = mElements[currentElementIdx];
-				numPassesInCurrentElement = renderElem->material->getNumPasses();
-				separablePasses = renderElem->material->getShader()->getAllowSeparablePasses();
-			}
-
-			const SortableElement& elem = mSortableElements[idx];
-			if (separablePasses)
+			if (elem.separablePasses)
 			{
 				mSortedRenderElements.push_back(RenderQueueElement());
 
@@ -125,12 +169,11 @@ namespace BansheeEngine
 				}
 				else
 					sortedElem.applyPass = false;
-
-				numPassesInCurrentElement--;
 			}
 			else
 			{
-				for (UINT32 j = 0; j < numPassesInCurrentElement; j++)
+				UINT32 numPasses = renderElem->material->getNumPasses();
+				for (UINT32 j = 0; j < numPasses; j++)
 				{
 					mSortedRenderElements.push_back(RenderQueueElement());
 
@@ -142,8 +185,6 @@ namespace BansheeEngine
 					prevShaderId = elem.shaderId;
 					prevPassIdx = j;
 				}
-
-				numPassesInCurrentElement = 0;
 			}			
 		}
 	}
@@ -143,6 +143,16 @@ namespace BansheeEngine
 		_markCoreDirty();
 	}
 
+	template<bool Core>
+	void TRenderable<Core>::setOccluder(const SPtr<MeshData>& occluder)
+	{
+		if (mOccluder == occluder)
+			return;
+
+		mOccluder = occluder;
+		_markCoreDirty();
+	}
+
 	template class TRenderable < false >;
 	template class TRenderable < true >;
 
@@ -228,6 +238,11 @@ namespace BansheeEngine
 			dataPtr += sizeof(SPtr<MaterialCore>);
 		}
 
+		SPtr<MeshData>* occluder = (SPtr<MeshData>*)dataPtr;
+		mOccluder = *occluder;
+		occluder->~SPtr<MeshData>();
+		dataPtr += sizeof(SPtr<MeshData>);
+
 		if (dirtyFlags == (UINT32)RenderableDirtyFlag::Transform)
 		{
 			if (mIsActive)
@@ -394,7 +409,8 @@ namespace BansheeEngine
 			rttiGetElemSize(animationId) + 
 			rttiGetElemSize(getCoreDirtyFlags()) +
 			sizeof(SPtr<MeshCore>) + 
-			numMaterials * sizeof(SPtr<MaterialCore>);
+			numMaterials * sizeof(SPtr<MaterialCore>) +
+			sizeof(SPtr<MeshData>);
 
 		UINT8* data = allocator->alloc(size);
 		char* dataPtr = (char*)data;
@@ -424,6 +440,9 @@ namespace BansheeEngine
 			dataPtr += sizeof(SPtr<MaterialCore>);
 		}
 
+		new (dataPtr) SPtr<MeshData>(mOccluder);
+		dataPtr += sizeof(SPtr<MeshData>);
+
 		return CoreSyncData(data, size);
 	}
 
@@ -2,11 +2,22 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsSpriteManager.h"
 #include "BsSpriteMaterials.h"
+#include "BsTextLayoutCache.h"
+#include "BsFontManager.h"
+#include "BsGlyphAtlas.h"
 
 namespace BansheeEngine
 {
+	const UINT32 SpriteManager::TEXT_LAYOUT_CACHE_BUDGET = 4 * 1024 * 1024;
+
 	SpriteManager::SpriteManager()
 	{
+		mTextLayoutCache = bs_new<TextLayoutCache>(TEXT_LAYOUT_CACHE_BUDGET);
+
+		// Cached layouts reference character texture coordinates, which are no longer valid once evicted
+		mGlyphPageEvictedConn = FontManager::instance().getGlyphAtlas().onPageEvicted.connect(
+			[this](UINT32 page) { mTextLayoutCache->clear(); });
+
 		SpriteMaterial* imageTransparentMat = registerMaterial<SpriteImageTransparentMaterial>();
 		SpriteMaterial* imageOpaqueMat = registerMaterial<SpriteImageOpaqueMaterial>();
 		SpriteMaterial* textMat = registerMaterial<SpriteTextMaterial>();
@@ -22,6 +33,9 @@ namespace BansheeEngine
 	{
 		for(auto& entry : mMaterials)
 			bs_delete(entry.second);
+
+		mGlyphPageEvictedConn.disconnect();
+		bs_delete(mTextLayoutCache);
 	}
 
 	SpriteMaterial* SpriteManager::getMaterial(UINT32 id) const
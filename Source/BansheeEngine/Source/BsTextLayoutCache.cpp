@@ -0,0 +1,155 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsTextLayoutCache.h"
+#include "BsTextData.h"
+#include "BsFont.h"
+
+namespace BansheeEngine
+{
+	TextLayoutCache::Key::Key(const TEXT_SPRITE_DESC& desc)
+		: text(desc.text), fontId(0), fontSize(desc.fontSize), width(desc.width), height(desc.height)
+		, horzAlign(desc.horzAlign), vertAlign(desc.vertAlign), anchor(desc.anchor), wordWrap(desc.wordWrap)
+		, wordBreak(desc.wordBreak), hash(0)
+	{
+		// Font resources get a new internal ID when reloaded or reimported, so stale layouts are never returned
+		if (desc.font.isLoaded())
+			fontId = desc.font->getInternalID();
+
+		// Dimensions that don't affect the layout are ignored, so different bounds can share an entry
+		bool dependsOnWidth = wordWrap || horzAlign != THA_Left || (anchor != SA_TopLeft && anchor != SA_MiddleLeft &&
+			anchor != SA_BottomLeft);
+		bool dependsOnHeight = vertAlign != TVA_Top || (anchor != SA_TopLeft && anchor != SA_TopCenter &&
+			anchor != SA_TopRight);
+
+		if (!dependsOnWidth)
+			width = 0;
+
+		if (!dependsOnHeight)
+			height = 0;
+
+		hash_combine(hash, text);
+		hash_combine(hash, fontId);
+		hash_combine(hash, fontSize);
+		hash_combine(hash, width);
+		hash_combine(hash, height);
+		hash_combine(hash, (UINT32)horzAlign);
+		hash_combine(hash, (UINT32)vertAlign);
+		hash_combine(hash, (UINT32)anchor);
+		hash_combine(hash, wordWrap);
+		hash_combine(hash, wordBreak);
+	}
+
+	bool TextLayoutCache::Key::EqualFunction::operator()(const Key* lhs, const Key* rhs) const
+	{
+		return lhs->hash == rhs->hash && lhs->fontId == rhs->fontId && lhs->fontSize == rhs->fontSize &&
+			lhs->width == rhs->width && lhs->height == rhs->height && lhs->horzAlign == rhs->horzAlign &&
+			lhs->vertAlign == rhs->vertAlign && lhs->anchor == rhs->anchor && lhs->wordWrap == rhs->wordWrap &&
+			lhs->wordBreak == rhs->wordBreak && lhs->text == rhs->text;
+	}
+
+	TextLayoutCache::TextLayoutCache(UINT32 memoryBudget)
+		:mMemoryBudget(memoryBudget), mMemoryUsage(0), mNumHits(0), mNumMisses(0)
+	{ }
+
+	const TextLayout& TextLayoutCache::getLayout(const TEXT_SPRITE_DESC& desc)
+	{
+		Key key(desc);
+
+		auto iterFind = mLookup.find(&key);
+		if (iterFind != mLookup.end())
+		{
+			// Move to front, as the most recently used entry
+			List<Entry>::iterator entryIter = iterFind->second;
+			if (entryIter != mEntries.begin())
+				mEntries.splice(mEntries.begin(), mEntries, entryIter);
+
+			mNumHits++;
+			return entryIter->layout;
+		}
+
+		mNumMisses++;
+
+		// Lay out the text in a separate list, so the node can be moved into the cache without copying
+		List<Entry> newEntries;
+		newEntries.emplace_back(std::move(key));
+
+		Entry& entry = newEntries.front();
+		generate(desc, entry);
+
+		// Make room for the new entry. If the entry alone exceeds the budget it is still kept until the next miss, as
+		// the caller needs it.
+		if (entry.memorySize < mMemoryBudget)
+			evict(mMemoryBudget - entry.memorySize);
+		else
+			evict(0);
+
+		mEntries.splice(mEntries.begin(), newEntries);
+		mLookup[&mEntries.front().key] = mEntries.begin();
+		mMemoryUsage += entry.memorySize;
+
+		return entry.layout;
+	}
+
+	void TextLayoutCache::clear()
+	{
+		mLookup.clear();
+		mEntries.clear();
+		mMemoryUsage = 0;
+	}
+
+	void TextLayoutCache::setMemoryBudget(UINT32 memoryBudget)
+	{
+		mMemoryBudget = memoryBudget;
+		evict(mMemoryBudget);
+	}
+
+	void TextLayoutCache::evict(UINT32 targetUsage)
+	{
+		while (mMemoryUsage > targetUsage && !mEntries.empty())
+		{
+			Entry& entry = mEntries.back();
+
+			mMemoryUsage -= entry.memorySize;
+			mLookup.erase(&entry.key);
+			mEntries.pop_back();
+		}
+	}
+
+	void TextLayoutCache::generate(const TEXT_SPRITE_DESC& desc, Entry& entry)
+	{
+		const Key& key = entry.key;
+		UINT32 memorySize = sizeof(Entry) + (UINT32)(key.text.size() * sizeof(WString::value_type));
+
+		bs_frame_mark();
+		{
+			TextData<FrameAlloc> textData(desc.text, desc.font, desc.fontSize, key.width, key.height, desc.wordWrap,
+				desc.wordBreak);
+
+			UINT32 numPages = textData.getNumPages();
+			entry.layout.pages.resize(numPages);
+
+			for (UINT32 i = 0; i < numPages; i++)
+			{
+				TextLayoutPage& page = entry.layout.pages[i];
+
+				UINT32 numQuads = textData.getNumQuadsForPage(i);
+				page.texture = textData.getTextureForPage(i);
+				page.numQuads = numQuads;
+				page.vertices.resize(numQuads * 4);
+				page.uvs.resize(numQuads * 4);
+				page.indices.resize(numQuads * 6);
+
+				if (numQuads > 0)
+				{
+					TextSprite::genTextQuads(i, textData, key.width, key.height, desc.horzAlign, desc.vertAlign,
+						desc.anchor, &page.vertices[0], &page.uvs[0], &page.indices[0], numQuads);
+				}
+
+				memorySize += sizeof(TextLayoutPage) + numQuads * (8 * sizeof(Vector2) + 6 * sizeof(UINT32));
+			}
+		}
+		bs_frame_clear();
+
+		entry.memorySize = memorySize;
+	}
+}
@@ -4,6 +4,7 @@
 #include "BsTextData.h"
 #include "BsVector2.h"
 #include "BsSpriteManager.h"
+#include "BsTextLayoutCache.h"
 
 namespace BansheeEngine
 {
@@ -19,60 +20,54 @@ namespace BansheeEngine
 
 	void TextSprite::update(const TEXT_SPRITE_DESC& desc, UINT64 groupId)
 	{
-		bs_frame_mark();
-		{
-			TextData<FrameAlloc> textData(desc.text, desc.font, desc.fontSize, desc.width, desc.height, desc.wordWrap, desc.wordBreak);
-
-			UINT32 numPages = textData.getNumPages();
-
-			// Free all previous memory
-			for (auto& cachedElem : mCachedRenderElements)
-			{
-				if (cachedElem.vertices != nullptr) mAlloc.free(cachedElem.vertices);
-				if (cachedElem.uvs != nullptr) mAlloc.free(cachedElem.uvs);
-				if (cachedElem.indexes != nullptr) mAlloc.free(cachedElem.indexes);
-			}
-
-			mAlloc.clear();
+		// Layout doesn't depend on the sprite's position or clipping (those are applied when filling the buffers), so
+		// identical text can reuse previously generated quads
+		const TextLayout& layout = SpriteManager::instance().getTextLayoutCache().getLayout(desc);
 
-			// Resize cached mesh array to needed size
-			if (mCachedRenderElements.size() != numPages)
-				mCachedRenderElements.resize(numPages);
+		UINT32 numPages = (UINT32)layout.pages.size();
 
-			// Actually generate a mesh
-			UINT32 texPage = 0;
-			for (auto& cachedElem : mCachedRenderElements)
-			{
-				UINT32 newNumQuads = textData.getNumQuadsForPage(texPage);
+		// Free all previous memory
+		for (auto& cachedElem : mCachedRenderElements)
+		{
+			if (cachedElem.vertices != nullptr) mAlloc.free(cachedElem.vertices);
+			if (cachedElem.uvs != nullptr) mAlloc.free(cachedElem.uvs);
+			if (cachedElem.indexes != nullptr) mAlloc.free(cachedElem.indexes);
+		}
 
-				cachedElem.vertices = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
-				cachedElem.uvs = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
-				cachedElem.indexes = (UINT32*)mAlloc.alloc(sizeof(UINT32) * newNumQuads * 6);
-				cachedElem.numQuads = newNumQuads;
+		mAlloc.clear();
 
-				const HTexture& tex = textData.getTextureForPage(texPage);
+		// Resize cached mesh array to needed size
+		if (mCachedRenderElements.size() != numPages)
+			mCachedRenderElements.resize(numPages);
 
-				SpriteMaterialInfo& matInfo = cachedElem.matInfo;
-				matInfo.groupId = groupId;
-				matInfo.texture = tex;
-				matInfo.tint = desc.color;
+		// Copy the quads from the layout
+		UINT32 texPage = 0;
+		for (auto& cachedElem : mCachedRenderElements)
+		{
+			const TextLayoutPage& page = layout.pages[texPage];
+			UINT32 newNumQuads = page.numQuads;
 
-				cachedElem.material = SpriteManager::instance().getTextMaterial();
+			cachedElem.vertices = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
+			cachedElem.uvs = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
+			cachedElem.indexes = (UINT32*)mAlloc.alloc(sizeof(UINT32) * newNumQuads * 6);
+			cachedElem.numQuads = newNumQuads;
 
-				texPage++;
+			if (newNumQuads > 0)
+			{
+				memcpy(cachedElem.vertices, &page.vertices[0], sizeof(Vector2) * newNumQuads * 4);
+				memcpy(cachedElem.uvs, &page.uvs[0], sizeof(Vector2) * newNumQuads * 4);
+				memcpy(cachedElem.indexes, &page.indices[0], sizeof(UINT32) * newNumQuads * 6);
 			}
 
-			// Calc alignment and anchor offsets and set final line positions
-			for (UINT32 j = 0; j < numPages; j++)
-			{
-				SpriteRenderElement& renderElem = mCachedRenderElements[j];
+			SpriteMaterialInfo& matInfo = cachedElem.matInfo;
+			matInfo.groupId = groupId;
+			matInfo.texture = page.texture;
+			matInfo.tint = desc.color;
 
-				genTextQuads(j, textData, desc.width, desc.height, desc.horzAlign, desc.vertAlign, desc.anchor,
-					renderElem.vertices, renderElem.uvs, renderElem.indexes, renderElem.numQuads);
-			}
-		}
+			cachedElem.material = SpriteManager::instance().getTextMaterial();
 
-		bs_frame_clear();
+			texPage++;
+		}
 
 		updateBounds();
 	}
@@ -149,6 +149,29 @@ namespace BansheeEngine
 		/** Parses the scene and generates morph shapes for the imported meshes using the imported raw data. */
 		SPtr<MorphShapes> createMorphShapes(const FBXImportScene& scene);
 
+		/** 
+		 * Optimizes the generated mesh data for rendering, and updates the morph shapes (if any) so they reference the
+		 * optimized vertices.
+		 */
+		SPtr<RendererMeshData> optimizeMeshData(const SPtr<RendererMeshData>& meshData, const Vector<SubMesh>& subMeshes,
+			MeshOptimizeFlags flags, SPtr<MorphShapes>& morphShapes);
+
+		/** 
+		 * Generates simplified levels of detail for the mesh data, as requested by the import options. Returns mesh data
+		 * containing the indices of both the original mesh and all the generated levels, or the original mesh data if no
+		 * levels were generated.
+		 */
+		SPtr<RendererMeshData> generateLODs(const SPtr<RendererMeshData>& meshData, const Vector<SubMesh>& subMeshes,
+			const MeshImportOptions* importOptions, Vector<MeshLOD>& lods);
+
+		/** 
+		 * Quantizes the vertices of the mesh data into smaller formats, as requested by the import options. Outputs the
+		 * parameters required for decoding the vertices, which should be provided to the mesh. Returns the original mesh
+		 * data if no vertices were compressed.
+		 */
+		SPtr<RendererMeshData> compressVertices(const SPtr<RendererMeshData>& meshData, 
+			const MeshImportOptions* importOptions, MeshVertexCompression& compression);
+
 		/**	Creates an internal representation of an FBX node from an FbxNode object. */
 		FBXImportNode* createImportNode(FBXImportScene& scene, FbxNode* fbxNode, FBXImportNode* parent);
 
@@ -130,7 +130,11 @@ namespace BansheeEngine
 		if (meshImportOptions->getCPUReadable())
 			desc.usage |= MU_CPUCACHED;
 
-		SPtr<Mesh> mesh = Mesh::_createPtr(rendererMeshData->getData(), desc);
+		SPtr<RendererMeshData> lodMeshData = generateLODs(rendererMeshData, desc.subMeshes, meshImportOptions, desc.lods);
+		SPtr<RendererMeshData> compressedMeshData = compressVertices(lodMeshData, meshImportOptions, 
+			desc.vertexCompression);
+
+		SPtr<Mesh> mesh = Mesh::_createPtr(compressedMeshData->getData(), desc);
 
 		WString fileName = filePath.getWFilename(false);
 		mesh->setName(fileName);
@@ -152,7 +156,11 @@ namespace BansheeEngine
 		if (meshImportOptions->getCPUReadable())
 			desc.usage |= MU_CPUCACHED;
 
-		SPtr<Mesh> mesh = Mesh::_createPtr(rendererMeshData->getData(), desc);
+		SPtr<RendererMeshData> lodMeshData = generateLODs(rendererMeshData, desc.subMeshes, meshImportOptions, desc.lods);
+		SPtr<RendererMeshData> compressedMeshData = compressVertices(lodMeshData, meshImportOptions, 
+			desc.vertexCompression);
+
+		SPtr<Mesh> mesh = Mesh::_createPtr(compressedMeshData->getData(), desc);
 
 		WString fileName = filePath.getWFilename(false);
 		mesh->setName(fileName);
@@ -183,6 +191,31 @@ namespace BansheeEngine
 			Vector<ImportedAnimationEvents> events = meshImportOptions->getAnimationEvents();
 			for(auto& entry : animationClips)
 			{
+				if(meshImportOptions->getAnimationCompression())
+				{
+					AnimationCompressionStats stats = AnimationCompression::compress(*entry.curves);
+
+					LOGDBG("Compressed animation clip \"" + entry.name + "\" from " + toString(stats.originalSize) + 
+						" to " + toString(stats.compressedSize) + " bytes (" + toString(stats.originalNumKeys) + " to " + 
+						toString(stats.compressedNumKeys) + " keyframes). Maximum error: position " + 
+						toString(stats.maxPositionError) + ", rotation " + toString(stats.maxRotationError) + 
+						" rad, scale " + toString(stats.maxScaleError) + ". Evaluation time: " + 
+						toString(stats.originalEvaluationTime) + "us uncompressed, " + 
+						toString(stats.compressedEvaluationTime) + "us compressed.");
+				}
+
+				if(meshImportOptions->getAnimationBaking())
+				{
+					AnimationBakingStats stats = BakedAnimationCurves::bake(*entry.curves, entry.sampleRate);
+
+					LOGDBG("Baked animation clip \"" + entry.name + "\" into " + toString(stats.numFrames) + 
+						" frames (" + toString(stats.bakedSize) + " bytes). Maximum error: position " + 
+						toString(stats.maxPositionError) + ", rotation " + toString(stats.maxRotationError) + 
+						" rad, scale " + toString(stats.maxScaleError) + ". Evaluation time: " + 
+						toString(stats.originalEvaluationTime) + "us original, " + 
+						toString(stats.bakedEvaluationTime) + "us baked.");
+				}
+
 				SPtr<AnimationClip> clip = AnimationClip::_createPtr(entry.curves, entry.isAdditive, entry.sampleRate);
 				
 				for(auto& eventsEntry : events)
@@ -243,6 +276,10 @@ namespace BansheeEngine
 		skeleton = createSkeleton(importedScene, subMeshes.size() > 1);
 		morphShapes = createMorphShapes(importedScene);		
 
+		MeshOptimizeFlags optimizeFlags = meshImportOptions->getMeshOptimization();
+		if (rendererMeshData != nullptr && optimizeFlags != MeshOptimizeFlags())
+			rendererMeshData = optimizeMeshData(rendererMeshData, subMeshes, optimizeFlags, morphShapes);
+
 		// Import animation clips
 		if (!importedScene.clips.empty())
 		{
@@ -250,8 +287,6 @@ namespace BansheeEngine
 			convertAnimations(importedScene.clips, splits, animation);
 		}
 
-		// TODO - Later: Optimize mesh: Remove bad and degenerate polygons, weld nearby vertices, optimize for vertex cache
-
 		shutDownSdk();
 
 		return rendererMeshData;
@@ -336,6 +371,101 @@ namespace BansheeEngine
 		return nullptr;
 	}
 
+	SPtr<RendererMeshData> FBXImporter::optimizeMeshData(const SPtr<RendererMeshData>& meshData, 
+		const Vector<SubMesh>& subMeshes, MeshOptimizeFlags flags, SPtr<MorphShapes>& morphShapes)
+	{
+		// Welded vertices could have different morph shape deltas, so don't weld if the mesh uses morph shapes
+		if (morphShapes != nullptr)
+			flags.unset(MeshOptimizeFlag::WeldVertices);
+
+		Vector<UINT32> vertexRemap;
+		MeshOptimizeStats stats;
+		SPtr<MeshData> optimizedMeshData = MeshUtility::optimize(meshData->getData(), subMeshes, flags, vertexRemap, 
+			stats);
+
+		LOGDBG("Optimized mesh vertex cache efficiency from " + toString(stats.acmrBefore) + " to " + 
+			toString(stats.acmrAfter) + " ACMR (" + toString(stats.numVerticesBefore) + " to " + 
+			toString(stats.numVerticesAfter) + " vertices).");
+
+		if (morphShapes != nullptr)
+		{
+			Vector<SPtr<MorphShape>> shapes;
+			for (UINT32 i = 0; i < morphShapes->getNumShapes(); i++)
+			{
+				SPtr<MorphShape> shape = morphShapes->getShape(i);
+
+				Vector<MorphVertex> vertices = shape->getVertices();
+				for (auto& vertex : vertices)
+					vertex.sourceIdx = vertexRemap[vertex.sourceIdx];
+
+				shapes.push_back(MorphShape::create(shape->getName(), vertices));
+			}
+
+			morphShapes = MorphShapes::create(shapes, stats.numVerticesAfter);
+		}
+
+		return RendererMeshData::create(optimizedMeshData);
+	}
+
+	SPtr<RendererMeshData> FBXImporter::generateLODs(const SPtr<RendererMeshData>& meshData, 
+		const Vector<SubMesh>& subMeshes, const MeshImportOptions* importOptions, Vector<MeshLOD>& lods)
+	{
+		UINT32 numLODs = importOptions->getNumLODs();
+		if (meshData == nullptr || numLODs == 0)
+			return meshData;
+
+		SPtr<MeshData> lodMeshData = MeshUtility::generateLODs(meshData->getData(), subMeshes, numLODs, 
+			importOptions->getLODReduction(), lods);
+
+		if (lods.empty())
+		{
+			LOGWRN("Unable to generate levels of detail for the mesh. Make sure the mesh has positions in 3D float " 
+				"format and can be simplified.");
+
+			return meshData;
+		}
+
+		String lodInfo;
+		for (auto& lod : lods)
+		{
+			UINT32 numIndices = 0;
+			for (auto& subMesh : lod.subMeshes)
+				numIndices += subMesh.indexCount;
+
+			lodInfo += " " + toString(numIndices / 3);
+		}
+
+		LOGDBG("Generated " + toString((UINT32)lods.size()) + " levels of detail with triangle counts:" + lodInfo + ".");
+
+		return RendererMeshData::create(lodMeshData);
+	}
+
+	SPtr<RendererMeshData> FBXImporter::compressVertices(const SPtr<RendererMeshData>& meshData, 
+		const MeshImportOptions* importOptions, MeshVertexCompression& compression)
+	{
+		VertexCompressionFlags flags = importOptions->getVertexCompression();
+		if (meshData == nullptr || (UINT32)flags == 0)
+			return meshData;
+
+		VertexCompressionStats stats;
+		SPtr<MeshData> compressedMeshData = MeshUtility::compressVertices(meshData->getData(), flags, compression, 
+			stats);
+
+		if (flags.isSet(VertexCompressionFlag::Position) && !stats.positionsCompressed)
+			LOGDBG("Mesh is too large for its vertex positions to be compressed without a noticeable error.");
+
+		if (compressedMeshData == meshData->getData())
+			return meshData;
+
+		UINT32 reduction = 100 - (UINT32)((UINT64)stats.compressedSize * 100 / std::max(stats.originalSize, 1U));
+
+		LOGDBG("Compressed mesh vertices from " + toString(stats.originalSize) + " to " + 
+			toString(stats.compressedSize) + " bytes (" + toString(reduction) + "% reduction). Maximum error: position " + 
+			toString(stats.maxPositionError) + ", normal " + toString(stats.maxNormalError) + " rad.");
+
+		return RendererMeshData::create(compressedMeshData);
+	}
+
 	SPtr<MorphShapes> FBXImporter::createMorphShapes(const FBXImportScene& scene)
 	{
 		// Combine morph shapes from all sub-meshes, and transform them
@@ -812,8 +942,8 @@ namespace BansheeEngine
 
 				SPtr<RendererMeshData> meshData = RendererMeshData::create((UINT32)numVertices, numIndices, (VertexLayout)vertexLayout);
 
-				// Copy indices
-				meshData->setIndices((UINT32*)mesh->indices.data(), numIndices * sizeof(UINT32));
+				// Copy indices, ordered so they match the sub-mesh ranges
+				meshData->setIndices(orderedIndices, numIndices * sizeof(UINT32));
 
 				// Copy & transform positions
 				UINT32 positionsSize = sizeof(Vector3) * (UINT32)numVertices;
@@ -929,6 +1059,8 @@ namespace BansheeEngine
 				allSubMeshes.push_back(subMeshes);
 			}
 
+			bs_free(orderedIndices);
+
 			UINT32 numBones = (UINT32)mesh->bones.size();
 			boneIndexOffset += numBones;
 		}
@@ -1540,8 +1672,8 @@ namespace BansheeEngine
 
 					if (options.importTangents && !mesh->UV[0].empty() && (frame.tangents.empty() || frame.bitangents.empty()))
 					{
-						mesh->tangents.resize(numVertices);
-						mesh->bitangents.resize(numVertices);
+						frame.tangents.resize(numVertices);
+						frame.bitangents.resize(numVertices);
 
 						MeshUtility::calculateTangents(mesh->positions.data(), frame.normals.data(), mesh->UV[0].data(), (UINT8*)mesh->indices.data(),
 							numVertices, numIndices, frame.tangents.data(), frame.bitangents.data());
@@ -0,0 +1,63 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsFontPrerequisites.h"
+#include "BsFontRasterizer.h"
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+namespace BansheeEngine
+{
+	/** @addtogroup Font
+	 *  @{
+	 */
+
+	/** Font rasterizer that renders characters of dynamic fonts using the FreeType library. */
+	class BS_FONT_EXPORT FreeTypeFontRasterizer : public FontRasterizer
+	{
+	public:
+		/** @copydoc FontRasterizerFactory::create */
+		FreeTypeFontRasterizer(const UINT8* data, UINT32 size, UINT32 dpi, FontRenderMode renderMode);
+		~FreeTypeFontRasterizer();
+
+		/** Checks was the font face successfully loaded. */
+		bool isValid() const { return mFace != nullptr; }
+
+		/** @copydoc FontRasterizer::getMetrics */
+		bool getMetrics(UINT32 size, FONT_DESC& output) override;
+
+		/** @copydoc FontRasterizer::rasterize */
+		bool rasterize(UINT32 size, UINT32 charId, CHAR_DESC& desc, Vector<UINT8>& pixels) override;
+
+		/** @copydoc FontRasterizer::hasKerning */
+		bool hasKerning() const override;
+
+		/** @copydoc FontRasterizer::getKerning */
+		INT32 getKerning(UINT32 size, UINT32 leftCharId, UINT32 rightCharId) override;
+
+		/** Returns FreeType glyph load flags corresponding to the provided render mode. */
+		static FT_Int32 getLoadFlags(FontRenderMode renderMode);
+
+	private:
+		/** Changes the active size of the font face, if different from the current one. */
+		bool setSize(UINT32 size);
+
+		FT_Library mLibrary;
+		FT_Face mFace;
+		FT_Int32 mLoadFlags;
+		UINT32 mDPI;
+		UINT32 mActiveSize;
+	};
+
+	/** Creates FreeType rasterizers for dynamic fonts. */
+	class BS_FONT_EXPORT FreeTypeFontRasterizerFactory : public FontRasterizerFactory
+	{
+	public:
+		/** @copydoc FontRasterizerFactory::create */
+		SPtr<FontRasterizer> create(const UINT8* data, UINT32 size, UINT32 dpi, FontRenderMode renderMode) override;
+	};
+
+	/** @} */
+}
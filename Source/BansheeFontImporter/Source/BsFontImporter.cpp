@@ -10,6 +10,9 @@
 #include "BsCoreApplication.h"
 #include "BsCoreThread.h"
 #include "BsCoreThreadAccessor.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsFreeTypeFontRasterizer.h"
 
 #include <ft2build.h>
 #include <freetype/freetype.h>
@@ -54,6 +57,26 @@ namespace BansheeEngine
 	{
 		const FontImportOptions* fontImportOptions = static_cast<const FontImportOptions*>(importOptions.get());
 
+		// Dynamic fonts keep the source file and render characters when needed
+		if (fontImportOptions->getDynamic())
+		{
+			SPtr<DataStream> stream = FileSystem::openFile(filePath);
+			if (stream == nullptr)
+				BS_EXCEPT(InternalErrorException, "Failed to load font file: " + filePath.toString() + ".");
+
+			Vector<UINT8> sourceData(stream->size());
+			if (!sourceData.empty())
+				stream->read(&sourceData[0], sourceData.size());
+
+			SPtr<Font> newFont = Font::_createDynamicPtr(sourceData, fontImportOptions->getDPI(),
+				fontImportOptions->getRenderMode());
+
+			WString fileName = filePath.getWFilename(false);
+			newFont->setName(fileName);
+
+			return newFont;
+		}
+
 		FT_Library library;
 
 		FT_Error error = FT_Init_FreeType(&library);
@@ -76,25 +99,7 @@ namespace BansheeEngine
 		Vector<UINT32> fontSizes = fontImportOptions->getFontSizes();
 		UINT32 dpi = fontImportOptions->getDPI();
 
-		FT_Int32 loadFlags;
-		switch (fontImportOptions->getRenderMode())
-		{
-		case FontRenderMode::Smooth:
-			loadFlags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
-			break;
-		case FontRenderMode::Raster:
-			loadFlags = FT_LOAD_TARGET_MONO | FT_LOAD_NO_HINTING;
-			break;
-		case FontRenderMode::HintedSmooth:
-			loadFlags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_AUTOHINT;
-			break;
-		case FontRenderMode::HintedRaster:
-			loadFlags = FT_LOAD_TARGET_MONO | FT_LOAD_NO_AUTOHINT;
-			break;
-		default:
-			loadFlags = FT_LOAD_TARGET_NORMAL;
-			break;
-		}
+		FT_Int32 loadFlags = FreeTypeFontRasterizer::getLoadFlags(fontImportOptions->getRenderMode());
 
 		FT_Render_Mode renderMode = FT_LOAD_TARGET_MODE(loadFlags);
 
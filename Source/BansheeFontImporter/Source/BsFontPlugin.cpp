@@ -3,6 +3,8 @@
 #include "BsFontPrerequisites.h"
 #include "BsImporter.h"
 #include "BsFontImporter.h"
+#include "BsFreeTypeFontRasterizer.h"
+#include "BsFontManager.h"
 
 namespace BansheeEngine
 {
@@ -19,6 +21,8 @@ namespace BansheeEngine
 		FontImporter* importer = bs_new<FontImporter>();
 		Importer::instance()._registerAssetImporter(importer);
 
+		FontManager::instance().setRasterizerFactory(bs_shared_ptr_new<FreeTypeFontRasterizerFactory>());
+
 		return nullptr;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,190 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsFreeTypeFontRasterizer.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	FreeTypeFontRasterizer::FreeTypeFontRasterizer(const UINT8* data, UINT32 size, UINT32 dpi, FontRenderMode renderMode)
+		:mLibrary(nullptr), mFace(nullptr), mLoadFlags(getLoadFlags(renderMode)), mDPI(dpi), mActiveSize(0)
+	{
+		if (FT_Init_FreeType(&mLibrary))
+		{
+			LOGERR("Error occurred during FreeType library initialization.");
+			mLibrary = nullptr;
+			return;
+		}
+
+		if (FT_New_Memory_Face(mLibrary, data, (FT_Long)size, 0, &mFace))
+		{
+			LOGERR("Failed to load a dynamic font. Unsupported file format.");
+			mFace = nullptr;
+		}
+	}
+
+	FreeTypeFontRasterizer::~FreeTypeFontRasterizer()
+	{
+		if (mFace != nullptr)
+			FT_Done_Face(mFace);
+
+		if (mLibrary != nullptr)
+			FT_Done_FreeType(mLibrary);
+	}
+
+	bool FreeTypeFontRasterizer::getMetrics(UINT32 size, FONT_DESC& output)
+	{
+		if (!setSize(size))
+			return false;
+
+		const FT_Size_Metrics& metrics = mFace->size->metrics;
+		output.baselineOffset = (INT32)(metrics.ascender >> 6);
+		output.lineHeight = (UINT32)(metrics.height >> 6);
+
+		if (FT_Load_Char(mFace, 32, mLoadFlags))
+			output.spaceWidth = size / 2;
+		else
+			output.spaceWidth = (UINT32)(mFace->glyph->advance.x >> 6);
+
+		return true;
+	}
+
+	bool FreeTypeFontRasterizer::rasterize(UINT32 size, UINT32 charId, CHAR_DESC& desc, Vector<UINT8>& pixels)
+	{
+		if (!setSize(size))
+			return false;
+
+		// Glyph zero is the missing glyph
+		FT_UInt glyphIdx = 0;
+		if (charId != 0)
+		{
+			glyphIdx = FT_Get_Char_Index(mFace, (FT_ULong)charId);
+			if (glyphIdx == 0)
+				return false;
+		}
+
+		if (FT_Load_Glyph(mFace, glyphIdx, mLoadFlags))
+			return false;
+
+		FT_GlyphSlot slot = mFace->glyph;
+		if (FT_Render_Glyph(slot, FT_LOAD_TARGET_MODE(mLoadFlags)))
+			return false;
+
+		UINT32 width = (UINT32)slot->bitmap.width;
+		UINT32 height = (UINT32)slot->bitmap.rows;
+
+		if (slot->bitmap.buffer == nullptr && width > 0 && height > 0)
+			return false;
+
+		pixels.resize(width * height);
+
+		UINT8* srcBuffer = slot->bitmap.buffer;
+		UINT8* dstBuffer = pixels.data();
+		if (slot->bitmap.pixel_mode == FT_PIXEL_MODE_GRAY)
+		{
+			for (UINT32 row = 0; row < height; row++)
+			{
+				memcpy(dstBuffer, srcBuffer, width);
+
+				dstBuffer += width;
+				srcBuffer += slot->bitmap.pitch;
+			}
+		}
+		else if (slot->bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+		{
+			// 8 pixels are packed into a byte, so do some unpacking
+			for (UINT32 row = 0; row < height; row++)
+			{
+				for (UINT32 column = 0; column < width; column++)
+				{
+					UINT8 srcValue = srcBuffer[column >> 3];
+					dstBuffer[column] = (srcValue & (128 >> (column & 7))) != 0 ? 255 : 0;
+				}
+
+				dstBuffer += width;
+				srcBuffer += slot->bitmap.pitch;
+			}
+		}
+		else
+		{
+			LOGWRN("Unsupported pixel mode for a FreeType bitmap.");
+			return false;
+		}
+
+		desc.charId = charId;
+		desc.width = width;
+		desc.height = height;
+		desc.xOffset = slot->bitmap_left;
+		desc.yOffset = slot->bitmap_top;
+		desc.xAdvance = (INT32)(slot->advance.x >> 6);
+		desc.yAdvance = (INT32)(slot->advance.y >> 6);
+		desc.kerningPairs.clear();
+
+		return true;
+	}
+
+	bool FreeTypeFontRasterizer::hasKerning() const
+	{
+		return FT_HAS_KERNING(mFace) != 0;
+	}
+
+	INT32 FreeTypeFontRasterizer::getKerning(UINT32 size, UINT32 leftCharId, UINT32 rightCharId)
+	{
+		if (!setSize(size))
+			return 0;
+
+		FT_UInt leftGlyphIdx = FT_Get_Char_Index(mFace, (FT_ULong)leftCharId);
+		FT_UInt rightGlyphIdx = FT_Get_Char_Index(mFace, (FT_ULong)rightCharId);
+
+		FT_Vector kerning;
+		if (FT_Get_Kerning(mFace, leftGlyphIdx, rightGlyphIdx, FT_KERNING_DEFAULT, &kerning))
+			return 0;
+
+		return (INT32)(kerning.x >> 6); // Y kerning is ignored because it is so rare
+	}
+
+	FT_Int32 FreeTypeFontRasterizer::getLoadFlags(FontRenderMode renderMode)
+	{
+		switch (renderMode)
+		{
+		case FontRenderMode::Smooth:
+			return FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
+		case FontRenderMode::Raster:
+			return FT_LOAD_TARGET_MONO | FT_LOAD_NO_HINTING;
+		case FontRenderMode::HintedSmooth:
+			return FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_AUTOHINT;
+		case FontRenderMode::HintedRaster:
+			return FT_LOAD_TARGET_MONO | FT_LOAD_NO_AUTOHINT;
+		default:
+			return FT_LOAD_TARGET_NORMAL;
+		}
+	}
+
+	bool FreeTypeFontRasterizer::setSize(UINT32 size)
+	{
+		if (mFace == nullptr)
+			return false;
+
+		if (size == mActiveSize)
+			return true;
+
+		FT_F26Dot6 ftSize = (FT_F26Dot6)(size * (1 << 6));
+		if (FT_Set_Char_Size(mFace, ftSize, 0, mDPI, mDPI))
+		{
+			mActiveSize = 0;
+			return false;
+		}
+
+		mActiveSize = size;
+		return true;
+	}
+
+	SPtr<FontRasterizer> FreeTypeFontRasterizerFactory::create(const UINT8* data, UINT32 size, UINT32 dpi,
+		FontRenderMode renderMode)
+	{
+		SPtr<FreeTypeFontRasterizer> rasterizer = bs_shared_ptr_new<FreeTypeFontRasterizer>(data, size, dpi, renderMode);
+		if (!rasterizer->isValid())
+			return nullptr;
+
+		return rasterizer;
+	}
+}
@@ -168,6 +168,8 @@ namespace BansheeEngine
 			case VET_COLOR_ABGR:
 			case VET_COLOR_ARGB:
 			case VET_UBYTE4_NORM:
+			case VET_SHORT2_NORM:
+			case VET_SHORT4_NORM:
 				normalized = GL_TRUE;
 				break;
 			default:
@@ -108,6 +108,19 @@ namespace BansheeEngine
 
 		/** Returns the maximum available worker threads (maximum number of tasks that can be executed simultaneously). */
 		UINT32 getNumWorkers() const { return mMaxActiveTasks; }
+
+		/**
+		 * Splits the range [0, @p count) into chunks and calls @p function for each chunk on the worker threads, blocking
+		 * until all chunks are processed. The calling thread processes the first chunk itself. The range is processed on
+		 * the calling thread alone if it is too small to be worth splitting, or if the scheduler isn't running.
+		 *
+		 * @param[in]	name		Name of the tasks created for the chunks.
+		 * @param[in]	count		Number of elements in the range.
+		 * @param[in]	minPerTask	Minimum number of elements to process in a single task. Zero is treated as one.
+		 * @param[in]	function	Function that processes the elements in range [start, end), provided as parameters.
+		 */
+		static void processRangeInParallel(const String& name, UINT32 count, UINT32 minPerTask,
+			const std::function<void(UINT32, UINT32)>& function);
 	protected:
 		friend class Task;
 
@@ -22,5 +22,8 @@ namespace BansheeEngine
 	/**	Generates an MD5 hash string for the provided source string. */
 	String BS_UTILITY_EXPORT md5(const String& source);
 
+	/** Generates an MD5 hash string for the data in the provided stream, from its current position to its end. */
+	String BS_UTILITY_EXPORT md5(const SPtr<DataStream>& stream);
+
 	/** @} */
 }
\ No newline at end of file
@@ -177,6 +177,42 @@ namespace BansheeEngine
 		}
 	}
 
+	void TaskScheduler::processRangeInParallel(const String& name, UINT32 count, UINT32 minPerTask,
+		const std::function<void(UINT32, UINT32)>& function)
+	{
+		UINT32 numTasks = 1;
+		if (isStarted())
+		{
+			UINT32 maxTasks = count / std::max(minPerTask, 1U);
+			numTasks = std::min(instance().getNumWorkers(), maxTasks);
+		}
+
+		if (numTasks <= 1)
+		{
+			function(0, count);
+			return;
+		}
+
+		UINT32 countPerTask = (count + numTasks - 1) / numTasks;
+
+		Vector<SPtr<Task>> tasks;
+		for (UINT32 i = 1; i < numTasks; i++)
+		{
+			UINT32 start = i * countPerTask;
+			UINT32 end = std::min(start + countPerTask, count);
+
+			SPtr<Task> task = Task::create(name, std::bind(function, start, end), TaskPriority::High);
+			instance().addTask(task);
+
+			tasks.push_back(task);
+		}
+
+		function(0, countPerTask);
+
+		for (auto& task : tasks)
+			task->wait();
+	}
+
 	bool TaskScheduler::taskCompare(const SPtr<Task>& lhs, const SPtr<Task>& rhs)
 	{
 		// If one tasks priority is higher, that one goes first
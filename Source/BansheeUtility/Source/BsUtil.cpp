@@ -1,6 +1,7 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsPrerequisitesUtil.h"
+#include "BsDataStream.h"
 #include "ThirdParty/md5.h"
 
 namespace BansheeEngine
@@ -38,4 +39,32 @@ namespace BansheeEngine
 
 		return String(buf);
 	}
+
+	String md5(const SPtr<DataStream>& stream)
+	{
+		MD5 md5;
+
+		// Read in chunks, so large files don't need to be fully loaded in memory
+		UINT8 chunk[64 * 1024];
+		while (!stream->eof())
+		{
+			size_t numRead = stream->read(chunk, sizeof(chunk));
+			if (numRead == 0)
+				break;
+
+			md5.update(chunk, (UINT32)numRead);
+		}
+
+		md5.finalize();
+
+		UINT8 digest[16];
+		md5.decdigest(digest, sizeof(digest));
+
+		char buf[33];
+		for (int i = 0; i < 16; i++)
+			sprintf(buf + i * 2, "%02x", digest[i]);
+		buf[32] = 0;
+
+		return String(buf);
+	}
 }
\ No newline at end of file
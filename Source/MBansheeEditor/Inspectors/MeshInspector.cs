@@ -24,6 +24,12 @@ namespace BansheeEditor
         private GUIToggleField cpuReadableField;
         private GUIEnumField collisionMeshTypeField;
         private GUIToggleField keyFrameReductionField;
+        private GUIToggleField animCompressionField;
+        private GUIToggleField animBakingField;
+        private GUIEnumField meshOptimizationField;
+        private GUIIntField numLODsField;
+        private GUIFloatField lodReductionField;
+        private GUIEnumField vertexCompressionField;
         private GUIArrayField<AnimationSplitInfo, AnimSplitArrayRow> animSplitInfoField;
         private GUIButton reimportButton;
 
@@ -56,6 +62,12 @@ namespace BansheeEditor
             cpuReadableField.Value = newImportOptions.CPUReadable;
             collisionMeshTypeField.Value = (ulong)newImportOptions.CollisionMeshType;
             keyFrameReductionField.Value = newImportOptions.KeyframeReduction;
+            animCompressionField.Value = newImportOptions.AnimationCompression;
+            animBakingField.Value = newImportOptions.AnimationBaking;
+            meshOptimizationField.Value = (ulong)newImportOptions.MeshOptimization;
+            numLODsField.Value = newImportOptions.NumLODs;
+            lodReductionField.Value = newImportOptions.LODReduction;
+            vertexCompressionField.Value = (ulong)newImportOptions.VertexCompression;
 
             importOptions = newImportOptions;
 
@@ -78,6 +90,15 @@ namespace BansheeEditor
             cpuReadableField = new GUIToggleField(new LocEdString("CPU readable"));
             collisionMeshTypeField = new GUIEnumField(typeof(CollisionMeshType), new LocEdString("Collision mesh"));
             keyFrameReductionField = new GUIToggleField(new LocEdString("Keyframe Reduction"));
+            animCompressionField = new GUIToggleField(new LocEdString("Animation Compression"));
+            animBakingField = new GUIToggleField(new LocEdString("Animation Baking"));
+            meshOptimizationField = new GUIEnumField(typeof(MeshOptimizeFlags), true, new LocEdString("Optimization"));
+            numLODsField = new GUIIntField(new LocEdString("LOD count"));
+            numLODsField.SetRange(0, 8);
+            lodReductionField = new GUIFloatField(new LocEdString("LOD reduction"));
+            lodReductionField.SetRange(0.01f, 0.99f);
+            vertexCompressionField = new GUIEnumField(typeof(VertexCompressionFlags), true, 
+                new LocEdString("Vertex compression"));
             reimportButton = new GUIButton(new LocEdString("Reimport"));
 
             normalsField.OnChanged += x => importOptions.ImportNormals = x;
@@ -89,6 +110,14 @@ namespace BansheeEditor
             cpuReadableField.OnChanged += x => importOptions.CPUReadable = x;
             collisionMeshTypeField.OnSelectionChanged += x => importOptions.CollisionMeshType = (CollisionMeshType)x;
             keyFrameReductionField.OnChanged += x => importOptions.KeyframeReduction = x;
+            animCompressionField.OnChanged += x => importOptions.AnimationCompression = x;
+            animBakingField.OnChanged += x => importOptions.AnimationBaking = x;
+            meshOptimizationField.OnSelectionChanged += 
+                x => importOptions.MeshOptimization = (MeshOptimizeFlags)meshOptimizationField.Value;
+            numLODsField.OnChanged += x => importOptions.NumLODs = x;
+            lodReductionField.OnChanged += x => importOptions.LODReduction = x;
+            vertexCompressionField.OnSelectionChanged += 
+                x => importOptions.VertexCompression = (VertexCompressionFlags)vertexCompressionField.Value;
 
             reimportButton.OnClick += TriggerReimport;
 
@@ -101,6 +130,12 @@ namespace BansheeEditor
             Layout.AddElement(cpuReadableField);
             Layout.AddElement(collisionMeshTypeField);
             Layout.AddElement(keyFrameReductionField);
+            Layout.AddElement(animCompressionField);
+            Layout.AddElement(animBakingField);
+            Layout.AddElement(meshOptimizationField);
+            Layout.AddElement(numLODsField);
+            Layout.AddElement(lodReductionField);
+            Layout.AddElement(vertexCompressionField);
 
             splitInfos = importOptions.AnimationClipSplits;
 
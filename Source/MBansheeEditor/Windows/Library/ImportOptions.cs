@@ -227,6 +227,68 @@ namespace BansheeEditor
             set { Internal_SetKeyFrameReduction(mCachedPtr, value); }
         }
 
+        /// <summary>
+        /// Determines if animation compression is enabled. Compressed animation clips have keyframes that don't noticeably
+        /// contribute to the animation removed, and the remaining keyframes stored in quantized form. This reduces the 
+        /// memory used by the clip and speeds up its evaluation, at the cost of a small loss of precision.
+        /// </summary>
+        public bool AnimationCompression
+        {
+            get { return Internal_GetAnimationCompression(mCachedPtr); }
+            set { Internal_SetAnimationCompression(mCachedPtr, value); }
+        }
+
+        /// <summary>
+        /// Determines if animation baking is enabled. Baked animation clips have their curves pre-sampled at the clip's
+        /// sample rate, so evaluating them takes constant time regardless of playback direction or seeking. This speeds
+        /// up evaluation at the cost of additional memory, and a small loss of precision between the samples.
+        /// </summary>
+        public bool AnimationBaking
+        {
+            get { return Internal_GetAnimationBaking(mCachedPtr); }
+            set { Internal_SetAnimationBaking(mCachedPtr, value); }
+        }
+
+        /// <summary>
+        /// Determines which optimizations are performed on the imported mesh. Optimized meshes have their triangles and
+        /// vertices reordered (and optionally duplicate vertices merged) so they are cheaper to render.
+        /// </summary>
+        public MeshOptimizeFlags MeshOptimization
+        {
+            get { return (MeshOptimizeFlags)Internal_GetMeshOptimization(mCachedPtr); }
+            set { Internal_SetMeshOptimization(mCachedPtr, (int)value); }
+        }
+
+        /// <summary>
+        /// Number of simplified levels of detail to generate for the mesh, not counting the original mesh. Lower levels
+        /// of detail are used for rendering the mesh when it takes up a small portion of the screen. Zero disables level
+        /// of detail generation.
+        /// </summary>
+        public int NumLODs
+        {
+            get { return Internal_GetNumLODs(mCachedPtr); }
+            set { Internal_SetNumLODs(mCachedPtr, value); }
+        }
+
+        /// <summary>
+        /// Ratio of the number of triangles in each level of detail compared to the previous level, in range (0, 1).
+        /// </summary>
+        public float LODReduction
+        {
+            get { return Internal_GetLODReduction(mCachedPtr); }
+            set { Internal_SetLODReduction(mCachedPtr, value); }
+        }
+
+        /// <summary>
+        /// Determines which vertex attributes are quantized into smaller formats, reducing the memory used by the mesh 
+        /// and the bandwidth required for rendering it, at the cost of some precision.
+        /// </summary>
+        public VertexCompressionFlags VertexCompression
+        {
+            get { return (VertexCompressionFlags)Internal_GetVertexCompression(mCachedPtr); }
+            set { Internal_SetVertexCompression(mCachedPtr, (int)value); }
+        }
+
         /// <summary>
         /// Controls what type (if any) of collision mesh should be imported.
         /// </summary>
@@ -301,6 +363,42 @@ namespace BansheeEditor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_SetKeyFrameReduction(IntPtr thisPtr, bool value);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_GetAnimationCompression(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetAnimationCompression(IntPtr thisPtr, bool value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_GetAnimationBaking(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetAnimationBaking(IntPtr thisPtr, bool value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern int Internal_GetMeshOptimization(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetMeshOptimization(IntPtr thisPtr, int value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern int Internal_GetNumLODs(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetNumLODs(IntPtr thisPtr, int value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern float Internal_GetLODReduction(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetLODReduction(IntPtr thisPtr, float value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern int Internal_GetVertexCompression(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetVertexCompression(IntPtr thisPtr, int value);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern AnimationSplitInfo[] Internal_GetAnimationClipSplits(IntPtr thisPtr);
 
@@ -345,6 +443,36 @@ namespace BansheeEditor
         Convex
     }
 
+    /// <summary>
+    /// Determines which optimizations are performed on a mesh during import. These flags can be combined.
+    /// </summary>
+    [Flags]
+    public enum MeshOptimizeFlags // Note: Must match the C++ enum MeshOptimizeFlag
+    {
+        /// <summary>Merges vertices with identical data into a single vertex.</summary>
+        WeldVertices = 0x01,
+        /// <summary>Reorders triangles so that vertices are more likely to be reused from the GPU vertex cache.</summary>
+        VertexCache = 0x02,
+        /// <summary>Reorders clusters of triangles so that triangles likely to occlude others are drawn first.</summary>
+        Overdraw = 0x04,
+        /// <summary>Reorders vertices in the order they are referenced by the triangles.</summary>
+        VertexFetch = 0x08
+    }
+
+    /// <summary>
+    /// Determines which vertex attributes are quantized into smaller formats during import. These flags can be combined.
+    /// </summary>
+    [Flags]
+    public enum VertexCompressionFlags // Note: Must match the C++ enum VertexCompressionFlag
+    {
+        /// <summary>Stores positions as 16-bit floats, normalized to the mesh bounds.</summary>
+        Position = 0x01,
+        /// <summary>Stores normals and tangents as octahedral encoded pairs of 16-bit normalized integers.</summary>
+        NormalTangent = 0x02,
+        /// <summary>Stores texture coordinates as pairs of 16-bit normalized integers.</summary>
+        UV = 0x04
+    }
+
     /// <summary>
     /// Import options that provide various options for controlling how is a font resource imported.
     /// </summary>
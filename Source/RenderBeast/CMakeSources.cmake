@@ -11,6 +11,7 @@ set(BS_RENDERBEAST_INC_NOFILTER
 	"Include/BsPostProcessing.h"
 	"Include/BsRendererCamera.h"
 	"Include/BsRendererObject.h"
+	"Include/BsShadowRendering.h"
 )
 
 set(BS_RENDERBEAST_SRC_NOFILTER
@@ -24,6 +25,7 @@ set(BS_RENDERBEAST_SRC_NOFILTER
 	"Source/BsLightRendering.cpp"
 	"Source/BsPostProcessing.cpp"
 	"Source/BsRendererCamera.cpp"
+	"Source/BsShadowRendering.cpp"
 )
 
 source_group("Header Files" FILES ${BS_RENDERBEAST_INC_NOFILTER})
@@ -5,6 +5,7 @@
 #include "BsRenderBeastPrerequisites.h"
 #include "BsRendererMaterial.h"
 #include "BsParamBlocks.h"
+#include "BsShadowRendering.h"
 
 namespace BansheeEngine
 {
@@ -19,6 +20,10 @@ namespace BansheeEngine
 		BS_PARAM_BLOCK_ENTRY(Vector3, gLightDirection)
 		BS_PARAM_BLOCK_ENTRY(Vector4, gLightGeometry)
 		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatConeTransform)
+		BS_PARAM_BLOCK_ENTRY_ARRAY(Matrix4, gMatShadow, MAX_SHADOW_CASCADES)
+		BS_PARAM_BLOCK_ENTRY(Vector4, gShadowCascadeSplits)
+		BS_PARAM_BLOCK_ENTRY(Vector4, gShadowCascadeBias)
+		BS_PARAM_BLOCK_ENTRY(Vector4, gShadowParams)
 	BS_PARAM_BLOCK_END
 
 	/** Manipulates parameters used in various light rendering shaders. */
@@ -31,8 +36,13 @@ namespace BansheeEngine
 		void setStaticParameters(const SPtr<RenderTargets>& gbuffer,
 			const SPtr<GpuParamBlockBufferCore>& perCamera);
 
-		/** Updates data in the parameter buffer from the data in the provided light. */
-		void setParameters(const LightCore* light);
+		/** 
+		 * Updates data in the parameter buffer from the data in the provided light. 
+		 *
+		 * @param[in]	light	Light whose parameters to use.
+		 * @param[in]	shadow	Shadow map rendered for the light, or null if the light isn't shadowed.
+		 */
+		void setParameters(const LightCore* light, const ShadowMapInfo* shadow);
 
 		/** Returns the internal parameter buffer that can be bound to the pipeline. */
 		const SPtr<GpuParamBlockBufferCore>& getBuffer() const;
@@ -43,6 +53,8 @@ namespace BansheeEngine
 		GpuParamTextureCore mGBufferA;
 		GpuParamTextureCore mGBufferB;
 		GpuParamTextureCore mGBufferDepth;
+		GpuParamTextureCore mShadowMap;
+		GpuParamSampStateCore mShadowMapSampler;
 		PerLightParamBuffer mBuffer;
 	};
 
@@ -57,8 +69,10 @@ namespace BansheeEngine
 		/** Binds the material for rendering and sets up any global parameters. */
 		void bind(const SPtr<RenderTargets>& gbuffer, const SPtr<GpuParamBlockBufferCore>& perCamera);
 
-		/** Updates the per-light buffers used by the material. */
-		void setPerLightParams(const LightCore* light);
+		/** 
+		 * Updates the per-light buffers used by the material. Provide null for @p shadow if the light is not shadowed.
+		 */
+		void setPerLightParams(const LightCore* light, const ShadowMapInfo* shadow);
 	private:
 		LightRenderingParams mParams;
 	};
@@ -77,8 +91,10 @@ namespace BansheeEngine
 		/** Binds the material for rendering and sets up any global parameters. */
 		void bind(const SPtr<RenderTargets>& gbuffer, const SPtr<GpuParamBlockBufferCore>& perCamera);
 
-		/** Updates the per-light buffers used by the material. */
-		void setPerLightParams(const LightCore* light);
+		/** 
+		 * Updates the per-light buffers used by the material. Provide null for @p shadow if the light is not shadowed.
+		 */
+		void setPerLightParams(const LightCore* light, const ShadowMapInfo* shadow);
 	private:
 		LightRenderingParams mParams;
 	};
@@ -97,8 +113,10 @@ namespace BansheeEngine
 		/** Binds the material for rendering and sets up any global parameters. */
 		void bind(const SPtr<RenderTargets>& gbuffer, const SPtr<GpuParamBlockBufferCore>& perCamera);
 
-		/** Updates the per-light buffers used by the material. */
-		void setPerLightParams(const LightCore* light);
+		/** 
+		 * Updates the per-light buffers used by the material. Provide null for @p shadow if the light is not shadowed.
+		 */
+		void setPerLightParams(const LightCore* light, const ShadowMapInfo* shadow);
 	private:
 		LightRenderingParams mParams;
 	};
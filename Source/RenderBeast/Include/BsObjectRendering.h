@@ -40,6 +40,10 @@ namespace BansheeEngine
 		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatWorldNoScale)
 		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatInvWorldNoScale)
 		BS_PARAM_BLOCK_ENTRY(float, gWorldDeterminantSign)
+		BS_PARAM_BLOCK_ENTRY(float, gOctahedralNormals)
+		BS_PARAM_BLOCK_ENTRY(Vector3, gPositionScale)
+		BS_PARAM_BLOCK_ENTRY(Vector3, gPositionOffset)
+		BS_PARAM_BLOCK_ENTRY(Vector4, gUVScaleOffset)
 	BS_PARAM_BLOCK_END
 
 	/**	Data bound to the shader when rendering a specific renderable object. */
@@ -55,6 +55,9 @@ namespace BansheeEngine
 		struct RendererLight
 		{
 			LightCore* internal;
+
+			/** Shadow map to use when rendering the light for the current camera, or null if not shadowed. Transient. */
+			const ShadowMapInfo* shadowMap = nullptr;
 		};
 
 		/** Renderer information for a single material. */
@@ -174,9 +177,10 @@ namespace BansheeEngine
 		 *							already bound.
 		 * @param[in]	frameInfo	Renderer information specific to this frame.
 		 * @param[in]	viewProj	View projection matrix of the camera the element is being rendered with.
+		 * @param[in]	lod			Level of detail of the element's mesh to render.
 		 */
 		void renderElement(const BeastRenderableElement& element, UINT32 passIdx, bool bindPass, 
-			const RendererFrame& frameInfo, const Matrix4& viewProj);
+			const RendererFrame& frameInfo, const Matrix4& viewProj, UINT32 lod);
 
 		/**	Creates data used by the renderer on the core thread. */
 		void initializeCore();
@@ -227,6 +231,7 @@ namespace BansheeEngine
 		DirectionalLightMat* mDirLightMat;
 
 		ObjectRenderer* mObjectRenderer;
+		ShadowRenderer* mShadowRenderer;
 
 		// Sim thread only fields
 		SPtr<RenderBeastOptions> mOptions;
@@ -39,6 +39,37 @@ namespace BansheeEngine
 		 * changes. Sorting by material can reduce CPU usage but could increase overdraw.
 		 */
 		StateReduction stateReductionMode = StateReduction::Distance;
+
+		/**
+		 * Determines should renderables hidden behind occluders be culled. Occluders are renderables with occluder
+		 * geometry assigned (see Renderable::setOccluder()). Culling is performed on the CPU using a low resolution depth
+		 * buffer.
+		 */
+		bool occlusionCulling = true;
+
+		/** 
+		 * Width of the depth buffer used for occlusion culling, in pixels. Higher resolution culls more precisely but
+		 * costs more CPU time. Only relevant if #occlusionCulling is enabled.
+		 */
+		UINT32 occlusionBufferWidth = 256;
+
+		/** Height of the depth buffer used for occlusion culling, in pixels. See #occlusionBufferWidth. */
+		UINT32 occlusionBufferHeight = 128;
+
+		/** 
+		 * Width and height of shadow maps rendered for shadow casting lights, in pixels. Directional lights use this
+		 * resolution for each of their cascades.
+		 */
+		UINT32 shadowMapSize = 1024;
+
+		/** 
+		 * Number of cascades the view frustum is split in when rendering directional light shadows. More cascades yield
+		 * higher shadow resolution near the viewer, at the cost of more shadow rendering. In range [1, 4].
+		 */
+		UINT32 numShadowCascades = 4;
+
+		/** Distance from the viewer up to which directional light shadows are rendered. */
+		float shadowDistance = 100.0f;
 	};
 
 	/** @} */
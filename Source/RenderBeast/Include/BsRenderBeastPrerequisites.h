@@ -36,4 +36,6 @@ namespace BansheeEngine
 	struct RenderBeastOptions;
 	struct PooledRenderTexture;
 	class RenderTargets;
+	class ShadowRenderer;
+	struct ShadowMapInfo;
 }
\ No newline at end of file
@@ -14,67 +14,6 @@ namespace BansheeEngine
 	 */
 
 	class RenderTexturePool;
-	struct POOLED_RENDER_TEXTURE_DESC;
-
-	/**	Contains data about a single render texture in the texture pool. */
-	struct PooledRenderTexture
-	{
-		PooledRenderTexture(RenderTexturePool* pool);
-		~PooledRenderTexture();
-
-		SPtr<TextureCore> texture;
-		SPtr<RenderTextureCore> renderTexture;
-
-	private:
-		friend class RenderTexturePool;
-
-		RenderTexturePool* mPool;
-		bool mIsFree;
-	};
-
-	/** Contains a pool of render textures meant to accommodate reuse of render textures of the same size and format. */
-	class RenderTexturePool : public Module<RenderTexturePool>
-	{
-	public:
-		~RenderTexturePool();
-
-		/**
-		 * Attempts to find the unused render texture with the specified parameters in the pool, or creates a new texture
-		 * otherwise. When done with the texture make sure to call release().
-		 *
-		 * @param[in]	desc		Descriptor structure that describes what kind of texture to retrieve.
-		 */
-		SPtr<PooledRenderTexture> get(const POOLED_RENDER_TEXTURE_DESC& desc);
-
-		/**
-		 * Releases a texture previously allocated with get(). The texture is returned to the pool so that it may be reused
-		 * later.
-		 *			
-		 * @note	
-		 * The texture will be removed from the pool if the last reference to it is deleted. Normally you would call 
-		 * release() but keep a reference if you plan on using it later on.
-		 */
-		void release(const SPtr<PooledRenderTexture>& texture);
-
-	private:
-		friend struct PooledRenderTexture;
-
-		/**	Registers a newly created render texture in the pool. */
-		void _registerTexture(const SPtr<PooledRenderTexture>& texture);
-
-		/**	Unregisters a created render texture in the pool. */
-		void _unregisterTexture(PooledRenderTexture* texture);
-
-		/**
-		 * Checks does the provided texture match the parameters.
-		 * 
-		 * @param[in]	desc	Descriptor structure that describes what kind of texture to match.
-		 * @return				True if the texture matches the descriptor, false otherwise.
-		 */
-		static bool matches(const SPtr<TextureCore>& texture, const POOLED_RENDER_TEXTURE_DESC& desc);
-
-		Map<PooledRenderTexture*, std::weak_ptr<PooledRenderTexture>> mTextures;
-	};
 
 	/** Structure used for creating a new pooled render texture. */
 	struct POOLED_RENDER_TEXTURE_DESC
@@ -121,6 +60,20 @@ namespace BansheeEngine
 		static POOLED_RENDER_TEXTURE_DESC createCube(PixelFormat format, UINT32 width, UINT32 height,
 			INT32 usage = TU_STATIC);
 
+		/** Generates a hash value from the descriptor. */
+		class HashFunction
+		{
+		public:
+			size_t operator()(const POOLED_RENDER_TEXTURE_DESC& key) const;
+		};
+
+		/** Checks are two descriptors describing the same texture. */
+		class EqualFunction
+		{
+		public:
+			bool operator()(const POOLED_RENDER_TEXTURE_DESC& a, const POOLED_RENDER_TEXTURE_DESC& b) const;
+		};
+
 	private:
 		friend class RenderTexturePool;
 
@@ -134,5 +87,86 @@ namespace BansheeEngine
 		bool hwGamma;
 	};
 
+	/**	Contains data about a single render texture in the texture pool. */
+	struct PooledRenderTexture
+	{
+		PooledRenderTexture(RenderTexturePool* pool);
+		~PooledRenderTexture();
+
+		SPtr<TextureCore> texture;
+		SPtr<RenderTextureCore> renderTexture;
+
+	private:
+		friend class RenderTexturePool;
+
+		RenderTexturePool* mPool;
+		POOLED_RENDER_TEXTURE_DESC mDesc;
+		UINT32 mMemorySize;
+		bool mIsFree;
+	};
+
+	/** 
+	 * Contains a pool of render textures meant to accommodate reuse of render textures of the same size and format. A
+	 * released texture is only reused by later requests with the same descriptor.
+	 */
+	class RenderTexturePool : public Module<RenderTexturePool>
+	{
+	public:
+		~RenderTexturePool();
+
+		/**
+		 * Attempts to find the unused render texture with the specified parameters in the pool, or creates a new texture
+		 * otherwise. When done with the texture make sure to call release().
+		 *
+		 * @param[in]	desc		Descriptor structure that describes what kind of texture to retrieve.
+		 */
+		SPtr<PooledRenderTexture> get(const POOLED_RENDER_TEXTURE_DESC& desc);
+
+		/**
+		 * Releases a texture previously allocated with get(). The texture is returned to the pool so that it may be reused
+		 * later.
+		 *			
+		 * @note	
+		 * The texture will be removed from the pool if the last reference to it is deleted. Normally you would call 
+		 * release() but keep a reference if you plan on using it later on.
+		 */
+		void release(const SPtr<PooledRenderTexture>& texture);
+
+		/** Returns the amount of memory used by all textures in the pool, whether in use or not, in bytes. */
+		UINT64 getAllocatedMemory() const { return mAllocatedMemory; }
+
+		/** Returns the amount of memory used by textures retrieved from the pool and not yet released, in bytes. */
+		UINT64 getUsedMemory() const { return mUsedMemory; }
+
+		/** 
+		 * Returns the highest amount of memory used by textures in use at the same time, since the last call to 
+		 * beginFrame(), in bytes. 
+		 */
+		UINT64 getPeakUsedMemory() const { return mPeakUsedMemory; }
+
+		/** Starts tracking memory for a new frame. Resets the peak memory counter to the currently used memory. */
+		void beginFrame() { mPeakUsedMemory = mUsedMemory; }
+
+	private:
+		friend struct PooledRenderTexture;
+
+		/**	Registers a newly created render texture in the pool. */
+		void _registerTexture(const SPtr<PooledRenderTexture>& texture);
+
+		/**	Unregisters a created render texture in the pool. */
+		void _unregisterTexture(PooledRenderTexture* texture);
+
+		/** Calculates the amount of GPU memory used by a texture created from the provided descriptor, in bytes. */
+		static UINT32 getMemorySize(const POOLED_RENDER_TEXTURE_DESC& desc);
+
+		UnorderedMap<PooledRenderTexture*, std::weak_ptr<PooledRenderTexture>> mTextures;
+		UnorderedMap<POOLED_RENDER_TEXTURE_DESC, Vector<PooledRenderTexture*>, POOLED_RENDER_TEXTURE_DESC::HashFunction,
+			POOLED_RENDER_TEXTURE_DESC::EqualFunction> mFreeTextures;
+
+		UINT64 mAllocatedMemory = 0;
+		UINT64 mUsedMemory = 0;
+		UINT64 mPeakUsedMemory = 0;
+	};
+
 	/** @} */
 }
\ No newline at end of file
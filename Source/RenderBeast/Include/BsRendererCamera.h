@@ -8,6 +8,8 @@
 #include "BsRenderQueue.h"
 #include "BsRendererObject.h"
 #include "BsBounds.h"
+#include "BsConvexVolume.h"
+#include "BsOcclusionCulling.h"
 
 namespace BansheeEngine
 {
@@ -20,10 +22,10 @@ namespace BansheeEngine
 	{
 	public:
 		RendererCamera();
-		RendererCamera(const CameraCore* camera, StateReduction reductionMode);
+		RendererCamera(const CameraCore* camera, const RenderBeastOptions& options);
 
-		/** Updates the internal camera data, usually called after source camera changes. */
-		void update(StateReduction reductionMode);
+		/** Updates the internal camera data, usually called after source camera or renderer options change. */
+		void update(const RenderBeastOptions& options);
 
 		/** Updates the internal camera post-processing data. */
 		void updatePP();
@@ -55,7 +57,10 @@ namespace BansheeEngine
 		const SPtr<RenderQueue>& getTransparentQueue() const { return mTransparentQueue; }
 
 		/**
-		 * Populates camera render queues by determining visible renderable objects. 
+		 * Populates camera render queues by determining visible renderable objects. Queues are retained between calls
+		 * and only rebuilt if they were invalidated (see invalidateQueues()). If only a small number of renderables were
+		 * updated since the last call (see notifyRenderableUpdated()), only their entries are moved within the sorted
+		 * queues. If occlusion culling is enabled, renderables hidden behind occluders are excluded from the queues.
 		 *
 		 * @param[in]	renderables			A set of renderable objects to iterate over and determine visibility for.
 		 * @param[in]	renderableBounds	A set of world bounds for the provided renderable objects. Must be the same size
@@ -68,6 +73,26 @@ namespace BansheeEngine
 		void determineVisible(Vector<RendererObject>& renderables, const Vector<Bounds>& renderableBounds, 
 			Vector<bool>& visibility);
 
+		/** 
+		 * Marks the cached render queues as out of date, forcing them to be fully rebuilt on the next call to
+		 * determineVisible(). Must be called whenever the camera transform changes, or whenever renderables are added or
+		 * removed, as queues reference renderable elements directly.
+		 */
+		void invalidateQueues() { mQueuesDirty = true; }
+
+		/** 
+		 * Notifies the camera that the renderable with the specified renderer ID changed (e.g. it moved), requiring its
+		 * visibility to be re-evaluated on the next call to determineVisible().
+		 */
+		void notifyRenderableUpdated(UINT32 rendererId);
+
+		/** 
+		 * Returns the level of detail of the mesh to render the renderable with the specified renderer ID with, as
+		 * selected during the last call to determineVisible(). Levels are selected based on the size of the renderable
+		 * on screen. Zero represents the full detail mesh.
+		 */
+		UINT32 getLOD(UINT32 rendererId) const { return rendererId < mCachedLODs.size() ? mCachedLODs[rendererId] : 0; }
+
 		/** 
 		 * Returns a structure containing information about post-processing effects. This structure will be modified and
 		 * maintained by the post-processing system.
@@ -88,10 +113,62 @@ namespace BansheeEngine
 		 */
 		Vector2 getDeviceZTransform(const Matrix4& projMatrix) const;
 
+		/** 
+		 * Checks if the renderable with the specified index is visible by the camera, by testing its layer and bounds
+		 * against the camera's layers and frustum.
+		 */
+		bool isVisible(const RendererObject& renderable, const Bounds& bounds, UINT64 cameraLayers, 
+			const ConvexVolume& worldFrustum) const;
+
+		/** 
+		 * Clears and re-populates the render queues from the cached visibility of all renderables, and sorts them. Does not
+		 * perform any culling.
+		 */
+		void rebuildQueues(Vector<RendererObject>& renderables, const Vector<Bounds>& renderableBounds);
+
+		/** 
+		 * Adds all elements of the renderable with the specified index to the render queues and selects its level of 
+		 * detail. If @p keepSorted is true the elements are inserted at their sorted positions, otherwise the queues
+		 * must be sorted afterwards.
+		 */
+		void queueRenderable(RendererObject& renderable, const Bounds& bounds, UINT32 idx, bool keepSorted);
+
+		/** Removes all elements of the provided renderable from the render queues. */
+		void dequeueRenderable(RendererObject& renderable);
+
+		/** 
+		 * Selects the mesh level of detail for the renderable with the specified index, from its bounds projected on
+		 * screen. The level only changes once the projected size moves sufficiently past the level's threshold, so
+		 * renderables near the threshold don't keep switching levels.
+		 */
+		void updateLOD(const RendererObject& renderable, const Bounds& bounds, UINT32 idx);
+
+		/** Checks if any of the materials referenced by the render queues changed since they were populated. */
+		bool haveMaterialsChanged() const;
+
+		/** 
+		 * Rasterizes all occluders visible by the camera into the occlusion buffer. Returns false if occlusion culling is
+		 * disabled or there are no visible occluders.
+		 */
+		bool renderOccluders(const Vector<RendererObject>& renderables);
+
 		const CameraCore* mCamera;
 		SPtr<RenderQueue> mOpaqueQueue;
 		SPtr<RenderQueue> mTransparentQueue;
 
+		bool mQueuesDirty;
+		Vector<bool> mCachedVisibility;
+		Vector<bool> mCachedOcclusion;
+		Vector<UINT32> mVisibleRenderables;
+		Vector<UINT32> mCachedLODs;
+		Vector<UINT32> mDirtyRenderables;
+		UnorderedMap<const MaterialCore*, UINT32> mQueuedMaterialVersions;
+
+		bool mOcclusionCulling;
+		bool mHasOccluders;
+		UINT32 mNumOccluded;
+		SPtr<OcclusionBuffer> mOcclusionBuffer;
+
 		SPtr<RenderTargets> mRenderTargets;
 		PostProcessInfo mPostProcessInfo;
 		bool mUsingRenderTargets;
@@ -12,6 +12,7 @@ namespace BansheeEngine
 	 */
 
 	struct MaterialSamplerOverrides;
+	struct OccluderGeometry;
 
 	/**
 	 * @copydoc	RenderableElement
@@ -33,6 +34,9 @@ namespace BansheeEngine
 		/**	Identifier of the owner renderable. */
 		UINT32 renderableId;
 
+		/** Index of the mesh's sub-mesh the element renders. Used for retrieving the sub-mesh at other levels of detail. */
+		UINT32 subMeshIdx;
+
 		/** Identifier of the animation running on the renderable's mesh. -1 if no animation. */
 		UINT64 animationId;
 
@@ -46,6 +50,12 @@ namespace BansheeEngine
 
 		/** GPU buffer containing element's bone matrices, if it requires any. */
 		SPtr<GpuBufferCore> boneMatrixBuffer;
+
+		/** 
+		 * GPU buffer to render the element with. Normally equal to @p boneMatrixBuffer, unless the element's animation
+		 * shares its pose with another animation, in which case it references the buffer the pose was uploaded to.
+		 */
+		SPtr<GpuBufferCore> activeBoneMatrixBuffer;
 	};
 
 	 /** Contains information about a Renderable, used by the Renderer. */
@@ -53,6 +63,9 @@ namespace BansheeEngine
 	{
 		RenderableCore* renderable;
 		Vector<BeastRenderableElement> elements;
+
+		/** Geometry to render into the occlusion buffer, if the renderable is an occluder. Null otherwise. */
+		SPtr<OccluderGeometry> occluder;
 	};
 
 	/** @} */
@@ -0,0 +1,195 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "BsRendererMaterial.h"
+#include "BsParamBlocks.h"
+#include "BsMatrix4.h"
+#include "BsBounds.h"
+#include "BsQuaternion.h"
+
+namespace BansheeEngine
+{
+	struct RendererObject;
+
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	/** Maximum number of cascades a directional light shadow map can be split in. */
+	static const UINT32 MAX_SHADOW_CASCADES = 4;
+
+	BS_PARAM_BLOCK_BEGIN(ShadowParamBuffer)
+		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatWorldViewProj)
+	BS_PARAM_BLOCK_END
+
+	/** Shader that renders depth of shadow casters into a shadow map. */
+	class ShadowDepthMat : public RendererMaterial<ShadowDepthMat>
+	{
+		RMAT_DEF("ShadowDepth.bsl");
+
+	public:
+		ShadowDepthMat();
+
+		/** Binds the material for rendering. */
+		void bind();
+
+		/** Updates the transform of the object about to be rendered. Material must be bound. */
+		void setPerObjectParams(const Matrix4& worldViewProj);
+	private:
+		ShadowParamBuffer mParams;
+	};
+
+	/**
+	 * Shadow map rendered for a single light. Directional lights store multiple cascades side by side in the same
+	 * texture.
+	 */
+	struct ShadowMapInfo
+	{
+		/** Texture containing the depth of the shadow casters, in render API specific normalized device coordinates. */
+		SPtr<PooledRenderTexture> texture;
+
+		/** Depth buffer the shadow map was last rendered with. Kept so the pool can hand it out again on re-render. */
+		SPtr<PooledRenderTexture> depthTexture;
+
+		/** Render target combining @p texture and @p depthTexture. Only rebuilt when either of them changes. */
+		SPtr<RenderTextureCore> renderTarget;
+
+		/** Transforms from world space into normalized device coordinates of each cascade. */
+		Matrix4 shadowTransforms[MAX_SHADOW_CASCADES];
+
+		/** View space distance at which each cascade ends. */
+		float cascadeSplits[MAX_SHADOW_CASCADES];
+
+		/** Depth bias to apply to receivers of each cascade, in normalized device coordinates. */
+		float cascadeBias[MAX_SHADOW_CASCADES];
+
+		/** 
+		 * World space bounds of each cascade, snapped so they only change once the view moves by a noticeable amount. For
+		 * spot lights this contains the bounds of the light.
+		 */
+		Sphere cascadeBounds[MAX_SHADOW_CASCADES];
+
+		/** Rotation of the light the cascades were fitted with. */
+		Quaternion lightRotation;
+
+		/** True if the shadow map belongs to a directional light. */
+		bool isDirectional = false;
+
+		/** True if a caster within the bounds, the light or the shadow options changed since the map was last rendered. */
+		bool isDirty = true;
+
+		/** Number of cascades in the shadow map. Zero if the light shouldn't be shadowed. */
+		UINT32 numCascades = 0;
+
+		/** Width and height of a single cascade, in pixels. */
+		UINT32 size = 0;
+
+		/** Index of the frame the shadow map was last used in. */
+		UINT64 lastUsedFrame = 0;
+	};
+
+	/**
+	 * Renders and keeps track of shadow maps for shadow casting lights. Shadow maps are retained between frames and only
+	 * re-rendered when the light or a shadow caster within its bounds changes, or when the view moves enough to change
+	 * the bounds of the directional light cascades.
+	 *
+	 * Directional lights use cascaded shadow maps fitted to the view frustum of each camera, while spot lights use a
+	 * single perspective shadow map independent of the camera. Radial point lights are not shadowed.
+	 */
+	class ShadowRenderer
+	{
+		/** Key identifying a shadow map. Camera is null for lights whose shadow map doesn't depend on the view. */
+		typedef std::pair<const LightCore*, const CameraCore*> ShadowMapKey;
+
+	public:
+		ShadowRenderer();
+		~ShadowRenderer();
+
+		/** Updates options controlling the shadow map resolution, number of cascades and the shadowed distance. */
+		void setOptions(const RenderBeastOptions& options);
+
+		/**
+		 * Retrieves a shadow map for the provided light as seen by the provided camera, rendering it if it isn't up to date.
+		 *
+		 * @param[in]	light			Light to render the shadow map for.
+		 * @param[in]	camera			Camera the shadow map will be used with.
+		 * @param[in]	renderables		All renderables in the scene, that are potential shadow casters.
+		 * @param[in]	worldBounds		World bounds of each renderable in @p renderables.
+		 * @return						Up-to-date shadow map, or null if the light doesn't cast shadows.
+		 *
+		 * @note	Changes the bound render target and viewport.
+		 */
+		const ShadowMapInfo* getShadowMap(const LightCore* light, const CameraCore* camera,
+			const Vector<RendererObject>& renderables, const Vector<Bounds>& worldBounds);
+
+		/** Releases shadow maps that haven't been used for a while. Should be called once per frame. */
+		void endFrame();
+
+		/** Releases all shadow maps of the provided light. */
+		void notifyLightRemoved(const LightCore* light);
+
+		/** Releases all shadow maps rendered for the provided camera. */
+		void notifyCameraRemoved(const CameraCore* camera);
+
+		/** Marks all shadow maps of the provided light as requiring a re-render. */
+		void notifyLightUpdated(const LightCore* light);
+
+		/** 
+		 * Marks all shadow maps whose bounds intersect the provided bounds as requiring a re-render. Should be called with
+		 * both the old and the new bounds whenever a renderable is added, removed or moved.
+		 */
+		void notifyRenderableUpdated(const RendererObject& renderable, const Bounds& bounds);
+
+	private:
+		/**
+		 * Calculates the cascade split distances and the bounds of each cascade for a directional light.
+		 *
+		 * @return	True if the bounds of any cascade changed since the last call.
+		 */
+		bool setupDirectional(const LightCore* light, const CameraCore* camera, ShadowMapInfo& info);
+
+		/**
+		 * Calculates the shadow transform and bounds for a spot light.
+		 *
+		 * @return	True if the bounds of the light changed since the last call.
+		 */
+		bool setupSpot(const LightCore* light, ShadowMapInfo& info);
+
+		/** 
+		 * Finds shadow casters within the bounds of each cascade. For directional lights also calculates the per-cascade
+		 * transforms, with the depth range fitted to the casters.
+		 */
+		void findCasters(ShadowMapInfo& info, const Vector<RendererObject>& renderables, 
+			const Vector<Bounds>& worldBounds);
+
+		/** Renders shadow casters found by the last findCasters() call into the provided shadow map. */
+		void render(ShadowMapInfo& info, const Vector<RendererObject>& renderables);
+
+		/** 
+		 * Checks can an object with the provided bounds cast a shadow into the cascade. Objects outside of a directional
+		 * cascade can still cast a shadow into it if they are between the cascade and the light, so for directional
+		 * lights the cascade bounds are extruded towards the light.
+		 */
+		static bool intersectsCascade(const ShadowMapInfo& info, UINT32 cascadeIdx, const Sphere& bounds);
+
+		/** Checks can any element of the renderable cast a shadow. */
+		static bool isShadowCaster(const RendererObject& renderable);
+
+		/** Number of frames an unused shadow map is kept around, before its texture is released. */
+		static const UINT32 MAX_UNUSED_FRAMES;
+
+		ShadowDepthMat* mDepthMat;
+		Map<ShadowMapKey, ShadowMapInfo> mShadowMaps;
+
+		UINT32 mShadowMapSize;
+		UINT32 mNumCascades;
+		float mShadowDistance;
+		UINT64 mFrameIdx;
+
+		Vector<UINT32> mCasters[MAX_SHADOW_CASCADES]; // Transient
+	};
+
+	/** @} */
+}
@@ -9,6 +9,8 @@
 #include "BsGpuParamsSet.h"
 #include "BsLight.h"
 #include "BsRendererUtility.h"
+#include "BsRenderTexturePool.h"
+#include "BsSamplerState.h"
 
 namespace BansheeEngine
 {
@@ -27,6 +29,20 @@ namespace BansheeEngine
 			else if (entry.second.rendererSemantic == RPS_GBufferDepth)
 				fragmentParams->getTextureParam(entry.second.name, mGBufferDepth);
 		}
+
+		fragmentParams->getTextureParam("gShadowMapTex", mShadowMap);
+		fragmentParams->getSamplerStateParam("gShadowMapSamp", mShadowMapSampler);
+
+		// Shadow map contains depth values which must not be filtered, and must not repeat outside of each cascade
+		SAMPLER_STATE_DESC samplerDesc;
+		samplerDesc.minFilter = FO_POINT;
+		samplerDesc.magFilter = FO_POINT;
+		samplerDesc.mipFilter = FO_POINT;
+		samplerDesc.addressMode.u = TAM_CLAMP;
+		samplerDesc.addressMode.v = TAM_CLAMP;
+		samplerDesc.addressMode.w = TAM_CLAMP;
+
+		mShadowMapSampler.set(SamplerStateCore::create(samplerDesc));
 	}
 
 	void LightRenderingParams::setStaticParameters(const SPtr<RenderTargets>& gbuffer, 
@@ -42,7 +58,7 @@ namespace BansheeEngine
 		gRendererUtility().setPassParams(mParamsSet);
 	}
 
-	void LightRenderingParams::setParameters(const LightCore* light)
+	void LightRenderingParams::setParameters(const LightCore* light, const ShadowMapInfo* shadow)
 	{
 		// Note: I could just copy the data directly to the parameter buffer if I ensured the parameter
 		// layout matches
@@ -98,6 +114,34 @@ namespace BansheeEngine
 		Matrix4 transform = Matrix4::TRS(light->getPosition(), light->getRotation(), Vector3::ONE);
 		mBuffer.gMatConeTransform.set(transform);
 
+		Vector4 shadowParams(0.0f, 0.0f, 0.0f, 0.0f);
+		if (shadow != nullptr && shadow->numCascades > 0)
+		{
+			Vector4 cascadeSplits;
+			Vector4 cascadeBias;
+			for (UINT32 i = 0; i < MAX_SHADOW_CASCADES; i++)
+			{
+				UINT32 cascadeIdx = std::min(i, shadow->numCascades - 1);
+
+				mBuffer.gMatShadow.set(shadow->shadowTransforms[cascadeIdx], i);
+				cascadeSplits[i] = shadow->cascadeSplits[cascadeIdx];
+				cascadeBias[i] = shadow->cascadeBias[cascadeIdx];
+			}
+
+			mBuffer.gShadowCascadeSplits.set(cascadeSplits);
+			mBuffer.gShadowCascadeBias.set(cascadeBias);
+
+			shadowParams.x = (float)shadow->numCascades;
+			shadowParams.z = 1.0f / shadow->numCascades;
+			shadowParams.w = 1.0f / shadow->size;
+
+			mShadowMap.set(shadow->texture->texture);
+
+			// Texture binding changes per-light, unlike the rest of the parameters which are in the buffer
+			gRendererUtility().setPassParams(mParamsSet);
+		}
+
+		mBuffer.gShadowParams.set(shadowParams);
 		mBuffer.flushToGPU();
 	}
 
@@ -124,9 +168,9 @@ namespace BansheeEngine
 		mParams.setStaticParameters(gbuffer, perCamera);
 	}
 
-	void DirectionalLightMat::setPerLightParams(const LightCore* light)
+	void DirectionalLightMat::setPerLightParams(const LightCore* light, const ShadowMapInfo* shadow)
 	{
-		mParams.setParameters(light);
+		mParams.setParameters(light, shadow);
 	}
 
 	PointLightInMat::PointLightInMat()
@@ -147,9 +191,9 @@ namespace BansheeEngine
 		mParams.setStaticParameters(gbuffer, perCamera);
 	}
 
-	void PointLightInMat::setPerLightParams(const LightCore* light)
+	void PointLightInMat::setPerLightParams(const LightCore* light, const ShadowMapInfo* shadow)
 	{
-		mParams.setParameters(light);
+		mParams.setParameters(light, shadow);
 	}
 
 	PointLightOutMat::PointLightOutMat()
@@ -170,8 +214,8 @@ namespace BansheeEngine
 		mParams.setStaticParameters(gbuffer, perCamera);
 	}
 
-	void PointLightOutMat::setPerLightParams(const LightCore* light)
+	void PointLightOutMat::setPerLightParams(const LightCore* light, const ShadowMapInfo* shadow)
 	{
-		mParams.setParameters(light);
+		mParams.setParameters(light, shadow);
 	}
 }
\ No newline at end of file
@@ -72,6 +72,7 @@ namespace BansheeEngine
 				buffer->unlock();
 
 				element.boneMatrixBuffer = buffer;
+				element.activeBoneMatrixBuffer = buffer;
 			}
 		}
 	}
@@ -109,6 +110,13 @@ namespace BansheeEngine
 		mPerObjectParams.gWorldDeterminantSign.set(data.worldDeterminantSign);
 		mPerObjectParams.gMatWorldViewProj.set(wvpMatrix);
 
+		const MeshVertexCompression& compression = element.mesh->getProperties().getVertexCompression();
+		mPerObjectParams.gOctahedralNormals.set(compression.octahedralNormals ? 1.0f : 0.0f);
+		mPerObjectParams.gPositionScale.set(compression.positionScale);
+		mPerObjectParams.gPositionOffset.set(compression.positionOffset);
+		mPerObjectParams.gUVScaleOffset.set(Vector4(compression.uvScale.x, compression.uvScale.y, 
+			compression.uvOffset.x, compression.uvOffset.y));
+
 		element.boneMatricesParam.set(boneMatrices);
 	}
 
@@ -29,6 +29,9 @@
 #include "BsSkeleton.h"
 #include "BsGpuBuffer.h"
 #include "BsGpuParamsSet.h"
+#include "BsOcclusionCulling.h"
+#include "BsShadowRendering.h"
+#include "BsRenderStats.h"
 
 using namespace std::placeholders;
 
@@ -40,7 +43,7 @@ namespace BansheeEngine
 
 	RenderBeast::RenderBeast()
 		: mDefaultMaterial(nullptr), mPointLightInMat(nullptr), mPointLightOutMat(nullptr), mDirLightMat(nullptr)
-		, mObjectRenderer(nullptr), mOptions(bs_shared_ptr_new<RenderBeastOptions>()), mOptionsDirty(true)
+		, mObjectRenderer(nullptr), mShadowRenderer(nullptr), mOptions(bs_shared_ptr_new<RenderBeastOptions>()), mOptionsDirty(true)
 	{ }
 
 	const StringID& RenderBeast::getName() const
@@ -78,6 +81,9 @@ namespace BansheeEngine
 
 		RenderTexturePool::startUp();
 		PostProcessing::startUp();
+
+		mShadowRenderer = bs_new<ShadowRenderer>();
+		mShadowRenderer->setOptions(*mCoreOptions);
 	}
 
 	void RenderBeast::destroyCore()
@@ -90,6 +96,10 @@ namespace BansheeEngine
 		mRenderables.clear();
 		mVisibility.clear();
 
+		// Must be destroyed before the pool, as it holds on to pooled shadow map textures
+		if (mShadowRenderer != nullptr)
+			bs_delete(mShadowRenderer);
+
 		PostProcessing::shutDown();
 		RenderTexturePool::shutDown();
 
@@ -109,6 +119,10 @@ namespace BansheeEngine
 
 		renderable->setRendererId(renderableId);
 
+		// Adding may relocate existing renderable elements, which are referenced by the cached camera render queues
+		for (auto& entry : mCameras)
+			entry.second.invalidateQueues();
+
 		mRenderables.push_back(RendererObject());
 		mRenderableShaderData.push_back(RenderableShaderData());
 		mWorldBounds.push_back(renderable->getBounds());
@@ -117,6 +131,10 @@ namespace BansheeEngine
 		RendererObject& rendererObject = mRenderables.back();
 		rendererObject.renderable = renderable;
 
+		SPtr<MeshData> occluder = renderable->getOccluder();
+		if (occluder != nullptr)
+			rendererObject.occluder = OccluderGeometry::create(*occluder);
+
 		RenderableShaderData& shaderData = mRenderableShaderData.back();
 		shaderData.worldTransform = renderable->getTransform();
 		shaderData.invWorldTransform = shaderData.worldTransform.inverseAffine();
@@ -137,6 +155,7 @@ namespace BansheeEngine
 
 				renElement.mesh = mesh;
 				renElement.subMesh = meshProps.getSubMesh(i);
+				renElement.subMeshIdx = i;
 				renElement.renderableId = renderableId;
 				renElement.animationId = renderable->getAnimationId();
 
@@ -195,7 +214,7 @@ namespace BansheeEngine
 					matInfo.params[techniqueIdx] = renElement.material->createParamsSet(techniqueIdx);
 					matInfo.matVersion = renElement.material->getVersion();
 
-					renElement.material->updateParamsSet(matInfo.params[techniqueIdx], techniqueIdx, true);
+					renElement.material->updateParamsSet(matInfo.params[techniqueIdx], true);
 					renElement.material->setRendererData(matInfo);
 					renElement.params = matInfo.params[techniqueIdx];
 				}
@@ -210,7 +229,7 @@ namespace BansheeEngine
 						matInfo.params[techniqueIdx] = renElement.material->createParamsSet(techniqueIdx);
 						matInfo.matVersion = renElement.material->getVersion();
 
-						renElement.material->updateParamsSet(matInfo.params[techniqueIdx], techniqueIdx, true);
+						renElement.material->updateParamsSet(matInfo.params[techniqueIdx], true);
 					}
 
 					renElement.params = matInfo.params[techniqueIdx];
@@ -239,6 +258,8 @@ namespace BansheeEngine
 				mObjectRenderer->initElement(renElement);
 			}
 		}
+
+		mShadowRenderer->notifyRenderableUpdated(rendererObject, mWorldBounds[renderableId]);
 	}
 
 	void RenderBeast::notifyRenderableRemoved(RenderableCore* renderable)
@@ -247,6 +268,11 @@ namespace BansheeEngine
 		RenderableCore* lastRenerable = mRenderables.back().renderable;
 		UINT32 lastRenderableId = lastRenerable->getRendererId();
 
+		for (auto& entry : mCameras)
+			entry.second.invalidateQueues();
+
+		mShadowRenderer->notifyRenderableUpdated(mRenderables[renderableId], mWorldBounds[renderableId]);
+
 		Vector<BeastRenderableElement>& elements = mRenderables[renderableId].elements;
 		for (auto& element : elements)
 		{
@@ -297,7 +323,13 @@ namespace BansheeEngine
 		shaderData.invWorldNoScaleTransform = shaderData.worldNoScaleTransform.inverseAffine();
 		shaderData.worldDeterminantSign = shaderData.worldTransform.determinant3x3() >= 0.0f ? 1.0f : -1.0f;
 
+		// Shadows need to be updated both where the renderable was, and where it is now
+		mShadowRenderer->notifyRenderableUpdated(mRenderables[renderableId], mWorldBounds[renderableId]);
 		mWorldBounds[renderableId] = renderable->getBounds();
+		mShadowRenderer->notifyRenderableUpdated(mRenderables[renderableId], mWorldBounds[renderableId]);
+
+		for (auto& entry : mCameras)
+			entry.second.notifyRenderableUpdated(renderableId);
 	}
 
 	void RenderBeast::notifyLightAdded(LightCore* light)
@@ -332,10 +364,14 @@ namespace BansheeEngine
 
 		if (light->getType() != LightType::Directional)
 			mLightWorldBounds[lightId] = light->getBounds();
+
+		mShadowRenderer->notifyLightUpdated(light);
 	}
 
 	void RenderBeast::notifyLightRemoved(LightCore* light)
 	{
+		mShadowRenderer->notifyLightRemoved(light);
+
 		UINT32 lightId = light->getRendererId();
 		if (light->getType() == LightType::Directional)
 		{
@@ -383,11 +419,16 @@ namespace BansheeEngine
 		{
 			updateCameraData(camera);
 		}
-		else if((updateFlag & (UINT32)CameraDirtyFlag::PostProcess) != 0)
+		else
 		{
 			RendererCamera& rendererCam = mCameras[camera];
-			rendererCam.updatePP();
-		} 
+
+			if ((updateFlag & (UINT32)CameraDirtyFlag::Transform) != 0)
+				rendererCam.invalidateQueues();
+
+			if ((updateFlag & (UINT32)CameraDirtyFlag::PostProcess) != 0)
+				rendererCam.updatePP();
+		}
 	}
 
 	void RenderBeast::notifyCameraRemoved(const CameraCore* camera)
@@ -405,12 +446,13 @@ namespace BansheeEngine
 		SPtr<RenderTargetCore> renderTarget = camera->getViewport()->getTarget();
 		if(forceRemove)
 		{
+			mShadowRenderer->notifyCameraRemoved(camera);
 			mCameras.erase(camera);
 			renderTarget = nullptr;
 		}
 		else
 		{
-			mCameras[camera] = RendererCamera(camera, mCoreOptions->stateReductionMode);
+			mCameras[camera] = RendererCamera(camera, *mCoreOptions);
 		}
 
 		// Remove from render target list
@@ -497,11 +539,12 @@ namespace BansheeEngine
 			refreshSamplerOverrides(true);
 
 		*mCoreOptions = options;
+		mShadowRenderer->setOptions(*mCoreOptions);
 
 		for (auto& entry : mCameras)
 		{
 			RendererCamera& rendererCam = entry.second;
-			rendererCam.update(mCoreOptions->stateReductionMode);
+			rendererCam.update(*mCoreOptions);
 		}
 	}
 
@@ -525,6 +568,9 @@ namespace BansheeEngine
 
 		gProfilerCPU().beginSample("renderAllCore");
 
+		// Track peak render target memory per-frame
+		RenderTexturePool::instance().beginFrame();
+
 		// Note: I'm iterating over all sampler states every frame. If this ends up being a performance
 		// issue consider handling this internally in MaterialCore which can only do it when sampler states
 		// are actually modified after sync
@@ -533,7 +579,7 @@ namespace BansheeEngine
 		// Update global per-frame hardware buffers
 		mObjectRenderer->setParamFrameParams(time);
 
-		// Generate render queues per camera
+		// Generate render queues per camera (re-uses queues from last frame if nothing relevant changed)
 		mVisibility.assign(mVisibility.size(), false);
 
 		for (auto& entry : mCameras)
@@ -543,7 +589,9 @@ namespace BansheeEngine
 		const RendererAnimationData& animData = AnimationManager::instance().getRendererData();
 		RendererFrame frameInfo(delta, animData);
 
-		// Update bone matrix buffers
+		// Update bone matrix buffers. Animations sharing a pose also share the buffer it was uploaded to.
+		UnorderedMap<UINT32, SPtr<GpuBufferCore>> uploadedPoses;
+
 		UINT32 numRenderables = (UINT32)mRenderables.size();
 		for (UINT32 i = 0; i < numRenderables; i++)
 		{
@@ -563,6 +611,15 @@ namespace BansheeEngine
 				if (iterFind != animData.infos.end())
 				{
 					const RendererAnimationData::PoseInfo& poseInfo = iterFind->second.poseInfo;
+					if (poseInfo.numBones == 0)
+						continue;
+
+					auto iterUploaded = uploadedPoses.find(poseInfo.startIdx);
+					if (iterUploaded != uploadedPoses.end())
+					{
+						element.activeBoneMatrixBuffer = iterUploaded->second;
+						continue;
+					}
 
 					UINT8* dest = (UINT8*)boneMatrices->lock(0, poseInfo.numBones * 3 * sizeof(Vector4), GBL_WRITE_ONLY_DISCARD);
 					for (UINT32 j = 0; j < poseInfo.numBones; j++)
@@ -574,6 +631,9 @@ namespace BansheeEngine
 					}
 
 					boneMatrices->unlock();
+
+					element.activeBoneMatrixBuffer = boneMatrices;
+					uploadedPoses[poseInfo.startIdx] = boneMatrices;
 				}
 			}
 
@@ -606,6 +666,10 @@ namespace BansheeEngine
 			RenderAPICore::instance().swapBuffers(target);
 		}
 
+		mShadowRenderer->endFrame();
+
+		BS_ADD_RENDER_STAT(PeakRenderTargetMemory, RenderTexturePool::instance().getPeakUsedMemory());
+
 		gProfilerCPU().endSample("renderAllCore");
 	}
 
@@ -619,6 +683,33 @@ namespace BansheeEngine
 
 		assert(!camera->getFlags().isSet(CameraFlag::Overlay));
 
+		//// Render shadow maps (re-uses shadow maps from previous frames if nothing relevant changed)
+		gProfilerCPU().beginSample("Shadows");
+
+		for (auto& light : mDirectionalLights)
+		{
+			light.shadowMap = nullptr;
+			if (!light.internal->getIsActive())
+				continue;
+
+			light.shadowMap = mShadowRenderer->getShadowMap(light.internal, camera, mRenderables, mWorldBounds);
+		}
+
+		ConvexVolume worldFrustum = camera->getWorldFrustum();
+		UINT32 numPointLights = (UINT32)mPointLights.size();
+		for (UINT32 i = 0; i < numPointLights; i++)
+		{
+			RendererLight& light = mPointLights[i];
+
+			light.shadowMap = nullptr;
+			if (!light.internal->getIsActive() || !worldFrustum.intersects(mLightWorldBounds[i]))
+				continue;
+
+			light.shadowMap = mShadowRenderer->getShadowMap(light.internal, camera, mRenderables, mWorldBounds);
+		}
+
+		gProfilerCPU().endSample("Shadows");
+
 		mObjectRenderer->setPerCameraParams(cameraShaderData);
 		rendererCam.beginRendering(true);
 
@@ -648,7 +739,9 @@ namespace BansheeEngine
 		for (auto iter = opaqueElements.begin(); iter != opaqueElements.end(); ++iter)
 		{
 			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(iter->renderElem);
-			renderElement(*renderElem, iter->passIdx, iter->applyPass, frameInfo, cameraShaderData.viewProj);
+			UINT32 lod = rendererCam.getLOD(renderElem->renderableId);
+
+			renderElement(*renderElem, iter->passIdx, iter->applyPass, frameInfo, cameraShaderData.viewProj, lod);
 		}
 
 		renderTargets->bindSceneColor(true);
@@ -663,7 +756,7 @@ namespace BansheeEngine
 				if (!light.internal->getIsActive())
 					continue;
 
-				mDirLightMat->setPerLightParams(light.internal);
+				mDirLightMat->setPerLightParams(light.internal, light.shadowMap);
 				gRendererUtility().drawScreenQuad();
 			}
 
@@ -684,7 +777,7 @@ namespace BansheeEngine
 				if (!cameraInLightGeometry)
 					continue;
 
-				mPointLightInMat->setPerLightParams(light.internal);
+				mPointLightInMat->setPerLightParams(light.internal, light.shadowMap);
 
 				SPtr<MeshCore> mesh = light.internal->getMesh();
 				gRendererUtility().draw(mesh, mesh->getProperties().getSubMesh(0));
@@ -705,7 +798,7 @@ namespace BansheeEngine
 				if (cameraInLightGeometry)
 					continue;
 
-				mPointLightOutMat->setPerLightParams(light.internal);
+				mPointLightOutMat->setPerLightParams(light.internal, light.shadowMap);
 
 				SPtr<MeshCore> mesh = light.internal->getMesh();
 				gRendererUtility().draw(mesh, mesh->getProperties().getSubMesh(0));
@@ -719,7 +812,9 @@ namespace BansheeEngine
 		for (auto iter = transparentElements.begin(); iter != transparentElements.end(); ++iter)
 		{
 			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(iter->renderElem);
-			renderElement(*renderElem, iter->passIdx, iter->applyPass, frameInfo, cameraShaderData.viewProj);
+			UINT32 lod = rendererCam.getLOD(renderElem->renderableId);
+
+			renderElement(*renderElem, iter->passIdx, iter->applyPass, frameInfo, cameraShaderData.viewProj, lod);
 		}
 
 		// Render non-overlay post-scene callbacks
@@ -819,16 +914,16 @@ namespace BansheeEngine
 	}
 	
 	void RenderBeast::renderElement(const BeastRenderableElement& element, UINT32 passIdx, bool bindPass,
-		const RendererFrame& frameInfo, const Matrix4& viewProj)
+		const RendererFrame& frameInfo, const Matrix4& viewProj, UINT32 lod)
 	{
 		SPtr<MaterialCore> material = element.material;
 
 		UINT32 rendererId = element.renderableId;
 		Matrix4 worldViewProjMatrix = viewProj * mRenderableShaderData[rendererId].worldTransform;
-		SPtr<GpuBufferCore> boneMatrices = element.boneMatrixBuffer;
+		SPtr<GpuBufferCore> boneMatrices = element.activeBoneMatrixBuffer;
 
 		mObjectRenderer->setPerObjectParams(element, mRenderableShaderData[rendererId], worldViewProjMatrix, boneMatrices);
-		material->updateParamsSet(element.params, element.techniqueIdx);
+		material->updateParamsSet(element.params);
 
 		if (bindPass)
 			RendererUtility::instance().setPass(material, passIdx, element.techniqueIdx);
@@ -838,7 +933,10 @@ namespace BansheeEngine
 		else
 			setPassParams(element.params, nullptr, passIdx);
 
-		gRendererUtility().draw(element.mesh, element.subMesh);
+		if (lod > 0)
+			gRendererUtility().draw(element.mesh, element.mesh->getProperties().getSubMesh(element.subMeshIdx, lod));
+		else
+			gRendererUtility().draw(element.mesh, element.subMesh);
 	}
 
 	void RenderBeast::refreshSamplerOverrides(bool force)
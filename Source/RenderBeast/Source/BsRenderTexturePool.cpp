@@ -4,6 +4,7 @@
 #include "BsRenderTexture.h"
 #include "BsTexture.h"
 #include "BsTextureManager.h"
+#include "BsPixelUtil.h"
 
 namespace BansheeEngine
 {
@@ -25,24 +26,24 @@ namespace BansheeEngine
 
 	SPtr<PooledRenderTexture> RenderTexturePool::get(const POOLED_RENDER_TEXTURE_DESC& desc)
 	{
-		for (auto& texturePair : mTextures)
+		auto iterFind = mFreeTextures.find(desc);
+		if (iterFind != mFreeTextures.end() && !iterFind->second.empty())
 		{
-			SPtr<PooledRenderTexture> textureData = texturePair.second.lock();
+			PooledRenderTexture* textureData = iterFind->second.back();
+			iterFind->second.pop_back();
 
-			if (!textureData->mIsFree)
-				continue;
+			textureData->mIsFree = false;
 
-			if (textureData->texture == nullptr)
-				continue;
+			mUsedMemory += textureData->mMemorySize;
+			mPeakUsedMemory = std::max(mPeakUsedMemory, mUsedMemory);
 
-			if (matches(textureData->texture, desc))
-			{
-				textureData->mIsFree = false;
-				return textureData;
-			}
+			return mTextures[textureData].lock();
 		}
 
 		SPtr<PooledRenderTexture> newTextureData = bs_shared_ptr_new<PooledRenderTexture>(this);
+		newTextureData->mDesc = desc;
+		newTextureData->mMemorySize = getMemorySize(desc);
+
 		_registerTexture(newTextureData);
 
 		newTextureData->texture = TextureCoreManager::instance().createTexture(desc.type, desc.width, desc.height, 
@@ -76,39 +77,53 @@ namespace BansheeEngine
 
 	void RenderTexturePool::release(const SPtr<PooledRenderTexture>& texture)
 	{
-		auto iterFind = mTextures.find(texture.get());
-		iterFind->second.lock()->mIsFree = true;
+		PooledRenderTexture* textureData = texture.get();
+		if (textureData->mIsFree)
+			return;
+
+		textureData->mIsFree = true;
+		mFreeTextures[textureData->mDesc].push_back(textureData);
+
+		mUsedMemory -= textureData->mMemorySize;
 	}
 
-	bool RenderTexturePool::matches(const SPtr<TextureCore>& texture, const POOLED_RENDER_TEXTURE_DESC& desc)
+	UINT32 RenderTexturePool::getMemorySize(const POOLED_RENDER_TEXTURE_DESC& desc)
 	{
-		const TextureProperties& texProps = texture->getProperties();
-
-		bool match = texProps.getTextureType() == desc.type 
-			&& texProps.getFormat() == desc.format 
-			&& texProps.getWidth() == desc.width 
-			&& texProps.getHeight() == desc.height
-			&& (texProps.getUsage() & desc.flag) == desc.flag
-			&& (
-				(desc.type == TEX_TYPE_2D 
-					&& texProps.isHardwareGammaEnabled() == desc.hwGamma 
-					&& texProps.getMultisampleCount() == desc.numSamples)
-				|| (desc.type == TEX_TYPE_3D 
-					&& texProps.getDepth() == desc.depth)
-				|| (desc.type == TEX_TYPE_CUBE_MAP)
-				)
-			;
-
-		return match;
+		UINT32 size = PixelUtil::getMemorySize(desc.width, desc.height, desc.depth, desc.format);
+		size *= std::max(desc.numSamples, 1U);
+
+		if (desc.type == TEX_TYPE_CUBE_MAP)
+			size *= 6;
+
+		return size;
 	}
 
 	void RenderTexturePool::_registerTexture(const SPtr<PooledRenderTexture>& texture)
 	{
 		mTextures.insert(std::make_pair(texture.get(), texture));
+
+		mAllocatedMemory += texture->mMemorySize;
+		mUsedMemory += texture->mMemorySize;
+		mPeakUsedMemory = std::max(mPeakUsedMemory, mUsedMemory);
 	}
 
 	void RenderTexturePool::_unregisterTexture(PooledRenderTexture* texture)
 	{
+		if (texture->mIsFree)
+		{
+			Vector<PooledRenderTexture*>& freeTextures = mFreeTextures[texture->mDesc];
+
+			auto iterFind = std::find(freeTextures.begin(), freeTextures.end(), texture);
+			if (iterFind != freeTextures.end())
+			{
+				std::swap(*iterFind, freeTextures.back());
+				freeTextures.pop_back();
+			}
+		}
+		else
+			mUsedMemory -= texture->mMemorySize;
+
+		mAllocatedMemory -= texture->mMemorySize;
 		mTextures.erase(texture);
 	}
 
@@ -159,4 +174,26 @@ namespace BansheeEngine
 
 		return desc;
 	}
+
+	size_t POOLED_RENDER_TEXTURE_DESC::HashFunction::operator()(const POOLED_RENDER_TEXTURE_DESC& key) const
+	{
+		size_t hash = 0;
+		hash_combine(hash, key.width);
+		hash_combine(hash, key.height);
+		hash_combine(hash, key.depth);
+		hash_combine(hash, key.numSamples);
+		hash_combine(hash, (UINT32)key.format);
+		hash_combine(hash, (UINT32)key.flag);
+		hash_combine(hash, (UINT32)key.type);
+		hash_combine(hash, key.hwGamma);
+
+		return hash;
+	}
+
+	bool POOLED_RENDER_TEXTURE_DESC::EqualFunction::operator()(const POOLED_RENDER_TEXTURE_DESC& a, 
+		const POOLED_RENDER_TEXTURE_DESC& b) const
+	{
+		return a.width == b.width && a.height == b.height && a.depth == b.depth && a.numSamples == b.numSamples &&
+			a.format == b.format && a.flag == b.flag && a.type == b.type && a.hwGamma == b.hwGamma;
+	}
 }
\ No newline at end of file
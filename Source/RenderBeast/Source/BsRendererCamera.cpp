@@ -4,30 +4,51 @@
 #include "BsCamera.h"
 #include "BsRenderable.h"
 #include "BsMaterial.h"
+#include "BsMesh.h"
 #include "BsShader.h"
 #include "BsRenderTargets.h"
+#include "BsRenderBeastOptions.h"
+#include "BsRenderStats.h"
 
 namespace BansheeEngine
 {
 	RendererCamera::RendererCamera()
-		:mCamera(nullptr), mUsingRenderTargets(false)
+		: mCamera(nullptr), mQueuesDirty(true), mOcclusionCulling(false), mHasOccluders(false), mNumOccluded(0)
+		, mUsingRenderTargets(false)
 	{ }
 
-	RendererCamera::RendererCamera(const CameraCore* camera, StateReduction reductionMode)
-		:mCamera(camera), mUsingRenderTargets(false)
+	RendererCamera::RendererCamera(const CameraCore* camera, const RenderBeastOptions& options)
+		: mCamera(camera), mQueuesDirty(true), mOcclusionCulling(false), mHasOccluders(false), mNumOccluded(0)
+		, mUsingRenderTargets(false)
 	{
-		update(reductionMode);
+		update(options);
 	}
 
-	void RendererCamera::update(StateReduction reductionMode)
+	void RendererCamera::update(const RenderBeastOptions& options)
 	{
-		mOpaqueQueue = bs_shared_ptr_new<RenderQueue>(reductionMode);
+		mOpaqueQueue = bs_shared_ptr_new<RenderQueue>(options.stateReductionMode);
 
-		StateReduction transparentStateReduction = reductionMode;
+		StateReduction transparentStateReduction = options.stateReductionMode;
 		if (transparentStateReduction == StateReduction::Material)
 			transparentStateReduction = StateReduction::Distance; // Transparent object MUST be sorted by distance
 
 		mTransparentQueue = bs_shared_ptr_new<RenderQueue>(transparentStateReduction);
+		mQueuesDirty = true;
+
+		mOcclusionCulling = options.occlusionCulling;
+		if (mOcclusionCulling)
+		{
+			bool createBuffer = mOcclusionBuffer == nullptr ||
+				mOcclusionBuffer->getWidth() != ((options.occlusionBufferWidth + 3) & ~3U) ||
+				mOcclusionBuffer->getHeight() != options.occlusionBufferHeight;
+
+			if (createBuffer)
+				mOcclusionBuffer = bs_shared_ptr_new<OcclusionBuffer>(options.occlusionBufferWidth, 
+					options.occlusionBufferHeight);
+		}
+		else
+			mOcclusionBuffer = nullptr;
+
 		updatePP();
 	}
 
@@ -68,9 +89,7 @@ namespace BansheeEngine
 
 	void RendererCamera::endRendering()
 	{
-		mOpaqueQueue->clear();
-		mTransparentQueue->clear();
-
+		// Note: Render queues are intentionally not cleared, so they can be re-used next frame if nothing changes
 		if(mUsingRenderTargets)
 		{
 			mRenderTargets->release();
@@ -78,6 +97,14 @@ namespace BansheeEngine
 		}
 	}
 
+	void RendererCamera::notifyRenderableUpdated(UINT32 rendererId)
+	{
+		if (mQueuesDirty)
+			return;
+
+		mDirtyRenderables.push_back(rendererId);
+	}
+
 	void RendererCamera::determineVisible(Vector<RendererObject>& renderables, const Vector<Bounds>& renderableBounds, 
 		Vector<bool>& visibility)
 	{
@@ -85,51 +112,263 @@ namespace BansheeEngine
 		if (isOverlayCamera)
 			return;
 
+		UINT32 numRenderables = (UINT32)renderables.size();
+
+		// If too many renderables changed it's cheaper to just rebuild everything
+		UINT32 maxPatchedRenderables = std::max(16U, numRenderables / 4);
+		if (mDirtyRenderables.size() > maxPatchedRenderables || haveMaterialsChanged())
+			mQueuesDirty = true;
+
+		// Moving an occluder changes the occlusion buffer, which can affect visibility of any renderable
+		if (!mQueuesDirty && mOcclusionCulling)
+		{
+			for (auto& rendererId : mDirtyRenderables)
+			{
+				if (renderables[rendererId].occluder != nullptr)
+				{
+					mQueuesDirty = true;
+					break;
+				}
+			}
+		}
+
 		UINT64 cameraLayers = mCamera->getLayers();
 		ConvexVolume worldFrustum = mCamera->getWorldFrustum();
 
-		// Update per-object param buffers and queue render elements
-		for(UINT32 i = 0; i < (UINT32)renderables.size(); i++)
+		if (mQueuesDirty)
 		{
-			RenderableCore* renderable = renderables[i].renderable;
-			UINT32 rendererId = renderable->getRendererId();
+			mCachedVisibility.assign(numRenderables, false);
+			mCachedOcclusion.assign(numRenderables, false);
+			for (UINT32 i = 0; i < numRenderables; i++)
+			{
+				UINT32 rendererId = renderables[i].renderable->getRendererId();
+				mCachedVisibility[i] = isVisible(renderables[i], renderableBounds[rendererId], cameraLayers, worldFrustum);
+			}
 
-			if ((renderable->getLayer() & cameraLayers) == 0)
-				continue;
+			// Cull renderables hidden behind occluders that passed frustum culling
+			mNumOccluded = 0;
+			mHasOccluders = renderOccluders(renderables);
+			if (mHasOccluders)
+			{
+				for (UINT32 i = 0; i < numRenderables; i++)
+				{
+					if (!mCachedVisibility[i] || !mOcclusionBuffer->isOccluded(renderableBounds[i].getBox()))
+						continue;
 
-			// Do frustum culling
-			// Note: This is bound to be a bottleneck at some point. When it is ensure that intersect methods use vector
-			// operations, as it is trivial to update them. Also consider spatial partitioning.
-			const Sphere& boundingSphere = renderableBounds[rendererId].getSphere();
-			if (worldFrustum.intersects(boundingSphere))
+					mCachedVisibility[i] = false;
+					mCachedOcclusion[i] = true;
+					mNumOccluded++;
+				}
+			}
+
+			rebuildQueues(renderables, renderableBounds);
+		}
+		else if (!mDirtyRenderables.empty())
+		{
+			// Only re-evaluate the renderables that changed, and move their entries within the already sorted queues. 
+			// Occlusion buffer is still valid as neither the camera nor any occluders moved.
+			bool queuesModified = false;
+			for (auto& rendererId : mDirtyRenderables)
 			{
-				// More precise with the box
-				const AABox& boundingBox = renderableBounds[rendererId].getBox();
+				bool wasVisible = mCachedVisibility[rendererId];
+				bool nowVisible = isVisible(renderables[rendererId], renderableBounds[rendererId], cameraLayers, 
+					worldFrustum);
+
+				if (mCachedOcclusion[rendererId])
+				{
+					mCachedOcclusion[rendererId] = false;
+					mNumOccluded--;
+				}
 
-				if (worldFrustum.intersects(boundingBox))
+				if (nowVisible && mHasOccluders && mOcclusionBuffer->isOccluded(renderableBounds[rendererId].getBox()))
 				{
-					visibility[i] = true;
+					nowVisible = false;
+					mCachedOcclusion[rendererId] = true;
+					mNumOccluded++;
+				}
 
-					float distanceToCamera = (mCamera->getPosition() - boundingBox.getCenter()).length();
+				mCachedVisibility[rendererId] = nowVisible;
 
-					for (auto& renderElem : renderables[i].elements)
-					{
-						bool isTransparent = (renderElem.material->getShader()->getFlags() & (UINT32)ShaderFlags::Transparent) != 0;
+				if (wasVisible)
+				{
+					dequeueRenderable(renderables[rendererId]);
 
-						if (isTransparent)
-							mTransparentQueue->add(&renderElem, distanceToCamera);
-						else
-							mOpaqueQueue->add(&renderElem, distanceToCamera);
-					}
+					auto iterFind = std::find(mVisibleRenderables.begin(), mVisibleRenderables.end(), rendererId);
+					if (iterFind != mVisibleRenderables.end())
+						mVisibleRenderables.erase(iterFind);
+				}
 
+				if (nowVisible)
+				{
+					mVisibleRenderables.push_back(rendererId);
+					queueRenderable(renderables[rendererId], renderableBounds[rendererId], rendererId, true);
 				}
+
+				queuesModified |= wasVisible || nowVisible;
+			}
+
+			// Entries were inserted in order, so this only regenerates the sorted element lists
+			if (queuesModified)
+			{
+				mOpaqueQueue->sort();
+				mTransparentQueue->sort();
 			}
 		}
 
+		mDirtyRenderables.clear();
+		mQueuesDirty = false;
+
+		BS_ADD_RENDER_STAT(NumOcclusionCulled, mNumOccluded);
+
+		for (auto& rendererId : mVisibleRenderables)
+			visibility[rendererId] = true;
+	}
+
+	bool RendererCamera::isVisible(const RendererObject& renderable, const Bounds& bounds, UINT64 cameraLayers,
+		const ConvexVolume& worldFrustum) const
+	{
+		if ((renderable.renderable->getLayer() & cameraLayers) == 0)
+			return false;
+
+		// Do frustum culling
+		// Note: This is bound to be a bottleneck at some point. When it is ensure that intersect methods use vector
+		// operations, as it is trivial to update them. Also consider spatial partitioning.
+		if (!worldFrustum.intersects(bounds.getSphere()))
+			return false;
+
+		// More precise with the box
+		return worldFrustum.intersects(bounds.getBox());
+	}
+
+	bool RendererCamera::renderOccluders(const Vector<RendererObject>& renderables)
+	{
+		if (!mOcclusionCulling || mOcclusionBuffer == nullptr)
+			return false;
+
+		Matrix4 viewProj = mCamera->getProjectionMatrix() * mCamera->getViewMatrix();
+		mOcclusionBuffer->clear(viewProj);
+
+		UINT32 numRenderables = (UINT32)renderables.size();
+		for (UINT32 i = 0; i < numRenderables; i++)
+		{
+			if (!mCachedVisibility[i] || renderables[i].occluder == nullptr)
+				continue;
+
+			mOcclusionBuffer->addOccluder(*renderables[i].occluder, renderables[i].renderable->getTransform());
+		}
+
+		if (!mOcclusionBuffer->hasOccluders())
+			return false;
+
+		mOcclusionBuffer->rasterize();
+		return true;
+	}
+
+	void RendererCamera::rebuildQueues(Vector<RendererObject>& renderables, const Vector<Bounds>& renderableBounds)
+	{
+		mOpaqueQueue->clear();
+		mTransparentQueue->clear();
+		mVisibleRenderables.clear();
+		mQueuedMaterialVersions.clear();
+
+		UINT32 numRenderables = (UINT32)renderables.size();
+		mCachedLODs.resize(numRenderables, 0);
+
+		for (UINT32 i = 0; i < numRenderables; i++)
+		{
+			if (!mCachedVisibility[i])
+				continue;
+
+			mVisibleRenderables.push_back(i);
+			queueRenderable(renderables[i], renderableBounds[i], i, false);
+		}
+
 		mOpaqueQueue->sort();
 		mTransparentQueue->sort();
 	}
 
+	void RendererCamera::queueRenderable(RendererObject& renderable, const Bounds& bounds, UINT32 idx, bool keepSorted)
+	{
+		updateLOD(renderable, bounds, idx);
+
+		Vector3 cameraPosition = mCamera->getPosition();
+		float distanceToCamera = (cameraPosition - bounds.getBox().getCenter()).length();
+
+		for (auto& renderElem : renderable.elements)
+		{
+			bool isTransparent = (renderElem.material->getShader()->getFlags() & (UINT32)ShaderFlags::Transparent) != 0;
+
+			RenderQueue* queue = isTransparent ? mTransparentQueue.get() : mOpaqueQueue.get();
+			if (keepSorted)
+				queue->insert(&renderElem, distanceToCamera);
+			else
+				queue->add(&renderElem, distanceToCamera);
+
+			mQueuedMaterialVersions[renderElem.material.get()] = renderElem.material->getVersion();
+		}
+	}
+
+	void RendererCamera::dequeueRenderable(RendererObject& renderable)
+	{
+		for (auto& renderElem : renderable.elements)
+		{
+			mOpaqueQueue->remove(&renderElem);
+			mTransparentQueue->remove(&renderElem);
+		}
+	}
+
+	void RendererCamera::updateLOD(const RendererObject& renderable, const Bounds& bounds, UINT32 idx)
+	{
+		// Relative distance the screen size must move past a level's threshold before the level changes
+		static const float LOD_HYSTERESIS = 0.1f;
+
+		SPtr<MeshCore> mesh = renderable.renderable->getMesh();
+		if (mesh == nullptr)
+		{
+			mCachedLODs[idx] = 0;
+			return;
+		}
+
+		const MeshProperties& meshProps = mesh->getProperties();
+		UINT32 numLODs = meshProps.getNumLODs();
+		if (numLODs <= 1)
+		{
+			mCachedLODs[idx] = 0;
+			return;
+		}
+
+		// Size of the bounding sphere projected on screen, relative to screen height
+		const Sphere& sphere = bounds.getSphere();
+		float screenSize;
+		if (mCamera->getProjectionType() == PT_ORTHOGRAPHIC)
+			screenSize = sphere.getRadius() * 2.0f / std::max(mCamera->getOrthoWindowHeight(), 0.0001f);
+		else
+		{
+			float distance = mCamera->getPosition().distance(sphere.getCenter());
+			screenSize = sphere.getRadius() * mCamera->getProjectionMatrix()[1][1] / std::max(distance, 0.0001f);
+		}
+
+		UINT32 lod = std::min(mCachedLODs[idx], numLODs - 1);
+		while ((lod + 1) < numLODs && screenSize < meshProps.getLODScreenSize(lod + 1) * (1.0f - LOD_HYSTERESIS))
+			lod++;
+
+		while (lod > 0 && screenSize > meshProps.getLODScreenSize(lod) * (1.0f + LOD_HYSTERESIS))
+			lod--;
+
+		mCachedLODs[idx] = lod;
+	}
+
+	bool RendererCamera::haveMaterialsChanged() const
+	{
+		for (auto& entry : mQueuedMaterialVersions)
+		{
+			if (entry.first->getVersion() != entry.second)
+				return true;
+		}
+
+		return false;
+	}
+
 	Vector2 RendererCamera::getDeviceZTransform(const Matrix4& projMatrix) const
 	{
 		// Returns a set of values that will transform depth buffer values (e.g. [0, 1] in DX, [-1, 1] in GL) to a distance
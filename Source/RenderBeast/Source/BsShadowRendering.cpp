@@ -0,0 +1,549 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsShadowRendering.h"
+#include "BsRendererObject.h"
+#include "BsRenderBeastOptions.h"
+#include "BsRenderTexturePool.h"
+#include "BsRenderTexture.h"
+#include "BsTextureManager.h"
+#include "BsRendererUtility.h"
+#include "BsRenderAPI.h"
+#include "BsGpuParamsSet.h"
+#include "BsMaterial.h"
+#include "BsShader.h"
+#include "BsRenderable.h"
+#include "BsMesh.h"
+#include "BsLight.h"
+#include "BsCamera.h"
+
+namespace BansheeEngine
+{
+	ShadowDepthMat::ShadowDepthMat()
+	{
+		mParamsSet->setParamBlockBuffer("ShadowParams", mParams.getBuffer());
+	}
+
+	void ShadowDepthMat::_initDefines(ShaderDefines& defines)
+	{
+		// Do nothing
+	}
+
+	void ShadowDepthMat::bind()
+	{
+		gRendererUtility().setPass(mMaterial);
+		gRendererUtility().setPassParams(mParamsSet);
+	}
+
+	void ShadowDepthMat::setPerObjectParams(const Matrix4& worldViewProj)
+	{
+		mParams.gMatWorldViewProj.set(worldViewProj);
+		mParams.flushToGPU();
+	}
+
+	/** Checks should the element be rendered into shadow maps. */
+	static bool castsShadow(const BeastRenderableElement& element)
+	{
+		// Skinned and morphed meshes would require the animation to be applied during shadow rendering
+		if (element.animationId != (UINT64)-1)
+			return false;
+
+		return (element.material->getShader()->getFlags() & (UINT32)ShaderFlags::Transparent) == 0;
+	}
+
+	const UINT32 ShadowRenderer::MAX_UNUSED_FRAMES = 60;
+
+	ShadowRenderer::ShadowRenderer()
+		: mDepthMat(bs_new<ShadowDepthMat>()), mShadowMapSize(1024), mNumCascades(MAX_SHADOW_CASCADES)
+		, mShadowDistance(100.0f), mFrameIdx(1)
+	{ }
+
+	ShadowRenderer::~ShadowRenderer()
+	{
+		for (auto& entry : mShadowMaps)
+		{
+			if (entry.second.texture != nullptr)
+				RenderTexturePool::instance().release(entry.second.texture);
+		}
+
+		bs_delete(mDepthMat);
+	}
+
+	void ShadowRenderer::setOptions(const RenderBeastOptions& options)
+	{
+		mShadowMapSize = std::max(options.shadowMapSize, 16U);
+		mNumCascades = Math::clamp(options.numShadowCascades, 1U, MAX_SHADOW_CASCADES);
+		mShadowDistance = std::max(options.shadowDistance, 0.1f);
+
+		for (auto& entry : mShadowMaps)
+			entry.second.isDirty = true;
+	}
+
+	const ShadowMapInfo* ShadowRenderer::getShadowMap(const LightCore* light, const CameraCore* camera,
+		const Vector<RendererObject>& renderables, const Vector<Bounds>& worldBounds)
+	{
+		if (!light->getCastsShadow())
+			return nullptr;
+
+		LightType type = light->getType();
+		if (type == LightType::Point)
+			return nullptr;
+
+		// Spot light shadow maps don't depend on the view, and are shared between all cameras
+		ShadowMapKey key(light, type == LightType::Directional ? camera : nullptr);
+
+		ShadowMapInfo& info = mShadowMaps[key];
+		if (info.lastUsedFrame == mFrameIdx)
+			return &info;
+
+		info.lastUsedFrame = mFrameIdx;
+
+		bool boundsChanged;
+		if (type == LightType::Directional)
+			boundsChanged = setupDirectional(light, camera, info);
+		else
+			boundsChanged = setupSpot(light, info);
+
+		UINT32 width = mShadowMapSize * info.numCascades;
+		UINT32 height = mShadowMapSize;
+
+		if (info.texture != nullptr)
+		{
+			const TextureProperties& texProps = info.texture->texture->getProperties();
+			if (texProps.getWidth() != width || texProps.getHeight() != height)
+			{
+				RenderTexturePool::instance().release(info.texture);
+				info.texture = nullptr;
+			}
+		}
+
+		if (info.texture == nullptr)
+		{
+			info.texture = RenderTexturePool::instance().get(
+				POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT32_R, width, height, TU_RENDERTARGET));
+
+			info.isDirty = true;
+		}
+
+		info.size = mShadowMapSize;
+
+		// Casters only need to be found and rendered if something within the bounds changed since the last render
+		if (info.isDirty || boundsChanged)
+		{
+			findCasters(info, renderables, worldBounds);
+			render(info, renderables);
+
+			info.isDirty = false;
+		}
+
+		return &info;
+	}
+
+	void ShadowRenderer::endFrame()
+	{
+		for (auto iter = mShadowMaps.begin(); iter != mShadowMaps.end();)
+		{
+			ShadowMapInfo& info = iter->second;
+			if ((mFrameIdx - info.lastUsedFrame) > MAX_UNUSED_FRAMES)
+			{
+				if (info.texture != nullptr)
+					RenderTexturePool::instance().release(info.texture);
+
+				iter = mShadowMaps.erase(iter);
+			}
+			else
+				++iter;
+		}
+
+		mFrameIdx++;
+	}
+
+	void ShadowRenderer::notifyLightRemoved(const LightCore* light)
+	{
+		for (auto iter = mShadowMaps.begin(); iter != mShadowMaps.end();)
+		{
+			if (iter->first.first == light)
+			{
+				if (iter->second.texture != nullptr)
+					RenderTexturePool::instance().release(iter->second.texture);
+
+				iter = mShadowMaps.erase(iter);
+			}
+			else
+				++iter;
+		}
+	}
+
+	void ShadowRenderer::notifyCameraRemoved(const CameraCore* camera)
+	{
+		for (auto iter = mShadowMaps.begin(); iter != mShadowMaps.end();)
+		{
+			if (iter->first.second == camera)
+			{
+				if (iter->second.texture != nullptr)
+					RenderTexturePool::instance().release(iter->second.texture);
+
+				iter = mShadowMaps.erase(iter);
+			}
+			else
+				++iter;
+		}
+	}
+
+	void ShadowRenderer::notifyLightUpdated(const LightCore* light)
+	{
+		for (auto& entry : mShadowMaps)
+		{
+			if (entry.first.first == light)
+				entry.second.isDirty = true;
+		}
+	}
+
+	void ShadowRenderer::notifyRenderableUpdated(const RendererObject& renderable, const Bounds& bounds)
+	{
+		if (!isShadowCaster(renderable))
+			return;
+
+		const Sphere& sphere = bounds.getSphere();
+		for (auto& entry : mShadowMaps)
+		{
+			ShadowMapInfo& info = entry.second;
+			if (info.isDirty)
+				continue;
+
+			for (UINT32 i = 0; i < info.numCascades; i++)
+			{
+				if (intersectsCascade(info, i, sphere))
+				{
+					info.isDirty = true;
+					break;
+				}
+			}
+		}
+	}
+
+	bool ShadowRenderer::setupDirectional(const LightCore* light, const CameraCore* camera, ShadowMapInfo& info)
+	{
+		float nearDist = std::max(camera->getNearClipDistance(), 0.01f);
+		float farDist = camera->getFarClipDistance();
+		if (farDist <= 0.0f) // Infinite far plane
+			farDist = mShadowDistance;
+		else
+			farDist = std::min(farDist, mShadowDistance);
+
+		farDist = std::max(farDist, nearDist * 2.0f);
+
+		// Split the view frustum using a blend between logarithmic and uniform distribution. Logarithmic distribution
+		// keeps shadow texel to screen pixel ratio constant, but wastes too much resolution right next to the near plane.
+		const float LOG_SPLIT_WEIGHT = 0.75f;
+
+		bool boundsChanged = !info.isDirectional || info.numCascades != mNumCascades;
+
+		info.isDirectional = true;
+		info.numCascades = mNumCascades;
+		for (UINT32 i = 0; i < info.numCascades; i++)
+		{
+			float t = (i + 1) / (float)info.numCascades;
+
+			float logSplit = nearDist * Math::pow(farDist / nearDist, t);
+			float uniformSplit = nearDist + (farDist - nearDist) * t;
+
+			info.cascadeSplits[i] = LOG_SPLIT_WEIGHT * logSplit + (1.0f - LOG_SPLIT_WEIGHT) * uniformSplit;
+		}
+
+		// Find near plane corners in view space, from which the corners of each cascade can be derived
+		static const float CORNER_X[4] = { -1.0f, 1.0f, 1.0f, -1.0f };
+		static const float CORNER_Y[4] = { -1.0f, -1.0f, 1.0f, 1.0f };
+
+		Matrix4 invProj = camera->getProjectionMatrix().inverse();
+		bool isPerspective = camera->getProjectionType() == PT_PERSPECTIVE;
+
+		Vector3 nearCorners[4];
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			Vector4 corner = invProj.multiply(Vector4(CORNER_X[i], CORNER_Y[i], -1.0f, 1.0f));
+			nearCorners[i] = Vector3(corner.x, corner.y, corner.z) / corner.w;
+		}
+
+		auto getCornerAtDistance = [&](UINT32 idx, float distance) -> Vector3
+		{
+			const Vector3& nearCorner = nearCorners[idx];
+
+			if (isPerspective)
+				return nearCorner * (distance / -nearCorner.z);
+			else
+				return Vector3(nearCorner.x, nearCorner.y, -distance);
+		};
+
+		const Matrix4& viewInv = camera->getViewMatrixInv();
+
+		Quaternion lightRotation = light->getRotation();
+		Vector3 lightRight = lightRotation.xAxis();
+		Vector3 lightUp = lightRotation.yAxis();
+		Vector3 lightDir = -lightRotation.zAxis();
+
+		float cascadeStart = nearDist;
+		for (UINT32 i = 0; i < info.numCascades; i++)
+		{
+			float cascadeEnd = info.cascadeSplits[i];
+
+			Vector3 corners[8];
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				corners[j] = viewInv.multiplyAffine(getCornerAtDistance(j, cascadeStart));
+				corners[j + 4] = viewInv.multiplyAffine(getCornerAtDistance(j, cascadeEnd));
+			}
+
+			Vector3 center = Vector3::ZERO;
+			for (UINT32 j = 0; j < 8; j++)
+				center += corners[j];
+
+			center /= 8.0f;
+
+			float radius = 0.0f;
+			for (UINT32 j = 0; j < 8; j++)
+				radius = std::max(radius, (corners[j] - center).squaredLength());
+
+			// Fitting a sphere (rather than a box) keeps the projection size constant as the view rotates, and rounding
+			// it up keeps it constant under small floating point differences. This prevents the shadow edges from
+			// shimmering.
+			radius = Math::ceil(Math::sqrt(radius) * 16.0f) / 16.0f;
+
+			// Snap the center to shadow map texels, so the shadow doesn't shimmer as the view moves. Along the light
+			// direction snap it in steps of the radius, so the cascade doesn't change (and need a re-render) every time
+			// the view moves. The cascade depth range is extended to still cover the entire cascade.
+			float texelSize = (2.0f * radius) / mShadowMapSize;
+
+			float centerX = Math::floor(center.dot(lightRight) / texelSize) * texelSize;
+			float centerY = Math::floor(center.dot(lightUp) / texelSize) * texelSize;
+			float centerZ = Math::round(center.dot(lightDir) / radius) * radius;
+			center = lightRight * centerX + lightUp * centerY + lightDir * centerZ;
+
+			const Sphere& oldBounds = info.cascadeBounds[i];
+			if (oldBounds.getCenter() != center || oldBounds.getRadius() != radius)
+			{
+				info.cascadeBounds[i] = Sphere(center, radius);
+				boundsChanged = true;
+			}
+
+			cascadeStart = cascadeEnd;
+		}
+
+		if (info.lightRotation != lightRotation)
+		{
+			info.lightRotation = lightRotation;
+			boundsChanged = true;
+		}
+
+		return boundsChanged;
+	}
+
+	bool ShadowRenderer::setupSpot(const LightCore* light, ShadowMapInfo& info)
+	{
+		const RenderAPIInfo& rapiInfo = RenderAPICore::instance().getAPIInfo();
+		float depthRange = rapiInfo.getMaximumDepthInputValue() - rapiInfo.getMinimumDepthInputValue();
+
+		const Sphere& lightBounds = light->getBounds();
+		const Sphere& oldBounds = info.cascadeBounds[0];
+
+		bool boundsChanged = info.isDirectional || info.numCascades != 1 || 
+			oldBounds.getCenter() != lightBounds.getCenter() || oldBounds.getRadius() != lightBounds.getRadius();
+
+		info.isDirectional = false;
+		info.cascadeBounds[0] = lightBounds;
+		info.lightRotation = light->getRotation();
+
+		info.numCascades = 1;
+		info.cascadeSplits[0] = std::numeric_limits<float>::max();
+
+		float farDist = std::max(light->getRange(), 0.1f);
+		float nearDist = farDist * 0.01f;
+
+		Degree fov = Math::clamp(light->getSpotAngle(), Degree(1.0f), Degree(170.0f));
+		float tanHalfFov = Math::tan(fov * 0.5f);
+
+		Matrix4 proj = Matrix4::ZERO;
+		proj[0][0] = 1.0f / tanHalfFov;
+		proj[1][1] = 1.0f / tanHalfFov;
+		proj[2][2] = -(farDist + nearDist) / (farDist - nearDist);
+		proj[2][3] = -2.0f * farDist * nearDist / (farDist - nearDist);
+		proj[3][2] = -1.0f;
+
+		Matrix4 projRS;
+		RenderAPICore::instance().convertProjectionMatrix(proj, projRS);
+
+		Matrix4 view;
+		view.makeView(light->getPosition(), light->getRotation());
+
+		info.shadowTransforms[0] = projRS * view;
+
+		// Perspective projection doesn't map depth linearly, so calculate the bias for a texel and a half in the middle
+		// of the light's range
+		float biasDist = farDist * 0.5f;
+		float texelSize = 2.0f * tanHalfFov * biasDist / mShadowMapSize;
+		float depthSlope = 2.0f * farDist * nearDist / ((farDist - nearDist) * biasDist * biasDist);
+
+		info.cascadeBias[0] = 1.5f * texelSize * depthSlope * depthRange * 0.5f;
+
+		return boundsChanged;
+	}
+
+	void ShadowRenderer::findCasters(ShadowMapInfo& info, const Vector<RendererObject>& renderables,
+		const Vector<Bounds>& worldBounds)
+	{
+		const RenderAPIInfo& rapiInfo = RenderAPICore::instance().getAPIInfo();
+		float depthRange = rapiInfo.getMaximumDepthInputValue() - rapiInfo.getMinimumDepthInputValue();
+
+		Vector3 lightDir = -info.lightRotation.zAxis();
+
+		UINT32 numRenderables = (UINT32)renderables.size();
+		for (UINT32 i = 0; i < info.numCascades; i++)
+		{
+			const Sphere& cascadeBounds = info.cascadeBounds[i];
+			float radius = cascadeBounds.getRadius();
+
+			// Cascade center is snapped by up to half the radius along the light direction
+			float minCasterDist = -radius * 1.5f;
+
+			Vector<UINT32>& casters = mCasters[i];
+			casters.clear();
+
+			for (UINT32 j = 0; j < numRenderables; j++)
+			{
+				if (!isShadowCaster(renderables[j]))
+					continue;
+
+				const Sphere& bounds = worldBounds[j].getSphere();
+				if (!intersectsCascade(info, i, bounds))
+					continue;
+
+				casters.push_back(j);
+
+				if (info.isDirectional)
+				{
+					float dist = (bounds.getCenter() - cascadeBounds.getCenter()).dot(lightDir);
+					minCasterDist = std::min(minCasterDist, dist - bounds.getRadius());
+				}
+			}
+
+			if (!info.isDirectional)
+				continue;
+
+			// Place the near plane just in front of the closest caster
+			const float DEPTH_MARGIN = 0.1f;
+
+			Vector3 viewOrigin = cascadeBounds.getCenter() + lightDir * (minCasterDist - DEPTH_MARGIN);
+			float depth = radius * 1.5f - minCasterDist + DEPTH_MARGIN * 2.0f;
+
+			Matrix4 view;
+			view.makeView(viewOrigin, info.lightRotation);
+
+			Matrix4 proj;
+			proj.makeProjectionOrtho(-radius, radius, radius, -radius, 0.0f, depth);
+
+			Matrix4 projRS;
+			RenderAPICore::instance().convertProjectionMatrix(proj, projRS);
+
+			info.shadowTransforms[i] = projRS * view;
+
+			// Offset receivers by a texel and a half to avoid self-shadowing
+			float texelSize = (2.0f * radius) / mShadowMapSize;
+			info.cascadeBias[i] = 1.5f * texelSize * depthRange / depth;
+		}
+	}
+
+	void ShadowRenderer::render(ShadowMapInfo& info, const Vector<RendererObject>& renderables)
+	{
+		const TextureProperties& texProps = info.texture->texture->getProperties();
+
+		// Depth buffer is only needed while rendering, but the reference is kept so the pool doesn't destroy it, and the
+		// same texture (and the render target using it) can be reused on the next re-render
+		SPtr<PooledRenderTexture> depthTex = RenderTexturePool::instance().get(
+			POOLED_RENDER_TEXTURE_DESC::create2D(PF_D24S8, texProps.getWidth(), texProps.getHeight(), TU_DEPTHSTENCIL));
+
+		bool rebuildTarget = info.renderTarget == nullptr || depthTex != info.depthTexture ||
+			info.renderTarget->getBindableColorTexture() != info.texture->texture;
+
+		info.depthTexture = depthTex;
+
+		if (rebuildTarget)
+		{
+			RENDER_TEXTURE_CORE_DESC rtDesc;
+			rtDesc.colorSurface.texture = info.texture->texture;
+			rtDesc.colorSurface.face = 0;
+			rtDesc.colorSurface.numFaces = 1;
+			rtDesc.colorSurface.mipLevel = 0;
+
+			rtDesc.depthStencilSurface.texture = depthTex->texture;
+			rtDesc.depthStencilSurface.face = 0;
+			rtDesc.depthStencilSurface.numFaces = 1;
+			rtDesc.depthStencilSurface.mipLevel = 0;
+
+			info.renderTarget = TextureCoreManager::instance().createRenderTexture(rtDesc);
+		}
+
+		RenderAPICore& rapi = RenderAPICore::instance();
+		rapi.setRenderTarget(info.renderTarget);
+		rapi.setViewport(Rect2(0.0f, 0.0f, 1.0f, 1.0f));
+
+		// Areas without casters end up at maximum depth, and are never shadowed
+		rapi.clearRenderTarget(FBT_COLOR | FBT_DEPTH, Color::White, 1.0f);
+
+		mDepthMat->bind();
+
+		float cascadeWidth = 1.0f / info.numCascades;
+		for (UINT32 i = 0; i < info.numCascades; i++)
+		{
+			rapi.setViewport(Rect2(i * cascadeWidth, 0.0f, cascadeWidth, 1.0f));
+
+			for (auto& casterIdx : mCasters[i])
+			{
+				const RendererObject& caster = renderables[casterIdx];
+				Matrix4 worldViewProj = info.shadowTransforms[i] * caster.renderable->getTransform();
+
+				for (auto& element : caster.elements)
+				{
+					if (!castsShadow(element))
+						continue;
+
+					// Shadow depth shader doesn't decode compressed positions, so apply the decoding with the transform
+					const MeshVertexCompression& compression = element.mesh->getProperties().getVertexCompression();
+					mDepthMat->setPerObjectParams(worldViewProj * compression.getPositionDecodeTransform());
+					gRendererUtility().draw(element.mesh, element.subMesh);
+				}
+			}
+		}
+
+		rapi.setRenderTarget(nullptr);
+		RenderTexturePool::instance().release(depthTex);
+	}
+
+	bool ShadowRenderer::intersectsCascade(const ShadowMapInfo& info, UINT32 cascadeIdx, const Sphere& bounds)
+	{
+		const Sphere& cascadeBounds = info.cascadeBounds[cascadeIdx];
+		if (!info.isDirectional)
+			return cascadeBounds.intersects(bounds);
+
+		Vector3 offset = bounds.getCenter() - cascadeBounds.getCenter();
+		float radius = cascadeBounds.getRadius();
+		float extent = radius + bounds.getRadius();
+
+		if (Math::abs(offset.dot(info.lightRotation.xAxis())) > extent || 
+			Math::abs(offset.dot(info.lightRotation.yAxis())) > extent)
+			return false;
+
+		// Cascade center is snapped by up to half the radius along the light direction
+		float dist = offset.dot(-info.lightRotation.zAxis());
+		return (dist - bounds.getRadius()) <= radius * 1.5f;
+	}
+
+	bool ShadowRenderer::isShadowCaster(const RendererObject& renderable)
+	{
+		for (auto& element : renderable.elements)
+		{
+			if (castsShadow(element))
+				return true;
+		}
+
+		return false;
+	}
+}
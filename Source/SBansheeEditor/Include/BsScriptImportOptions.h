@@ -114,6 +114,18 @@ namespace BansheeEngine
 		static void internal_SetImportBlendShapes(ScriptMeshImportOptions* thisPtr, bool value);
 		static bool internal_GetKeyFrameReduction(ScriptMeshImportOptions* thisPtr);
 		static void internal_SetKeyFrameReduction(ScriptMeshImportOptions* thisPtr, bool value);
+		static bool internal_GetAnimationCompression(ScriptMeshImportOptions* thisPtr);
+		static void internal_SetAnimationCompression(ScriptMeshImportOptions* thisPtr, bool value);
+		static bool internal_GetAnimationBaking(ScriptMeshImportOptions* thisPtr);
+		static void internal_SetAnimationBaking(ScriptMeshImportOptions* thisPtr, bool value);
+		static int internal_GetMeshOptimization(ScriptMeshImportOptions* thisPtr);
+		static void internal_SetMeshOptimization(ScriptMeshImportOptions* thisPtr, int value);
+		static UINT32 internal_GetNumLODs(ScriptMeshImportOptions* thisPtr);
+		static void internal_SetNumLODs(ScriptMeshImportOptions* thisPtr, UINT32 value);
+		static float internal_GetLODReduction(ScriptMeshImportOptions* thisPtr);
+		static void internal_SetLODReduction(ScriptMeshImportOptions* thisPtr, float value);
+		static int internal_GetVertexCompression(ScriptMeshImportOptions* thisPtr);
+		static void internal_SetVertexCompression(ScriptMeshImportOptions* thisPtr, int value);
 		static float internal_GetScale(ScriptMeshImportOptions* thisPtr);
 		static void internal_SetScale(ScriptMeshImportOptions* thisPtr, float value);
 		static int internal_GetCollisionMeshType(ScriptMeshImportOptions* thisPtr);
@@ -210,8 +210,7 @@ namespace BansheeEngine
 
 	void GUIGameObjectField::_updateLayoutInternal(const GUILayoutData& data)
 	{
-		mLayout->_setLayoutData(data);
-		mLayout->_updateLayoutInternal(data);
+		updateChildLayout(mLayout, data);
 	}
 
 	Vector2I GUIGameObjectField::_getOptimalSize() const
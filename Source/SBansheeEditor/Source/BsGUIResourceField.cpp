@@ -258,8 +258,7 @@ namespace BansheeEngine
 
 	void GUIResourceField::_updateLayoutInternal(const GUILayoutData& data)
 	{
-		mLayout->_setLayoutData(data);
-		mLayout->_updateLayoutInternal(data);
+		updateChildLayout(mLayout, data);
 	}
 
 	Vector2I GUIResourceField::_getOptimalSize() const
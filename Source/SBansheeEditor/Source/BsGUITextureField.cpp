@@ -235,8 +235,7 @@ namespace BansheeEngine
 
 	void GUITextureField::_updateLayoutInternal(const GUILayoutData& data)
 	{
-		mLayout->_setLayoutData(data);
-		mLayout->_updateLayoutInternal(data);
+		updateChildLayout(mLayout, data);
 	}
 
 	Vector2I GUITextureField::_getOptimalSize() const
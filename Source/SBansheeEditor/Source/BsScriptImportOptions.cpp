@@ -180,6 +180,18 @@ namespace BansheeEngine
 		metaData.scriptClass->addInternalCall("Internal_SetImportBlendShapes", &ScriptMeshImportOptions::internal_SetImportBlendShapes);
 		metaData.scriptClass->addInternalCall("Internal_GetKeyFrameReduction", &ScriptMeshImportOptions::internal_GetKeyFrameReduction);
 		metaData.scriptClass->addInternalCall("Internal_SetKeyFrameReduction", &ScriptMeshImportOptions::internal_SetKeyFrameReduction);
+		metaData.scriptClass->addInternalCall("Internal_GetAnimationCompression", &ScriptMeshImportOptions::internal_GetAnimationCompression);
+		metaData.scriptClass->addInternalCall("Internal_SetAnimationCompression", &ScriptMeshImportOptions::internal_SetAnimationCompression);
+		metaData.scriptClass->addInternalCall("Internal_GetAnimationBaking", &ScriptMeshImportOptions::internal_GetAnimationBaking);
+		metaData.scriptClass->addInternalCall("Internal_SetAnimationBaking", &ScriptMeshImportOptions::internal_SetAnimationBaking);
+		metaData.scriptClass->addInternalCall("Internal_GetMeshOptimization", &ScriptMeshImportOptions::internal_GetMeshOptimization);
+		metaData.scriptClass->addInternalCall("Internal_SetMeshOptimization", &ScriptMeshImportOptions::internal_SetMeshOptimization);
+		metaData.scriptClass->addInternalCall("Internal_GetNumLODs", &ScriptMeshImportOptions::internal_GetNumLODs);
+		metaData.scriptClass->addInternalCall("Internal_SetNumLODs", &ScriptMeshImportOptions::internal_SetNumLODs);
+		metaData.scriptClass->addInternalCall("Internal_GetLODReduction", &ScriptMeshImportOptions::internal_GetLODReduction);
+		metaData.scriptClass->addInternalCall("Internal_SetLODReduction", &ScriptMeshImportOptions::internal_SetLODReduction);
+		metaData.scriptClass->addInternalCall("Internal_GetVertexCompression", &ScriptMeshImportOptions::internal_GetVertexCompression);
+		metaData.scriptClass->addInternalCall("Internal_SetVertexCompression", &ScriptMeshImportOptions::internal_SetVertexCompression);
 		metaData.scriptClass->addInternalCall("Internal_GetScale", &ScriptMeshImportOptions::internal_GetScale);
 		metaData.scriptClass->addInternalCall("Internal_SetScale", &ScriptMeshImportOptions::internal_SetScale);
 		metaData.scriptClass->addInternalCall("Internal_GetCollisionMeshType", &ScriptMeshImportOptions::internal_GetCollisionMeshType);
@@ -284,6 +296,66 @@ namespace BansheeEngine
 		thisPtr->getMeshImportOptions()->setKeyFrameReduction(value);
 	}
 
+	bool ScriptMeshImportOptions::internal_GetAnimationCompression(ScriptMeshImportOptions* thisPtr)
+	{
+		return thisPtr->getMeshImportOptions()->getAnimationCompression();
+	}
+
+	void ScriptMeshImportOptions::internal_SetAnimationCompression(ScriptMeshImportOptions* thisPtr, bool value)
+	{
+		thisPtr->getMeshImportOptions()->setAnimationCompression(value);
+	}
+
+	bool ScriptMeshImportOptions::internal_GetAnimationBaking(ScriptMeshImportOptions* thisPtr)
+	{
+		return thisPtr->getMeshImportOptions()->getAnimationBaking();
+	}
+
+	void ScriptMeshImportOptions::internal_SetAnimationBaking(ScriptMeshImportOptions* thisPtr, bool value)
+	{
+		thisPtr->getMeshImportOptions()->setAnimationBaking(value);
+	}
+
+	int ScriptMeshImportOptions::internal_GetMeshOptimization(ScriptMeshImportOptions* thisPtr)
+	{
+		return (int)(UINT32)thisPtr->getMeshImportOptions()->getMeshOptimization();
+	}
+
+	void ScriptMeshImportOptions::internal_SetMeshOptimization(ScriptMeshImportOptions* thisPtr, int value)
+	{
+		thisPtr->getMeshImportOptions()->setMeshOptimization(MeshOptimizeFlags((UINT32)value));
+	}
+
+	UINT32 ScriptMeshImportOptions::internal_GetNumLODs(ScriptMeshImportOptions* thisPtr)
+	{
+		return thisPtr->getMeshImportOptions()->getNumLODs();
+	}
+
+	void ScriptMeshImportOptions::internal_SetNumLODs(ScriptMeshImportOptions* thisPtr, UINT32 value)
+	{
+		thisPtr->getMeshImportOptions()->setNumLODs(value);
+	}
+
+	float ScriptMeshImportOptions::internal_GetLODReduction(ScriptMeshImportOptions* thisPtr)
+	{
+		return thisPtr->getMeshImportOptions()->getLODReduction();
+	}
+
+	void ScriptMeshImportOptions::internal_SetLODReduction(ScriptMeshImportOptions* thisPtr, float value)
+	{
+		thisPtr->getMeshImportOptions()->setLODReduction(value);
+	}
+
+	int ScriptMeshImportOptions::internal_GetVertexCompression(ScriptMeshImportOptions* thisPtr)
+	{
+		return (int)(UINT32)thisPtr->getMeshImportOptions()->getVertexCompression();
+	}
+
+	void ScriptMeshImportOptions::internal_SetVertexCompression(ScriptMeshImportOptions* thisPtr, int value)
+	{
+		thisPtr->getMeshImportOptions()->setVertexCompression(VertexCompressionFlags((UINT32)value));
+	}
+
 	float ScriptMeshImportOptions::internal_GetScale(ScriptMeshImportOptions* thisPtr)
 	{
 		return thisPtr->getMeshImportOptions()->getImportScale();
@@ -107,7 +107,7 @@ namespace BansheeEngine
 
 		for(UINT32 i = 0; i < numPosCurves; i++)
 		{
-			MonoObject* monoCurve = ScriptNamedVector3Curve::toManaged(curves->position[i]);
+			MonoObject* monoCurve = ScriptNamedVector3Curve::toManaged(curves->getPositionCurve(i));
 			scriptPositionCurves.set(i, monoCurve);
 		}
 
@@ -116,9 +116,11 @@ namespace BansheeEngine
 
 		for (UINT32 i = 0; i < numRotCurves; i++)
 		{
+			TNamedAnimationCurve<Quaternion> quatRotationCurve = curves->getRotationCurve(i);
+
 			TNamedAnimationCurve<Vector3> eulerRotationCurve;
-			eulerRotationCurve.name = curves->rotation[i].name;
-			eulerRotationCurve.curve = AnimationUtility::quaternionToEulerCurve(curves->rotation[i].curve);
+			eulerRotationCurve.name = quatRotationCurve.name;
+			eulerRotationCurve.curve = AnimationUtility::quaternionToEulerCurve(quatRotationCurve.curve);
 
 			MonoObject* monoCurve = ScriptNamedVector3Curve::toManaged(eulerRotationCurve);
 			scriptRotationCurves.set(i, monoCurve);
@@ -129,7 +131,7 @@ namespace BansheeEngine
 
 		for (UINT32 i = 0; i < numScaleCurves; i++)
 		{
-			MonoObject* monoCurve = ScriptNamedVector3Curve::toManaged(curves->scale[i]);
+			MonoObject* monoCurve = ScriptNamedVector3Curve::toManaged(curves->getScaleCurve(i));
 			scriptScaleCurves.set(i, monoCurve);
 		}
 